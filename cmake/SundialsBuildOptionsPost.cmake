@@ -20,16 +20,10 @@
 # available in CVODE.
 # ---------------------------------------------------------------
 
-if(ENABLE_CUDA OR ENABLE_HIP)
-  set(CUDA_OR_HIP TRUE)
-else()
-  set(CUDA_OR_HIP FALSE)
-endif()
-
 sundials_option(
   SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS BOOL
-  "Build specialized fused GPU kernels" OFF
-  DEPENDS_ON BUILD_CVODE CUDA_OR_HIP
+  "Build specialized fused CPU and GPU kernels" OFF
+  DEPENDS_ON BUILD_CVODE
   DEPENDS_ON_THROW_ERROR)
 
 # ---------------------------------------------------------------
@@ -62,6 +56,14 @@ sundials_option(BUILD_NVECTOR_MANYVECTOR BOOL
                 "Build the NVECTOR_MANYVECTOR module" ON ADVANCED)
 list(APPEND SUNDIALS_BUILD_LIST "BUILD_NVECTOR_MANYVECTOR")
 
+sundials_option(BUILD_NVECTOR_MIXED BOOL "Build the NVECTOR_MIXED module" ON
+                ADVANCED)
+list(APPEND SUNDIALS_BUILD_LIST "BUILD_NVECTOR_MIXED")
+
+sundials_option(BUILD_NVECTOR_ENSEMBLE BOOL "Build the NVECTOR_ENSEMBLE module"
+                ON ADVANCED)
+list(APPEND SUNDIALS_BUILD_LIST "BUILD_NVECTOR_ENSEMBLE")
+
 sundials_option(
   BUILD_NVECTOR_MPIMANYVECTOR BOOL
   "Build the NVECTOR_MPIMANYVECTOR module (requires MPI)" ON
@@ -134,6 +136,17 @@ sundials_option(
   ADVANCED)
 list(APPEND SUNDIALS_BUILD_LIST "BUILD_NVECTOR_KOKKOS")
 
+sundials_option(
+  BUILD_NVECTOR_STDPAR BOOL
+  "Build the NVECTOR_STDPAR module (requires C++17 parallel algorithms)" OFF
+  ADVANCED)
+list(APPEND SUNDIALS_BUILD_LIST "BUILD_NVECTOR_STDPAR")
+
+sundials_option(
+  BUILD_NVECTOR_MMAP BOOL
+  "Build the NVECTOR_MMAP module (requires POSIX mmap)" OFF ADVANCED)
+list(APPEND SUNDIALS_BUILD_LIST "BUILD_NVECTOR_MMAP")
+
 # ---------------------------------------------------------------
 # Options to enable/disable build for SUNMATRIX modules.
 # ---------------------------------------------------------------
@@ -433,7 +433,8 @@ if(BUILD_BENCHMARKS
    OR ENABLE_MAGMA
    OR ENABLE_GINKGO
    OR ENABLE_KOKKOS
-   OR ENABLE_ADIAK)
+   OR ENABLE_ADIAK
+   OR BUILD_NVECTOR_STDPAR)
   include(SundialsSetupCXX)
 endif()
 
@@ -97,6 +97,10 @@ SUNDIALS_EXPORT int ARKodeSetMassLinearSolver(void* arkode_mem,
 /* Linear solver interface optional input functions -- must be called
    AFTER ARKodeSetLinearSolver and/or ARKodeSetMassLinearSolver */
 SUNDIALS_EXPORT int ARKodeSetJacFn(void* arkode_mem, ARKLsJacFn jac);
+SUNDIALS_EXPORT int ARKodeSetJacSparsity(void* arkode_mem, SUNMatrix S);
+SUNDIALS_EXPORT int ARKodeComputeJacSparsity(void* arkode_mem, sunrealtype t,
+                                             N_Vector y, int sparsetype,
+                                             SUNMatrix* S);
 SUNDIALS_EXPORT int ARKodeSetMassFn(void* arkode_mem, ARKLsMassFn mass);
 SUNDIALS_EXPORT int ARKodeSetJacEvalFrequency(void* arkode_mem, long int msbj);
 SUNDIALS_EXPORT int ARKodeSetLinearSolutionScaling(void* arkode_mem,
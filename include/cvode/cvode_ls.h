@@ -84,6 +84,10 @@ SUNDIALS_EXPORT int CVodeSetLinearSolver(void* cvode_mem, SUNLinearSolver LS,
   -----------------------------------------------------------------*/
 
 SUNDIALS_EXPORT int CVodeSetJacFn(void* cvode_mem, CVLsJacFn jac);
+SUNDIALS_EXPORT int CVodeSetJacSparsity(void* cvode_mem, SUNMatrix S);
+SUNDIALS_EXPORT int CVodeComputeJacSparsity(void* cvode_mem, sunrealtype t,
+                                            N_Vector y, int sparsetype,
+                                            SUNMatrix* S);
 SUNDIALS_EXPORT int CVodeSetJacEvalFrequency(void* cvode_mem, long int msbj);
 SUNDIALS_EXPORT int CVodeSetLinearSolutionScaling(void* cvode_mem,
                                                   sunbooleantype onoff);
@@ -81,6 +81,10 @@ SUNDIALS_EXPORT int IDASetLinearSolver(void* ida_mem, SUNLinearSolver LS,
   -----------------------------------------------------------------*/
 
 SUNDIALS_EXPORT int IDASetJacFn(void* ida_mem, IDALsJacFn jac);
+SUNDIALS_EXPORT int IDASetJacSparsity(void* ida_mem, SUNMatrix S);
+SUNDIALS_EXPORT int IDAComputeJacSparsity(void* ida_mem, sunrealtype t,
+                                          N_Vector yy, N_Vector yp,
+                                          int sparsetype, SUNMatrix* S);
 SUNDIALS_EXPORT int IDASetPreconditioner(void* ida_mem, IDALsPrecSetupFn pset,
                                          IDALsPrecSolveFn psolve);
 SUNDIALS_EXPORT int IDASetJacTimes(void* ida_mem, IDALsJacTimesSetupFn jtsetup,
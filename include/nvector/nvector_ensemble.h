@@ -0,0 +1,232 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the header file for the ensemble implementation of the
+ * NVECTOR module. An ensemble vector holds the states of a number
+ * of independent systems of the same size.
+ *
+ * Notes:
+ *
+ *   - The data is stored interleaved (structure-of-arrays), i.e.,
+ *     component i of system s is stored at data[i * num_systems + s],
+ *     so the same component of all systems is contiguous.
+ *
+ *   - The standard vector operations act on the whole ensemble. The
+ *     functions with the PerSystem suffix return one value for each
+ *     system.
+ *
+ *   - N_Vector arguments to arithmetic vector operations need not
+ *     be distinct. For example, the following call:
+ *
+ *       N_VLinearSum_Ensemble(a,x,b,y,y);
+ *
+ *     (which stores the result of the operation a*x+b*y in y)
+ *     is legal.
+ * -----------------------------------------------------------------*/
+
+#ifndef _NVECTOR_ENSEMBLE_H
+#define _NVECTOR_ENSEMBLE_H
+
+#include <stdio.h>
+#include <sundials/sundials_nvector.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/*
+ * -----------------------------------------------------------------
+ * Ensemble implementation of N_Vector
+ * -----------------------------------------------------------------
+ */
+
+struct _N_VectorContent_Ensemble
+{
+  sunindextype num_systems;   /* number of systems              */
+  sunindextype system_length; /* length of each system          */
+  sunindextype length;        /* total vector length            */
+  sunbooleantype own_data;    /* data ownership flag            */
+  sunrealtype* data;          /* interleaved data array         */
+};
+
+typedef struct _N_VectorContent_Ensemble* N_VectorContent_Ensemble;
+
+/*
+ * -----------------------------------------------------------------
+ * Macros NV_CONTENT_EN, NV_DATA_EN, NV_OWN_DATA_EN, NV_LENGTH_EN,
+ *        NV_NUM_SYSTEMS_EN, NV_SYSTEM_LENGTH_EN, NV_Ith_EN, and
+ *        NV_SYS_Ith_EN
+ * -----------------------------------------------------------------
+ */
+
+#define NV_CONTENT_EN(v) ((N_VectorContent_Ensemble)(v->content))
+
+#define NV_LENGTH_EN(v) (NV_CONTENT_EN(v)->length)
+
+#define NV_NUM_SYSTEMS_EN(v) (NV_CONTENT_EN(v)->num_systems)
+
+#define NV_SYSTEM_LENGTH_EN(v) (NV_CONTENT_EN(v)->system_length)
+
+#define NV_OWN_DATA_EN(v) (NV_CONTENT_EN(v)->own_data)
+
+#define NV_DATA_EN(v) (NV_CONTENT_EN(v)->data)
+
+#define NV_Ith_EN(v, i) (NV_DATA_EN(v)[i])
+
+#define NV_SYS_Ith_EN(v, s, i) (NV_DATA_EN(v)[(i) * NV_NUM_SYSTEMS_EN(v) + (s)])
+
+/*
+ * -----------------------------------------------------------------
+ * Functions exported by nvector_ensemble
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_EXPORT
+N_Vector N_VNewEmpty_Ensemble(sunindextype num_systems,
+                              sunindextype system_length, SUNContext sunctx);
+
+SUNDIALS_EXPORT
+N_Vector N_VNew_Ensemble(sunindextype num_systems, sunindextype system_length,
+                         SUNContext sunctx);
+
+SUNDIALS_EXPORT
+N_Vector N_VMake_Ensemble(sunindextype num_systems, sunindextype system_length,
+                          sunrealtype* v_data, SUNContext sunctx);
+
+SUNDIALS_EXPORT
+sunindextype N_VGetLength_Ensemble(N_Vector v);
+
+SUNDIALS_EXPORT
+sunindextype N_VGetNumSystems_Ensemble(N_Vector v);
+
+SUNDIALS_EXPORT
+sunindextype N_VGetSystemLength_Ensemble(N_Vector v);
+
+SUNDIALS_EXPORT
+void N_VPrint_Ensemble(N_Vector v);
+
+SUNDIALS_EXPORT
+void N_VPrintFile_Ensemble(N_Vector v, FILE* outfile);
+
+SUNDIALS_EXPORT
+N_Vector_ID N_VGetVectorID_Ensemble(N_Vector v);
+
+SUNDIALS_EXPORT
+N_Vector N_VCloneEmpty_Ensemble(N_Vector w);
+
+SUNDIALS_EXPORT
+N_Vector N_VClone_Ensemble(N_Vector w);
+
+SUNDIALS_EXPORT
+void N_VDestroy_Ensemble(N_Vector v);
+
+SUNDIALS_EXPORT
+sunrealtype* N_VGetArrayPointer_Ensemble(N_Vector v);
+
+SUNDIALS_EXPORT
+void N_VSetArrayPointer_Ensemble(sunrealtype* v_data, N_Vector v);
+
+/* standard vector operations */
+SUNDIALS_EXPORT
+void N_VLinearSum_Ensemble(sunrealtype a, N_Vector x, sunrealtype b,
+                           N_Vector y, N_Vector z);
+SUNDIALS_EXPORT
+void N_VConst_Ensemble(sunrealtype c, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VProd_Ensemble(N_Vector x, N_Vector y, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VDiv_Ensemble(N_Vector x, N_Vector y, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VScale_Ensemble(sunrealtype c, N_Vector x, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VAbs_Ensemble(N_Vector x, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VInv_Ensemble(N_Vector x, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VAddConst_Ensemble(N_Vector x, sunrealtype b, N_Vector z);
+
+SUNDIALS_EXPORT
+sunrealtype N_VDotProd_Ensemble(N_Vector x, N_Vector y);
+
+SUNDIALS_EXPORT
+sunrealtype N_VMaxNorm_Ensemble(N_Vector x);
+
+SUNDIALS_EXPORT
+sunrealtype N_VWrmsNorm_Ensemble(N_Vector x, N_Vector w);
+
+SUNDIALS_EXPORT
+sunrealtype N_VWrmsNormMask_Ensemble(N_Vector x, N_Vector w, N_Vector id);
+
+SUNDIALS_EXPORT
+sunrealtype N_VMin_Ensemble(N_Vector x);
+
+SUNDIALS_EXPORT
+sunrealtype N_VWL2Norm_Ensemble(N_Vector x, N_Vector w);
+
+SUNDIALS_EXPORT
+sunrealtype N_VL1Norm_Ensemble(N_Vector x);
+
+SUNDIALS_EXPORT
+void N_VCompare_Ensemble(sunrealtype c, N_Vector x, N_Vector z);
+
+SUNDIALS_EXPORT
+sunbooleantype N_VInvTest_Ensemble(N_Vector x, N_Vector z);
+
+SUNDIALS_EXPORT
+sunbooleantype N_VConstrMask_Ensemble(N_Vector c, N_Vector x, N_Vector m);
+
+SUNDIALS_EXPORT
+sunrealtype N_VMinQuotient_Ensemble(N_Vector num, N_Vector denom);
+
+/* per-system reduction operations */
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdPerSystem_Ensemble(N_Vector x, N_Vector y,
+                                        sunrealtype* dotprods);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VMaxNormPerSystem_Ensemble(N_Vector x, sunrealtype* nrm);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VWrmsNormPerSystem_Ensemble(N_Vector x, N_Vector w,
+                                         sunrealtype* nrm);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VWrmsNormMaskPerSystem_Ensemble(N_Vector x, N_Vector w,
+                                             N_Vector id, sunrealtype* nrm);
+
+/* local reduction kernels */
+SUNDIALS_EXPORT
+sunrealtype N_VWSqrSumLocal_Ensemble(N_Vector x, N_Vector w);
+
+SUNDIALS_EXPORT
+sunrealtype N_VWSqrSumMaskLocal_Ensemble(N_Vector x, N_Vector w, N_Vector id);
+
+/* OPTIONAL XBraid interface operations */
+SUNDIALS_EXPORT
+SUNErrCode N_VBufSize_Ensemble(N_Vector x, sunindextype* size);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VBufPack_Ensemble(N_Vector x, void* buf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VBufUnpack_Ensemble(N_Vector x, void* buf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -54,6 +54,7 @@ struct _N_VectorContent_ManyVector
   sunindextype global_length;  /* overall global manyvector length */
   N_Vector* subvec_array;      /* pointer to N_Vector array        */
   sunbooleantype own_data;     /* flag indicating data ownership   */
+  int num_threads;             /* threads operating on subvectors  */
 };
 
 typedef struct _N_VectorContent_ManyVector* N_VectorContent_ManyVector;
@@ -80,6 +81,12 @@ SUNErrCode N_VSetSubvectorArrayPointer_ManyVector(sunrealtype* v_data, N_Vector
 SUNDIALS_EXPORT
 sunindextype N_VGetNumSubvectors_ManyVector(N_Vector v);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VSetNumThreads_ManyVector(N_Vector v, int num_threads);
+
+SUNDIALS_EXPORT
+int N_VGetNumThreads_ManyVector(N_Vector v);
+
 /* standard vector operations */
 
 SUNDIALS_EXPORT
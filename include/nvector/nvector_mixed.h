@@ -0,0 +1,202 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the header file for the mixed precision implementation of
+ * the NVECTOR module.
+ *
+ * Notes:
+ *
+ *   - The vector data is stored in single precision (float) while
+ *     operations compute in sunrealtype and reductions accumulate
+ *     in (at least) double precision.
+ *
+ *   - Since the data is not stored as sunrealtype, the vector does
+ *     not provide N_VGetArrayPointer. The data is accessed with the
+ *     macros NV_DATA_MX and NV_Ith_MX instead.
+ *
+ *   - When SUNDIALS is built with OpenMP enabled, operations are
+ *     threaded with the number of threads given to the constructor.
+ *     Otherwise the number of threads is ignored.
+ *
+ *   - N_Vector arguments to arithmetic vector operations need not
+ *     be distinct. For example, the following call:
+ *
+ *       N_VLinearSum_Mixed(a,x,b,y,y);
+ *
+ *     (which stores the result of the operation a*x+b*y in y)
+ *     is legal.
+ * -----------------------------------------------------------------*/
+
+#ifndef _NVECTOR_MIXED_H
+#define _NVECTOR_MIXED_H
+
+#include <stdio.h>
+#include <sundials/sundials_nvector.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/*
+ * -----------------------------------------------------------------
+ * Mixed precision implementation of N_Vector
+ * -----------------------------------------------------------------
+ */
+
+struct _N_VectorContent_Mixed
+{
+  sunindextype length;     /* vector length                  */
+  sunbooleantype own_data; /* data ownership flag            */
+  float* data;             /* single precision data array    */
+  int num_threads;         /* number of OpenMP threads       */
+};
+
+typedef struct _N_VectorContent_Mixed* N_VectorContent_Mixed;
+
+/*
+ * -----------------------------------------------------------------
+ * Macros NV_CONTENT_MX, NV_DATA_MX, NV_OWN_DATA_MX,
+ *        NV_LENGTH_MX, NV_NUM_THREADS_MX, and NV_Ith_MX
+ * -----------------------------------------------------------------
+ */
+
+#define NV_CONTENT_MX(v) ((N_VectorContent_Mixed)(v->content))
+
+#define NV_LENGTH_MX(v) (NV_CONTENT_MX(v)->length)
+
+#define NV_NUM_THREADS_MX(v) (NV_CONTENT_MX(v)->num_threads)
+
+#define NV_OWN_DATA_MX(v) (NV_CONTENT_MX(v)->own_data)
+
+#define NV_DATA_MX(v) (NV_CONTENT_MX(v)->data)
+
+#define NV_Ith_MX(v, i) (NV_DATA_MX(v)[i])
+
+/*
+ * -----------------------------------------------------------------
+ * Functions exported by nvector_mixed
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_EXPORT
+N_Vector N_VNewEmpty_Mixed(sunindextype vec_length, int num_threads,
+                           SUNContext sunctx);
+
+SUNDIALS_EXPORT
+N_Vector N_VNew_Mixed(sunindextype vec_length, int num_threads,
+                      SUNContext sunctx);
+
+SUNDIALS_EXPORT
+N_Vector N_VMake_Mixed(sunindextype vec_length, float* v_data,
+                       int num_threads, SUNContext sunctx);
+
+SUNDIALS_EXPORT
+sunindextype N_VGetLength_Mixed(N_Vector v);
+
+SUNDIALS_EXPORT
+void N_VPrint_Mixed(N_Vector v);
+
+SUNDIALS_EXPORT
+void N_VPrintFile_Mixed(N_Vector v, FILE* outfile);
+
+SUNDIALS_EXPORT
+N_Vector_ID N_VGetVectorID_Mixed(N_Vector v);
+
+SUNDIALS_EXPORT
+N_Vector N_VCloneEmpty_Mixed(N_Vector w);
+
+SUNDIALS_EXPORT
+N_Vector N_VClone_Mixed(N_Vector w);
+
+SUNDIALS_EXPORT
+void N_VDestroy_Mixed(N_Vector v);
+
+/* standard vector operations */
+SUNDIALS_EXPORT
+void N_VLinearSum_Mixed(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
+                        N_Vector z);
+SUNDIALS_EXPORT
+void N_VConst_Mixed(sunrealtype c, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VProd_Mixed(N_Vector x, N_Vector y, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VDiv_Mixed(N_Vector x, N_Vector y, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VScale_Mixed(sunrealtype c, N_Vector x, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VAbs_Mixed(N_Vector x, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VInv_Mixed(N_Vector x, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VAddConst_Mixed(N_Vector x, sunrealtype b, N_Vector z);
+
+SUNDIALS_EXPORT
+sunrealtype N_VDotProd_Mixed(N_Vector x, N_Vector y);
+
+SUNDIALS_EXPORT
+sunrealtype N_VMaxNorm_Mixed(N_Vector x);
+
+SUNDIALS_EXPORT
+sunrealtype N_VWrmsNorm_Mixed(N_Vector x, N_Vector w);
+
+SUNDIALS_EXPORT
+sunrealtype N_VWrmsNormMask_Mixed(N_Vector x, N_Vector w, N_Vector id);
+
+SUNDIALS_EXPORT
+sunrealtype N_VMin_Mixed(N_Vector x);
+
+SUNDIALS_EXPORT
+sunrealtype N_VWL2Norm_Mixed(N_Vector x, N_Vector w);
+
+SUNDIALS_EXPORT
+sunrealtype N_VL1Norm_Mixed(N_Vector x);
+
+SUNDIALS_EXPORT
+void N_VCompare_Mixed(sunrealtype c, N_Vector x, N_Vector z);
+
+SUNDIALS_EXPORT
+sunbooleantype N_VInvTest_Mixed(N_Vector x, N_Vector z);
+
+SUNDIALS_EXPORT
+sunbooleantype N_VConstrMask_Mixed(N_Vector c, N_Vector x, N_Vector m);
+
+SUNDIALS_EXPORT
+sunrealtype N_VMinQuotient_Mixed(N_Vector num, N_Vector denom);
+
+/* local reduction kernels */
+
+SUNDIALS_EXPORT
+sunrealtype N_VWSqrSumLocal_Mixed(N_Vector x, N_Vector w);
+
+SUNDIALS_EXPORT
+sunrealtype N_VWSqrSumMaskLocal_Mixed(N_Vector x, N_Vector w, N_Vector id);
+
+/* OPTIONAL XBraid interface operations */
+SUNDIALS_EXPORT
+SUNErrCode N_VBufSize_Mixed(N_Vector x, sunindextype* size);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VBufPack_Mixed(N_Vector x, void* buf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VBufUnpack_Mixed(N_Vector x, void* buf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
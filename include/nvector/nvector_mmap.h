@@ -0,0 +1,131 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the header file for the memory-mapped (out-of-core)
+ * implementation of the NVECTOR module.
+ *
+ * Notes:
+ *
+ *   - The vector data is a shared memory mapping of a file, so the
+ *     operating system pages it between memory and the file system
+ *     on demand. Vectors that are not in use (e.g., stored
+ *     trajectories or sensitivities) can therefore be larger than
+ *     the available memory when the files are on fast local storage.
+ *
+ *   - The mappings are advised for sequential access so the kernel
+ *     reads ahead while the operations stream through the data.
+ *
+ *   - An mmap vector is a serial vector whose data is mapped, so
+ *     the vector operations, the N_VEnable*_Serial functions, and
+ *     the NV_*_S macros of nvector_serial.h apply to it. Only the
+ *     constructors, the destructor, and the functions that replace
+ *     the data are specific to the mmap vector.
+ * -----------------------------------------------------------------*/
+
+#ifndef _NVECTOR_MMAP_H
+#define _NVECTOR_MMAP_H
+
+#include <nvector/nvector_serial.h>
+#include <sundials/sundials_nvector.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/*
+ * -----------------------------------------------------------------
+ * MMAP implementation of N_Vector
+ * -----------------------------------------------------------------
+ */
+
+struct _N_VectorContent_Mmap
+{
+  struct _N_VectorContent_Serial serial; /* serial content, must be first  */
+  size_t map_size; /* bytes mapped, 0 if data not mapped                  */
+  char* dir;       /* directory for the files of clones                   */
+};
+
+typedef struct _N_VectorContent_Mmap* N_VectorContent_Mmap;
+
+/*
+ * -----------------------------------------------------------------
+ * Macros NV_CONTENT_MM, NV_DATA_MM, NV_OWN_DATA_MM,
+ *        NV_LENGTH_MM, NV_MAP_SIZE_MM, NV_DIR_MM, and NV_Ith_MM
+ * -----------------------------------------------------------------
+ */
+
+#define NV_CONTENT_MM(v) ((N_VectorContent_Mmap)(v->content))
+
+#define NV_LENGTH_MM(v) (NV_CONTENT_MM(v)->serial.length)
+
+#define NV_OWN_DATA_MM(v) (NV_CONTENT_MM(v)->serial.own_data)
+
+#define NV_DATA_MM(v) (NV_CONTENT_MM(v)->serial.data)
+
+#define NV_MAP_SIZE_MM(v) (NV_CONTENT_MM(v)->map_size)
+
+#define NV_DIR_MM(v) (NV_CONTENT_MM(v)->dir)
+
+#define NV_Ith_MM(v, i) (NV_DATA_MM(v)[i])
+
+/*
+ * -----------------------------------------------------------------
+ * Functions exported by nvector_mmap
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_EXPORT
+N_Vector N_VNewEmpty_Mmap(sunindextype vec_length, SUNContext sunctx);
+
+SUNDIALS_EXPORT
+N_Vector N_VNew_Mmap(sunindextype vec_length, const char* dir,
+                     SUNContext sunctx);
+
+SUNDIALS_EXPORT
+N_Vector N_VNewFile_Mmap(sunindextype vec_length, const char* filename,
+                         SUNContext sunctx);
+
+SUNDIALS_EXPORT
+N_Vector N_VMake_Mmap(sunindextype vec_length, sunrealtype* v_data,
+                      SUNContext sunctx);
+
+SUNDIALS_EXPORT
+N_Vector_ID N_VGetVectorID_Mmap(N_Vector v);
+
+SUNDIALS_EXPORT
+N_Vector N_VCloneEmpty_Mmap(N_Vector w);
+
+SUNDIALS_EXPORT
+N_Vector N_VClone_Mmap(N_Vector w);
+
+SUNDIALS_EXPORT
+void N_VDestroy_Mmap(N_Vector v);
+
+SUNDIALS_EXPORT
+N_Vector* N_VCloneVectorArrayContiguous_Mmap(int count, N_Vector w);
+
+SUNDIALS_EXPORT
+void N_VSetArrayPointer_Mmap(sunrealtype* v_data, N_Vector v);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VSync_Mmap(N_Vector v);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VPrefetch_Mmap(N_Vector v);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VRelease_Mmap(N_Vector v);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
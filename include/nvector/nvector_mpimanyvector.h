@@ -57,6 +57,7 @@ struct _N_VectorContent_MPIManyVector
   sunindextype global_length;  /* overall global manyvector length */
   N_Vector* subvec_array;      /* pointer to N_Vector array        */
   sunbooleantype own_data;     /* flag indicating data ownership   */
+  MPI_Request request;         /* pending non-blocking reduction   */
 };
 
 typedef struct _N_VectorContent_MPIManyVector* N_VectorContent_MPIManyVector;
@@ -198,6 +199,14 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMultiAllReduce_MPIManyVector(int nvec_total, N_Vector x,
                                                   sunrealtype* sum);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMultiAllReduceBegin_MPIManyVector(int nvec_total,
+                                                       N_Vector x,
+                                                       sunrealtype* sum);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMultiAllReduceEnd_MPIManyVector(N_Vector x);
+
 /* vector array operations */
 SUNDIALS_EXPORT
 SUNErrCode N_VLinearSumVectorArray_MPIManyVector(int nvec, sunrealtype a,
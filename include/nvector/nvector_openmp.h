@@ -55,12 +55,20 @@ extern "C" {
  * -----------------------------------------------------------------
  */
 
+/* Recorder for deferred operations shared by a vector and its clones. The
+   structure is private to the implementation. */
+
+struct _SUNDeferredOps;
+
 struct _N_VectorContent_OpenMP
 {
-  sunindextype length;     /* vector length            */
-  sunbooleantype own_data; /* data ownership flag      */
-  sunrealtype* data;       /* data array               */
-  int num_threads;         /* number of OpenMP threads */
+  sunindextype length;              /* vector length               */
+  sunbooleantype own_data;          /* data ownership flag         */
+  sunrealtype* data;                /* data array                  */
+  int num_threads;                  /* number of OpenMP threads    */
+  SUNAffinity affinity;             /* thread affinity policy      */
+  struct _SUNDeferredOps* deferred; /* deferred operations or NULL */
+  sunbooleantype reproducible;      /* reproducible reductions     */
 };
 
 typedef struct _N_VectorContent_OpenMP* N_VectorContent_OpenMP;
@@ -78,6 +86,10 @@ typedef struct _N_VectorContent_OpenMP* N_VectorContent_OpenMP;
 
 #define NV_NUM_THREADS_OMP(v) (NV_CONTENT_OMP(v)->num_threads)
 
+#define NV_AFFINITY_OMP(v) (NV_CONTENT_OMP(v)->affinity)
+
+#define NV_REPRODUCIBLE_OMP(v) (NV_CONTENT_OMP(v)->reproducible)
+
 #define NV_OWN_DATA_OMP(v) (NV_CONTENT_OMP(v)->own_data)
 
 #define NV_DATA_OMP(v) (NV_CONTENT_OMP(v)->data)
@@ -94,6 +106,10 @@ SUNDIALS_EXPORT
 N_Vector N_VNew_OpenMP(sunindextype vec_length, int num_threads,
                        SUNContext sunctx);
 
+SUNDIALS_EXPORT
+N_Vector N_VNewWithAffinity_OpenMP(sunindextype vec_length, int num_threads,
+                                   SUNAffinity affinity, SUNContext sunctx);
+
 SUNDIALS_EXPORT
 N_Vector N_VNewEmpty_OpenMP(sunindextype vec_length, int num_threads,
                             SUNContext sunctx);
@@ -102,6 +118,10 @@ SUNDIALS_EXPORT
 N_Vector N_VMake_OpenMP(sunindextype vec_length, sunrealtype* v_data,
                         int num_threads, SUNContext sunctx);
 
+SUNDIALS_EXPORT
+N_Vector N_VMakeView_OpenMP(N_Vector w, sunindextype offset,
+                            sunindextype vec_length);
+
 SUNDIALS_EXPORT
 sunindextype N_VGetLength_OpenMP(N_Vector v);
 
@@ -120,6 +140,9 @@ N_Vector N_VCloneEmpty_OpenMP(N_Vector w);
 SUNDIALS_EXPORT
 N_Vector N_VClone_OpenMP(N_Vector w);
 
+SUNDIALS_EXPORT
+N_Vector* N_VCloneVectorArrayContiguous_OpenMP(int count, N_Vector w);
+
 SUNDIALS_EXPORT
 void N_VDestroy_OpenMP(N_Vector v);
 
@@ -206,6 +229,16 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti_OpenMP(int nvec, N_Vector x, N_Vector* Y,
                                   sunrealtype* dotprods);
 
+SUNDIALS_EXPORT
+sunrealtype N_VLinearSumWrmsNorm_OpenMP(sunrealtype a, N_Vector x,
+                                        sunrealtype b, N_Vector y, N_Vector z,
+                                        N_Vector w);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWrmsNorm_OpenMP(int nvec, sunrealtype* c,
+                                               N_Vector* X, N_Vector z,
+                                               N_Vector w, sunrealtype* nrm);
+
 /* vector array operations */
 
 SUNDIALS_EXPORT
@@ -272,6 +305,13 @@ SUNErrCode N_VEnableScaleAddMulti_OpenMP(N_Vector v, sunbooleantype tf);
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableDotProdMulti_OpenMP(N_Vector v, sunbooleantype tf);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableLinearSumWrmsNorm_OpenMP(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableLinearCombinationWrmsNorm_OpenMP(N_Vector v,
+                                                     sunbooleantype tf);
+
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableLinearSumVectorArray_OpenMP(N_Vector v, sunbooleantype tf);
 
@@ -295,6 +335,22 @@ SUNDIALS_EXPORT
 SUNErrCode N_VEnableLinearCombinationVectorArray_OpenMP(N_Vector v,
                                                         sunbooleantype tf);
 
+/*
+ * -----------------------------------------------------------------
+ * Enable / disable and execute deferred vector operations
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableDeferredOps_OpenMP(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VFlushDeferredOps_OpenMP(N_Vector v);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableReproducibleReductions_OpenMP(N_Vector v,
+                                                  sunbooleantype tf);
+
 #ifdef __cplusplus
 }
 #endif
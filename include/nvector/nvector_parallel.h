@@ -61,6 +61,7 @@ struct _N_VectorContent_Parallel
   sunbooleantype own_data;    /* ownership of data           */
   sunrealtype* data;          /* local data array            */
   MPI_Comm comm;              /* pointer to MPI communicator */
+  MPI_Request request;        /* pending non-blocking reduce */
 };
 
 typedef struct _N_VectorContent_Parallel* N_VectorContent_Parallel;
@@ -126,6 +127,9 @@ N_Vector N_VCloneEmpty_Parallel(N_Vector w);
 SUNDIALS_EXPORT
 N_Vector N_VClone_Parallel(N_Vector w);
 
+SUNDIALS_EXPORT
+N_Vector* N_VCloneVectorArrayContiguous_Parallel(int count, N_Vector w);
+
 SUNDIALS_EXPORT
 void N_VDestroy_Parallel(N_Vector v);
 
@@ -214,6 +218,16 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti_Parallel(int nvec, N_Vector x, N_Vector* Y,
                                     sunrealtype* dotprods);
 
+SUNDIALS_EXPORT
+sunrealtype N_VLinearSumWrmsNorm_Parallel(sunrealtype a, N_Vector x,
+                                          sunrealtype b, N_Vector y, N_Vector z,
+                                          N_Vector w);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWrmsNorm_Parallel(int nvec, sunrealtype* c,
+                                                 N_Vector* X, N_Vector z,
+                                                 N_Vector w, sunrealtype* nrm);
+
 /* vector array operations */
 SUNDIALS_EXPORT
 SUNErrCode N_VLinearSumVectorArray_Parallel(int nvec, sunrealtype a,
@@ -279,6 +293,13 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMultiAllReduce_Parallel(int nvec_total, N_Vector x,
                                              sunrealtype* dotprods);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMultiAllReduceBegin_Parallel(int nvec_total, N_Vector x,
+                                                  sunrealtype* dotprods);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMultiAllReduceEnd_Parallel(N_Vector x);
+
 /* OPTIONAL XBraid interface operations */
 
 SUNDIALS_EXPORT
@@ -308,6 +329,13 @@ SUNErrCode N_VEnableScaleAddMulti_Parallel(N_Vector v, sunbooleantype tf);
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableDotProdMulti_Parallel(N_Vector v, sunbooleantype tf);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableLinearSumWrmsNorm_Parallel(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableLinearCombinationWrmsNorm_Parallel(N_Vector v,
+                                                       sunbooleantype tf);
+
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableLinearSumVectorArray_Parallel(N_Vector v, sunbooleantype tf);
 
@@ -57,12 +57,21 @@ extern "C" {
  * -----------------------------------------------------------------
  */
 
+/* Persistent pool of worker threads shared by the vectors with the same
+   context, number of threads, and affinity policy. The structure is private
+   to the implementation. */
+
+struct _Pthreads_Pool;
+
 struct _N_VectorContent_Pthreads
 {
-  sunindextype length;     /* vector length           */
-  sunbooleantype own_data; /* data ownership flag     */
-  sunrealtype* data;       /* data array              */
-  int num_threads;         /* number of POSIX threads */
+  sunindextype length;         /* vector length           */
+  sunbooleantype own_data;     /* data ownership flag     */
+  sunrealtype* data;           /* data array              */
+  int num_threads;             /* number of POSIX threads */
+  SUNAffinity affinity;        /* thread affinity policy  */
+  struct _Pthreads_Pool* pool; /* persistent worker pool  */
+  sunbooleantype reproducible; /* reproducible reductions */
 };
 
 typedef struct _N_VectorContent_Pthreads* N_VectorContent_Pthreads;
@@ -70,8 +79,11 @@ typedef struct _N_VectorContent_Pthreads* N_VectorContent_Pthreads;
 /* Structure to hold parallelization information for each thread when
    calling "companion" functions to compute vector operations. The
    start and end vector (loop) indices are unique to each thread, the
-   sunrealtype variables are the same for each thread, and the mutex
-   variable is used to lock variables in reductions. */
+   sunrealtype variables are the same for each thread, and the local
+   values point to a cache-line padded buffer owned by the thread where
+   partial results of reductions are stored. The mutex variable is no
+   longer used by the SUNDIALS kernels and is retained for
+   compatibility. */
 
 struct _Pthreads_Data
 {
@@ -81,6 +93,7 @@ struct _Pthreads_Data
   sunrealtype *v1, *v2, *v3;     /* vector data              */
   sunrealtype* global_val;       /* shared global variable   */
   pthread_mutex_t* global_mutex; /* lock for shared variable */
+  sunrealtype* local_val;        /* per-thread partial value */
 
   int nvec; /* number of vectors in fused op */
   int nsum; /* number of sums in fused op    */
@@ -114,6 +127,10 @@ typedef struct _Pthreads_Data Pthreads_Data;
 
 #define NV_NUM_THREADS_PT(v) (NV_CONTENT_PT(v)->num_threads)
 
+#define NV_AFFINITY_PT(v) (NV_CONTENT_PT(v)->affinity)
+
+#define NV_REPRODUCIBLE_PT(v) (NV_CONTENT_PT(v)->reproducible)
+
 #define NV_OWN_DATA_PT(v) (NV_CONTENT_PT(v)->own_data)
 
 #define NV_DATA_PT(v) (NV_CONTENT_PT(v)->data)
@@ -130,6 +147,10 @@ SUNDIALS_EXPORT
 N_Vector N_VNew_Pthreads(sunindextype vec_length, int n_threads,
                          SUNContext sunctx);
 
+SUNDIALS_EXPORT
+N_Vector N_VNewWithAffinity_Pthreads(sunindextype vec_length, int n_threads,
+                                     SUNAffinity affinity, SUNContext sunctx);
+
 SUNDIALS_EXPORT
 N_Vector N_VNewEmpty_Pthreads(sunindextype vec_length, int n_threads,
                               SUNContext sunctx);
@@ -240,6 +261,16 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti_Pthreads(int nvec, N_Vector x, N_Vector* Y,
                                     sunrealtype* dotprods);
 
+SUNDIALS_EXPORT
+sunrealtype N_VLinearSumWrmsNorm_Pthreads(sunrealtype a, N_Vector x,
+                                          sunrealtype b, N_Vector y, N_Vector z,
+                                          N_Vector w);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWrmsNorm_Pthreads(int nvec, sunrealtype* c,
+                                                 N_Vector* X, N_Vector z,
+                                                 N_Vector w, sunrealtype* nrm);
+
 /* vector array operations */
 SUNDIALS_EXPORT
 SUNErrCode N_VLinearSumVectorArray_Pthreads(int nvec, sunrealtype a,
@@ -301,6 +332,13 @@ SUNErrCode N_VEnableScaleAddMulti_Pthreads(N_Vector v, sunbooleantype tf);
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableDotProdMulti_Pthreads(N_Vector v, sunbooleantype tf);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableLinearSumWrmsNorm_Pthreads(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableLinearCombinationWrmsNorm_Pthreads(N_Vector v,
+                                                       sunbooleantype tf);
+
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableLinearSumVectorArray_Pthreads(N_Vector v, sunbooleantype tf);
 
@@ -325,6 +363,10 @@ SUNDIALS_EXPORT
 SUNErrCode N_VEnableLinearCombinationVectorArray_Pthreads(N_Vector v,
                                                           sunbooleantype tf);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableReproducibleReductions_Pthreads(N_Vector v,
+                                                    sunbooleantype tf);
+
 #ifdef __cplusplus
 }
 #endif
@@ -51,11 +51,17 @@ extern "C" {
  * -----------------------------------------------------------------
  */
 
+/* Recorder for deferred operations shared by a vector and its clones. The
+   structure is private to the implementation. */
+
+struct _SUNDeferredOps;
+
 struct _N_VectorContent_Serial
 {
-  sunindextype length;     /* vector length       */
-  sunbooleantype own_data; /* data ownership flag */
-  sunrealtype* data;       /* data array          */
+  sunindextype length;              /* vector length               */
+  sunbooleantype own_data;          /* data ownership flag         */
+  sunrealtype* data;                /* data array                  */
+  struct _SUNDeferredOps* deferred; /* deferred operations or NULL */
 };
 
 typedef struct _N_VectorContent_Serial* N_VectorContent_Serial;
@@ -93,6 +99,10 @@ SUNDIALS_EXPORT
 N_Vector N_VMake_Serial(sunindextype vec_length, sunrealtype* v_data,
                         SUNContext sunctx);
 
+SUNDIALS_EXPORT
+N_Vector N_VMakeView_Serial(N_Vector w, sunindextype offset,
+                            sunindextype vec_length);
+
 SUNDIALS_EXPORT
 sunindextype N_VGetLength_Serial(N_Vector v);
 
@@ -111,6 +121,9 @@ N_Vector N_VCloneEmpty_Serial(N_Vector w);
 SUNDIALS_EXPORT
 N_Vector N_VClone_Serial(N_Vector w);
 
+SUNDIALS_EXPORT
+N_Vector* N_VCloneVectorArrayContiguous_Serial(int count, N_Vector w);
+
 SUNDIALS_EXPORT
 void N_VDestroy_Serial(N_Vector v);
 
@@ -193,6 +206,16 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti_Serial(int nvec, N_Vector x, N_Vector* Y,
                                   sunrealtype* dotprods);
 
+SUNDIALS_EXPORT
+sunrealtype N_VLinearSumWrmsNorm_Serial(sunrealtype a, N_Vector x,
+                                        sunrealtype b, N_Vector y, N_Vector z,
+                                        N_Vector w);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWrmsNorm_Serial(int nvec, sunrealtype* c,
+                                               N_Vector* X, N_Vector z,
+                                               N_Vector w, sunrealtype* nrm);
+
 /* vector array operations */
 SUNDIALS_EXPORT
 SUNErrCode N_VLinearSumVectorArray_Serial(int nvec, sunrealtype a, N_Vector* X,
@@ -259,6 +282,13 @@ SUNErrCode N_VEnableScaleAddMulti_Serial(N_Vector v, sunbooleantype tf);
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableDotProdMulti_Serial(N_Vector v, sunbooleantype tf);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableLinearSumWrmsNorm_Serial(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableLinearCombinationWrmsNorm_Serial(N_Vector v,
+                                                     sunbooleantype tf);
+
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableLinearSumVectorArray_Serial(N_Vector v, sunbooleantype tf);
 
@@ -282,6 +312,18 @@ SUNDIALS_EXPORT
 SUNErrCode N_VEnableLinearCombinationVectorArray_Serial(N_Vector v,
                                                         sunbooleantype tf);
 
+/*
+ * -----------------------------------------------------------------
+ * Enable / disable and execute deferred vector operations
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableDeferredOps_Serial(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VFlushDeferredOps_Serial(N_Vector v);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,283 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the header file for the C++17 parallel algorithms
+ * (stdpar) implementation of the NVECTOR module.
+ *
+ * Notes:
+ *
+ *   - The vector data is a contiguous host array, as in the serial
+ *     vector. The operations are implemented with the standard
+ *     library algorithms (std::transform, std::transform_reduce,
+ *     ...) using the std::execution::par_unseq policy, so they are
+ *     threaded and vectorized by the C++ standard library (e.g.,
+ *     with TBB for libstdc++).
+ *
+ *   - The library is compiled as C++17 but the interface below is
+ *     callable from C.
+ *
+ *   - N_Vector arguments to arithmetic vector operations need not
+ *     be distinct. For example, the following call:
+ *
+ *       N_VLinearSum_Stdpar(a,x,b,y,y);
+ *
+ *     (which stores the result of the operation a*x+b*y in y)
+ *     is legal.
+ * -----------------------------------------------------------------*/
+
+#ifndef _NVECTOR_STDPAR_H
+#define _NVECTOR_STDPAR_H
+
+#include <stdio.h>
+#include <sundials/sundials_nvector.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/*
+ * -----------------------------------------------------------------
+ * STDPAR implementation of N_Vector
+ * -----------------------------------------------------------------
+ */
+
+struct _N_VectorContent_Stdpar
+{
+  sunindextype length;     /* vector length       */
+  sunbooleantype own_data; /* data ownership flag */
+  sunrealtype* data;       /* data array          */
+};
+
+typedef struct _N_VectorContent_Stdpar* N_VectorContent_Stdpar;
+
+/*
+ * -----------------------------------------------------------------
+ * Macros NV_CONTENT_SP, NV_DATA_SP, NV_OWN_DATA_SP,
+ *        NV_LENGTH_SP, and NV_Ith_SP
+ * -----------------------------------------------------------------
+ */
+
+#define NV_CONTENT_SP(v) ((N_VectorContent_Stdpar)(v->content))
+
+#define NV_LENGTH_SP(v) (NV_CONTENT_SP(v)->length)
+
+#define NV_OWN_DATA_SP(v) (NV_CONTENT_SP(v)->own_data)
+
+#define NV_DATA_SP(v) (NV_CONTENT_SP(v)->data)
+
+#define NV_Ith_SP(v, i) (NV_DATA_SP(v)[i])
+
+/*
+ * -----------------------------------------------------------------
+ * Functions exported by nvector_stdpar
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_EXPORT
+N_Vector N_VNewEmpty_Stdpar(sunindextype vec_length, SUNContext sunctx);
+
+SUNDIALS_EXPORT
+N_Vector N_VNew_Stdpar(sunindextype vec_length, SUNContext sunctx);
+
+SUNDIALS_EXPORT
+N_Vector N_VMake_Stdpar(sunindextype vec_length, sunrealtype* v_data,
+                        SUNContext sunctx);
+
+SUNDIALS_EXPORT
+sunindextype N_VGetLength_Stdpar(N_Vector v);
+
+SUNDIALS_EXPORT
+void N_VPrint_Stdpar(N_Vector v);
+
+SUNDIALS_EXPORT
+void N_VPrintFile_Stdpar(N_Vector v, FILE* outfile);
+
+SUNDIALS_EXPORT
+N_Vector_ID N_VGetVectorID_Stdpar(N_Vector v);
+
+SUNDIALS_EXPORT
+N_Vector N_VCloneEmpty_Stdpar(N_Vector w);
+
+SUNDIALS_EXPORT
+N_Vector N_VClone_Stdpar(N_Vector w);
+
+SUNDIALS_EXPORT
+void N_VDestroy_Stdpar(N_Vector v);
+
+SUNDIALS_EXPORT
+sunrealtype* N_VGetArrayPointer_Stdpar(N_Vector v);
+
+SUNDIALS_EXPORT
+void N_VSetArrayPointer_Stdpar(sunrealtype* v_data, N_Vector v);
+
+/* standard vector operations */
+SUNDIALS_EXPORT
+void N_VLinearSum_Stdpar(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
+                         N_Vector z);
+SUNDIALS_EXPORT
+void N_VConst_Stdpar(sunrealtype c, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VProd_Stdpar(N_Vector x, N_Vector y, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VDiv_Stdpar(N_Vector x, N_Vector y, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VScale_Stdpar(sunrealtype c, N_Vector x, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VAbs_Stdpar(N_Vector x, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VInv_Stdpar(N_Vector x, N_Vector z);
+
+SUNDIALS_EXPORT
+void N_VAddConst_Stdpar(N_Vector x, sunrealtype b, N_Vector z);
+
+SUNDIALS_EXPORT
+sunrealtype N_VDotProd_Stdpar(N_Vector x, N_Vector y);
+
+SUNDIALS_EXPORT
+sunrealtype N_VMaxNorm_Stdpar(N_Vector x);
+
+SUNDIALS_EXPORT
+sunrealtype N_VWrmsNorm_Stdpar(N_Vector x, N_Vector w);
+
+SUNDIALS_EXPORT
+sunrealtype N_VWrmsNormMask_Stdpar(N_Vector x, N_Vector w, N_Vector id);
+
+SUNDIALS_EXPORT
+sunrealtype N_VMin_Stdpar(N_Vector x);
+
+SUNDIALS_EXPORT
+sunrealtype N_VWL2Norm_Stdpar(N_Vector x, N_Vector w);
+
+SUNDIALS_EXPORT
+sunrealtype N_VL1Norm_Stdpar(N_Vector x);
+
+SUNDIALS_EXPORT
+void N_VCompare_Stdpar(sunrealtype c, N_Vector x, N_Vector z);
+
+SUNDIALS_EXPORT
+sunbooleantype N_VInvTest_Stdpar(N_Vector x, N_Vector z);
+
+SUNDIALS_EXPORT
+sunbooleantype N_VConstrMask_Stdpar(N_Vector c, N_Vector x, N_Vector m);
+
+SUNDIALS_EXPORT
+sunrealtype N_VMinQuotient_Stdpar(N_Vector num, N_Vector denom);
+
+/* fused vector operations */
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombination_Stdpar(int nvec, sunrealtype* c, N_Vector* V,
+                                       N_Vector z);
+SUNDIALS_EXPORT
+SUNErrCode N_VScaleAddMulti_Stdpar(int nvec, sunrealtype* a, N_Vector x,
+                                   N_Vector* Y, N_Vector* Z);
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMulti_Stdpar(int nvec, N_Vector x, N_Vector* Y,
+                                  sunrealtype* dotprods);
+
+/* vector array operations */
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearSumVectorArray_Stdpar(int nvec, sunrealtype a, N_Vector* X,
+                                          sunrealtype b, N_Vector* Y,
+                                          N_Vector* Z);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VScaleVectorArray_Stdpar(int nvec, sunrealtype* c, N_Vector* X,
+                                      N_Vector* Z);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VConstVectorArray_Stdpar(int nvecs, sunrealtype c, N_Vector* Z);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VWrmsNormVectorArray_Stdpar(int nvecs, N_Vector* X, N_Vector* W,
+                                         sunrealtype* nrm);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VWrmsNormMaskVectorArray_Stdpar(int nvecs, N_Vector* X, N_Vector* W,
+                                             N_Vector id, sunrealtype* nrm);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VScaleAddMultiVectorArray_Stdpar(int nvec, int nsum,
+                                              sunrealtype* a, N_Vector* X,
+                                              N_Vector** Y, N_Vector** Z);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationVectorArray_Stdpar(int nvec, int nsum,
+                                                  sunrealtype* c, N_Vector** X,
+                                                  N_Vector* Z);
+
+/* OPTIONAL local reduction kernels (no parallel communication) */
+SUNDIALS_EXPORT
+sunrealtype N_VWSqrSumLocal_Stdpar(N_Vector x, N_Vector w);
+
+SUNDIALS_EXPORT
+sunrealtype N_VWSqrSumMaskLocal_Stdpar(N_Vector x, N_Vector w, N_Vector id);
+
+/* OPTIONAL XBraid interface operations */
+SUNDIALS_EXPORT
+SUNErrCode N_VBufSize_Stdpar(N_Vector x, sunindextype* size);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VBufPack_Stdpar(N_Vector x, void* buf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VBufUnpack_Stdpar(N_Vector x, void* buf);
+
+/*
+ * -----------------------------------------------------------------
+ * Enable / disable fused vector operations
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableFusedOps_Stdpar(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableLinearCombination_Stdpar(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableScaleAddMulti_Stdpar(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableDotProdMulti_Stdpar(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableLinearSumVectorArray_Stdpar(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableScaleVectorArray_Stdpar(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableConstVectorArray_Stdpar(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableWrmsNormVectorArray_Stdpar(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableWrmsNormMaskVectorArray_Stdpar(N_Vector v, sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableScaleAddMultiVectorArray_Stdpar(N_Vector v,
+                                                    sunbooleantype tf);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableLinearCombinationVectorArray_Stdpar(N_Vector v,
+                                                        sunbooleantype tf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -229,6 +229,23 @@ SUNErrCode SUNClassicalGS(N_Vector* v, sunrealtype** h, int k, int p,
                           sunrealtype* new_vk_norm, sunrealtype* stemp,
                           N_Vector* vtemp);
 
+/*
+ * -----------------------------------------------------------------
+ * Function: SUNClassicalGSEstNorm
+ * -----------------------------------------------------------------
+ * SUNClassicalGSEstNorm is the same as SUNClassicalGS except that
+ * the norm of the new v[k] is estimated from the projections,
+ * sqrt(||v[k]||^2 - sum_i h[i][k-1]^2), when reorthogonalization
+ * is not needed. This saves a dot product (a global reduction for
+ * distributed vectors) at the cost of a less accurate norm.
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_EXPORT
+SUNErrCode SUNClassicalGSEstNorm(N_Vector* v, sunrealtype** h, int k, int p,
+                                 sunrealtype* new_vk_norm, sunrealtype* stemp,
+                                 N_Vector* vtemp);
+
 /*
  * -----------------------------------------------------------------
  * Function: SUNQRfact
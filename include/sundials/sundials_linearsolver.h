@@ -96,6 +96,7 @@ typedef enum
   SUNLINEARSOLVER_ONEMKLDENSE,
   SUNLINEARSOLVER_GINKGO,
   SUNLINEARSOLVER_KOKKOSDENSE,
+  SUNLINEARSOLVER_BLOCKDIAG,
   SUNLINEARSOLVER_CUSTOM
 } SUNLinearSolver_ID;
 
@@ -68,6 +68,8 @@ typedef enum
   SUNMATRIX_CUSPARSE,
   SUNMATRIX_GINKGO,
   SUNMATRIX_KOKKOSDENSE,
+  SUNMATRIX_BLOCKDIAG,
+  SUNMATRIX_BSR,
   SUNMATRIX_CUSTOM
 } SUNMatrix_ID;
 
@@ -78,9 +78,24 @@ typedef enum
   SUNDIALS_NVEC_MANYVECTOR,
   SUNDIALS_NVEC_MPIMANYVECTOR,
   SUNDIALS_NVEC_MPIPLUSX,
+  SUNDIALS_NVEC_MIXED,
+  SUNDIALS_NVEC_ENSEMBLE,
+  SUNDIALS_NVEC_STDPAR,
+  SUNDIALS_NVEC_MMAP,
   SUNDIALS_NVEC_CUSTOM
 } N_Vector_ID;
 
+/* -----------------------------------------------------------------
+ * Thread affinity policies for threaded CPU N_Vector types
+ * ----------------------------------------------------------------- */
+
+typedef enum
+{
+  SUN_AFFINITY_NONE,  /* threads are not pinned                      */
+  SUN_AFFINITY_CLOSE, /* thread i is pinned to the i-th available CPU */
+  SUN_AFFINITY_SPREAD /* threads are spread evenly over the CPUs      */
+} SUNAffinity;
+
 /* -----------------------------------------------------------------
  * Generic definition of N_Vector
  * ----------------------------------------------------------------- */
@@ -148,6 +163,10 @@ struct _generic_N_Vector_Ops
   SUNErrCode (*nvscaleaddmulti)(int, sunrealtype*, N_Vector, N_Vector*,
                                 N_Vector*);
   SUNErrCode (*nvdotprodmulti)(int, N_Vector, N_Vector*, sunrealtype*);
+  sunrealtype (*nvlinearsumwrmsnorm)(sunrealtype, N_Vector, sunrealtype,
+                                     N_Vector, N_Vector, N_Vector);
+  SUNErrCode (*nvlinearcombinationwrmsnorm)(int, sunrealtype*, N_Vector*,
+                                            N_Vector, N_Vector, sunrealtype*);
 
   /* OPTIONAL vector array operations */
   SUNErrCode (*nvlinearsumvectorarray)(int, sunrealtype, N_Vector*, sunrealtype,
@@ -180,6 +199,11 @@ struct _generic_N_Vector_Ops
   /* Single buffer reduction operations */
   SUNErrCode (*nvdotprodmultilocal)(int, N_Vector, N_Vector*, sunrealtype*);
   SUNErrCode (*nvdotprodmultiallreduce)(int, N_Vector, sunrealtype*);
+  SUNErrCode (*nvdotprodmultiallreducebegin)(int, N_Vector, sunrealtype*);
+  SUNErrCode (*nvdotprodmultiallreduceend)(N_Vector);
+
+  /* Contiguous vector array constructor */
+  N_Vector* (*nvclonevectorarraycontiguous)(int, N_Vector);
 
   /* XBraid interface operations */
   SUNErrCode (*nvbufsize)(N_Vector, sunindextype*);
@@ -266,6 +290,15 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti(int nvec, N_Vector x, N_Vector* Y,
                            sunrealtype* dotprods);
 
+SUNDIALS_EXPORT
+sunrealtype N_VLinearSumWrmsNorm(sunrealtype a, N_Vector x, sunrealtype b,
+                                 N_Vector y, N_Vector z, N_Vector w);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWrmsNorm(int nvec, sunrealtype* c, N_Vector* X,
+                                        N_Vector z, N_Vector w,
+                                        sunrealtype* nrm);
+
 /* vector array operations */
 SUNDIALS_EXPORT
 SUNErrCode N_VLinearSumVectorArray(int nvec, sunrealtype a, N_Vector* X,
@@ -316,6 +349,10 @@ SUNDIALS_EXPORT SUNErrCode N_VDotProdMultiLocal(int nvec, N_Vector x, N_Vector*
                                                 sunrealtype* dotprods);
 SUNDIALS_EXPORT SUNErrCode N_VDotProdMultiAllReduce(int nvec_total, N_Vector x,
                                                     sunrealtype* sum);
+SUNDIALS_EXPORT SUNErrCode N_VDotProdMultiAllReduceBegin(int nvec_total,
+                                                         N_Vector x,
+                                                         sunrealtype* sum);
+SUNDIALS_EXPORT SUNErrCode N_VDotProdMultiAllReduceEnd(N_Vector x);
 
 /* XBraid interface operations */
 SUNDIALS_EXPORT SUNErrCode N_VBufSize(N_Vector x, sunindextype* size);
@@ -329,6 +366,7 @@ SUNDIALS_EXPORT SUNErrCode N_VBufUnpack(N_Vector x, void* buf);
 SUNDIALS_EXPORT N_Vector* N_VNewVectorArray(int count, SUNContext sunctx);
 SUNDIALS_EXPORT N_Vector* N_VCloneEmptyVectorArray(int count, N_Vector w);
 SUNDIALS_EXPORT N_Vector* N_VCloneVectorArray(int count, N_Vector w);
+SUNDIALS_EXPORT N_Vector* N_VCloneVectorArrayContiguous(int count, N_Vector w);
 SUNDIALS_EXPORT void N_VDestroyVectorArray(N_Vector* vs, int count);
 
 /* These function are really only for users of the Fortran interface */
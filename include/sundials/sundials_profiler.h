@@ -38,6 +38,10 @@ SUNErrCode SUNProfiler_Begin(SUNProfiler p, const char* name);
 SUNDIALS_EXPORT
 SUNErrCode SUNProfiler_End(SUNProfiler p, const char* name);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_AddCounts(SUNProfiler p, const char* name, double bytes,
+                                 double flops);
+
 SUNDIALS_EXPORT
 SUNErrCode SUNProfiler_GetTimerResolution(SUNProfiler p, double* resolution);
 
@@ -45,6 +49,10 @@ SUNDIALS_EXPORT
 SUNErrCode SUNProfiler_GetElapsedTime(SUNProfiler p, const char* name,
                                       double* time);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_GetCounts(SUNProfiler p, const char* name,
+                                 double* bytes, double* flops);
+
 SUNDIALS_EXPORT
 SUNErrCode SUNProfiler_Print(SUNProfiler p, FILE* fp);
 
@@ -64,6 +72,8 @@ SUNErrCode SUNProfiler_Reset(SUNProfiler p);
 
 #define SUNDIALS_MARK_END(profobj, name) CALI_MARK_END(name)
 
+#define SUNDIALS_MARK_FUNCTION_COUNTS(profobj, bytes, flops)
+
 #elif defined(SUNDIALS_BUILD_WITH_PROFILING)
 
 #define SUNDIALS_MARK_FUNCTION_BEGIN(profobj) \
@@ -80,6 +90,9 @@ SUNErrCode SUNProfiler_Reset(SUNProfiler p);
 
 #define SUNDIALS_MARK_END(profobj, name) SUNProfiler_End(profobj, (name))
 
+#define SUNDIALS_MARK_FUNCTION_COUNTS(profobj, bytes, flops) \
+  SUNProfiler_AddCounts(profobj, __func__, (bytes), (flops))
+
 #else
 
 #define SUNDIALS_MARK_FUNCTION_BEGIN(profobj)
@@ -92,6 +105,8 @@ SUNErrCode SUNProfiler_Reset(SUNProfiler p);
 
 #define SUNDIALS_MARK_END(profobj, name)
 
+#define SUNDIALS_MARK_FUNCTION_COUNTS(profobj, bytes, flops)
+
 #endif
 
 #ifdef __cplusplus
@@ -0,0 +1,101 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the header file for the batched block-diagonal
+ * implementation of the SUNLINSOL module, SUNLINSOL_BLOCKDIAG.
+ *
+ * Notes:
+ *   - The definition of the generic SUNLinearSolver structure can
+ *     be found in the header file sundials_linearsolver.h.
+ *   - The definition of the type 'sunrealtype' can be found in the
+ *     header file sundials_types.h, and it may be changed (at the
+ *     configuration stage) according to the user's needs.
+ *     The sundials_types.h file also contains the definition
+ *     for the type 'sunbooleantype' and 'indextype'.
+ * -----------------------------------------------------------------
+ */
+
+#ifndef _SUNLINSOL_BLOCKDIAG_H
+#define _SUNLINSOL_BLOCKDIAG_H
+
+#include <sundials/sundials_linearsolver.h>
+#include <sundials/sundials_matrix.h>
+#include <sundials/sundials_nvector.h>
+#include <sunmatrix/sunmatrix_blockdiag.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* Number of blocks factored together in one interleaved batch */
+#define SUNLINSOL_BLOCKDIAG_BATCH 8
+
+/* -----------------------------------------------
+ * Block-diagonal Implementation of SUNLinearSolver
+ * ----------------------------------------------- */
+
+struct _SUNLinearSolverContent_BlockDiag
+{
+  sunindextype nblocks;
+  sunindextype block_size;
+  sunindextype nbatches;
+  sunrealtype* factors;
+  sunindextype* pivots;
+  sunrealtype* work;
+  sunindextype last_flag;
+  int nthreads;
+};
+
+typedef struct _SUNLinearSolverContent_BlockDiag*
+  SUNLinearSolverContent_BlockDiag;
+
+/* -------------------------------------------
+ * Exported Functions for SUNLINSOL_BLOCKDIAG
+ * ------------------------------------------- */
+
+SUNDIALS_EXPORT
+SUNLinearSolver SUNLinSol_BlockDiag(N_Vector y, SUNMatrix A, SUNContext sunctx);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSol_BlockDiagSetNumThreads(SUNLinearSolver S, int nthreads);
+
+SUNDIALS_EXPORT
+SUNLinearSolver_Type SUNLinSolGetType_BlockDiag(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+SUNLinearSolver_ID SUNLinSolGetID_BlockDiag(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSolInitialize_BlockDiag(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+int SUNLinSolSetup_BlockDiag(SUNLinearSolver S, SUNMatrix A);
+
+SUNDIALS_EXPORT
+int SUNLinSolSolve_BlockDiag(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                             N_Vector b, sunrealtype tol);
+
+SUNDIALS_EXPORT
+sunindextype SUNLinSolLastFlag_BlockDiag(SUNLinearSolver S);
+
+SUNDIALS_DEPRECATED_EXPORT_MSG(
+  "Work space functions will be removed in version 8.0.0")
+SUNErrCode SUNLinSolSpace_BlockDiag(SUNLinearSolver S, long int* lenrwLS,
+                                    long int* leniwLS);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSolFree_BlockDiag(SUNLinearSolver S);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -48,6 +48,7 @@ struct _SUNLinearSolverContent_Dense
   sunindextype N;
   sunindextype* pivots;
   sunindextype last_flag;
+  int nthreads;
 };
 
 typedef struct _SUNLinearSolverContent_Dense* SUNLinearSolverContent_Dense;
@@ -59,6 +60,9 @@ typedef struct _SUNLinearSolverContent_Dense* SUNLinearSolverContent_Dense;
 SUNDIALS_EXPORT
 SUNLinearSolver SUNLinSol_Dense(N_Vector y, SUNMatrix A, SUNContext sunctx);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSol_DenseSetNumThreads(SUNLinearSolver S, int nthreads);
+
 SUNDIALS_EXPORT
 SUNLinearSolver_Type SUNLinSolGetType_Dense(SUNLinearSolver S);
 
@@ -50,6 +50,7 @@ struct _SUNLinearSolverContent_SPFGMR
   int maxl;
   int pretype;
   int gstype;
+  sunbooleantype gs_est_norm;
   int max_restarts;
   sunbooleantype zeroguess;
   int numiters;
@@ -88,6 +89,8 @@ SUNDIALS_EXPORT SUNErrCode SUNLinSol_SPFGMRSetPrecType(SUNLinearSolver S,
                                                        int pretype);
 SUNDIALS_EXPORT SUNErrCode SUNLinSol_SPFGMRSetGSType(SUNLinearSolver S,
                                                      int gstype);
+SUNDIALS_EXPORT SUNErrCode
+SUNLinSol_SPFGMRSetGSNormEstimate(SUNLinearSolver S, sunbooleantype onoff);
 SUNDIALS_EXPORT SUNErrCode SUNLinSol_SPFGMRSetMaxRestarts(SUNLinearSolver S,
                                                           int maxrs);
 SUNDIALS_EXPORT SUNLinearSolver_Type SUNLinSolGetType_SPFGMR(SUNLinearSolver S);
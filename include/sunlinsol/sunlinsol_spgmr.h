@@ -51,6 +51,7 @@ struct _SUNLinearSolverContent_SPGMR
   int maxl;
   int pretype;
   int gstype;
+  sunbooleantype gs_est_norm;
   int max_restarts;
   sunbooleantype zeroguess;
   int numiters;
@@ -88,6 +89,8 @@ SUNDIALS_EXPORT SUNErrCode SUNLinSol_SPGMRSetPrecType(SUNLinearSolver S,
                                                       int pretype);
 SUNDIALS_EXPORT SUNErrCode SUNLinSol_SPGMRSetGSType(SUNLinearSolver S,
                                                     int gstype);
+SUNDIALS_EXPORT SUNErrCode
+SUNLinSol_SPGMRSetGSNormEstimate(SUNLinearSolver S, sunbooleantype onoff);
 SUNDIALS_EXPORT SUNErrCode SUNLinSol_SPGMRSetMaxRestarts(SUNLinearSolver S,
                                                          int maxrs);
 SUNDIALS_EXPORT SUNLinearSolver_Type SUNLinSolGetType_SPGMR(SUNLinearSolver S);
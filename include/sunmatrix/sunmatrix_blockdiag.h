@@ -0,0 +1,122 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the header file for the block-diagonal implementation of
+ * the SUNMATRIX module, SUNMATRIX_BLOCKDIAG. The matrix consists of
+ * nblocks square dense blocks of equal size stored one after the
+ * other in a single contiguous array.
+ *
+ * Notes:
+ *   - The definition of the generic SUNMatrix structure can be found
+ *     in the header file sundials_matrix.h.
+ *   - The definition of the type 'sunrealtype' can be found in the
+ *     header file sundials_types.h, and it may be changed (at the
+ *     configuration stage) according to the user's needs.
+ *     The sundials_types.h file also contains the definition
+ *     for the type 'sunbooleantype' and 'indextype'.
+ * -----------------------------------------------------------------
+ */
+
+#ifndef _SUNMATRIX_BLOCKDIAG_H
+#define _SUNMATRIX_BLOCKDIAG_H
+
+#include <stdio.h>
+#include <sundials/sundials_matrix.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* -------------------------------------------
+ * Block-diagonal implementation of SUNMatrix
+ * ------------------------------------------- */
+
+struct _SUNMatrixContent_BlockDiag
+{
+  sunindextype nblocks;
+  sunindextype block_size;
+  sunindextype M;
+  sunrealtype* data;
+  sunindextype ldata;
+  sunrealtype** blocks;
+};
+
+typedef struct _SUNMatrixContent_BlockDiag* SUNMatrixContent_BlockDiag;
+
+/* ----------------------------------------
+ * Macros for access to SUNMATRIX_BLOCKDIAG
+ * ---------------------------------------- */
+
+#define SM_CONTENT_BD(A) ((SUNMatrixContent_BlockDiag)(A->content))
+
+#define SM_NBLOCKS_BD(A) (SM_CONTENT_BD(A)->nblocks)
+
+#define SM_BLOCKSIZE_BD(A) (SM_CONTENT_BD(A)->block_size)
+
+#define SM_ROWS_BD(A) (SM_CONTENT_BD(A)->M)
+
+#define SM_COLUMNS_BD(A) (SM_CONTENT_BD(A)->M)
+
+#define SM_LDATA_BD(A) (SM_CONTENT_BD(A)->ldata)
+
+#define SM_DATA_BD(A) (SM_CONTENT_BD(A)->data)
+
+#define SM_BLOCKS_BD(A) (SM_CONTENT_BD(A)->blocks)
+
+#define SM_BLOCK_BD(A, k) ((SM_CONTENT_BD(A)->blocks)[k])
+
+#define SM_ELEMENT_BD(A, k, i, j) \
+  ((SM_CONTENT_BD(A)->blocks)[k][(j) * SM_BLOCKSIZE_BD(A) + (i)])
+
+/* -------------------------------------------
+ * Exported Functions for SUNMATRIX_BLOCKDIAG
+ * ------------------------------------------- */
+
+SUNDIALS_EXPORT SUNMatrix SUNBlockDiagMatrix(sunindextype nblocks,
+                                             sunindextype block_size,
+                                             SUNContext sunctx);
+
+SUNDIALS_EXPORT void SUNBlockDiagMatrix_Print(SUNMatrix A, FILE* outfile);
+
+SUNDIALS_EXPORT sunindextype SUNBlockDiagMatrix_NumBlocks(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNBlockDiagMatrix_BlockSize(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNBlockDiagMatrix_Rows(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNBlockDiagMatrix_Columns(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNBlockDiagMatrix_LData(SUNMatrix A);
+SUNDIALS_EXPORT sunrealtype* SUNBlockDiagMatrix_Data(SUNMatrix A);
+SUNDIALS_EXPORT sunrealtype** SUNBlockDiagMatrix_Blocks(SUNMatrix A);
+SUNDIALS_EXPORT sunrealtype* SUNBlockDiagMatrix_Block(SUNMatrix A,
+                                                      sunindextype k);
+
+SUNDIALS_EXPORT SUNMatrix_ID SUNMatGetID_BlockDiag(SUNMatrix A);
+SUNDIALS_EXPORT SUNMatrix SUNMatClone_BlockDiag(SUNMatrix A);
+SUNDIALS_EXPORT void SUNMatDestroy_BlockDiag(SUNMatrix A);
+SUNDIALS_EXPORT SUNErrCode SUNMatZero_BlockDiag(SUNMatrix A);
+SUNDIALS_EXPORT SUNErrCode SUNMatCopy_BlockDiag(SUNMatrix A, SUNMatrix B);
+SUNDIALS_EXPORT SUNErrCode SUNMatScaleAdd_BlockDiag(sunrealtype c, SUNMatrix A,
+                                                    SUNMatrix B);
+SUNDIALS_EXPORT SUNErrCode SUNMatScaleAddI_BlockDiag(sunrealtype c,
+                                                     SUNMatrix A);
+SUNDIALS_EXPORT SUNErrCode SUNMatMatvec_BlockDiag(SUNMatrix A, N_Vector x,
+                                                  N_Vector y);
+SUNDIALS_EXPORT SUNErrCode SUNMatHermitianTransposeVec_BlockDiag(SUNMatrix A,
+                                                                 N_Vector x,
+                                                                 N_Vector y);
+SUNDIALS_DEPRECATED_EXPORT_MSG(
+  "Work space functions will be removed in version 8.0.0")
+SUNErrCode SUNMatSpace_BlockDiag(SUNMatrix A, long int* lenrw, long int* leniw);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
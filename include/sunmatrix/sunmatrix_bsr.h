@@ -0,0 +1,173 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the header file for the block sparse row (BSR)
+ * implementation of the SUNMATRIX module, SUNMATRIX_BSR. The matrix
+ * consists of dense square blocks of equal size placed on a sparse
+ * block pattern stored in compressed row format.
+ *
+ * Notes:
+ *   - The definition of the generic SUNMatrix structure can be found
+ *     in the header file sundials_matrix.h.
+ *   - The definition of the type 'sunrealtype' can be found in the
+ *     header file sundials_types.h, and it may be changed (at the
+ *     configuration stage) according to the user's needs.
+ *     The sundials_types.h file also contains the definition
+ *     for the type 'sunbooleantype' and 'indextype'.
+ * -----------------------------------------------------------------
+ */
+
+#ifndef _SUNMATRIX_BSR_H
+#define _SUNMATRIX_BSR_H
+
+#include <stdio.h>
+#include <sundials/sundials_matrix.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* ------------------------------------
+ * BSR implementation of SUNMatrix
+ * ------------------------------------ */
+
+struct _SUNMatrixContent_BSR
+{
+  sunindextype MB;
+  sunindextype NB;
+  sunindextype block_size;
+  sunindextype NNZB;
+  sunindextype M;
+  sunindextype N;
+  sunrealtype* data;
+  sunindextype* colidx;
+  sunindextype* rowptrs;
+};
+
+typedef struct _SUNMatrixContent_BSR* SUNMatrixContent_BSR;
+
+/* -----------------------------------
+ * Macros for access to SUNMATRIX_BSR
+ * ----------------------------------- */
+
+#define SM_CONTENT_BSR(A) ((SUNMatrixContent_BSR)(A->content))
+
+#define SM_BLOCKROWS_BSR(A) (SM_CONTENT_BSR(A)->MB)
+
+#define SM_BLOCKCOLUMNS_BSR(A) (SM_CONTENT_BSR(A)->NB)
+
+#define SM_BLOCKSIZE_BSR(A) (SM_CONTENT_BSR(A)->block_size)
+
+#define SM_NNZB_BSR(A) (SM_CONTENT_BSR(A)->NNZB)
+
+#define SM_ROWS_BSR(A) (SM_CONTENT_BSR(A)->M)
+
+#define SM_COLUMNS_BSR(A) (SM_CONTENT_BSR(A)->N)
+
+#define SM_DATA_BSR(A) (SM_CONTENT_BSR(A)->data)
+
+#define SM_COLIDX_BSR(A) (SM_CONTENT_BSR(A)->colidx)
+
+#define SM_ROWPTRS_BSR(A) (SM_CONTENT_BSR(A)->rowptrs)
+
+#define SM_BLOCK_BSR(A, p) \
+  (SM_CONTENT_BSR(A)->data + (p) * SM_BLOCKSIZE_BSR(A) * SM_BLOCKSIZE_BSR(A))
+
+#define SM_ELEMENT_BSR(A, p, i, j) \
+  (SM_BLOCK_BSR(A, p)[(j) * SM_BLOCKSIZE_BSR(A) + (i)])
+
+/* --------------------------------------
+ * Exported Functions for SUNMATRIX_BSR
+ * -------------------------------------- */
+
+SUNDIALS_EXPORT
+SUNMatrix SUNBSRMatrix(sunindextype MB, sunindextype NB,
+                       sunindextype block_size, sunindextype NNZB,
+                       SUNContext sunctx);
+
+SUNDIALS_EXPORT
+SUNMatrix SUNBSRFromSparseMatrix(SUNMatrix A, sunindextype block_size);
+
+SUNDIALS_EXPORT
+SUNMatrix SUNSparseFromBSRMatrix(SUNMatrix A, sunrealtype droptol,
+                                 int sparsetype);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNBSRMatrix_Reallocate(SUNMatrix A, sunindextype NNZB);
+
+SUNDIALS_EXPORT
+void SUNBSRMatrix_Print(SUNMatrix A, FILE* outfile);
+
+SUNDIALS_EXPORT
+sunindextype SUNBSRMatrix_Rows(SUNMatrix A);
+
+SUNDIALS_EXPORT
+sunindextype SUNBSRMatrix_Columns(SUNMatrix A);
+
+SUNDIALS_EXPORT
+sunindextype SUNBSRMatrix_BlockRows(SUNMatrix A);
+
+SUNDIALS_EXPORT
+sunindextype SUNBSRMatrix_BlockColumns(SUNMatrix A);
+
+SUNDIALS_EXPORT
+sunindextype SUNBSRMatrix_BlockSize(SUNMatrix A);
+
+SUNDIALS_EXPORT
+sunindextype SUNBSRMatrix_NNZB(SUNMatrix A);
+
+SUNDIALS_EXPORT
+sunrealtype* SUNBSRMatrix_Data(SUNMatrix A);
+
+SUNDIALS_EXPORT
+sunindextype* SUNBSRMatrix_BlockColumnIndices(SUNMatrix A);
+
+SUNDIALS_EXPORT
+sunindextype* SUNBSRMatrix_BlockRowPointers(SUNMatrix A);
+
+SUNDIALS_EXPORT
+SUNMatrix_ID SUNMatGetID_BSR(SUNMatrix A);
+
+SUNDIALS_EXPORT
+SUNMatrix SUNMatClone_BSR(SUNMatrix A);
+
+SUNDIALS_EXPORT
+void SUNMatDestroy_BSR(SUNMatrix A);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMatZero_BSR(SUNMatrix A);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMatCopy_BSR(SUNMatrix A, SUNMatrix B);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMatScaleAdd_BSR(sunrealtype c, SUNMatrix A, SUNMatrix B);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMatScaleAddI_BSR(sunrealtype c, SUNMatrix A);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMatMatvec_BSR(SUNMatrix A, N_Vector x, N_Vector y);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMatHermitianTransposeVec_BSR(SUNMatrix A, N_Vector x,
+                                           N_Vector y);
+
+SUNDIALS_DEPRECATED_EXPORT_MSG(
+  "Work space functions will be removed in version 8.0.0")
+SUNErrCode SUNMatSpace_BSR(SUNMatrix A, long int* lenrw, long int* leniw);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -54,6 +54,22 @@ extern "C" {
  * Sparse Implementation of SUNMATRIX_SPARSE
  * ------------------------------------------ */
 
+/* Cached merge of sparsity patterns used by SUNMatScaleAdd and
+   SUNMatScaleAddI. The structure is private to the implementation. */
+
+struct _SUNSparseMergeMap;
+
+/* SELL-C-sigma copy of the matrix used by SUNMatMatvec when enabled. The
+   structure is private to the implementation. */
+
+struct _SUNSparseSELL;
+
+/* Compressed pattern and scatter map of a list of (row, column) triplets used
+   by SUNSparseMatrix_AssembleTriplets. The structure is private to the
+   implementation. */
+
+struct _SUNSparseTripletMap;
+
 struct _SUNMatrixContent_Sparse
 {
   sunindextype M;
@@ -70,6 +86,15 @@ struct _SUNMatrixContent_Sparse
   /* CSR indices */
   sunindextype** colvals;
   sunindextype** rowptrs;
+  /* number of OpenMP threads used by the matrix operations */
+  int nthreads;
+  /* cached pattern merges for SUNMatScaleAdd and SUNMatScaleAddI */
+  struct _SUNSparseMergeMap* scaleadd_map;
+  struct _SUNSparseMergeMap* scaleaddi_map;
+  /* SELL-C-sigma copy for SUNMatMatvec (NULL when not enabled) */
+  struct _SUNSparseSELL* sell;
+  /* triplet map for SUNSparseMatrix_AssembleTriplets (NULL when not set) */
+  struct _SUNSparseTripletMap* triplet_map;
 };
 
 typedef struct _SUNMatrixContent_Sparse* SUNMatrixContent_Sparse;
@@ -96,6 +121,8 @@ typedef struct _SUNMatrixContent_Sparse* SUNMatrixContent_Sparse;
 
 #define SM_INDEXPTRS_S(A) (SM_CONTENT_S(A)->indexptrs)
 
+#define SM_NTHREADS_S(A) (SM_CONTENT_S(A)->nthreads)
+
 /* ----------------------------------------
  * Exported Functions for SUNMATRIX_SPARSE
  * ---------------------------------------- */
@@ -124,6 +151,26 @@ SUNErrCode SUNSparseMatrix_Realloc(SUNMatrix A);
 SUNDIALS_EXPORT
 SUNErrCode SUNSparseMatrix_Reallocate(SUNMatrix A, sunindextype NNZ);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNSparseMatrix_SetNumThreads(SUNMatrix A, int nthreads);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNSparseMatrix_SetMatvecSELL(SUNMatrix A, sunbooleantype onoff,
+                                         sunindextype sigma);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNSparseMatrix_ColumnColoring(SUNMatrix A, sunindextype* colors,
+                                          sunindextype* ncolors);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNSparseMatrix_SetTripletPattern(SUNMatrix A, sunindextype ntrip,
+                                             const sunindextype* rows,
+                                             const sunindextype* cols);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNSparseMatrix_AssembleTriplets(SUNMatrix A,
+                                            const sunrealtype* vals);
+
 SUNDIALS_EXPORT
 void SUNSparseMatrix_Print(SUNMatrix A, FILE* outfile);
 
@@ -172,6 +219,9 @@ SUNErrCode SUNMatScaleAdd_Sparse(sunrealtype c, SUNMatrix A, SUNMatrix B);
 SUNDIALS_EXPORT
 SUNErrCode SUNMatScaleAddI_Sparse(sunrealtype c, SUNMatrix A);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNMatMatvecSetup_Sparse(SUNMatrix A);
+
 SUNDIALS_EXPORT
 SUNErrCode SUNMatMatvec_Sparse(SUNMatrix A, N_Vector x, N_Vector y);
 
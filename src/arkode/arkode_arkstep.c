@@ -3158,8 +3158,10 @@ int arkStep_StageSetup(ARKodeMem ark_mem, sunbooleantype implicit)
 int arkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
 {
   /* local data */
-  int retval, j, nvec;
+  int retval, j, nvec, dsm_idx;
   N_Vector y, yerr;
+  sunbooleantype estimate;
+  SUNReduceBatch dsm_reduce;
   sunrealtype* cj;
   sunrealtype* bj;
   sunrealtype* dj;
@@ -3186,7 +3188,9 @@ int arkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
   Xvecs = step_mem->Xvecs;
 
   /* initialize output */
-  *dsmPtr = ZERO;
+  *dsmPtr  = ZERO;
+  estimate = SUNFALSE;
+  dsm_idx  = 0;
 
   /* check if the method is stiffly accurate */
   stiffly_accurate = SUNTRUE;
@@ -3207,26 +3211,22 @@ int arkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
     }
   }
 
-  /* If the method is stiffly accurate, ycur is already the new solution */
-
-  if (!stiffly_accurate)
+  /* Compute yerr (if temporal error estimation is enabled). */
+  if (!ark_mem->fixedstep || (ark_mem->AccumErrorType != ARK_ACCUMERROR_NONE))
   {
-    /* Compute time step solution (if necessary) */
-    /*   set arrays for fused vector operation */
-    cvals[0] = ONE;
-    Xvecs[0] = ark_mem->yn;
-    nvec     = 1;
+    /* set arrays for fused vector operation */
+    nvec = 0;
     for (j = 0; j < step_mem->stages; j++)
     {
       if (step_mem->explicit)
       { /* Explicit pieces */
-        cvals[nvec] = ark_mem->h * step_mem->Be->b[j];
+        cvals[nvec] = ark_mem->h * (step_mem->Be->b[j] - step_mem->Be->d[j]);
         Xvecs[nvec] = step_mem->Fe[j];
         nvec += 1;
       }
       if (step_mem->implicit)
       { /* Implicit pieces */
-        cvals[nvec] = ark_mem->h * step_mem->Bi->b[j];
+        cvals[nvec] = ark_mem->h * (step_mem->Bi->b[j] - step_mem->Bi->d[j]);
         Xvecs[nvec] = step_mem->Fi[j];
         nvec += 1;
       }
@@ -3239,44 +3239,56 @@ int arkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
       {
         cj = step_mem->Be->c;
         bj = step_mem->Be->b;
+        dj = step_mem->Be->d;
       }
       else
       {
         cj = step_mem->Bi->c;
         bj = step_mem->Bi->b;
+        dj = step_mem->Bi->d;
       }
 
       for (j = 0; j < step_mem->stages; j++)
       {
         step_mem->stage_times[j] = ark_mem->tn + cj[j] * ark_mem->h;
-        step_mem->stage_coefs[j] = ark_mem->h * bj[j];
+        step_mem->stage_coefs[j] = ark_mem->h * (bj[j] - dj[j]);
       }
 
       arkStep_ApplyForcing(step_mem, step_mem->stage_times,
                            step_mem->stage_coefs, step_mem->stages, &nvec);
     }
 
-    /*   call fused vector operation to do the work */
-    retval = N_VLinearCombination(nvec, cvals, Xvecs, y);
+    /* call fused vector operation to do the work and start the error norm
+       reduction, completed after computing y */
+    estimate = SUNTRUE;
+    sunReduceInit(&dsm_reduce, yerr);
+    dsm_idx = sunReduceAddLinearCombinationWrmsNorm(&dsm_reduce, nvec, cvals,
+                                                    Xvecs, yerr, ark_mem->ewt);
+    if (dsm_idx < 0) { return (ARK_VECTOROP_ERR); }
+    retval = sunReduceBegin(&dsm_reduce);
     if (retval != 0) { return (ARK_VECTOROP_ERR); }
   }
 
-  /* Compute yerr (if temporal error estimation is enabled). */
-  if (!ark_mem->fixedstep || (ark_mem->AccumErrorType != ARK_ACCUMERROR_NONE))
+  /* If the method is stiffly accurate, ycur is already the new solution */
+
+  if (!stiffly_accurate)
   {
-    /* set arrays for fused vector operation */
-    nvec = 0;
+    /* Compute time step solution (if necessary) */
+    /*   set arrays for fused vector operation */
+    cvals[0] = ONE;
+    Xvecs[0] = ark_mem->yn;
+    nvec     = 1;
     for (j = 0; j < step_mem->stages; j++)
     {
       if (step_mem->explicit)
       { /* Explicit pieces */
-        cvals[nvec] = ark_mem->h * (step_mem->Be->b[j] - step_mem->Be->d[j]);
+        cvals[nvec] = ark_mem->h * step_mem->Be->b[j];
         Xvecs[nvec] = step_mem->Fe[j];
         nvec += 1;
       }
       if (step_mem->implicit)
       { /* Implicit pieces */
-        cvals[nvec] = ark_mem->h * (step_mem->Bi->b[j] - step_mem->Bi->d[j]);
+        cvals[nvec] = ark_mem->h * step_mem->Bi->b[j];
         Xvecs[nvec] = step_mem->Fi[j];
         nvec += 1;
       }
@@ -3289,31 +3301,34 @@ int arkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
       {
         cj = step_mem->Be->c;
         bj = step_mem->Be->b;
-        dj = step_mem->Be->d;
       }
       else
       {
         cj = step_mem->Bi->c;
         bj = step_mem->Bi->b;
-        dj = step_mem->Bi->d;
       }
 
       for (j = 0; j < step_mem->stages; j++)
       {
         step_mem->stage_times[j] = ark_mem->tn + cj[j] * ark_mem->h;
-        step_mem->stage_coefs[j] = ark_mem->h * (bj[j] - dj[j]);
+        step_mem->stage_coefs[j] = ark_mem->h * bj[j];
       }
 
       arkStep_ApplyForcing(step_mem, step_mem->stage_times,
                            step_mem->stage_coefs, step_mem->stages, &nvec);
     }
 
-    /* call fused vector operation to do the work */
-    retval = N_VLinearCombination(nvec, cvals, Xvecs, yerr);
+    /*   call fused vector operation to do the work */
+    retval = N_VLinearCombination(nvec, cvals, Xvecs, y);
     if (retval != 0) { return (ARK_VECTOROP_ERR); }
+  }
 
-    /* fill error norm */
-    *dsmPtr = N_VWrmsNorm(yerr, ark_mem->ewt);
+  /* fill error norm */
+  if (estimate)
+  {
+    retval = sunReduceEnd(&dsm_reduce);
+    if (retval != 0) { return (ARK_VECTOROP_ERR); }
+    *dsmPtr = sunReduceValue(&dsm_reduce, dsm_idx);
   }
 
   return (ARK_SUCCESS);
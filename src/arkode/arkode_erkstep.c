@@ -1409,8 +1409,10 @@ int erkStep_CheckButcherTable(ARKodeMem ark_mem)
 int erkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
 {
   /* local data */
-  int retval, j, nvec;
+  int retval, j, nvec, dsm_idx;
   N_Vector y, yerr;
+  sunbooleantype estimate;
+  SUNReduceBatch dsm_reduce;
   sunrealtype* cvals;
   N_Vector* Xvecs;
   ARKodeERKStepMem step_mem;
@@ -1433,7 +1435,45 @@ int erkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
   Xvecs = step_mem->Xvecs;
 
   /* initialize output */
-  *dsmPtr = ZERO;
+  *dsmPtr  = ZERO;
+  estimate = SUNFALSE;
+  dsm_idx  = 0;
+
+  /* Compute yerr (if step adaptivity or error accumulation enabled) */
+  if (!ark_mem->fixedstep || (ark_mem->AccumErrorType != ARK_ACCUMERROR_NONE))
+  {
+    /* set arrays for fused vector operation */
+    nvec = 0;
+    for (j = 0; j < step_mem->stages; j++)
+    {
+      cvals[nvec] = ark_mem->h * (step_mem->B->b[j] - step_mem->B->d[j]);
+      Xvecs[nvec] = step_mem->F[j];
+      nvec += 1;
+    }
+
+    /* apply external polynomial forcing */
+    if (step_mem->nforcing > 0)
+    {
+      for (j = 0; j < step_mem->stages; j++)
+      {
+        step_mem->stage_times[j] = ark_mem->tn + step_mem->B->c[j] * ark_mem->h;
+        step_mem->stage_coefs[j] = ark_mem->h *
+                                   (step_mem->B->b[j] - step_mem->B->d[j]);
+      }
+      erkStep_ApplyForcing(step_mem, step_mem->stage_times,
+                           step_mem->stage_coefs, step_mem->stages, &nvec);
+    }
+
+    /* call fused vector operation to do the work and start the error norm
+       reduction, completed after computing y */
+    estimate = SUNTRUE;
+    sunReduceInit(&dsm_reduce, yerr);
+    dsm_idx = sunReduceAddLinearCombinationWrmsNorm(&dsm_reduce, nvec, cvals,
+                                                    Xvecs, yerr, ark_mem->ewt);
+    if (dsm_idx < 0) { return (ARK_VECTOROP_ERR); }
+    retval = sunReduceBegin(&dsm_reduce);
+    if (retval != 0) { return (ARK_VECTOROP_ERR); }
+  }
 
   /* Compute time step solution */
   /*   set arrays for fused vector operation */
@@ -1464,37 +1504,12 @@ int erkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
   retval = N_VLinearCombination(nvec, cvals, Xvecs, y);
   if (retval != 0) { return (ARK_VECTOROP_ERR); }
 
-  /* Compute yerr (if step adaptivity or error accumulation enabled) */
-  if (!ark_mem->fixedstep || (ark_mem->AccumErrorType != ARK_ACCUMERROR_NONE))
+  /* fill error norm */
+  if (estimate)
   {
-    /* set arrays for fused vector operation */
-    nvec = 0;
-    for (j = 0; j < step_mem->stages; j++)
-    {
-      cvals[nvec] = ark_mem->h * (step_mem->B->b[j] - step_mem->B->d[j]);
-      Xvecs[nvec] = step_mem->F[j];
-      nvec += 1;
-    }
-
-    /* apply external polynomial forcing */
-    if (step_mem->nforcing > 0)
-    {
-      for (j = 0; j < step_mem->stages; j++)
-      {
-        step_mem->stage_times[j] = ark_mem->tn + step_mem->B->c[j] * ark_mem->h;
-        step_mem->stage_coefs[j] = ark_mem->h *
-                                   (step_mem->B->b[j] - step_mem->B->d[j]);
-      }
-      erkStep_ApplyForcing(step_mem, step_mem->stage_times,
-                           step_mem->stage_coefs, step_mem->stages, &nvec);
-    }
-
-    /* call fused vector operation to do the work */
-    retval = N_VLinearCombination(nvec, cvals, Xvecs, yerr);
+    retval = sunReduceEnd(&dsm_reduce);
     if (retval != 0) { return (ARK_VECTOROP_ERR); }
-
-    /* fill error norm */
-    *dsmPtr = N_VWrmsNorm(yerr, ark_mem->ewt);
+    *dsmPtr = sunReduceValue(&dsm_reduce, dsm_idx);
   }
 
   return (ARK_SUCCESS);
@@ -596,6 +596,162 @@ int ARKodeSetJacFn(void* arkode_mem, ARKLsJacFn jac)
   return (ARKLS_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKodeSetJacSparsity specifies the sparsity pattern of the
+  Jacobian used by the internal difference quotient approximation
+  with a sparse matrix. The columns of the pattern are colored so
+  that the Jacobian is formed with one call to fi per color.
+  ---------------------------------------------------------------*/
+int ARKodeSetJacSparsity(void* arkode_mem, SUNMatrix S)
+{
+  ARKodeMem ark_mem;
+  ARKLsMem arkls_mem;
+  SUNErrCode ier;
+  int retval;
+
+  /* Return immediately if arkode_mem is NULL */
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Guard against use for time steppers that do not need an algebraic solver */
+  if (!ark_mem->step_supports_implicit)
+  {
+    arkProcessError(ark_mem, ARK_STEPPER_UNSUPPORTED, __LINE__, __func__,
+                    __FILE__, "time-stepping module does not require an algebraic solver");
+    return (ARK_STEPPER_UNSUPPORTED);
+  }
+
+  /* access ARKLsMem structure */
+  retval = arkLs_AccessLMem(ark_mem, __func__, &arkls_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* free any existing pattern */
+  sunSparseDQ_Free(&(arkls_mem->sparseDQ));
+
+  if (S == NULL) { return (ARKLS_SUCCESS); }
+
+  /* return with failure if the pattern cannot be used */
+  if ((arkls_mem->A == NULL) ||
+      (SUNMatGetID(arkls_mem->A) != SUNMATRIX_SPARSE) ||
+      (SUNMatGetID(S) != SUNMATRIX_SPARSE))
+  {
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Jacobian sparsity requires sparse SUNMatrix objects");
+    return (ARKLS_ILL_INPUT);
+  }
+  if ((SUNSparseMatrix_Rows(S) != SUNSparseMatrix_Rows(arkls_mem->A)) ||
+      (SUNSparseMatrix_Columns(S) != SUNSparseMatrix_Columns(arkls_mem->A)))
+  {
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Jacobian sparsity and SUNMatrix dimensions do not match");
+    return (ARKLS_ILL_INPUT);
+  }
+
+  /* store the pattern and color its columns */
+  ier = sunSparseDQ_SetPattern(&(arkls_mem->sparseDQ), S,
+                               SUNSparseMatrix_SparseType(arkls_mem->A));
+  if (ier == SUN_ERR_MEM_FAIL)
+  {
+    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (ARKLS_MEM_FAIL);
+  }
+  else if (ier != SUN_SUCCESS)
+  {
+    arkProcessError(ark_mem, ARKLS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_SUNMAT_FAILED);
+    return (ARKLS_SUNMAT_FAIL);
+  }
+
+  return (ARKLS_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkLsProbeRhs evaluates fi for ARKodeComputeJacSparsity and
+  arkLsSparseDQJac
+  ---------------------------------------------------------------*/
+static int arkLsProbeRhs(sunrealtype t, N_Vector* y, N_Vector fy,
+                         void* arkode_mem)
+{
+  ARKodeMem ark_mem = (ARKodeMem)arkode_mem;
+  ARKRhsFn fi       = ark_mem->step_getimplicitrhs(ark_mem);
+  return (fi(t, y[0], fy, ark_mem->user_data));
+}
+
+/*---------------------------------------------------------------
+  ARKodeComputeJacSparsity detects the sparsity pattern of the
+  Jacobian of the implicit right-hand side function fi at (t, y)
+  by probing fi one column at a time. Component j of y is set to
+  NaN and the rows of the result that change are the nonzeros of
+  column j. If fi returns a nonzero value for a NaN input, a
+  finite increment is used for that column instead. The pattern is
+  returned in a new sparse matrix of type sparsetype with exactly
+  the detected nonzeros, all set to one.
+  ---------------------------------------------------------------*/
+int ARKodeComputeJacSparsity(void* arkode_mem, sunrealtype t, N_Vector y,
+                             int sparsetype, SUNMatrix* S)
+{
+  ARKodeMem ark_mem;
+  ARKRhsFn fi;
+  SUNErrCode ier;
+
+  /* Return immediately if arkode_mem is NULL */
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARKLS_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARKLS_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Guard against use for time steppers that do not need an algebraic solver */
+  if (!ark_mem->step_supports_implicit ||
+      (ark_mem->step_getimplicitrhs == NULL))
+  {
+    arkProcessError(ark_mem, ARK_STEPPER_UNSUPPORTED, __LINE__, __func__,
+                    __FILE__, "time-stepping module does not require an algebraic solver");
+    return (ARK_STEPPER_UNSUPPORTED);
+  }
+  fi = ark_mem->step_getimplicitrhs(ark_mem);
+
+  /* Check for legal inputs */
+  if ((y == NULL) || (S == NULL) || (fi == NULL) ||
+      ((sparsetype != CSC_MAT) && (sparsetype != CSR_MAT)))
+  {
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Illegal input for the Jacobian sparsity detection");
+    return (ARKLS_ILL_INPUT);
+  }
+  ier = sunComputeJacSparsity(arkLsProbeRhs, ark_mem, t, 1, &y,
+                              SUNRsqrt(ark_mem->uround), sparsetype, S);
+
+  switch (ier)
+  {
+  case SUN_SUCCESS: return (ARKLS_SUCCESS);
+  case SUN_ERR_ARG_INCOMPATIBLE:
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_LS_PROBE_NVECTOR);
+    return (ARKLS_ILL_INPUT);
+  case SUN_ERR_MEM_FAIL:
+    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (ARKLS_MEM_FAIL);
+  case SUN_ERR_USER_FCN_FAIL:
+    arkProcessError(ark_mem, ARK_RHSFUNC_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_PROBE_FAILED);
+    return (ARK_RHSFUNC_FAIL);
+  default:
+    arkProcessError(ark_mem, ARKLS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_SUNMAT_FAILED);
+    return (ARKLS_SUNMAT_FAIL);
+  }
+}
+
 /*---------------------------------------------------------------
   ARKodeSetMassFn specifies the mass matrix function.
   ---------------------------------------------------------------*/
@@ -2558,7 +2714,7 @@ int arkLsMPSolve(void* arkode_mem, N_Vector r, N_Vector z, sunrealtype tol, int
 /*---------------------------------------------------------------
   arkLsDQJac:
 
-  This routine is a wrapper for the Dense and Band
+  This routine is a wrapper for the Dense, Band and Sparse
   implementations of the difference quotient Jacobian
   approximation routines.
   ---------------------------------------------------------------*/
@@ -2615,6 +2771,11 @@ int arkLsDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   {
     retval = arkLsBandDQJac(t, y, fy, Jac, ark_mem, arkls_mem, fi, tmp1, tmp2);
   }
+  else if ((SUNMatGetID(Jac) == SUNMATRIX_SPARSE) &&
+           (arkls_mem->sparseDQ.pattern != NULL))
+  {
+    retval = arkLsSparseDQJac(t, y, fy, Jac, ark_mem, arkls_mem, tmp1, tmp2);
+  }
   else
   {
     arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
@@ -2659,8 +2820,9 @@ int arkLsDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   /* Obtain pointers to the data for various vectors */
   ewt_data = N_VGetArrayPointer(ark_mem->ewt);
   y_data   = N_VGetArrayPointer(y);
-  cns_data = (ark_mem->constraintsSet) ? N_VGetArrayPointer(ark_mem->constraints)
-                                       : NULL;
+  cns_data   = (ark_mem->constraintsSet)
+                 ? N_VGetArrayPointer(ark_mem->constraints)
+                 : NULL;
 
   /* Set minimum increment based on uround and norm of f */
   srur   = SUNRsqrt(ark_mem->uround);
@@ -2748,8 +2910,9 @@ int arkLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   ftemp_data = N_VGetArrayPointer(ftemp);
   y_data     = N_VGetArrayPointer(y);
   ytemp_data = N_VGetArrayPointer(ytemp);
-  cns_data = (ark_mem->constraintsSet) ? N_VGetArrayPointer(ark_mem->constraints)
-                                       : NULL;
+  cns_data   = (ark_mem->constraintsSet)
+                 ? N_VGetArrayPointer(ark_mem->constraints)
+                 : NULL;
 
   /* Load ytemp with y = predicted y vector */
   N_VScale(ONE, y, ytemp);
@@ -2829,6 +2992,71 @@ int arkLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   return (retval);
 }
 
+/*---------------------------------------------------------------
+  arkLsSparseDQJac:
+
+  This routine generates a sparse difference quotient approximation
+  to the Jacobian of f(t,y) on the pattern set with
+  ARKodeSetJacSparsity. Columns of the same color have no rows in
+  common, so they are incremented together and the Jacobian is
+  formed with one call to f per color. The entries are computed in
+  the stored copy of the pattern in the format of Jac and then
+  copied into Jac.
+  ---------------------------------------------------------------*/
+int arkLsSparseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                     ARKodeMem ark_mem, ARKLsMem arkls_mem, N_Vector tmp1,
+                     N_Vector tmp2)
+{
+  sunrealtype fnorm, minInc, inc, srur, conj, one;
+  sunrealtype *ewt_data, *y_data, *cns_data, *inc_data;
+  sunindextype j, N;
+
+  /* Obtain pointers to the data for ewt, y, and the column increments */
+  N        = SUNSparseMatrix_Columns(Jac);
+  ewt_data = N_VGetArrayPointer(ark_mem->ewt);
+  y_data   = N_VGetArrayPointer(y);
+  inc_data = arkls_mem->sparseDQ.inc;
+  cns_data = (ark_mem->constraintsSet)
+               ? N_VGetArrayPointer(ark_mem->constraints)
+               : NULL;
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(ark_mem->uround);
+  fnorm  = N_VWrmsNorm(fy, ark_mem->rwt);
+  minInc = (fnorm != ZERO) ? (MIN_INC_MULT * SUNRabs(ark_mem->h) *
+                               ark_mem->uround * N * fnorm)
+                           : ONE;
+
+  /* Set the increment of each column */
+  for (j = 0; j < N; j++)
+  {
+    inc = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+    /* Adjust sign(inc) if yj has an inequality constraint. */
+    if (ark_mem->constraintsSet)
+    {
+      conj = cns_data[j];
+      if (SUNRabs(conj) == ONE)
+      {
+        if ((y_data[j] + inc) * conj < ZERO) { inc = -inc; }
+      }
+      else if (SUNRabs(conj) == TWO)
+      {
+        if ((y_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+      }
+    }
+
+    inc_data[j] = inc;
+  }
+
+  /* Form the Jacobian with one call to fi per color, using tmp2 and tmp1 as
+     temporary values of y and f */
+  one = ONE;
+  return (sunSparseDQ_Jac(&(arkls_mem->sparseDQ), arkLsProbeRhs, ark_mem, t, 1,
+                          &y, &tmp2, &one, fy, tmp1, Jac,
+                          &(arkls_mem->nfeDQ)));
+}
+
 /*---------------------------------------------------------------
   arkLsDQJtimes:
 
@@ -3017,7 +3245,9 @@ int arkLsInitialize(ARKodeMem ark_mem)
         if (arkls_mem->A->ops->getid)
         {
           if ((SUNMatGetID(arkls_mem->A) == SUNMATRIX_DENSE) ||
-              (SUNMatGetID(arkls_mem->A) == SUNMATRIX_BAND))
+              (SUNMatGetID(arkls_mem->A) == SUNMATRIX_BAND) ||
+              ((SUNMatGetID(arkls_mem->A) == SUNMATRIX_SPARSE) &&
+               (arkls_mem->sparseDQ.pattern != NULL)))
           {
             arkls_mem->jac    = arkLsDQJac;
             arkls_mem->J_data = ark_mem;
@@ -3550,6 +3780,9 @@ int arkLsFree(ARKodeMem ark_mem)
     arkls_mem->savedJ = NULL;
   }
 
+  /* Free the Jacobian sparsity pattern and coloring */
+  sunSparseDQ_Free(&(arkls_mem->sparseDQ));
+
   /* Nullify other N_Vector pointers */
   arkls_mem->ycur = NULL;
   arkls_mem->fcur = NULL;
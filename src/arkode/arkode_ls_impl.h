@@ -21,6 +21,7 @@
 #include <arkode/arkode_ls.h>
 
 #include "arkode_impl.h"
+#include "sundials_sparsedq_impl.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -56,6 +57,9 @@ typedef struct ARKLsMemRec
   void* J_data;         /* user data is passed to jac                    */
   sunbooleantype jbad;  /* heuristic suggestion for pset                 */
 
+  /* Sparse DQ Jacobian: pattern of df/dy and its column coloring */
+  sunSparseDQMem sparseDQ;
+
   /* Matrix-based solver, scale solution to account for change in gamma */
   sunbooleantype scalesol;
 
@@ -216,6 +220,9 @@ int arkLsDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
 int arkLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
                    ARKodeMem ark_mem, ARKLsMem arkls_mem, ARKRhsFn fi,
                    N_Vector tmp1, N_Vector tmp2);
+int arkLsSparseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                     ARKodeMem ark_mem, ARKLsMem arkls_mem, N_Vector tmp1,
+                     N_Vector tmp2);
 
 /* Generic linit/lsetup/lsolve/lfree interface routines for ARKODE to call */
 int arkLsInitialize(ARKodeMem ark_mem);
@@ -284,6 +291,10 @@ int arkLSGetCurrentMassMatrix(ARKodeMem ark_mem, SUNMatrix* M);
   "The mass matrix routine failed in an unrecoverable manner."
 #define MSG_LS_SUNMAT_FAILED \
   "A SUNMatrix routine failed in an unrecoverable manner."
+#define MSG_LS_PROBE_NVECTOR \
+  "Sparsity detection requires a non-distributed vector with array access."
+#define MSG_LS_PROBE_FAILED \
+  "The fi routine failed or is not finite while probing the sparsity."
 
 #ifdef __cplusplus
 }
@@ -2229,8 +2229,8 @@ int mriStep_TakeStepMRIGARK(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPt
        solution and embedding, store in ark_mem->tempv1, and take norm. */
     if (do_embedding)
     {
-      N_VLinearSum(ONE, ark_mem->tempv4, -ONE, ark_mem->ycur, ark_mem->tempv1);
-      *dsmPtr = N_VWrmsNorm(ark_mem->tempv1, ark_mem->ewt);
+      *dsmPtr = N_VLinearSumWrmsNorm(ONE, ark_mem->tempv4, -ONE, ark_mem->ycur,
+                                     ark_mem->tempv1, ark_mem->ewt);
     }
 
     SUNLogInfo(ARK_LOGGER, "end-stage", "status = success");
@@ -2694,8 +2694,8 @@ int mriStep_TakeStepMRISR(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
      copy solution back to ycur */
   if (!ark_mem->fixedstep || (ark_mem->AccumErrorType != ARK_ACCUMERROR_NONE))
   {
-    N_VLinearSum(ONE, ytilde, -ONE, ark_mem->ycur, ark_mem->tempv1);
-    *dsmPtr = N_VWrmsNorm(ark_mem->tempv1, ark_mem->ewt);
+    *dsmPtr = N_VLinearSumWrmsNorm(ONE, ytilde, -ONE, ark_mem->ycur,
+                                   ark_mem->tempv1, ark_mem->ewt);
     N_VScale(ONE, ytilde, ark_mem->ycur);
   }
 
@@ -3033,8 +3033,8 @@ int mriStep_TakeStepMERK(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
      step solution and embedding, store in ark_mem->tempv1, and store norm in dsmPtr */
   if (!ark_mem->fixedstep || (ark_mem->AccumErrorType != ARK_ACCUMERROR_NONE))
   {
-    N_VLinearSum(ONE, ytilde, -ONE, ark_mem->ycur, ark_mem->tempv1);
-    *dsmPtr = N_VWrmsNorm(ark_mem->tempv1, ark_mem->ewt);
+    *dsmPtr = N_VLinearSumWrmsNorm(ONE, ytilde, -ONE, ark_mem->ycur,
+                                   ark_mem->tempv1, ark_mem->ewt);
   }
 
   return (ARK_SUCCESS);
@@ -187,8 +187,7 @@ static int cvDoErrorTest(CVodeMem cv_mem, int* nflagPtr, sunrealtype saved_t,
 static void cvCompleteStep(CVodeMem cv_mem);
 static void cvPrepareNextStep(CVodeMem cv_mem, sunrealtype dsm);
 static void cvSetEta(CVodeMem cv_mem);
-static sunrealtype cvComputeEtaqm1(CVodeMem cv_mem);
-static sunrealtype cvComputeEtaqp1(CVodeMem cv_mem);
+static void cvComputeEtaqm1qp1(CVodeMem cv_mem);
 static void cvChooseEta(CVodeMem cv_mem);
 
 /* Function to handle failures */
@@ -1865,7 +1864,8 @@ static sunbooleantype cvCheckNvector(N_Vector tmpl)
 
 static sunbooleantype cvAllocVectors(CVodeMem cv_mem, N_Vector tmpl)
 {
-  int i, j;
+  int j;
+  N_Vector* zn;
 
   /* Allocate ewt, acor, tempv, ftemp */
 
@@ -1929,25 +1929,26 @@ static sunbooleantype cvAllocVectors(CVodeMem cv_mem, N_Vector tmpl)
     return (SUNFALSE);
   }
 
-  /* Allocate zn[0] ... zn[qmax] */
+  /* Allocate zn[0] ... zn[qmax] in a single block (when supported by the
+     vector) so the fused operations on the Nordsieck array can use blocked
+     kernels. The block is owned by zn[0] and freed with the other vectors. */
 
-  for (j = 0; j <= cv_mem->cv_qmax; j++)
+  zn = N_VCloneVectorArrayContiguous(cv_mem->cv_qmax + 1, tmpl);
+  if (zn == NULL)
   {
-    cv_mem->cv_zn[j] = N_VClone(tmpl);
-    if (cv_mem->cv_zn[j] == NULL)
-    {
-      N_VDestroy(cv_mem->cv_ewt);
-      N_VDestroy(cv_mem->cv_acor);
-      N_VDestroy(cv_mem->cv_tempv);
-      N_VDestroy(cv_mem->cv_ftemp);
-      N_VDestroy(cv_mem->cv_vtemp1);
-      N_VDestroy(cv_mem->cv_vtemp2);
-      N_VDestroy(cv_mem->cv_vtemp3);
-      for (i = 0; i < j; i++) { N_VDestroy(cv_mem->cv_zn[i]); }
-      return (SUNFALSE);
-    }
+    N_VDestroy(cv_mem->cv_ewt);
+    N_VDestroy(cv_mem->cv_acor);
+    N_VDestroy(cv_mem->cv_tempv);
+    N_VDestroy(cv_mem->cv_ftemp);
+    N_VDestroy(cv_mem->cv_vtemp1);
+    N_VDestroy(cv_mem->cv_vtemp2);
+    N_VDestroy(cv_mem->cv_vtemp3);
+    return (SUNFALSE);
   }
 
+  for (j = 0; j <= cv_mem->cv_qmax; j++) { cv_mem->cv_zn[j] = zn[j]; }
+  free(zn);
+
   /* Update solver workspace lengths  */
   cv_mem->cv_lrw += (cv_mem->cv_qmax + 8) * cv_mem->cv_lrw1;
   cv_mem->cv_liw += (cv_mem->cv_qmax + 8) * cv_mem->cv_liw1;
@@ -3550,9 +3551,8 @@ static void cvPrepareNextStep(CVodeMem cv_mem, sunrealtype dsm)
       /* If qwait = 0, consider an order change.   etaqm1 and etaqp1 are
         the ratios of new to old h at orders q-1 and q+1, respectively.
         cvChooseEta selects the largest; cvSetEta adjusts eta and acor */
-      cv_mem->cv_qwait  = 2;
-      cv_mem->cv_etaqm1 = cvComputeEtaqm1(cv_mem);
-      cv_mem->cv_etaqp1 = cvComputeEtaqp1(cv_mem);
+      cv_mem->cv_qwait = 2;
+      cvComputeEtaqm1qp1(cv_mem);
       cvChooseEta(cv_mem);
       cvSetEta(cv_mem);
     }
@@ -3604,51 +3604,63 @@ static void cvSetEta(CVodeMem cv_mem)
 }
 
 /*
- * cvComputeEtaqm1
+ * cvComputeEtaqm1qp1
  *
- * This routine computes and returns the value of etaqm1 for a
- * possible decrease in order by 1.
+ * This routine computes the values of etaqm1 and etaqp1 for a
+ * possible decrease or increase in order by 1. The norms for both
+ * are combined into a single reduction.
  */
 
-static sunrealtype cvComputeEtaqm1(CVodeMem cv_mem)
+static void cvComputeEtaqm1qp1(CVodeMem cv_mem)
 {
-  sunrealtype ddn;
+  int iddn, idup;
+  sunbooleantype qm1, qp1;
+  sunrealtype ddn, dup, cquot;
+  SUNReduceBatch nrm;
 
   cv_mem->cv_etaqm1 = ZERO;
-  if (cv_mem->cv_q > 1)
-  {
-    ddn = N_VWrmsNorm(cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_ewt) *
-          cv_mem->cv_tq[1];
-    cv_mem->cv_etaqm1 = ONE /
-                        (SUNRpowerR(BIAS1 * ddn, ONE / cv_mem->cv_q) + ADDON);
-  }
-  return (cv_mem->cv_etaqm1);
-}
+  cv_mem->cv_etaqp1 = ZERO;
 
-/*
- * cvComputeEtaqp1
- *
- * This routine computes and returns the value of etaqp1 for a
- * possible increase in order by 1.
- */
+  qm1 = (cv_mem->cv_q > 1);
+  qp1 = (cv_mem->cv_q != cv_mem->cv_qmax) && (cv_mem->cv_saved_tq5 != ZERO);
+  if (!qm1 && !qp1) { return; }
 
-static sunrealtype cvComputeEtaqp1(CVodeMem cv_mem)
-{
-  sunrealtype dup, cquot;
+  iddn = idup = 0;
+  sunReduceInit(&nrm, cv_mem->cv_ewt);
 
-  cv_mem->cv_etaqp1 = ZERO;
-  if (cv_mem->cv_q != cv_mem->cv_qmax)
+  if (qm1)
+  {
+    iddn = sunReduceAddWrmsNorm(&nrm, cv_mem->cv_zn[cv_mem->cv_q],
+                                cv_mem->cv_ewt);
+  }
+
+  if (qp1)
   {
-    if (cv_mem->cv_saved_tq5 == ZERO) { return (cv_mem->cv_etaqp1); }
     cquot = (cv_mem->cv_tq[5] / cv_mem->cv_saved_tq5) *
             SUNRpowerI(cv_mem->cv_h / cv_mem->cv_tau[2], cv_mem->cv_L);
-    N_VLinearSum(-cquot, cv_mem->cv_zn[cv_mem->cv_qmax], ONE, cv_mem->cv_acor,
-                 cv_mem->cv_tempv);
-    dup = N_VWrmsNorm(cv_mem->cv_tempv, cv_mem->cv_ewt) * cv_mem->cv_tq[3];
+    idup  = sunReduceAddLinearSumWrmsNorm(&nrm, -cquot,
+                                          cv_mem->cv_zn[cv_mem->cv_qmax], ONE,
+                                          cv_mem->cv_acor, cv_mem->cv_tempv,
+                                          cv_mem->cv_ewt);
+  }
+
+  /* on failure keep the current order, i.e., etaqm1 = etaqp1 = 0 */
+  if (sunReduceBegin(&nrm) != SUN_SUCCESS) { return; }
+  if (sunReduceEnd(&nrm) != SUN_SUCCESS) { return; }
+
+  if (qm1)
+  {
+    ddn = sunReduceValue(&nrm, iddn) * cv_mem->cv_tq[1];
+    cv_mem->cv_etaqm1 = ONE /
+                        (SUNRpowerR(BIAS1 * ddn, ONE / cv_mem->cv_q) + ADDON);
+  }
+
+  if (qp1)
+  {
+    dup = sunReduceValue(&nrm, idup) * cv_mem->cv_tq[3];
     cv_mem->cv_etaqp1 =
       ONE / (SUNRpowerR(BIAS3 * dup, ONE / (cv_mem->cv_L + 1)) + ADDON);
   }
-  return (cv_mem->cv_etaqp1);
 }
 
 /*
@@ -3828,8 +3840,9 @@ static int cvHandleFailure(CVodeMem cv_mem, int flag)
 
 static void cvBDFStab(CVodeMem cv_mem)
 {
-  int i, k, ldflag, factorial;
+  int i, k, ldflag, factorial, isqm1, isqm2;
   sunrealtype sq, sqm1, sqm2;
+  SUNReduceBatch nrm;
 
   /* If order is 3 or greater, then save scaled derivative data,
      push old data down in i, then add current values to top.    */
@@ -3847,10 +3860,18 @@ static void cvBDFStab(CVodeMem cv_mem)
     for (i = 1; i <= cv_mem->cv_q - 1; i++) { factorial *= i; }
     sq = factorial * cv_mem->cv_q * (cv_mem->cv_q + 1) * cv_mem->cv_acnrm /
          SUNMAX(cv_mem->cv_tq[5], TINY);
-    sqm1 = factorial * cv_mem->cv_q *
-           N_VWrmsNorm(cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_ewt);
-    sqm2 = factorial *
-           N_VWrmsNorm(cv_mem->cv_zn[cv_mem->cv_q - 1], cv_mem->cv_ewt);
+
+    /* compute both norms with a single reduction */
+    sunReduceInit(&nrm, cv_mem->cv_ewt);
+    isqm1 = sunReduceAddWrmsNorm(&nrm, cv_mem->cv_zn[cv_mem->cv_q],
+                                 cv_mem->cv_ewt);
+    isqm2 = sunReduceAddWrmsNorm(&nrm, cv_mem->cv_zn[cv_mem->cv_q - 1],
+                                 cv_mem->cv_ewt);
+    if (sunReduceBegin(&nrm) != SUN_SUCCESS) { return; }
+    if (sunReduceEnd(&nrm) != SUN_SUCCESS) { return; }
+
+    sqm1 = factorial * cv_mem->cv_q * sunReduceValue(&nrm, isqm1);
+    sqm2 = factorial * sunReduceValue(&nrm, isqm2);
     cv_mem->cv_ssdat[1][1] = sqm2 * sqm2;
     cv_mem->cv_ssdat[1][2] = sqm1 * sqm1;
     cv_mem->cv_ssdat[1][3] = sq * sq;
@@ -4792,12 +4813,12 @@ static int cvEwtSetSS(CVodeMem cv_mem, N_Vector ycur, N_Vector weight)
   if (cv_mem->cv_usefused)
   {
     /* We compute weight (inverse of tempv) regardless of the component test
-       since it will be thrown away in this case anyways. */
-    cvEwtSetSS_fused(cv_mem->cv_atolmin0, cv_mem->cv_reltol, cv_mem->cv_Sabstol,
-                     ycur, cv_mem->cv_tempv, weight);
-    if (cv_mem->cv_atolmin0)
+       since it will be thrown away in this case anyways. The fused kernel
+       tests for non-positive components when atolmin0 is set. */
+    if (cvEwtSetSS_fused(cv_mem->cv_atolmin0, cv_mem->cv_reltol,
+                         cv_mem->cv_Sabstol, ycur, cv_mem->cv_tempv, weight))
     {
-      if (N_VMin(cv_mem->cv_tempv) <= ZERO) return (-1);
+      return (-1);
     }
   }
   else
@@ -4832,12 +4853,12 @@ static int cvEwtSetSV(CVodeMem cv_mem, N_Vector ycur, N_Vector weight)
   if (cv_mem->cv_usefused)
   {
     /* We compute weight (inverse of tempv) regardless of the component test
-       since it will be thrown away in this case anyways. */
-    cvEwtSetSV_fused(cv_mem->cv_atolmin0, cv_mem->cv_reltol, cv_mem->cv_Vabstol,
-                     ycur, cv_mem->cv_tempv, weight);
-    if (cv_mem->cv_atolmin0)
+       since it will be thrown away in this case anyways. The fused kernel
+       tests for non-positive components when atolmin0 is set. */
+    if (cvEwtSetSV_fused(cv_mem->cv_atolmin0, cv_mem->cv_reltol,
+                         cv_mem->cv_Vabstol, ycur, cv_mem->cv_tempv, weight))
     {
-      if (N_VMin(cv_mem->cv_tempv) <= ZERO) return (-1);
+      return (-1);
     }
   }
   else
@@ -46,6 +46,22 @@ constexpr auto gpuAssert            = SUNDIALS_HIP_Assert;
 #error Incompatible GPU option for fused kernels
 #endif
 
+/*
+ * -----------------------------------------------------------------
+ * Returns SUNTRUE for the vector of the GPU backend the kernels are
+ * built for, the kernels access the vector content directly.
+ * -----------------------------------------------------------------
+ */
+
+extern "C" sunbooleantype cvFusedSupportsVector(const N_Vector v)
+{
+#ifdef USE_CUDA
+  return N_VGetVectorID(v) == SUNDIALS_NVEC_CUDA;
+#else
+  return N_VGetVectorID(v) == SUNDIALS_NVEC_HIP;
+#endif
+}
+
 /*
  * -----------------------------------------------------------------
  * Compute the ewt vector when the tol type is CV_SS.
@@ -93,6 +109,11 @@ extern "C" int cvEwtSetSS_fused(const sunbooleantype atolMin0,
   if (!gpuAssert(gpuGetLastError(), __FILE__, __LINE__)) return -1;
 #endif
 
+  if (atolMin0)
+  {
+    if (N_VMin(tempv) <= 0.0) { return -1; }
+  }
+
   return 0;
 }
 
@@ -144,6 +165,11 @@ extern "C" int cvEwtSetSV_fused(const sunbooleantype atolMin0,
   if (!gpuAssert(gpuGetLastError(), __FILE__, __LINE__)) return -1;
 #endif
 
+  if (atolMin0)
+  {
+    if (N_VMin(tempv) <= 0.0) { return -1; }
+  }
+
   return 0;
 }
 
@@ -12,13 +12,17 @@
  * SPDX-License-Identifier: BSD-3-Clause
  * SUNDIALS Copyright End
  * -----------------------------------------------------------------
- * This file implements fused stub kernels for CVODE.
+ * This file implements fused CPU kernels for CVODE. With the serial
+ * and OpenMP vectors each operation is a single pass over the data
+ * (multithreaded in the OpenMP case). Other vectors fall back to the
+ * equivalent sequence of generic vector operations.
  * -----------------------------------------------------------------
  */
 
+#include <nvector/nvector_openmp.h>
+
 #include "cvode_diag_impl.h"
 #include "cvode_impl.h"
-#include "sundials_macros.h"
 
 #define ZERO   SUN_RCONST(0.0)
 #define PT1    SUN_RCONST(0.1)
@@ -26,6 +30,52 @@
 #define ONEPT5 SUN_RCONST(1.50)
 #define ONE    SUN_RCONST(1.0)
 
+/* OpenMP directives for the CPU kernels, omitted when the library is not
+   compiled with OpenMP support */
+#ifdef _OPENMP
+#define CV_OMP(directive) _Pragma(#directive)
+#else
+#define CV_OMP(directive)
+#endif
+
+/*
+ * -----------------------------------------------------------------
+ * Returns the number of threads to use in the CPU kernels for the
+ * vector v or 0 if the kernels do not support the vector.
+ * -----------------------------------------------------------------
+ */
+
+static int cvFusedNumThreads(N_Vector v)
+{
+  switch (N_VGetVectorID(v))
+  {
+  case SUNDIALS_NVEC_SERIAL: return 1;
+#ifdef _OPENMP
+  case SUNDIALS_NVEC_OPENMP: return NV_NUM_THREADS_OMP(v);
+#endif
+  default: return 0;
+  }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Returns SUNTRUE for the vectors the fused kernels may be used
+ * with. The GPU vectors use the generic fallback.
+ * -----------------------------------------------------------------
+ */
+
+sunbooleantype cvFusedSupportsVector(const N_Vector v)
+{
+  switch (N_VGetVectorID(v))
+  {
+  case SUNDIALS_NVEC_SERIAL:
+  case SUNDIALS_NVEC_OPENMP:
+  case SUNDIALS_NVEC_CUDA:
+  case SUNDIALS_NVEC_HIP: return SUNTRUE;
+  default: return SUNFALSE;
+  }
+}
+
 /*
  * -----------------------------------------------------------------
  * Compute the ewt vector when the tol type is CV_SS.
@@ -36,6 +86,42 @@ int cvEwtSetSS_fused(const sunbooleantype atolmin0, const sunrealtype reltol,
                      const sunrealtype Sabstol, const N_Vector ycur,
                      N_Vector tempv, N_Vector weight)
 {
+  sunindextype i, N;
+  sunrealtype min, tmin, *yd, *td, *wd;
+  int nt;
+
+  nt = cvFusedNumThreads(weight);
+
+  if (nt > 0)
+  {
+    N  = N_VGetLength(weight);
+    yd = N_VGetArrayPointer(ycur);
+    td = N_VGetArrayPointer(tempv);
+    wd = N_VGetArrayPointer(weight);
+
+    /* tempv = reltol * |ycur| + Sabstol, weight = 1 / tempv and the minimum
+       of tempv in one pass, weight is undefined if the minimum is <= 0 */
+    min = SUN_BIG_REAL;
+    CV_OMP(omp parallel private(i, tmin) num_threads(nt) if (nt > 1))
+    {
+      tmin = SUN_BIG_REAL;
+      CV_OMP(omp for schedule(static))
+      for (i = 0; i < N; i++)
+      {
+        td[i] = reltol * SUNRabs(yd[i]) + Sabstol;
+        if (td[i] < tmin) { tmin = td[i]; }
+        wd[i] = ONE / td[i];
+      }
+      CV_OMP(omp critical)
+      {
+        if (tmin < min) { min = tmin; }
+      }
+    }
+
+    if (atolmin0 && min <= ZERO) { return (-1); }
+    return 0;
+  }
+
   N_VAbs(ycur, tempv);
   N_VScale(reltol, tempv, tempv);
   N_VAddConst(tempv, Sabstol, tempv);
@@ -57,6 +143,43 @@ int cvEwtSetSV_fused(const sunbooleantype atolmin0, const sunrealtype reltol,
                      const N_Vector Vabstol, const N_Vector ycur,
                      N_Vector tempv, N_Vector weight)
 {
+  sunindextype i, N;
+  sunrealtype min, tmin, *ad, *yd, *td, *wd;
+  int nt;
+
+  nt = cvFusedNumThreads(weight);
+
+  if (nt > 0)
+  {
+    N  = N_VGetLength(weight);
+    ad = N_VGetArrayPointer(Vabstol);
+    yd = N_VGetArrayPointer(ycur);
+    td = N_VGetArrayPointer(tempv);
+    wd = N_VGetArrayPointer(weight);
+
+    /* tempv = reltol * |ycur| + Vabstol, weight = 1 / tempv and the minimum
+       of tempv in one pass, weight is undefined if the minimum is <= 0 */
+    min = SUN_BIG_REAL;
+    CV_OMP(omp parallel private(i, tmin) num_threads(nt) if (nt > 1))
+    {
+      tmin = SUN_BIG_REAL;
+      CV_OMP(omp for schedule(static))
+      for (i = 0; i < N; i++)
+      {
+        td[i] = reltol * SUNRabs(yd[i]) + ad[i];
+        if (td[i] < tmin) { tmin = td[i]; }
+        wd[i] = ONE / td[i];
+      }
+      CV_OMP(omp critical)
+      {
+        if (tmin < min) { min = tmin; }
+      }
+    }
+
+    if (atolmin0 && min <= ZERO) { return (-1); }
+    return 0;
+  }
+
   N_VAbs(ycur, tempv);
   N_VLinearSum(reltol, tempv, ONE, Vabstol, tempv);
   if (atolmin0)
@@ -77,6 +200,32 @@ int cvEwtSetSV_fused(const sunbooleantype atolmin0, const sunrealtype reltol,
 int cvCheckConstraints_fused(const N_Vector c, const N_Vector ewt,
                              const N_Vector y, const N_Vector mm, N_Vector tmp)
 {
+  sunindextype i, N;
+  sunrealtype a, *cd, *wd, *yd, *md, *td;
+  int nt;
+
+  nt = cvFusedNumThreads(tmp);
+
+  if (nt > 0)
+  {
+    N  = N_VGetLength(tmp);
+    cd = N_VGetArrayPointer(c);
+    wd = N_VGetArrayPointer(ewt);
+    yd = N_VGetArrayPointer(y);
+    md = N_VGetArrayPointer(mm);
+    td = N_VGetArrayPointer(tmp);
+
+    CV_OMP(omp parallel for private(i, a) schedule(static) num_threads(nt)
+             if (nt > 1))
+    for (i = 0; i < N; i++)
+    {
+      a     = (SUNRabs(cd[i]) >= ONEPT5) ? ONE : ZERO; /* a = 1 when |c| = 2 */
+      td[i] = (yd[i] - PT1 * (a * cd[i] / wd[i])) * md[i];
+    }
+
+    return 0;
+  }
+
   N_VCompare(ONEPT5, c, tmp);           /* a[i]=1 when |c[i]|=2  */
   N_VProd(tmp, c, tmp);                 /* a * c                 */
   N_VDiv(tmp, ewt, tmp);                /* a * c * wt            */
@@ -95,6 +244,30 @@ int cvNlsResid_fused(const sunrealtype rl1, const sunrealtype ngamma,
                      const N_Vector zn1, const N_Vector ycor,
                      const N_Vector ftemp, N_Vector res)
 {
+  sunindextype i, N;
+  sunrealtype *zd, *yd, *fd, *rd;
+  int nt;
+
+  nt = cvFusedNumThreads(res);
+
+  if (nt > 0)
+  {
+    N  = N_VGetLength(res);
+    zd = N_VGetArrayPointer(zn1);
+    yd = N_VGetArrayPointer(ycor);
+    fd = N_VGetArrayPointer(ftemp);
+    rd = N_VGetArrayPointer(res);
+
+    CV_OMP(omp parallel for private(i) schedule(static) num_threads(nt)
+             if (nt > 1))
+    for (i = 0; i < N; i++)
+    {
+      rd[i] = ngamma * fd[i] + (rl1 * zd[i] + yd[i]);
+    }
+
+    return 0;
+  }
+
   N_VLinearSum(rl1, zn1, ONE, ycor, res);
   N_VLinearSum(ngamma, ftemp, ONE, res, res);
   return 0;
@@ -110,6 +283,32 @@ int cvDiagSetup_formY(const sunrealtype h, const sunrealtype r,
                       const N_Vector fpred, const N_Vector zn1,
                       const N_Vector ypred, N_Vector ftemp, N_Vector y)
 {
+  sunindextype i, N;
+  sunrealtype *fpd, *zd, *ypd, *fd, *yd;
+  int nt;
+
+  nt = cvFusedNumThreads(y);
+
+  if (nt > 0)
+  {
+    N   = N_VGetLength(y);
+    fpd = N_VGetArrayPointer(fpred);
+    zd  = N_VGetArrayPointer(zn1);
+    ypd = N_VGetArrayPointer(ypred);
+    fd  = N_VGetArrayPointer(ftemp);
+    yd  = N_VGetArrayPointer(y);
+
+    CV_OMP(omp parallel for private(i) schedule(static) num_threads(nt)
+             if (nt > 1))
+    for (i = 0; i < N; i++)
+    {
+      fd[i] = h * fpd[i] - zd[i];
+      yd[i] = r * fd[i] + ypd[i];
+    }
+
+    return 0;
+  }
+
   N_VLinearSum(h, fpred, -ONE, zn1, ftemp);
   N_VLinearSum(r, ftemp, ONE, ypred, y);
   return 0;
@@ -122,12 +321,45 @@ int cvDiagSetup_formY(const sunrealtype h, const sunrealtype r,
  * -----------------------------------------------------------------
  */
 
-int cvDiagSetup_buildM(SUNDIALS_MAYBE_UNUSED const sunrealtype fract,
-                       const sunrealtype uround, const sunrealtype h,
-                       const N_Vector ftemp, const N_Vector fpred,
-                       const N_Vector ewt, N_Vector bit, N_Vector bitcomp,
-                       N_Vector y, N_Vector M)
+int cvDiagSetup_buildM(const sunrealtype fract, const sunrealtype uround,
+                       const sunrealtype h, const N_Vector ftemp,
+                       const N_Vector fpred, const N_Vector ewt, N_Vector bit,
+                       N_Vector bitcomp, N_Vector y, N_Vector M)
 {
+  sunindextype i, N;
+  sunrealtype *fd, *fpd, *wd, *bd, *bcd, *yd, *Md;
+  int nt;
+
+  nt = cvFusedNumThreads(M);
+
+  if (nt > 0)
+  {
+    N   = N_VGetLength(M);
+    fd  = N_VGetArrayPointer(ftemp);
+    fpd = N_VGetArrayPointer(fpred);
+    wd  = N_VGetArrayPointer(ewt);
+    bd  = N_VGetArrayPointer(bit);
+    bcd = N_VGetArrayPointer(bitcomp);
+    yd  = N_VGetArrayPointer(y);
+    Md  = N_VGetArrayPointer(M);
+
+    CV_OMP(omp parallel for private(i) schedule(static) num_threads(nt)
+             if (nt > 1))
+    for (i = 0; i < N; i++)
+    {
+      Md[i] = fract * fd[i] - h * (Md[i] - fpd[i]);
+      yd[i] = fd[i] * wd[i];
+
+      /* Protect against deltay_i being at roundoff level */
+      bd[i]  = (SUNRabs(yd[i]) >= uround) ? ONE : ZERO;
+      bcd[i] = bd[i] - ONE;
+      yd[i]  = fract * (fd[i] * bd[i]) - bcd[i];
+      Md[i]  = (Md[i] / yd[i]) * bd[i] - bcd[i];
+    }
+
+    return 0;
+  }
+
   N_VLinearSum(ONE, M, -ONE, fpred, M);
   N_VLinearSum(FRACT, ftemp, -h, M, M);
   N_VProd(ftemp, ewt, y);
@@ -150,6 +382,24 @@ int cvDiagSetup_buildM(SUNDIALS_MAYBE_UNUSED const sunrealtype fract,
 
 int cvDiagSolve_updateM(const sunrealtype r, N_Vector M)
 {
+  sunindextype i, N;
+  sunrealtype* Md;
+  int nt;
+
+  nt = cvFusedNumThreads(M);
+
+  if (nt > 0)
+  {
+    N  = N_VGetLength(M);
+    Md = N_VGetArrayPointer(M);
+
+    CV_OMP(omp parallel for private(i) schedule(static) num_threads(nt)
+             if (nt > 1))
+    for (i = 0; i < N; i++) { Md[i] = r * (ONE / Md[i] - ONE) + ONE; }
+
+    return 0;
+  }
+
   N_VInv(M, M);
   N_VAddConst(M, -ONE, M);
   N_VScale(r, M, M);
@@ -27,6 +27,7 @@
 #include "cvode_proj_impl.h"
 #include "sundials_logger_impl.h"
 #include "sundials_macros.h"
+#include "sundials_nvector_reduce.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -634,6 +635,9 @@ void cvRestore(CVodeMem cv_mem, sunrealtype saved_t);
 void cvRescale(CVodeMem cv_mem);
 
 #ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
+/* Returns SUNTRUE if the linked fused kernels support the vector */
+sunbooleantype cvFusedSupportsVector(const N_Vector v);
+
 int cvEwtSetSS_fused(const sunbooleantype atolmin0, const sunrealtype reltol,
                      const sunrealtype Sabstol, const N_Vector ycur,
                      N_Vector tempv, N_Vector weight);
@@ -320,6 +320,123 @@ int CVodeSetJacFn(void* cvode_mem, CVLsJacFn jac)
   return (CVLS_SUCCESS);
 }
 
+/* CVodeSetJacSparsity specifies the sparsity pattern of the Jacobian used by
+ * the internal difference quotient approximation with a sparse matrix. The
+ * columns of the pattern are colored so that the Jacobian is formed with one
+ * call to f per color. */
+int CVodeSetJacSparsity(void* cvode_mem, SUNMatrix S)
+{
+  CVodeMem cv_mem;
+  CVLsMem cvls_mem;
+  SUNErrCode ier;
+  int retval;
+
+  /* access CVLsMem structure */
+  retval = cvLs_AccessLMem(cvode_mem, __func__, &cv_mem, &cvls_mem);
+  if (retval != CVLS_SUCCESS) { return (retval); }
+
+  /* free any existing pattern */
+  sunSparseDQ_Free(&(cvls_mem->sparseDQ));
+
+  if (S == NULL) { return (CVLS_SUCCESS); }
+
+  /* return with failure if the pattern cannot be used */
+  if ((cvls_mem->A == NULL) || (SUNMatGetID(cvls_mem->A) != SUNMATRIX_SPARSE) ||
+      (SUNMatGetID(S) != SUNMATRIX_SPARSE))
+  {
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "Jacobian sparsity requires sparse SUNMatrix objects");
+    return (CVLS_ILL_INPUT);
+  }
+  if ((SUNSparseMatrix_Rows(S) != SUNSparseMatrix_Rows(cvls_mem->A)) ||
+      (SUNSparseMatrix_Columns(S) != SUNSparseMatrix_Columns(cvls_mem->A)))
+  {
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "Jacobian sparsity and SUNMatrix dimensions do not match");
+    return (CVLS_ILL_INPUT);
+  }
+
+  /* store the pattern and color its columns */
+  ier = sunSparseDQ_SetPattern(&(cvls_mem->sparseDQ), S,
+                               SUNSparseMatrix_SparseType(cvls_mem->A));
+  if (ier == SUN_ERR_MEM_FAIL)
+  {
+    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSG_LS_MEM_FAIL);
+    return (CVLS_MEM_FAIL);
+  }
+  else if (ier != SUN_SUCCESS)
+  {
+    cvProcessError(cv_mem, CVLS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                   MSG_LS_SUNMAT_FAILED);
+    return (CVLS_SUNMAT_FAIL);
+  }
+
+  return (CVLS_SUCCESS);
+}
+
+/* cvLsProbeRhs evaluates f for CVodeComputeJacSparsity and cvLsSparseDQJac */
+static int cvLsProbeRhs(sunrealtype t, N_Vector* y, N_Vector fy,
+                        void* cvode_mem)
+{
+  CVodeMem cv_mem = (CVodeMem)cvode_mem;
+  return (cv_mem->cv_f(t, y[0], fy, cv_mem->cv_user_data));
+}
+
+/* CVodeComputeJacSparsity detects the sparsity pattern of df/dy at (t, y) by
+ * probing f one column at a time. Component j of y is set to NaN and the rows
+ * of the result that change are the nonzeros of column j. If f returns a
+ * nonzero value for a NaN input, a finite increment is used for that column
+ * instead. The pattern is returned in a new sparse matrix of type sparsetype
+ * with exactly the detected nonzeros, all set to one. */
+int CVodeComputeJacSparsity(void* cvode_mem, sunrealtype t, N_Vector y,
+                            int sparsetype, SUNMatrix* S)
+{
+  CVodeMem cv_mem;
+  SUNErrCode ier;
+
+  /* Return immediately if cvode_mem is NULL */
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CVLS_MEM_NULL, __LINE__, __func__, __FILE__,
+                   MSG_LS_CVMEM_NULL);
+    return (CVLS_MEM_NULL);
+  }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  /* Check for legal inputs */
+  if ((y == NULL) || (S == NULL) || (cv_mem->cv_f == NULL) ||
+      ((sparsetype != CSC_MAT) && (sparsetype != CSR_MAT)))
+  {
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "Illegal input for the Jacobian sparsity detection");
+    return (CVLS_ILL_INPUT);
+  }
+  ier = sunComputeJacSparsity(cvLsProbeRhs, cv_mem, t, 1, &y,
+                              SUNRsqrt(cv_mem->cv_uround), sparsetype, S);
+
+  switch (ier)
+  {
+  case SUN_SUCCESS: return (CVLS_SUCCESS);
+  case SUN_ERR_ARG_INCOMPATIBLE:
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSG_LS_PROBE_NVECTOR);
+    return (CVLS_ILL_INPUT);
+  case SUN_ERR_MEM_FAIL:
+    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSG_LS_MEM_FAIL);
+    return (CVLS_MEM_FAIL);
+  case SUN_ERR_USER_FCN_FAIL:
+    cvProcessError(cv_mem, CV_RHSFUNC_FAIL, __LINE__, __func__, __FILE__,
+                   MSG_LS_PROBE_FAILED);
+    return (CV_RHSFUNC_FAIL);
+  default:
+    cvProcessError(cv_mem, CVLS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                   MSG_LS_SUNMAT_FAILED);
+    return (CVLS_SUNMAT_FAIL);
+  }
+}
+
 /* CVodeSetDeltaGammaMaxBadJac specifies the maximum gamma ratio change
  * after a NLS convergence failure with a potentially bad Jacobian. If
  * |gamma/gammap-1| < dgmax_jbad then the Jacobian is marked as bad */
@@ -972,7 +1089,7 @@ int cvLsPSolve(void* cvode_mem, N_Vector r, N_Vector z, sunrealtype tol, int lr)
 /*-----------------------------------------------------------------
   cvLsDQJac
 
-  This routine is a wrapper for the Dense and Band
+  This routine is a wrapper for the Dense, Band and Sparse
   implementations of the difference quotient Jacobian
   approximation routines.
   ---------------------------------------------------------------*/
@@ -1023,6 +1140,11 @@ int cvLsDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   {
     retval = cvLsBandDQJac(t, y, fy, Jac, cv_mem, tmp1, tmp2);
   }
+  else if ((SUNMatGetID(Jac) == SUNMATRIX_SPARSE) &&
+           (((CVLsMem)cv_mem->cv_lmem)->sparseDQ.pattern != NULL))
+  {
+    retval = cvLsSparseDQJac(t, y, fy, Jac, cv_mem, tmp1, tmp2);
+  }
   else
   {
     cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
@@ -1252,6 +1374,78 @@ int cvLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   return (retval);
 }
 
+/*-----------------------------------------------------------------
+  cvLsSparseDQJac
+
+  This routine generates a sparse difference quotient approximation
+  to the Jacobian of f(t,y) on the pattern set with
+  CVodeSetJacSparsity. Columns of the same color have no rows in
+  common, so they are incremented together and the Jacobian is
+  formed with one call to f per color. The entries are computed in
+  the stored copy of the pattern in the format of Jac and then
+  copied into Jac.
+  -----------------------------------------------------------------*/
+int cvLsSparseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                    CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2)
+{
+  sunrealtype fnorm, minInc, inc, srur, conj, one;
+  sunrealtype *ewt_data, *y_data, *cns_data, *inc_data;
+  sunindextype j, N;
+  CVLsMem cvls_mem;
+
+  /* initialize cns_data to avoid compiler warning */
+  cns_data = NULL;
+
+  /* access LsMem interface structure */
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+
+  /* Obtain pointers to the data for ewt, y, and the column increments */
+  N        = SUNSparseMatrix_Columns(Jac);
+  ewt_data = N_VGetArrayPointer(cv_mem->cv_ewt);
+  y_data   = N_VGetArrayPointer(y);
+  inc_data = cvls_mem->sparseDQ.inc;
+  if (cv_mem->cv_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(cv_mem->cv_constraints);
+  }
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(cv_mem->cv_uround);
+  fnorm  = N_VWrmsNorm(fy, cv_mem->cv_ewt);
+  minInc = (fnorm != ZERO) ? (MIN_INC_MULT * SUNRabs(cv_mem->cv_h) *
+                              cv_mem->cv_uround * N * fnorm)
+                           : ONE;
+
+  /* Set the increment of each column */
+  for (j = 0; j < N; j++)
+  {
+    inc = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+    /* Adjust sign(inc) if yj has an inequality constraint. */
+    if (cv_mem->cv_constraintsSet)
+    {
+      conj = cns_data[j];
+      if (SUNRabs(conj) == ONE)
+      {
+        if ((y_data[j] + inc) * conj < ZERO) { inc = -inc; }
+      }
+      else if (SUNRabs(conj) == TWO)
+      {
+        if ((y_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+      }
+    }
+
+    inc_data[j] = inc;
+  }
+
+  /* Form the Jacobian with one call to f per color, using tmp2 and tmp1 as
+     temporary values of y and f */
+  one = ONE;
+  return (sunSparseDQ_Jac(&(cvls_mem->sparseDQ), cvLsProbeRhs, cv_mem, t, 1,
+                          &y, &tmp2, &one, fy, tmp1, Jac,
+                          &(cvls_mem->nfeDQ)));
+}
+
 /*-----------------------------------------------------------------
   cvLsDQJtimes
 
@@ -1436,7 +1630,9 @@ int cvLsInitialize(CVodeMem cv_mem)
         if (cvls_mem->A->ops->getid)
         {
           if ((SUNMatGetID(cvls_mem->A) == SUNMATRIX_DENSE) ||
-              (SUNMatGetID(cvls_mem->A) == SUNMATRIX_BAND))
+              (SUNMatGetID(cvls_mem->A) == SUNMATRIX_BAND) ||
+              ((SUNMatGetID(cvls_mem->A) == SUNMATRIX_SPARSE) &&
+               (cvls_mem->sparseDQ.pattern != NULL)))
           {
             cvls_mem->jac    = cvLsDQJac;
             cvls_mem->J_data = cv_mem;
@@ -1880,6 +2076,9 @@ int cvLsFree(CVodeMem cv_mem)
     cvls_mem->savedJ = NULL;
   }
 
+  /* Free the Jacobian sparsity pattern and coloring */
+  sunSparseDQ_Free(&(cvls_mem->sparseDQ));
+
   /* Nullify other N_Vector pointers */
   cvls_mem->ycur = NULL;
   cvls_mem->fcur = NULL;
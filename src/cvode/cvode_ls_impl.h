@@ -21,6 +21,7 @@
 #include <cvode/cvode_ls.h>
 
 #include "cvode_impl.h"
+#include "sundials_sparsedq_impl.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -60,6 +61,9 @@ typedef struct CVLsMemRec
   sunrealtype dgmax_jbad; /* if convfail = FAIL_BAD_J and the gamma ratio *
                         * |gamma/gammap-1| < dgmax_jbad then J is bad  */
 
+  /* Sparse DQ Jacobian: pattern of df/dy and its column coloring */
+  sunSparseDQMem sparseDQ;
+
   /* Matrix-based solver, scale solution to account for change in gamma */
   sunbooleantype scalesol;
 
@@ -150,6 +154,8 @@ int cvLsDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
                    CVodeMem cv_mem, N_Vector tmp1);
 int cvLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
                   CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2);
+int cvLsSparseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                    CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2);
 
 /* Generic linit/lsetup/lsolve/lfree interface routines for CVode to call */
 int cvLsInitialize(CVodeMem cv_mem);
@@ -190,6 +196,10 @@ int cvLs_AccessLMem(void* cvode_mem, const char* fname, CVodeMem* cv_mem,
   "The Jacobian routine failed in an unrecoverable manner."
 #define MSG_LS_SUNMAT_FAILED \
   "A SUNMatrix routine failed in an unrecoverable manner."
+#define MSG_LS_PROBE_NVECTOR \
+  "Sparsity detection requires a non-distributed vector with array access."
+#define MSG_LS_PROBE_FAILED \
+  "The f routine failed or is not finite while probing the sparsity."
 
 #ifdef __cplusplus
 }
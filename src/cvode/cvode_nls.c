@@ -311,9 +311,10 @@ static int cvNlsConvTest(SUNNonlinearSolver NLS, N_Vector ycor, N_Vector delta,
                          sunrealtype tol, N_Vector ewt, void* cvode_mem)
 {
   CVodeMem cv_mem;
-  int m, retval;
+  int m, retval, idel, iacor;
   sunrealtype del;
   sunrealtype dcon;
+  SUNReduceBatch nrm;
 
   if (cvode_mem == NULL)
   {
@@ -322,13 +323,26 @@ static int cvNlsConvTest(SUNNonlinearSolver NLS, N_Vector ycor, N_Vector delta,
   }
   cv_mem = (CVodeMem)cvode_mem;
 
-  /* compute the norm of the correction */
-  del = N_VWrmsNorm(delta, ewt);
-
   /* get the current nonlinear solver iteration count */
   retval = SUNNonlinSolGetCurIter(NLS, &m);
   if (retval != CV_SUCCESS) { return (CV_MEM_NULL); }
 
+  /* compute the norm of the correction. When the reductions can be combined
+     and the convergence rate predicts that this iteration converges, also
+     compute the norm of the accumulated correction needed on convergence to
+     avoid a second reduction. Otherwise it is only computed on convergence. */
+  sunReduceInit(&nrm, delta);
+  idel  = sunReduceAddWrmsNorm(&nrm, delta, ewt);
+  iacor = -1;
+  if (m > 0 && nrm.combine &&
+      cv_mem->cv_crate * cv_mem->cv_delp * SUNMIN(ONE, cv_mem->cv_crate) <= tol)
+  {
+    iacor = sunReduceAddWrmsNorm(&nrm, ycor, ewt);
+  }
+  if (sunReduceBegin(&nrm) != SUN_SUCCESS) { return (CV_VECTOROP_ERR); }
+  if (sunReduceEnd(&nrm) != SUN_SUCCESS) { return (CV_VECTOROP_ERR); }
+  del = sunReduceValue(&nrm, idel);
+
   /* Test for convergence. If m > 0, an estimate of the convergence
      rate constant is stored in crate, and used in the test.        */
   if (m > 0)
@@ -339,7 +353,9 @@ static int cvNlsConvTest(SUNNonlinearSolver NLS, N_Vector ycor, N_Vector delta,
 
   if (dcon <= ONE)
   {
-    cv_mem->cv_acnrm    = (m == 0) ? del : N_VWrmsNorm(ycor, ewt);
+    if (m == 0) { cv_mem->cv_acnrm = del; }
+    else if (iacor >= 0) { cv_mem->cv_acnrm = sunReduceValue(&nrm, iacor); }
+    else { cv_mem->cv_acnrm = N_VWrmsNorm(ycor, ewt); }
     cv_mem->cv_acnrmcur = SUNTRUE;
     return (CV_SUCCESS); /* Nonlinear system was solved successfully */
   }
@@ -62,6 +62,7 @@
  *       IDAGetSolution
  *   Norm functions
  *       IDAWrmsNorm
+ *       IDALinearSumWrmsNorm
  *   Functions for rootfinding
  *       IDARcheck1
  *       IDARcheck2
@@ -215,6 +216,9 @@ static int IDANls(IDAMem IDA_mem);
 
 static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
                         sunrealtype* err_km1);
+static sunrealtype IDALinearSumWrmsNorm(IDAMem IDA_mem, sunrealtype a,
+                                        N_Vector x, sunrealtype b, N_Vector y,
+                                        N_Vector z, sunbooleantype mask);
 
 /* Handling of convergence and/or error test failures */
 
@@ -2889,10 +2893,10 @@ static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
   if (IDA_mem->ida_kk > 1)
   {
     /* Compute error at order k-1 */
-    N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk], ONE, IDA_mem->ida_ee,
-                 IDA_mem->ida_delta);
-    enorm_km1 = IDAWrmsNorm(IDA_mem, IDA_mem->ida_delta, IDA_mem->ida_ewt,
-                            IDA_mem->ida_suppressalg);
+    enorm_km1 = IDALinearSumWrmsNorm(IDA_mem, ONE,
+                                     IDA_mem->ida_phi[IDA_mem->ida_kk], ONE,
+                                     IDA_mem->ida_ee, IDA_mem->ida_delta,
+                                     IDA_mem->ida_suppressalg);
     *err_km1  = IDA_mem->ida_sigma[IDA_mem->ida_kk - 1] * enorm_km1;
     terr_km1  = IDA_mem->ida_kk * (*err_km1);
 
@@ -2903,10 +2907,11 @@ static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
     if (IDA_mem->ida_kk > 2)
     {
       /* Compute error at order k-2 */
-      N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk - 1], ONE,
-                   IDA_mem->ida_delta, IDA_mem->ida_delta);
-      enorm_km2 = IDAWrmsNorm(IDA_mem, IDA_mem->ida_delta, IDA_mem->ida_ewt,
-                              IDA_mem->ida_suppressalg);
+      enorm_km2 = IDALinearSumWrmsNorm(IDA_mem, ONE,
+                                       IDA_mem->ida_phi[IDA_mem->ida_kk - 1],
+                                       ONE, IDA_mem->ida_delta,
+                                       IDA_mem->ida_delta,
+                                       IDA_mem->ida_suppressalg);
       err_km2   = IDA_mem->ida_sigma[IDA_mem->ida_kk - 2] * enorm_km2;
       terr_km2  = (IDA_mem->ida_kk - 1) * err_km2;
 
@@ -3225,10 +3230,10 @@ static void IDACompleteStep(IDAMem IDA_mem, sunrealtype err_k, sunrealtype err_k
     {
       /* Estimate the error at order k+1 */
 
-      N_VLinearSum(ONE, IDA_mem->ida_ee, -ONE,
-                   IDA_mem->ida_phi[IDA_mem->ida_kk + 1], IDA_mem->ida_tempv1);
-      enorm   = IDAWrmsNorm(IDA_mem, IDA_mem->ida_tempv1, IDA_mem->ida_ewt,
-                            IDA_mem->ida_suppressalg);
+      enorm   = IDALinearSumWrmsNorm(IDA_mem, ONE, IDA_mem->ida_ee, -ONE,
+                                     IDA_mem->ida_phi[IDA_mem->ida_kk + 1],
+                                     IDA_mem->ida_tempv1,
+                                     IDA_mem->ida_suppressalg);
       err_kp1 = enorm / (IDA_mem->ida_kk + 2);
 
       /* Choose among orders k-1, k, k+1 using local truncation error norms. */
@@ -3445,6 +3450,27 @@ sunrealtype IDAWrmsNorm(IDAMem IDA_mem, N_Vector x, N_Vector w,
   return (nrm);
 }
 
+/*
+ * IDALinearSumWrmsNorm
+ *
+ *  Computes z = a*x + b*y and returns the WRMS norm of z with the
+ *  error weights, masked by id if mask = SUNTRUE. Without a mask the
+ *  norm is computed while z is written.
+ */
+
+static sunrealtype IDALinearSumWrmsNorm(IDAMem IDA_mem, sunrealtype a,
+                                        N_Vector x, sunrealtype b, N_Vector y,
+                                        N_Vector z, sunbooleantype mask)
+{
+  if (mask)
+  {
+    N_VLinearSum(a, x, b, y, z);
+    return (IDAWrmsNorm(IDA_mem, z, IDA_mem->ida_ewt, mask));
+  }
+
+  return (N_VLinearSumWrmsNorm(a, x, b, y, z, IDA_mem->ida_ewt));
+}
+
 /*
  * -----------------------------------------------------------------
  * Functions for rootfinding
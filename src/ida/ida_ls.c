@@ -323,6 +323,126 @@ int IDASetJacFn(void* ida_mem, IDALsJacFn jac)
   return (IDALS_SUCCESS);
 }
 
+/* IDASetJacSparsity specifies the sparsity pattern used by the sparse DQ
+   Jacobian approximation and colors its columns */
+int IDASetJacSparsity(void* ida_mem, SUNMatrix S)
+{
+  IDAMem IDA_mem;
+  IDALsMem idals_mem;
+  SUNErrCode ier;
+  int retval;
+
+  /* access IDALsMem structure */
+  retval = idaLs_AccessLMem(ida_mem, __func__, &IDA_mem, &idals_mem);
+  if (retval != IDALS_SUCCESS) { return (retval); }
+
+  /* free any existing pattern */
+  sunSparseDQ_Free(&(idals_mem->sparseDQ));
+
+  if (S == NULL) { return (IDALS_SUCCESS); }
+
+  /* return with failure if the pattern cannot be used */
+  if ((idals_mem->J == NULL) ||
+      (SUNMatGetID(idals_mem->J) != SUNMATRIX_SPARSE) ||
+      (SUNMatGetID(S) != SUNMATRIX_SPARSE))
+  {
+    IDAProcessError(IDA_mem, IDALS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Jacobian sparsity requires sparse SUNMatrix objects");
+    return (IDALS_ILL_INPUT);
+  }
+  if ((SUNSparseMatrix_Rows(S) != SUNSparseMatrix_Rows(idals_mem->J)) ||
+      (SUNSparseMatrix_Columns(S) != SUNSparseMatrix_Columns(idals_mem->J)))
+  {
+    IDAProcessError(IDA_mem, IDALS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Jacobian sparsity and SUNMatrix dimensions do not match");
+    return (IDALS_ILL_INPUT);
+  }
+
+  /* store the pattern and color its columns */
+  ier = sunSparseDQ_SetPattern(&(idals_mem->sparseDQ), S,
+                               SUNSparseMatrix_SparseType(idals_mem->J));
+  if (ier == SUN_ERR_MEM_FAIL)
+  {
+    IDAProcessError(IDA_mem, IDALS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (IDALS_MEM_FAIL);
+  }
+  else if (ier != SUN_SUCCESS)
+  {
+    IDAProcessError(IDA_mem, IDALS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_SUNMAT_FAILED);
+    return (IDALS_SUNMAT_FAIL);
+  }
+
+  return (IDALS_SUCCESS);
+}
+
+/* idaLsProbeRes evaluates res for IDAComputeJacSparsity and idaLsSparseDQJac */
+static int idaLsProbeRes(sunrealtype t, N_Vector* y, N_Vector fy, void* ida_mem)
+{
+  IDAMem IDA_mem = (IDAMem)ida_mem;
+  return (IDA_mem->ida_res(t, y[0], y[1], fy, IDA_mem->ida_user_data));
+}
+
+/* IDAComputeJacSparsity detects the sparsity pattern of F_y + c_j F_y' at
+   (t, yy, yp) by probing res one column at a time. Components j of yy and yp
+   are set to NaN and the rows of the result that change are the nonzeros of
+   column j. If res returns a nonzero value for a NaN input, a finite
+   increment is used for that column instead. The pattern is returned in a
+   new sparse matrix of type sparsetype with exactly the detected nonzeros,
+   all set to one. */
+int IDAComputeJacSparsity(void* ida_mem, sunrealtype t, N_Vector yy,
+                          N_Vector yp, int sparsetype, SUNMatrix* S)
+{
+  IDAMem IDA_mem;
+  N_Vector yvec[2];
+  SUNErrCode ier;
+
+  /* Return immediately if ida_mem is NULL */
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDALS_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_LS_IDAMEM_NULL);
+    return (IDALS_MEM_NULL);
+  }
+  IDA_mem = (IDAMem)ida_mem;
+
+  /* Check for legal inputs */
+  if ((yy == NULL) || (yp == NULL) || (S == NULL) ||
+      (IDA_mem->ida_res == NULL) ||
+      ((sparsetype != CSC_MAT) && (sparsetype != CSR_MAT)))
+  {
+    IDAProcessError(IDA_mem, IDALS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Illegal input for the Jacobian sparsity detection");
+    return (IDALS_ILL_INPUT);
+  }
+  yvec[0] = yy;
+  yvec[1] = yp;
+  ier = sunComputeJacSparsity(idaLsProbeRes, IDA_mem, t, 2, yvec,
+                              SUNRsqrt(IDA_mem->ida_uround), sparsetype, S);
+
+  switch (ier)
+  {
+  case SUN_SUCCESS: return (IDALS_SUCCESS);
+  case SUN_ERR_ARG_INCOMPATIBLE:
+    IDAProcessError(IDA_mem, IDALS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_LS_PROBE_NVECTOR);
+    return (IDALS_ILL_INPUT);
+  case SUN_ERR_MEM_FAIL:
+    IDAProcessError(IDA_mem, IDALS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (IDALS_MEM_FAIL);
+  case SUN_ERR_USER_FCN_FAIL:
+    IDAProcessError(IDA_mem, IDA_RES_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_PROBE_FAILED);
+    return (IDA_RES_FAIL);
+  default:
+    IDAProcessError(IDA_mem, IDALS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_SUNMAT_FAILED);
+    return (IDALS_SUNMAT_FAIL);
+  }
+}
+
 /* IDASetEpsLin specifies the nonlinear -> linear tolerance scale factor */
 int IDASetEpsLin(void* ida_mem, sunrealtype eplifac)
 {
@@ -882,7 +1002,7 @@ int idaLsPSolve(void* ida_mem, N_Vector r, N_Vector z, sunrealtype tol,
 /*---------------------------------------------------------------
   idaLsDQJac:
 
-  This routine is a wrapper for the Dense and Band
+  This routine is a wrapper for the Dense, Band and Sparse
   implementations of the difference quotient Jacobian
   approximation routines.
 ---------------------------------------------------------------*/
@@ -932,6 +1052,11 @@ int idaLsDQJac(sunrealtype t, sunrealtype c_j, N_Vector y, N_Vector yp,
   {
     retval = idaLsBandDQJac(t, c_j, y, yp, r, Jac, IDA_mem, tmp1, tmp2, tmp3);
   }
+  else if ((SUNMatGetID(Jac) == SUNMATRIX_SPARSE) &&
+           (((IDALsMem)IDA_mem->ida_lmem)->sparseDQ.pattern != NULL))
+  {
+    retval = idaLsSparseDQJac(t, c_j, y, yp, r, Jac, IDA_mem, tmp1, tmp2, tmp3);
+  }
   else
   {
     IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
@@ -1188,6 +1313,86 @@ int idaLsBandDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
   return (retval);
 }
 
+/*---------------------------------------------------------------
+  idaLsSparseDQJac
+
+  This routine generates a sparse difference quotient approximation
+  to the DAE system Jacobian F_y + c_j*F_y' on the pattern set with
+  IDASetJacSparsity. Columns of the same color have no rows in
+  common, so they are incremented together and the Jacobian is
+  formed with one call to res per color. The entries are computed
+  in the stored copy of the pattern in the format of Jac and then
+  copied into Jac. The return value is 0, -1 if a SUNMatrix operation
+  fails, or the nonzero value returned by the res routine.
+  ---------------------------------------------------------------*/
+int idaLsSparseDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
+                     N_Vector rr, SUNMatrix Jac, IDAMem IDA_mem, N_Vector tmp1,
+                     N_Vector tmp2, N_Vector tmp3)
+{
+  sunrealtype inc, yj, ypj, srur, conj, ewtj;
+  sunrealtype *y_data, *yp_data, *ewt_data, *cns_data = NULL, *inc_data;
+  sunrealtype scale[2];
+  N_Vector yvec[2], ytemp[2];
+  sunindextype j, N;
+  IDALsMem idals_mem;
+
+  /* access LsMem interface structure */
+  idals_mem = (IDALsMem)IDA_mem->ida_lmem;
+
+  /* Obtain pointers to the data for ewt, yy, yp, and the increments */
+  N        = SUNSparseMatrix_Columns(Jac);
+  ewt_data = N_VGetArrayPointer(IDA_mem->ida_ewt);
+  y_data   = N_VGetArrayPointer(yy);
+  yp_data  = N_VGetArrayPointer(yp);
+  inc_data = idals_mem->sparseDQ.inc;
+  if (IDA_mem->ida_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(IDA_mem->ida_constraints);
+  }
+
+  srur = SUNRsqrt(IDA_mem->ida_uround);
+
+  /* Set the increment of each column as in idaLsBandDQJac. */
+  for (j = 0; j < N; j++)
+  {
+    yj   = y_data[j];
+    ypj  = yp_data[j];
+    ewtj = ewt_data[j];
+
+    inc = SUNMAX(srur * SUNMAX(SUNRabs(yj), SUNRabs(IDA_mem->ida_hh * ypj)),
+                 ONE / ewtj);
+    if (IDA_mem->ida_hh * ypj < ZERO) { inc = -inc; }
+    inc = (yj + inc) - yj;
+    if (IDA_mem->ida_constraintsSet)
+    {
+      conj = cns_data[j];
+      if (SUNRabs(conj) == ONE)
+      {
+        if ((yj + inc) * conj < ZERO) { inc = -inc; }
+      }
+      else if (SUNRabs(conj) == TWO)
+      {
+        if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+      }
+    }
+
+    inc_data[j] = inc;
+  }
+
+  /* Form the Jacobian with one call to res per color, incrementing yy[j] by
+     inc and yp[j] by c_j*inc, with tmp2, tmp3, and tmp1 as temporary values of
+     yy, yp, and rr */
+  yvec[0]  = yy;
+  yvec[1]  = yp;
+  ytemp[0] = tmp2;
+  ytemp[1] = tmp3;
+  scale[0] = ONE;
+  scale[1] = c_j;
+  return (sunSparseDQ_Jac(&(idals_mem->sparseDQ), idaLsProbeRes, IDA_mem, tt, 2,
+                          yvec, ytemp, scale, rr, tmp1, Jac,
+                          &(idals_mem->nreDQ)));
+}
+
 /*---------------------------------------------------------------
   idaLsDQJtimes
 
@@ -1288,7 +1493,9 @@ int idaLsInitialize(IDAMem IDA_mem)
     if (idals_mem->J->ops->getid)
     {
       if ((SUNMatGetID(idals_mem->J) == SUNMATRIX_DENSE) ||
-          (SUNMatGetID(idals_mem->J) == SUNMATRIX_BAND))
+          (SUNMatGetID(idals_mem->J) == SUNMATRIX_BAND) ||
+          ((SUNMatGetID(idals_mem->J) == SUNMATRIX_SPARSE) &&
+           (idals_mem->sparseDQ.pattern != NULL)))
       {
         idals_mem->jac    = idaLsDQJac;
         idals_mem->J_data = IDA_mem;
@@ -1725,6 +1932,9 @@ int idaLsFree(IDAMem IDA_mem)
   /* Nullify SUNMatrix pointer */
   idals_mem->J = NULL;
 
+  /* Free the Jacobian sparsity pattern and coloring */
+  sunSparseDQ_Free(&(idals_mem->sparseDQ));
+
   /* Free preconditioner memory (if applicable) */
   if (idals_mem->pfree) { idals_mem->pfree(IDA_mem); }
 
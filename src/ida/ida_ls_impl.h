@@ -21,6 +21,7 @@
 #include <ida/ida_ls.h>
 
 #include "ida_impl.h"
+#include "sundials_sparsedq_impl.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -79,6 +80,9 @@ typedef struct IDALsMemRec
   long int nstlj;       /* nstlj = nst at last jac/pset call            */
   sunrealtype tnlj;     /* tnlj = t_n at last jac/pset call             */
 
+  /* Sparse DQ Jacobian: pattern of J and its column coloring */
+  sunSparseDQMem sparseDQ;
+
   int last_flag; /* last error return flag                       */
 
   /* Preconditioner computation
@@ -131,6 +135,9 @@ int idaLsDenseDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
 int idaLsBandDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
                    N_Vector rr, SUNMatrix Jac, IDAMem IDA_mem, N_Vector tmp1,
                    N_Vector tmp2, N_Vector tmp3);
+int idaLsSparseDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
+                     N_Vector rr, SUNMatrix Jac, IDAMem IDA_mem, N_Vector tmp1,
+                     N_Vector tmp2, N_Vector tmp3);
 
 /* Generic linit/lsetup/lsolve/lperf/lfree interface routines for IDA to call */
 int idaLsInitialize(IDAMem IDA_mem);
@@ -160,6 +167,12 @@ int idaLs_AccessLMem(void* ida_mem, const char* fname, IDAMem* IDA_mem,
 #define MSG_LS_BAD_SIZES \
   "Illegal bandwidth parameter(s). Must have 0 <=  ml, mu <= N-1."
 #define MSG_LS_BAD_LSTYPE   "Incompatible linear solver type."
+#define MSG_LS_SUNMAT_FAILED \
+  "A SUNMatrix routine failed in an unrecoverable manner."
+#define MSG_LS_PROBE_NVECTOR \
+  "Sparsity detection requires a non-distributed vector with array access."
+#define MSG_LS_PROBE_FAILED \
+  "The res routine failed or is not finite while probing the sparsity."
 #define MSG_LS_LMEM_NULL    "Linear solver memory is NULL."
 #define MSG_LS_BAD_GSTYPE   "gstype has an illegal value."
 #define MSG_LS_NEG_MAXRS    "maxrs < 0 illegal."
@@ -1106,7 +1106,8 @@ static sunbooleantype KINAllocVectors(KINMem kin_mem, N_Vector tmpl)
 
     if (kin_mem->kin_q_aa == NULL)
     {
-      kin_mem->kin_q_aa = N_VCloneVectorArray((int)kin_mem->kin_m_aa, tmpl);
+      kin_mem->kin_q_aa = N_VCloneVectorArrayContiguous((int)kin_mem->kin_m_aa,
+                                                        tmpl);
       if (kin_mem->kin_q_aa == NULL)
       {
         N_VDestroy(kin_mem->kin_unew);
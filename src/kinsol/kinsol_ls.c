@@ -262,6 +262,133 @@ int KINSetJacFn(void* kinmem, KINLsJacFn jac)
   return (KINLS_SUCCESS);
 }
 
+/*------------------------------------------------------------------
+  KINSetJacSparsity specifies the sparsity pattern of the Jacobian
+  used by the internal difference quotient approximation with a
+  sparse matrix. The columns of the pattern are colored so that the
+  Jacobian is formed with one call to func per color.
+  ------------------------------------------------------------------*/
+int KINSetJacSparsity(void* kinmem, SUNMatrix S)
+{
+  KINMem kin_mem;
+  KINLsMem kinls_mem;
+  SUNErrCode ier;
+  int retval;
+
+  /* access KINLsMem structure */
+  retval = kinLs_AccessLMem(kinmem, __func__, &kin_mem, &kinls_mem);
+  if (retval != KIN_SUCCESS) { return (retval); }
+
+  /* free any existing pattern */
+  sunSparseDQ_Free(&(kinls_mem->sparseDQ));
+
+  if (S == NULL) { return (KINLS_SUCCESS); }
+
+  /* return with failure if the pattern cannot be used */
+  if ((kinls_mem->J == NULL) ||
+      (SUNMatGetID(kinls_mem->J) != SUNMATRIX_SPARSE) ||
+      (SUNMatGetID(S) != SUNMATRIX_SPARSE))
+  {
+    KINProcessError(kin_mem, KINLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Jacobian sparsity requires sparse SUNMatrix objects");
+    return (KINLS_ILL_INPUT);
+  }
+  if ((SUNSparseMatrix_Rows(S) != SUNSparseMatrix_Rows(kinls_mem->J)) ||
+      (SUNSparseMatrix_Columns(S) != SUNSparseMatrix_Columns(kinls_mem->J)))
+  {
+    KINProcessError(kin_mem, KINLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Jacobian sparsity and SUNMatrix dimensions do not match");
+    return (KINLS_ILL_INPUT);
+  }
+
+  /* store the pattern and color its columns */
+  ier = sunSparseDQ_SetPattern(&(kinls_mem->sparseDQ), S,
+                               SUNSparseMatrix_SparseType(kinls_mem->J));
+  if (ier == SUN_ERR_MEM_FAIL)
+  {
+    KINProcessError(kin_mem, KINLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (KINLS_MEM_FAIL);
+  }
+  else if (ier != SUN_SUCCESS)
+  {
+    KINProcessError(kin_mem, KINLS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_SUNMAT_FAILED);
+    return (KINLS_SUNMAT_FAIL);
+  }
+
+  return (KINLS_SUCCESS);
+}
+
+/*------------------------------------------------------------------
+  kinLsProbeFunc evaluates func for KINComputeJacSparsity and
+  kinLsSparseDQJac
+  ------------------------------------------------------------------*/
+static int kinLsProbeFunc(SUNDIALS_MAYBE_UNUSED sunrealtype t, N_Vector* u,
+                          N_Vector fu, void* kinmem)
+{
+  KINMem kin_mem = (KINMem)kinmem;
+  return (kin_mem->kin_func(u[0], fu, kin_mem->kin_user_data));
+}
+
+/*------------------------------------------------------------------
+  KINComputeJacSparsity detects the sparsity pattern of the
+  Jacobian of F at u by probing func one column at a time.
+  Component j of u is set to NaN and the rows of the result that
+  change are the nonzeros of column j. If func returns a nonzero
+  value for a NaN input, a finite increment is used for that
+  column instead. The pattern is returned in a new sparse matrix
+  of type sparsetype with exactly the detected nonzeros, all set
+  to one.
+  ------------------------------------------------------------------*/
+int KINComputeJacSparsity(void* kinmem, N_Vector u, int sparsetype,
+                          SUNMatrix* S)
+{
+  KINMem kin_mem;
+  SUNErrCode ier;
+
+  /* Return immediately if kinmem is NULL */
+  if (kinmem == NULL)
+  {
+    KINProcessError(NULL, KINLS_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_LS_KINMEM_NULL);
+    return (KINLS_MEM_NULL);
+  }
+  kin_mem = (KINMem)kinmem;
+
+  /* Check for legal inputs */
+  if ((u == NULL) || (S == NULL) || (kin_mem->kin_func == NULL) ||
+      ((sparsetype != CSC_MAT) && (sparsetype != CSR_MAT)))
+  {
+    KINProcessError(kin_mem, KINLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Illegal input for the Jacobian sparsity detection");
+    return (KINLS_ILL_INPUT);
+  }
+  ier = sunComputeJacSparsity(kinLsProbeFunc, kin_mem, ZERO, 1, &u,
+                              SUNRsqrt(kin_mem->kin_uround), sparsetype, S);
+
+  switch (ier)
+  {
+  case SUN_SUCCESS: return (KINLS_SUCCESS);
+  case SUN_ERR_ARG_INCOMPATIBLE:
+    KINProcessError(kin_mem, KINLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_LS_PROBE_NVECTOR);
+    return (KINLS_ILL_INPUT);
+  case SUN_ERR_MEM_FAIL:
+    KINProcessError(kin_mem, KINLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (KINLS_MEM_FAIL);
+  case SUN_ERR_USER_FCN_FAIL:
+    KINProcessError(kin_mem, KIN_SYSFUNC_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_PROBE_FAILED);
+    return (KIN_SYSFUNC_FAIL);
+  default:
+    KINProcessError(kin_mem, KINLS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_SUNMAT_FAILED);
+    return (KINLS_SUNMAT_FAIL);
+  }
+}
+
 /*------------------------------------------------------------------
   KINSetPreconditioner sets the preconditioner setup and solve
   functions
@@ -704,8 +831,8 @@ int kinLsPSolve(void* kinmem, N_Vector r, N_Vector z,
 /*------------------------------------------------------------------
   kinLsDQJac
 
-  This routine is a wrapper for the Dense and Band implementations
-  of the difference quotient Jacobian approximation routines.
+  This routine is a wrapper for the Dense, Band and Sparse
+  implementations of the difference quotient Jacobian approximation routines.
   ------------------------------------------------------------------*/
 int kinLsDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, void* kinmem,
                N_Vector tmp1, N_Vector tmp2)
@@ -739,6 +866,11 @@ int kinLsDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, void* kinmem,
   {
     retval = kinLsBandDQJac(u, fu, Jac, kin_mem, tmp1, tmp2);
   }
+  else if ((SUNMatGetID(Jac) == SUNMATRIX_SPARSE) &&
+           (((KINLsMem)kin_mem->kin_lmem)->sparseDQ.pattern != NULL))
+  {
+    retval = kinLsSparseDQJac(u, fu, Jac, kin_mem, tmp1, tmp2);
+  }
   else
   {
     KINProcessError(kin_mem, KIN_ILL_INPUT, __LINE__, __func__, __FILE__,
@@ -923,6 +1055,51 @@ int kinLsBandDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
   return (0);
 }
 
+/*------------------------------------------------------------------
+  kinLsSparseDQJac
+
+  This routine generates a sparse difference quotient approximation
+  to the Jacobian of F(u) on the pattern set with KINSetJacSparsity.
+  Columns of the same color have no rows in common, so they are
+  incremented together and the Jacobian is formed with one call to
+  func per color. The entries are computed in the stored copy of
+  the pattern in the format of J and then copied into J.
+
+  NOTE: Any type of failure of the system function here leads to an
+        unrecoverable failure of the Jacobian function and thus of
+        the linear solver setup function, stopping KINSOL.
+  ------------------------------------------------------------------*/
+int kinLsSparseDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
+                     N_Vector tmp1, N_Vector tmp2)
+{
+  sunrealtype *u_data, *uscale_data, *inc_data, one;
+  sunindextype j, N;
+  KINLsMem kinls_mem;
+
+  /* access LsMem interface structure */
+  kinls_mem = (KINLsMem)kin_mem->kin_lmem;
+
+  /* Obtain pointers to the data for u, uscale, and the column increments */
+  N           = SUNSparseMatrix_Columns(Jac);
+  u_data      = N_VGetArrayPointer(u);
+  uscale_data = N_VGetArrayPointer(kin_mem->kin_uscale);
+  inc_data    = kinls_mem->sparseDQ.inc;
+
+  /* Set the increment of each column */
+  for (j = 0; j < N; j++)
+  {
+    inc_data[j] = kin_mem->kin_sqrt_relfunc *
+                  SUNMAX(SUNRabs(u_data[j]), ONE / SUNRabs(uscale_data[j]));
+  }
+
+  /* Form the Jacobian with one call to func per color, using tmp2 and tmp1 as
+     temporary values of u and fu */
+  one = ONE;
+  return (sunSparseDQ_Jac(&(kinls_mem->sparseDQ), kinLsProbeFunc, kin_mem,
+                          ZERO, 1, &u, &tmp2, &one, fu, tmp1, Jac,
+                          &(kinls_mem->nfeDQ)));
+}
+
 /*------------------------------------------------------------------
   kinLsDQJtimes
 
@@ -1031,7 +1208,9 @@ int kinLsInitialize(KINMem kin_mem)
     if (kinls_mem->J->ops->getid)
     {
       if ((SUNMatGetID(kinls_mem->J) == SUNMATRIX_DENSE) ||
-          (SUNMatGetID(kinls_mem->J) == SUNMATRIX_BAND))
+          (SUNMatGetID(kinls_mem->J) == SUNMATRIX_BAND) ||
+          ((SUNMatGetID(kinls_mem->J) == SUNMATRIX_SPARSE) &&
+           (kinls_mem->sparseDQ.pattern != NULL)))
       {
         kinls_mem->jac    = kinLsDQJac;
         kinls_mem->J_data = kin_mem;
@@ -1358,6 +1537,9 @@ int kinLsFree(KINMem kin_mem)
   /* Nullify SUNMatrix pointer */
   kinls_mem->J = NULL;
 
+  /* Free the Jacobian sparsity pattern and coloring */
+  sunSparseDQ_Free(&(kinls_mem->sparseDQ));
+
   /* Free preconditioner memory (if applicable) */
   if (kinls_mem->pfree) { kinls_mem->pfree(kin_mem); }
 
@@ -21,6 +21,7 @@
 #include <kinsol/kinsol_ls.h>
 
 #include "kinsol_impl.h"
+#include "sundials_sparsedq_impl.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -54,6 +55,9 @@ typedef struct KINLsMemRec
   SUNLinearSolver LS; /* generic iterative linear solver object        */
   SUNMatrix J;        /* problem Jacobian                              */
 
+  /* Sparse DQ Jacobian: pattern of dF/du and its column coloring */
+  sunSparseDQMem sparseDQ;
+
   /* Solver tolerance adjustment factor (if needed, see kinLsSolve)     */
   sunrealtype tol_fac;
 
@@ -123,6 +127,9 @@ int kinLsDenseDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
 int kinLsBandDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
                    N_Vector tmp1, N_Vector tmp2);
 
+int kinLsSparseDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
+                     N_Vector tmp1, N_Vector tmp2);
+
 /* Generic linit/lsetup/lsolve/lfree interface routines for KINSOL to call */
 int kinLsInitialize(KINMem kin_mem);
 int kinLsSetup(KINMem kin_mem);
@@ -157,6 +164,12 @@ int kinLs_AccessLMem(void* kinmem, const char* fname, KINMem* kin_mem,
   "The Jacobian x vector routine failed in an unrecoverable manner."
 #define MSG_LS_MATZERO_FAILED \
   "The SUNMatZero routine failed in an unrecoverable manner."
+#define MSG_LS_SUNMAT_FAILED \
+  "A SUNMatrix routine failed in an unrecoverable manner."
+#define MSG_LS_PROBE_NVECTOR \
+  "Sparsity detection requires a non-distributed vector with array access."
+#define MSG_LS_PROBE_FAILED \
+  "The func routine failed or is not finite while probing the sparsity."
 
 /*------------------------------------------------------------------
   Info messages
@@ -0,0 +1,937 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for an ensemble implementation
+ * of the NVECTOR package. The data of the independent systems is
+ * interleaved so each operation is a single unit stride loop over
+ * all systems, and the per-system reductions accumulate one value
+ * per system in an inner loop over the contiguous systems.
+ * -----------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <nvector/nvector_ensemble.h>
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_core.h>
+#include <sundials/sundials_errors.h>
+
+#include "sundials_macros.h"
+
+#define ZERO   SUN_RCONST(0.0)
+#define HALF   SUN_RCONST(0.5)
+#define ONE    SUN_RCONST(1.0)
+#define ONEPT5 SUN_RCONST(1.5)
+
+/*
+ * -----------------------------------------------------------------
+ * exported functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Returns vector type ID. Used to identify vector implementation
+ * from abstract N_Vector interface.
+ */
+N_Vector_ID N_VGetVectorID_Ensemble(SUNDIALS_MAYBE_UNUSED N_Vector v)
+{
+  return SUNDIALS_NVEC_ENSEMBLE;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new empty vector
+ */
+
+N_Vector N_VNewEmpty_Ensemble(sunindextype num_systems,
+                              sunindextype system_length, SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  N_Vector v;
+  N_VectorContent_Ensemble content;
+
+  SUNAssertNull(num_systems >= 1, SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssertNull(system_length >= 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* Create vector */
+  v = NULL;
+  v = N_VNewEmpty(sunctx);
+  SUNCheckLastErrNull();
+
+  /* Attach operations */
+
+  /* constructors, destructors, and utility operations */
+  v->ops->nvgetvectorid     = N_VGetVectorID_Ensemble;
+  v->ops->nvclone           = N_VClone_Ensemble;
+  v->ops->nvcloneempty      = N_VCloneEmpty_Ensemble;
+  v->ops->nvdestroy         = N_VDestroy_Ensemble;
+  v->ops->nvgetarraypointer = N_VGetArrayPointer_Ensemble;
+  v->ops->nvsetarraypointer = N_VSetArrayPointer_Ensemble;
+  v->ops->nvgetlength       = N_VGetLength_Ensemble;
+  v->ops->nvgetlocallength  = N_VGetLength_Ensemble;
+
+  /* standard vector operations */
+  v->ops->nvlinearsum    = N_VLinearSum_Ensemble;
+  v->ops->nvconst        = N_VConst_Ensemble;
+  v->ops->nvprod         = N_VProd_Ensemble;
+  v->ops->nvdiv          = N_VDiv_Ensemble;
+  v->ops->nvscale        = N_VScale_Ensemble;
+  v->ops->nvabs          = N_VAbs_Ensemble;
+  v->ops->nvinv          = N_VInv_Ensemble;
+  v->ops->nvaddconst     = N_VAddConst_Ensemble;
+  v->ops->nvdotprod      = N_VDotProd_Ensemble;
+  v->ops->nvmaxnorm      = N_VMaxNorm_Ensemble;
+  v->ops->nvwrmsnormmask = N_VWrmsNormMask_Ensemble;
+  v->ops->nvwrmsnorm     = N_VWrmsNorm_Ensemble;
+  v->ops->nvmin          = N_VMin_Ensemble;
+  v->ops->nvwl2norm      = N_VWL2Norm_Ensemble;
+  v->ops->nvl1norm       = N_VL1Norm_Ensemble;
+  v->ops->nvcompare      = N_VCompare_Ensemble;
+  v->ops->nvinvtest      = N_VInvTest_Ensemble;
+  v->ops->nvconstrmask   = N_VConstrMask_Ensemble;
+  v->ops->nvminquotient  = N_VMinQuotient_Ensemble;
+
+  /* fused and vector array operations use the generic implementations */
+
+  /* local reduction kernels */
+  v->ops->nvdotprodlocal     = N_VDotProd_Ensemble;
+  v->ops->nvmaxnormlocal     = N_VMaxNorm_Ensemble;
+  v->ops->nvminlocal         = N_VMin_Ensemble;
+  v->ops->nvl1normlocal      = N_VL1Norm_Ensemble;
+  v->ops->nvinvtestlocal     = N_VInvTest_Ensemble;
+  v->ops->nvconstrmasklocal  = N_VConstrMask_Ensemble;
+  v->ops->nvminquotientlocal = N_VMinQuotient_Ensemble;
+  v->ops->nvwsqrsumlocal     = N_VWSqrSumLocal_Ensemble;
+  v->ops->nvwsqrsummasklocal = N_VWSqrSumMaskLocal_Ensemble;
+
+  /* XBraid interface operations */
+  v->ops->nvbufsize   = N_VBufSize_Ensemble;
+  v->ops->nvbufpack   = N_VBufPack_Ensemble;
+  v->ops->nvbufunpack = N_VBufUnpack_Ensemble;
+
+  /* debugging functions */
+  v->ops->nvprint     = N_VPrint_Ensemble;
+  v->ops->nvprintfile = N_VPrintFile_Ensemble;
+
+  /* Create content */
+  content = NULL;
+  content = (N_VectorContent_Ensemble)malloc(sizeof *content);
+  SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
+
+  /* Attach content */
+  v->content = content;
+
+  /* Initialize content */
+  content->num_systems   = num_systems;
+  content->system_length = system_length;
+  content->length        = num_systems * system_length;
+  content->own_data      = SUNFALSE;
+  content->data          = NULL;
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new vector
+ */
+
+N_Vector N_VNew_Ensemble(sunindextype num_systems, sunindextype system_length,
+                         SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  N_Vector v;
+  sunrealtype* data;
+  sunindextype length;
+
+  v = NULL;
+  v = N_VNewEmpty_Ensemble(num_systems, system_length, sunctx);
+  SUNCheckLastErrNull();
+
+  length = NV_LENGTH_EN(v);
+
+  /* Create data */
+  data = NULL;
+  if (length > 0)
+  {
+    data = (sunrealtype*)malloc(length * sizeof(sunrealtype));
+    SUNAssertNull(data, SUN_ERR_MALLOC_FAIL);
+  }
+
+  /* Attach data */
+  NV_OWN_DATA_EN(v) = SUNTRUE;
+  NV_DATA_EN(v)     = data;
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a vector with user data component
+ */
+
+N_Vector N_VMake_Ensemble(sunindextype num_systems, sunindextype system_length,
+                          sunrealtype* v_data, SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  N_Vector v;
+
+  v = NULL;
+  v = N_VNewEmpty_Ensemble(num_systems, system_length, sunctx);
+  SUNCheckLastErrNull();
+
+  if (NV_LENGTH_EN(v) > 0)
+  {
+    /* Attach data */
+    NV_OWN_DATA_EN(v) = SUNFALSE;
+    NV_DATA_EN(v)     = v_data;
+  }
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Functions to return the vector length, number of systems, and system length
+ */
+
+sunindextype N_VGetLength_Ensemble(N_Vector v) { return NV_LENGTH_EN(v); }
+
+sunindextype N_VGetNumSystems_Ensemble(N_Vector v)
+{
+  return NV_NUM_SYSTEMS_EN(v);
+}
+
+sunindextype N_VGetSystemLength_Ensemble(N_Vector v)
+{
+  return NV_SYSTEM_LENGTH_EN(v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to print a vector to stdout
+ */
+
+void N_VPrint_Ensemble(N_Vector x) { N_VPrintFile_Ensemble(x, stdout); }
+
+/* ----------------------------------------------------------------------------
+ * Function to print a vector to outfile, one line per system
+ */
+
+void N_VPrintFile_Ensemble(N_Vector x, FILE* outfile)
+{
+  sunindextype i, s, nsys, nsl;
+
+  nsys = NV_NUM_SYSTEMS_EN(x);
+  nsl  = NV_SYSTEM_LENGTH_EN(x);
+
+  for (s = 0; s < nsys; s++)
+  {
+    for (i = 0; i < nsl; i++)
+    {
+      fprintf(outfile, " " SUN_FORMAT_E, NV_SYS_Ith_EN(x, s, i));
+    }
+    fprintf(outfile, "\n");
+  }
+
+  return;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * implementation of vector operations
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Create new vector from existing vector without attaching data
+ */
+
+N_Vector N_VCloneEmpty_Ensemble(N_Vector w)
+{
+  SUNFunctionBegin(w->sunctx);
+  N_Vector v;
+  N_VectorContent_Ensemble content;
+
+  /* Create vector */
+  v = NULL;
+  v = N_VNewEmpty(w->sunctx);
+  SUNCheckLastErrNull();
+
+  /* Attach operations */
+  SUNCheckCallNull(N_VCopyOps(w, v));
+
+  /* Create content */
+  content = NULL;
+  content = (N_VectorContent_Ensemble)malloc(sizeof *content);
+  SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
+
+  /* Attach content */
+  v->content = content;
+
+  /* Initialize content */
+  content->num_systems   = NV_NUM_SYSTEMS_EN(w);
+  content->system_length = NV_SYSTEM_LENGTH_EN(w);
+  content->length        = NV_LENGTH_EN(w);
+  content->own_data      = SUNFALSE;
+  content->data          = NULL;
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Create new vector from existing vector and attach data
+ */
+
+N_Vector N_VClone_Ensemble(N_Vector w)
+{
+  SUNFunctionBegin(w->sunctx);
+  N_Vector v;
+  sunrealtype* data;
+  sunindextype length;
+
+  v = NULL;
+  v = N_VCloneEmpty_Ensemble(w);
+  SUNCheckLastErrNull();
+
+  length = NV_LENGTH_EN(w);
+
+  /* Create data */
+  data = NULL;
+  if (length > 0)
+  {
+    data = (sunrealtype*)malloc(length * sizeof(sunrealtype));
+    SUNAssertNull(data, SUN_ERR_MALLOC_FAIL);
+  }
+
+  /* Attach data */
+  NV_OWN_DATA_EN(v) = SUNTRUE;
+  NV_DATA_EN(v)     = data;
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Destroy vector and free vector memory
+ */
+
+void N_VDestroy_Ensemble(N_Vector v)
+{
+  if (v == NULL) { return; }
+
+  /* free content */
+  if (v->content != NULL)
+  {
+    /* free data array if it's owned by the vector */
+    if (NV_OWN_DATA_EN(v) && NV_DATA_EN(v) != NULL)
+    {
+      free(NV_DATA_EN(v));
+      NV_DATA_EN(v) = NULL;
+    }
+    free(v->content);
+    v->content = NULL;
+  }
+
+  /* free ops and vector */
+  if (v->ops != NULL)
+  {
+    free(v->ops);
+    v->ops = NULL;
+  }
+  free(v);
+  v = NULL;
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Get vector data pointer
+ */
+
+sunrealtype* N_VGetArrayPointer_Ensemble(N_Vector v)
+{
+  return ((sunrealtype*)NV_DATA_EN(v));
+}
+
+/* ----------------------------------------------------------------------------
+ * Set vector data pointer
+ */
+
+void N_VSetArrayPointer_Ensemble(sunrealtype* v_data, N_Vector v)
+{
+  if (NV_LENGTH_EN(v) > 0) { NV_DATA_EN(v) = v_data; }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute linear combination z[i] = a*x[i]+b*y[i]
+ */
+
+void N_VLinearSum_Ensemble(sunrealtype a, N_Vector x, sunrealtype b,
+                           N_Vector y, N_Vector z)
+{
+  sunindextype i, N;
+  sunrealtype *xd, *yd, *zd;
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+  yd = NV_DATA_EN(y);
+  zd = NV_DATA_EN(z);
+
+  for (i = 0; i < N; i++) { zd[i] = (a * xd[i]) + (b * yd[i]); }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Assigns constant value to all vector elements, z[i] = c
+ */
+
+void N_VConst_Ensemble(sunrealtype c, N_Vector z)
+{
+  sunindextype i, N;
+  sunrealtype* zd;
+
+  N  = NV_LENGTH_EN(z);
+  zd = NV_DATA_EN(z);
+
+  for (i = 0; i < N; i++) { zd[i] = c; }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute componentwise product z[i] = x[i]*y[i]
+ */
+
+void N_VProd_Ensemble(N_Vector x, N_Vector y, N_Vector z)
+{
+  sunindextype i, N;
+  sunrealtype *xd, *yd, *zd;
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+  yd = NV_DATA_EN(y);
+  zd = NV_DATA_EN(z);
+
+  for (i = 0; i < N; i++) { zd[i] = xd[i] * yd[i]; }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute componentwise division z[i] = x[i]/y[i]
+ */
+
+void N_VDiv_Ensemble(N_Vector x, N_Vector y, N_Vector z)
+{
+  sunindextype i, N;
+  sunrealtype *xd, *yd, *zd;
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+  yd = NV_DATA_EN(y);
+  zd = NV_DATA_EN(z);
+
+  for (i = 0; i < N; i++) { zd[i] = xd[i] / yd[i]; }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute scaler multiplication z[i] = c*x[i]
+ */
+
+void N_VScale_Ensemble(sunrealtype c, N_Vector x, N_Vector z)
+{
+  sunindextype i, N;
+  sunrealtype *xd, *zd;
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+  zd = NV_DATA_EN(z);
+
+  for (i = 0; i < N; i++) { zd[i] = c * xd[i]; }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute absolute value of vector components z[i] = SUNRabs(x[i])
+ */
+
+void N_VAbs_Ensemble(N_Vector x, N_Vector z)
+{
+  sunindextype i, N;
+  sunrealtype *xd, *zd;
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+  zd = NV_DATA_EN(z);
+
+  for (i = 0; i < N; i++) { zd[i] = SUNRabs(xd[i]); }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute componentwise inverse z[i] = 1 / x[i]
+ */
+
+void N_VInv_Ensemble(N_Vector x, N_Vector z)
+{
+  sunindextype i, N;
+  sunrealtype *xd, *zd;
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+  zd = NV_DATA_EN(z);
+
+  for (i = 0; i < N; i++) { zd[i] = ONE / xd[i]; }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute componentwise addition of a scaler to a vector z[i] = x[i] + b
+ */
+
+void N_VAddConst_Ensemble(N_Vector x, sunrealtype b, N_Vector z)
+{
+  sunindextype i, N;
+  sunrealtype *xd, *zd;
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+  zd = NV_DATA_EN(z);
+
+  for (i = 0; i < N; i++) { zd[i] = xd[i] + b; }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Computes the dot product of two vectors, a = sum(x[i]*y[i])
+ */
+
+sunrealtype N_VDotProd_Ensemble(N_Vector x, N_Vector y)
+{
+  sunindextype i, N;
+  sunrealtype sum, *xd, *yd;
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+  yd = NV_DATA_EN(y);
+
+  sum = ZERO;
+  for (i = 0; i < N; i++) { sum += xd[i] * yd[i]; }
+
+  return (sum);
+}
+
+/* ----------------------------------------------------------------------------
+ * Computes max norm of a vector
+ */
+
+sunrealtype N_VMaxNorm_Ensemble(N_Vector x)
+{
+  sunindextype i, N;
+  sunrealtype max, *xd;
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+
+  max = ZERO;
+  for (i = 0; i < N; i++)
+  {
+    if (SUNRabs(xd[i]) > max) { max = SUNRabs(xd[i]); }
+  }
+
+  return (max);
+}
+
+/* ----------------------------------------------------------------------------
+ * Computes weighted root mean square norm of a vector
+ */
+
+sunrealtype N_VWrmsNorm_Ensemble(N_Vector x, N_Vector w)
+{
+  return (SUNRsqrt(N_VWSqrSumLocal_Ensemble(x, w) / (NV_LENGTH_EN(x))));
+}
+
+/* ----------------------------------------------------------------------------
+ * Computes weighted root mean square norm of a masked vector
+ */
+
+sunrealtype N_VWrmsNormMask_Ensemble(N_Vector x, N_Vector w, N_Vector id)
+{
+  return (SUNRsqrt(N_VWSqrSumMaskLocal_Ensemble(x, w, id) / (NV_LENGTH_EN(x))));
+}
+
+/* ----------------------------------------------------------------------------
+ * Finds the minimun component of a vector
+ */
+
+sunrealtype N_VMin_Ensemble(N_Vector x)
+{
+  sunindextype i, N;
+  sunrealtype min, *xd;
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+
+  min = xd[0];
+  for (i = 1; i < N; i++)
+  {
+    if (xd[i] < min) { min = xd[i]; }
+  }
+
+  return (min);
+}
+
+/* ----------------------------------------------------------------------------
+ * Computes weighted L2 norm of a vector
+ */
+
+sunrealtype N_VWL2Norm_Ensemble(N_Vector x, N_Vector w)
+{
+  return (SUNRsqrt(N_VWSqrSumLocal_Ensemble(x, w)));
+}
+
+/* ----------------------------------------------------------------------------
+ * Computes L1 norm of a vector
+ */
+
+sunrealtype N_VL1Norm_Ensemble(N_Vector x)
+{
+  sunindextype i, N;
+  sunrealtype sum, *xd;
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+
+  sum = ZERO;
+  for (i = 0; i < N; i++) { sum += SUNRabs(xd[i]); }
+
+  return (sum);
+}
+
+/* ----------------------------------------------------------------------------
+ * Compare vector component values to a scaler
+ */
+
+void N_VCompare_Ensemble(sunrealtype c, N_Vector x, N_Vector z)
+{
+  sunindextype i, N;
+  sunrealtype *xd, *zd;
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+  zd = NV_DATA_EN(z);
+
+  for (i = 0; i < N; i++) { zd[i] = (SUNRabs(xd[i]) >= c) ? ONE : ZERO; }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute componentwise inverse z[i] = ONE/x[i] and checks if x[i] == ZERO
+ */
+
+sunbooleantype N_VInvTest_Ensemble(N_Vector x, N_Vector z)
+{
+  sunindextype i, N;
+  sunrealtype *xd, *zd;
+  sunbooleantype no_zero_found;
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+  zd = NV_DATA_EN(z);
+
+  no_zero_found = SUNTRUE;
+  for (i = 0; i < N; i++)
+  {
+    if (xd[i] == ZERO) { no_zero_found = SUNFALSE; }
+    else { zd[i] = ONE / xd[i]; }
+  }
+
+  return no_zero_found;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute constraint mask of a vector
+ */
+
+sunbooleantype N_VConstrMask_Ensemble(N_Vector c, N_Vector x, N_Vector m)
+{
+  sunindextype i, N;
+  sunrealtype temp;
+  sunrealtype *cd, *xd, *md;
+  sunbooleantype test;
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+  cd = NV_DATA_EN(c);
+  md = NV_DATA_EN(m);
+
+  temp = ZERO;
+
+  for (i = 0; i < N; i++)
+  {
+    md[i] = ZERO;
+
+    /* Continue if no constraints were set for the variable */
+    if (cd[i] == ZERO) { continue; }
+
+    /* Check if a set constraint has been violated */
+    test = (SUNRabs(cd[i]) > ONEPT5 && xd[i] * cd[i] <= ZERO) ||
+           (SUNRabs(cd[i]) > HALF && xd[i] * cd[i] < ZERO);
+    if (test) { temp = md[i] = ONE; }
+  }
+
+  /* Return false if any constraint was violated */
+  return (temp == ONE) ? SUNFALSE : SUNTRUE;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute minimum componentwise quotient
+ */
+
+sunrealtype N_VMinQuotient_Ensemble(N_Vector num, N_Vector denom)
+{
+  sunindextype i, N;
+  sunrealtype *nd, *dd, min;
+
+  N  = NV_LENGTH_EN(num);
+  nd = NV_DATA_EN(num);
+  dd = NV_DATA_EN(denom);
+
+  min = SUN_BIG_REAL;
+
+  for (i = 0; i < N; i++)
+  {
+    if (dd[i] == ZERO) { continue; }
+    if (nd[i] / dd[i] < min) { min = nd[i] / dd[i]; }
+  }
+
+  return (min);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * per-system reduction operations
+ * -----------------------------------------------------------------
+ */
+
+SUNErrCode N_VDotProdPerSystem_Ensemble(N_Vector x, N_Vector y,
+                                        sunrealtype* dotprods)
+{
+  SUNFunctionBegin(x->sunctx);
+  sunindextype i, s, nsys, nsl;
+  sunrealtype *xd, *yd;
+
+  SUNAssert(dotprods, SUN_ERR_ARG_CORRUPT);
+
+  nsys = NV_NUM_SYSTEMS_EN(x);
+  nsl  = NV_SYSTEM_LENGTH_EN(x);
+
+  for (s = 0; s < nsys; s++) { dotprods[s] = ZERO; }
+
+  /* the inner loop is over the contiguous components of all systems */
+  for (i = 0; i < nsl; i++)
+  {
+    xd = NV_DATA_EN(x) + i * nsys;
+    yd = NV_DATA_EN(y) + i * nsys;
+    for (s = 0; s < nsys; s++) { dotprods[s] += xd[s] * yd[s]; }
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VMaxNormPerSystem_Ensemble(N_Vector x, sunrealtype* nrm)
+{
+  SUNFunctionBegin(x->sunctx);
+  sunindextype i, s, nsys, nsl;
+  sunrealtype* xd;
+
+  SUNAssert(nrm, SUN_ERR_ARG_CORRUPT);
+
+  nsys = NV_NUM_SYSTEMS_EN(x);
+  nsl  = NV_SYSTEM_LENGTH_EN(x);
+
+  for (s = 0; s < nsys; s++) { nrm[s] = ZERO; }
+
+  for (i = 0; i < nsl; i++)
+  {
+    xd = NV_DATA_EN(x) + i * nsys;
+    for (s = 0; s < nsys; s++)
+    {
+      nrm[s] = (SUNRabs(xd[s]) > nrm[s]) ? SUNRabs(xd[s]) : nrm[s];
+    }
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VWrmsNormPerSystem_Ensemble(N_Vector x, N_Vector w,
+                                         sunrealtype* nrm)
+{
+  SUNFunctionBegin(x->sunctx);
+  sunindextype i, s, nsys, nsl;
+  sunrealtype *xd, *wd, prodi;
+
+  SUNAssert(nrm, SUN_ERR_ARG_CORRUPT);
+
+  nsys = NV_NUM_SYSTEMS_EN(x);
+  nsl  = NV_SYSTEM_LENGTH_EN(x);
+
+  for (s = 0; s < nsys; s++) { nrm[s] = ZERO; }
+
+  for (i = 0; i < nsl; i++)
+  {
+    xd = NV_DATA_EN(x) + i * nsys;
+    wd = NV_DATA_EN(w) + i * nsys;
+    for (s = 0; s < nsys; s++)
+    {
+      prodi = xd[s] * wd[s];
+      nrm[s] += prodi * prodi;
+    }
+  }
+
+  for (s = 0; s < nsys; s++) { nrm[s] = SUNRsqrt(nrm[s] / nsl); }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VWrmsNormMaskPerSystem_Ensemble(N_Vector x, N_Vector w,
+                                             N_Vector id, sunrealtype* nrm)
+{
+  SUNFunctionBegin(x->sunctx);
+  sunindextype i, s, nsys, nsl;
+  sunrealtype *xd, *wd, *idd, prodi;
+
+  SUNAssert(nrm, SUN_ERR_ARG_CORRUPT);
+
+  nsys = NV_NUM_SYSTEMS_EN(x);
+  nsl  = NV_SYSTEM_LENGTH_EN(x);
+
+  for (s = 0; s < nsys; s++) { nrm[s] = ZERO; }
+
+  for (i = 0; i < nsl; i++)
+  {
+    xd  = NV_DATA_EN(x) + i * nsys;
+    wd  = NV_DATA_EN(w) + i * nsys;
+    idd = NV_DATA_EN(id) + i * nsys;
+    for (s = 0; s < nsys; s++)
+    {
+      prodi = (idd[s] > ZERO) ? xd[s] * wd[s] : ZERO;
+      nrm[s] += prodi * prodi;
+    }
+  }
+
+  for (s = 0; s < nsys; s++) { nrm[s] = SUNRsqrt(nrm[s] / nsl); }
+
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * single buffer reduction operations
+ * -----------------------------------------------------------------
+ */
+
+sunrealtype N_VWSqrSumLocal_Ensemble(N_Vector x, N_Vector w)
+{
+  sunindextype i, N;
+  sunrealtype sum, prodi, *xd, *wd;
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+  wd = NV_DATA_EN(w);
+
+  sum = ZERO;
+  for (i = 0; i < N; i++)
+  {
+    prodi = xd[i] * wd[i];
+    sum += SUNSQR(prodi);
+  }
+
+  return (sum);
+}
+
+sunrealtype N_VWSqrSumMaskLocal_Ensemble(N_Vector x, N_Vector w, N_Vector id)
+{
+  sunindextype i, N;
+  sunrealtype sum, prodi, *xd, *wd, *idd;
+
+  N   = NV_LENGTH_EN(x);
+  xd  = NV_DATA_EN(x);
+  wd  = NV_DATA_EN(w);
+  idd = NV_DATA_EN(id);
+
+  sum = ZERO;
+  for (i = 0; i < N; i++)
+  {
+    if (idd[i] > ZERO)
+    {
+      prodi = xd[i] * wd[i];
+      sum += SUNSQR(prodi);
+    }
+  }
+
+  return (sum);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * OPTIONAL XBraid interface operations
+ * -----------------------------------------------------------------
+ */
+
+SUNErrCode N_VBufSize_Ensemble(N_Vector x, sunindextype* size)
+{
+  SUNFunctionBegin(x->sunctx);
+  SUNAssert(size, SUN_ERR_ARG_CORRUPT);
+  *size = NV_LENGTH_EN(x) * ((sunindextype)sizeof(sunrealtype));
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VBufPack_Ensemble(N_Vector x, void* buf)
+{
+  SUNFunctionBegin(x->sunctx);
+  sunindextype i, N;
+  sunrealtype* xd = NULL;
+  sunrealtype* bd = NULL;
+
+  SUNAssert(buf, SUN_ERR_ARG_CORRUPT);
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+  bd = (sunrealtype*)buf;
+
+  for (i = 0; i < N; i++) { bd[i] = xd[i]; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VBufUnpack_Ensemble(N_Vector x, void* buf)
+{
+  SUNFunctionBegin(x->sunctx);
+  sunindextype i, N;
+  sunrealtype* xd = NULL;
+  sunrealtype* bd = NULL;
+
+  SUNAssert(buf, SUN_ERR_ARG_CORRUPT);
+
+  N  = NV_LENGTH_EN(x);
+  xd = NV_DATA_EN(x);
+  bd = (sunrealtype*)buf;
+
+  for (i = 0; i < N; i++) { xd[i] = bd[i]; }
+
+  return SUN_SUCCESS;
+}
@@ -33,6 +33,10 @@
 
 #include "sundials_macros.h"
 
+#if defined(_OPENMP) && !defined(MANYVECTOR_BUILD_WITH_MPI)
+#include <omp.h>
+#endif
+
 /* Macro to handle separate MPI-aware/unaware installations */
 #ifdef MANYVECTOR_BUILD_WITH_MPI
 #define MVAPPEND(fun) fun##_MPIManyVector
@@ -60,12 +64,45 @@
 #define MANYVECTOR_SUBVEC(v, i)   (MANYVECTOR_SUBVECS(v)[i])
 #define MANYVECTOR_OWN_DATA(v)    (MANYVECTOR_CONTENT(v)->own_data)
 
+/* The ManyVector may operate on its subvectors concurrently with OpenMP
+   threads; the MPIManyVector always loops over the subvectors in order since
+   the subvector operations may call MPI. */
+#if defined(_OPENMP) && !defined(MANYVECTOR_BUILD_WITH_MPI)
+#define MANYVECTOR_NUM_THREADS(v) (MANYVECTOR_CONTENT(v)->num_threads)
+#define MV_THREAD_NUM()           omp_get_thread_num()
+#define MV_OMP(directive)         _Pragma(#directive)
+#else
+#define MANYVECTOR_NUM_THREADS(v) 1
+#define MV_THREAD_NUM()           0
+#define MV_OMP(directive)
+#endif
+
+/* Within a threaded loop the subvector operations are called through their
+   ops table rather than the generic N_V* wrappers, since the wrappers update
+   the profiler and operation counters of the shared SUNContext, which are not
+   thread safe. */
+#define MV_SUBVEC_OP(nt, fn, op, v)  (((nt) > 1) ? (v)->ops->op : fn)
+#define MV_SUBVEC_FUSED(nt, fn, sub) (((nt) > 1) ? sub : fn)
+
 /* -----------------------------------------------------------------
    Prototypes of utility routines
    -----------------------------------------------------------------*/
 static N_Vector ManyVectorClone(N_Vector w, sunbooleantype cloneempty);
+static SUNErrCode SubvecLinearCombination(int nvec, sunrealtype* c, N_Vector* X,
+                                          N_Vector z);
+static SUNErrCode SubvecScaleAddMulti(int nvec, sunrealtype* a, N_Vector x,
+                                      N_Vector* Y, N_Vector* Z);
+static SUNErrCode SubvecLinearSumVectorArray(int nvec, sunrealtype a,
+                                             N_Vector* X, sunrealtype b,
+                                             N_Vector* Y, N_Vector* Z);
+static SUNErrCode SubvecScaleVectorArray(int nvec, sunrealtype* c, N_Vector* X,
+                                         N_Vector* Z);
+static SUNErrCode SubvecConstVectorArray(int nvec, sunrealtype c, N_Vector* Z);
 #ifdef MANYVECTOR_BUILD_WITH_MPI
 static int SubvectorMPIRank(N_Vector w);
+#else
+static sunrealtype* ManyVectorContribArray(N_Vector x);
+static sunrealtype ManyVectorOrderedSum(N_Vector x, sunrealtype* contribs);
 #endif
 
 /* -----------------------------------------------------------------
@@ -153,6 +190,9 @@ N_Vector N_VMake_MPIManyVector(MPI_Comm comm, sunindextype num_subvectors,
   /* single buffer reduction operations */
   v->ops->nvdotprodmultilocal     = N_VDotProdMultiLocal_MPIManyVector;
   v->ops->nvdotprodmultiallreduce = N_VDotProdMultiAllReduce_MPIManyVector;
+  v->ops->nvdotprodmultiallreducebegin =
+    N_VDotProdMultiAllReduceBegin_MPIManyVector;
+  v->ops->nvdotprodmultiallreduceend = N_VDotProdMultiAllReduceEnd_MPIManyVector;
 
   /* XBraid interface operations */
   v->ops->nvbufsize   = N_VBufSize_MPIManyVector;
@@ -175,6 +215,7 @@ N_Vector N_VMake_MPIManyVector(MPI_Comm comm, sunindextype num_subvectors,
 
   /* set scalar content entries, and allocate/set subvector array */
   content->comm           = MPI_COMM_NULL;
+  content->request        = MPI_REQUEST_NULL;
   content->num_subvectors = num_subvectors;
   content->own_data       = SUNFALSE;
   content->subvec_array   = NULL;
@@ -395,6 +436,7 @@ N_Vector N_VNew_ManyVector(sunindextype num_subvectors, N_Vector* vec_array,
   /* allocate and set subvector array */
   content->num_subvectors = num_subvectors;
   content->own_data       = SUNFALSE;
+  content->num_threads    = 1;
 
   content->subvec_array = NULL;
   content->subvec_array = (N_Vector*)malloc(num_subvectors * sizeof(N_Vector));
@@ -417,6 +459,24 @@ N_Vector N_VNew_ManyVector(sunindextype num_subvectors, N_Vector* vec_array,
 
   return (v);
 }
+
+/* This function sets the number of OpenMP threads used to operate on the
+   subvectors concurrently.  With the default of one thread, or when SUNDIALS
+   is built without OpenMP, the subvectors are processed in order. */
+SUNErrCode N_VSetNumThreads_ManyVector(N_Vector v, int num_threads)
+{
+  SUNFunctionBegin(v->sunctx);
+  SUNAssert(num_threads > 0, SUN_ERR_ARG_OUTOFRANGE);
+  MANYVECTOR_CONTENT(v)->num_threads = num_threads;
+  return SUN_SUCCESS;
+}
+
+/* This function returns the number of threads used to operate on the
+   subvectors. */
+int N_VGetNumThreads_ManyVector(N_Vector v)
+{
+  return (MANYVECTOR_CONTENT(v)->num_threads);
+}
 #endif
 
 /* This function returns the vec_num sub-N_Vector from the N_Vector
@@ -625,12 +685,16 @@ void MVAPPEND(N_VLinearSum)(sunrealtype a, N_Vector x, sunrealtype b,
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  SUNDIALS_MAYBE_UNUSED int nt = MANYVECTOR_NUM_THREADS(x);
+
+  MV_OMP(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
-    N_VLinearSum(a, MANYVECTOR_SUBVEC(x, i), b, MANYVECTOR_SUBVEC(y, i),
-                 MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    MV_SUBVEC_OP(nt, N_VLinearSum, nvlinearsum, MANYVECTOR_SUBVEC(z, i))
+    (a, MANYVECTOR_SUBVEC(x, i), b, MANYVECTOR_SUBVEC(y, i),
+     MANYVECTOR_SUBVEC(z, i));
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -639,11 +703,15 @@ void MVAPPEND(N_VConst)(sunrealtype c, N_Vector z)
 {
   SUNFunctionBegin(z->sunctx);
   sunindextype i;
+  SUNDIALS_MAYBE_UNUSED int nt = MANYVECTOR_NUM_THREADS(z);
+
+  MV_OMP(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(z); i++)
   {
-    N_VConst(c, MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    MV_SUBVEC_OP(nt, N_VConst, nvconst, MANYVECTOR_SUBVEC(z, i))
+    (c, MANYVECTOR_SUBVEC(z, i));
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -654,12 +722,15 @@ void MVAPPEND(N_VProd)(N_Vector x, N_Vector y, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  SUNDIALS_MAYBE_UNUSED int nt = MANYVECTOR_NUM_THREADS(x);
+
+  MV_OMP(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
-    N_VProd(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i),
-            MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    MV_SUBVEC_OP(nt, N_VProd, nvprod, MANYVECTOR_SUBVEC(z, i))
+    (MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i), MANYVECTOR_SUBVEC(z, i));
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -670,12 +741,15 @@ void MVAPPEND(N_VDiv)(N_Vector x, N_Vector y, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  SUNDIALS_MAYBE_UNUSED int nt = MANYVECTOR_NUM_THREADS(x);
+
+  MV_OMP(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
-    N_VDiv(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i),
-           MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    MV_SUBVEC_OP(nt, N_VDiv, nvdiv, MANYVECTOR_SUBVEC(z, i))
+    (MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i), MANYVECTOR_SUBVEC(z, i));
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -686,11 +760,15 @@ void MVAPPEND(N_VScale)(sunrealtype c, N_Vector x, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  SUNDIALS_MAYBE_UNUSED int nt = MANYVECTOR_NUM_THREADS(x);
+
+  MV_OMP(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
-    N_VScale(c, MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    MV_SUBVEC_OP(nt, N_VScale, nvscale, MANYVECTOR_SUBVEC(z, i))
+    (c, MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -701,11 +779,15 @@ void MVAPPEND(N_VAbs)(N_Vector x, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  SUNDIALS_MAYBE_UNUSED int nt = MANYVECTOR_NUM_THREADS(x);
+
+  MV_OMP(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
-    N_VAbs(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    MV_SUBVEC_OP(nt, N_VAbs, nvabs, MANYVECTOR_SUBVEC(z, i))
+    (MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -716,11 +798,15 @@ void MVAPPEND(N_VInv)(N_Vector x, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  SUNDIALS_MAYBE_UNUSED int nt = MANYVECTOR_NUM_THREADS(x);
+
+  MV_OMP(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
-    N_VInv(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    MV_SUBVEC_OP(nt, N_VInv, nvinv, MANYVECTOR_SUBVEC(z, i))
+    (MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -731,11 +817,15 @@ void MVAPPEND(N_VAddConst)(N_Vector x, sunrealtype b, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  SUNDIALS_MAYBE_UNUSED int nt = MANYVECTOR_NUM_THREADS(x);
+
+  MV_OMP(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
-    N_VAddConst(MANYVECTOR_SUBVEC(x, i), b, MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    MV_SUBVEC_OP(nt, N_VAddConst, nvaddconst, MANYVECTOR_SUBVEC(z, i))
+    (MANYVECTOR_SUBVEC(x, i), b, MANYVECTOR_SUBVEC(z, i));
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -756,15 +846,18 @@ sunrealtype MVAPPEND(N_VDotProdLocal)(N_Vector x, N_Vector y)
 #ifdef MANYVECTOR_BUILD_WITH_MPI
   sunrealtype contrib;
   int rank;
+#else
+  sunrealtype* contribs;
+  int nt = MANYVECTOR_NUM_THREADS(x);
 #endif
 
   /* initialize output*/
   sum = ZERO;
 
-  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
-  {
 #ifdef MANYVECTOR_BUILD_WITH_MPI
 
+  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+  {
     /* check for nvdotprodlocal in subvector */
     if (MANYVECTOR_SUBVEC(x, i)->ops->nvdotprodlocal)
     {
@@ -783,15 +876,37 @@ sunrealtype MVAPPEND(N_VDotProdLocal)(N_Vector x, N_Vector y)
       if (rank < 0) { return (ZERO); }
       if (rank == 0) { sum += contrib; }
     }
+  }
 
 #else
 
-    /* add subvector contribution */
-    sum += N_VDotProd(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i));
-    SUNCheckLastErrNoRet();
+  if (nt > 1)
+  {
+    /* compute the subvector contributions concurrently */
+    contribs = ManyVectorContribArray(x);
+    if (contribs == NULL) { return (ZERO); }
 
-#endif
+    MV_OMP(omp parallel for schedule(static) num_threads(nt))
+    for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+    {
+      contribs[i] =
+        MANYVECTOR_SUBVEC(x, i)->ops->nvdotprod(MANYVECTOR_SUBVEC(x, i),
+                                                MANYVECTOR_SUBVEC(y, i));
+    }
+
+    sum = ManyVectorOrderedSum(x, contribs);
   }
+  else
+  {
+    /* add subvector contributions */
+    for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+    {
+      sum += N_VDotProd(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i));
+      SUNCheckLastErrNoRet();
+    }
+  }
+
+#endif
 
   return (sum);
 }
@@ -826,28 +941,32 @@ sunrealtype MVAPPEND(N_VMaxNormLocal)(N_Vector x)
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
   sunrealtype max, lmax;
+  SUNDIALS_MAYBE_UNUSED int nt = MANYVECTOR_NUM_THREADS(x);
 
   /* initialize output*/
   max = ZERO;
 
+  MV_OMP(omp parallel for private(lmax) reduction(max : max) schedule(static)
+           num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     /* check for nvmaxnormlocal in subvector */
     if (MANYVECTOR_SUBVEC(x, i)->ops->nvmaxnormlocal)
     {
-      lmax = N_VMaxNormLocal(MANYVECTOR_SUBVEC(x, i));
-      SUNCheckLastErrNoRet();
-      max = (max > lmax) ? max : lmax;
+      lmax = MV_SUBVEC_OP(nt, N_VMaxNormLocal, nvmaxnormlocal,
+                          MANYVECTOR_SUBVEC(x, i))(MANYVECTOR_SUBVEC(x, i));
+      max  = (max > lmax) ? max : lmax;
 
       /* otherwise, call nvmaxnorm and accumulate to overall max */
     }
     else
     {
-      lmax = N_VMaxNorm(MANYVECTOR_SUBVEC(x, i));
-      SUNCheckLastErrNoRet();
-      max = (max > lmax) ? max : lmax;
+      lmax = MV_SUBVEC_OP(nt, N_VMaxNorm, nvmaxnorm,
+                          MANYVECTOR_SUBVEC(x, i))(MANYVECTOR_SUBVEC(x, i));
+      max  = (max > lmax) ? max : lmax;
     }
   }
+  SUNCheckLastErrNoRet();
 
   return (max);
 }
@@ -887,15 +1006,18 @@ sunrealtype MVAPPEND(N_VWSqrSumLocal)(N_Vector x, N_Vector w)
   sunrealtype sum, contrib;
 #ifdef MANYVECTOR_BUILD_WITH_MPI
   int rank;
+#else
+  sunrealtype* contribs;
+  int nt = MANYVECTOR_NUM_THREADS(x);
 #endif
 
   /* initialize output*/
   sum = ZERO;
 
-  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
-  {
 #ifdef MANYVECTOR_BUILD_WITH_MPI
 
+  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+  {
     /* check for nvwsqrsumlocal in subvector */
     if (MANYVECTOR_SUBVEC(x, i)->ops->nvwsqrsumlocal)
     {
@@ -920,18 +1042,43 @@ sunrealtype MVAPPEND(N_VWSqrSumLocal)(N_Vector x, N_Vector w)
         sum += (contrib * contrib * N);
       }
     }
+  }
 
 #else
 
-    /* accumulate subvector contribution to overall sum */
-    contrib = N_VWrmsNorm(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(w, i));
-    SUNCheckLastErrNoRet();
-    N = N_VGetLength(MANYVECTOR_SUBVEC(x, i));
-    SUNCheckLastErrNoRet();
-    sum += (contrib * contrib * N);
+  if (nt > 1)
+  {
+    /* compute the subvector contributions concurrently */
+    contribs = ManyVectorContribArray(x);
+    if (contribs == NULL) { return (ZERO); }
 
-#endif
+    MV_OMP(omp parallel for private(contrib, N) schedule(static)
+             num_threads(nt))
+    for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+    {
+      contrib =
+        MANYVECTOR_SUBVEC(x, i)->ops->nvwrmsnorm(MANYVECTOR_SUBVEC(x, i),
+                                                 MANYVECTOR_SUBVEC(w, i));
+      N = MANYVECTOR_SUBVEC(x, i)->ops->nvgetlength(MANYVECTOR_SUBVEC(x, i));
+      contribs[i] = contrib * contrib * N;
+    }
+
+    sum = ManyVectorOrderedSum(x, contribs);
   }
+  else
+  {
+    /* accumulate subvector contributions to overall sum */
+    for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+    {
+      contrib = N_VWrmsNorm(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(w, i));
+      SUNCheckLastErrNoRet();
+      N = N_VGetLength(MANYVECTOR_SUBVEC(x, i));
+      SUNCheckLastErrNoRet();
+      sum += (contrib * contrib * N);
+    }
+  }
+
+#endif
 
   return (sum);
 }
@@ -978,15 +1125,18 @@ sunrealtype MVAPPEND(N_VWSqrSumMaskLocal)(N_Vector x, N_Vector w, N_Vector id)
   sunrealtype sum, contrib;
 #ifdef MANYVECTOR_BUILD_WITH_MPI
   int rank;
+#else
+  sunrealtype* contribs;
+  int nt = MANYVECTOR_NUM_THREADS(x);
 #endif
 
   /* initialize output*/
   sum = ZERO;
 
-  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
-  {
 #ifdef MANYVECTOR_BUILD_WITH_MPI
 
+  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+  {
     /* check for nvwsqrsummasklocal in subvector */
     if (MANYVECTOR_SUBVEC(x, i)->ops->nvwsqrsummasklocal)
     {
@@ -1013,20 +1163,47 @@ sunrealtype MVAPPEND(N_VWSqrSumMaskLocal)(N_Vector x, N_Vector w, N_Vector id)
         sum += (contrib * contrib * N);
       }
     }
+  }
 
 #else
 
-    /* accumulate subvector contribution to overall sum */
-    contrib = N_VWrmsNormMask(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(w, i),
-                              MANYVECTOR_SUBVEC(id, i));
-    SUNCheckLastErrNoRet();
-    N = N_VGetLength(MANYVECTOR_SUBVEC(x, i));
-    SUNCheckLastErrNoRet();
-    sum += (contrib * contrib * N);
+  if (nt > 1)
+  {
+    /* compute the subvector contributions concurrently */
+    contribs = ManyVectorContribArray(x);
+    if (contribs == NULL) { return (ZERO); }
 
-#endif
+    MV_OMP(omp parallel for private(contrib, N) schedule(static)
+             num_threads(nt))
+    for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+    {
+      contrib =
+        MANYVECTOR_SUBVEC(x, i)->ops->nvwrmsnormmask(MANYVECTOR_SUBVEC(x, i),
+                                                     MANYVECTOR_SUBVEC(w, i),
+                                                     MANYVECTOR_SUBVEC(id, i));
+      N = MANYVECTOR_SUBVEC(x, i)->ops->nvgetlength(MANYVECTOR_SUBVEC(x, i));
+      contribs[i] = contrib * contrib * N;
+    }
+
+    sum = ManyVectorOrderedSum(x, contribs);
+  }
+  else
+  {
+    /* accumulate subvector contributions to overall sum */
+    for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+    {
+      contrib = N_VWrmsNormMask(MANYVECTOR_SUBVEC(x, i),
+                                MANYVECTOR_SUBVEC(w, i),
+                                MANYVECTOR_SUBVEC(id, i));
+      SUNCheckLastErrNoRet();
+      N = N_VGetLength(MANYVECTOR_SUBVEC(x, i));
+      SUNCheckLastErrNoRet();
+      sum += (contrib * contrib * N);
+    }
   }
 
+#endif
+
   return (sum);
 }
 
@@ -1064,28 +1241,32 @@ sunrealtype MVAPPEND(N_VMinLocal)(N_Vector x)
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
   sunrealtype min, lmin;
+  SUNDIALS_MAYBE_UNUSED int nt = MANYVECTOR_NUM_THREADS(x);
 
   /* initialize output*/
   min = SUN_BIG_REAL;
 
+  MV_OMP(omp parallel for private(lmin) reduction(min : min) schedule(static)
+           num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     /* check for nvminlocal in subvector */
     if (MANYVECTOR_SUBVEC(x, i)->ops->nvminlocal)
     {
-      lmin = N_VMinLocal(MANYVECTOR_SUBVEC(x, i));
-      SUNCheckLastErrNoRet();
-      min = (min < lmin) ? min : lmin;
+      lmin = MV_SUBVEC_OP(nt, N_VMinLocal, nvminlocal,
+                          MANYVECTOR_SUBVEC(x, i))(MANYVECTOR_SUBVEC(x, i));
+      min  = (min < lmin) ? min : lmin;
 
       /* otherwise, call nvmin and accumulate to overall min */
     }
     else
     {
-      lmin = N_VMin(MANYVECTOR_SUBVEC(x, i));
-      SUNCheckLastErrNoRet();
-      min = (min < lmin) ? min : lmin;
+      lmin = MV_SUBVEC_OP(nt, N_VMin, nvmin,
+                          MANYVECTOR_SUBVEC(x, i))(MANYVECTOR_SUBVEC(x, i));
+      min  = (min < lmin) ? min : lmin;
     }
   }
+  SUNCheckLastErrNoRet();
 
   return (min);
 }
@@ -1145,15 +1326,18 @@ sunrealtype MVAPPEND(N_VL1NormLocal)(N_Vector x)
 #ifdef MANYVECTOR_BUILD_WITH_MPI
   sunrealtype contrib;
   int rank;
+#else
+  sunrealtype* contribs;
+  int nt = MANYVECTOR_NUM_THREADS(x);
 #endif
 
   /* initialize output*/
   sum = ZERO;
 
-  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
-  {
 #ifdef MANYVECTOR_BUILD_WITH_MPI
 
+  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+  {
     /* check for nvl1normlocal in subvector */
     if (MANYVECTOR_SUBVEC(x, i)->ops->nvl1normlocal)
     {
@@ -1173,16 +1357,37 @@ sunrealtype MVAPPEND(N_VL1NormLocal)(N_Vector x)
       if (rank < 0) { return (ZERO); }
       if (rank == 0) { sum += contrib; }
     }
+  }
 
 #else
 
-    /* accumulate subvector contribution to overall sum */
-    sum += N_VL1Norm(MANYVECTOR_SUBVEC(x, i));
-    SUNCheckLastErrNoRet();
+  if (nt > 1)
+  {
+    /* compute the subvector contributions concurrently */
+    contribs = ManyVectorContribArray(x);
+    if (contribs == NULL) { return (ZERO); }
 
-#endif
+    MV_OMP(omp parallel for schedule(static) num_threads(nt))
+    for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+    {
+      contribs[i] =
+        MANYVECTOR_SUBVEC(x, i)->ops->nvl1norm(MANYVECTOR_SUBVEC(x, i));
+    }
+
+    sum = ManyVectorOrderedSum(x, contribs);
+  }
+  else
+  {
+    /* accumulate subvector contributions to overall sum */
+    for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+    {
+      sum += N_VL1Norm(MANYVECTOR_SUBVEC(x, i));
+      SUNCheckLastErrNoRet();
+    }
   }
 
+#endif
+
   return (sum);
 }
 
@@ -1211,11 +1416,15 @@ void MVAPPEND(N_VCompare)(sunrealtype c, N_Vector x, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  SUNDIALS_MAYBE_UNUSED int nt = MANYVECTOR_NUM_THREADS(x);
+
+  MV_OMP(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
-    N_VCompare(c, MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
+    MV_SUBVEC_OP(nt, N_VCompare, nvcompare, MANYVECTOR_SUBVEC(z, i))
+    (c, MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -1231,28 +1440,34 @@ sunbooleantype MVAPPEND(N_VInvTestLocal)(N_Vector x, N_Vector z)
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
   sunbooleantype val, subval;
+  SUNDIALS_MAYBE_UNUSED int nt = MANYVECTOR_NUM_THREADS(x);
 
   /* initialize output*/
   val = SUNTRUE;
 
+  MV_OMP(omp parallel for private(subval) reduction(&& : val)
+           schedule(static) num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     /* check for nvinvtestlocal in subvector */
     if (MANYVECTOR_SUBVEC(x, i)->ops->nvinvtestlocal)
     {
-      subval = N_VInvTestLocal(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
-      SUNCheckLastErrNoRet();
-      val = (val && subval);
+      subval = MV_SUBVEC_OP(nt, N_VInvTestLocal, nvinvtestlocal,
+                            MANYVECTOR_SUBVEC(x, i))(MANYVECTOR_SUBVEC(x, i),
+                                                     MANYVECTOR_SUBVEC(z, i));
+      val    = (val && subval);
 
       /* otherwise, call nvinvtest and accumulate to overall val */
     }
     else
     {
-      subval = N_VInvTest(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
-      SUNCheckLastErrNoRet();
-      val = (val && subval);
+      subval = MV_SUBVEC_OP(nt, N_VInvTest, nvinvtest,
+                            MANYVECTOR_SUBVEC(x, i))(MANYVECTOR_SUBVEC(x, i),
+                                                     MANYVECTOR_SUBVEC(z, i));
+      val    = (val && subval);
     }
   }
+  SUNCheckLastErrNoRet();
 
   return (val);
 }
@@ -1290,31 +1505,36 @@ sunbooleantype MVAPPEND(N_VConstrMaskLocal)(N_Vector c, N_Vector x, N_Vector m)
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
   sunbooleantype val, subval;
+  SUNDIALS_MAYBE_UNUSED int nt = MANYVECTOR_NUM_THREADS(x);
 
   /* initialize output*/
   val = SUNTRUE;
 
+  MV_OMP(omp parallel for private(subval) reduction(&& : val)
+           schedule(static) num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     /* check for nvconstrmasklocal in subvector */
     if (MANYVECTOR_SUBVEC(x, i)->ops->nvconstrmasklocal)
     {
-      subval = N_VConstrMaskLocal(MANYVECTOR_SUBVEC(c, i),
-                                  MANYVECTOR_SUBVEC(x, i),
-                                  MANYVECTOR_SUBVEC(m, i));
-      SUNCheckLastErrNoRet();
-      val = (val && subval);
+      subval = MV_SUBVEC_OP(nt, N_VConstrMaskLocal, nvconstrmasklocal,
+                            MANYVECTOR_SUBVEC(x, i))(MANYVECTOR_SUBVEC(c, i),
+                                                     MANYVECTOR_SUBVEC(x, i),
+                                                     MANYVECTOR_SUBVEC(m, i));
+      val    = (val && subval);
 
       /* otherwise, call nvconstrmask and accumulate to overall val */
     }
     else
     {
-      subval = N_VConstrMask(MANYVECTOR_SUBVEC(c, i), MANYVECTOR_SUBVEC(x, i),
-                             MANYVECTOR_SUBVEC(m, i));
-      SUNCheckLastErrNoRet();
-      val = (val && subval);
+      subval = MV_SUBVEC_OP(nt, N_VConstrMask, nvconstrmask,
+                            MANYVECTOR_SUBVEC(x, i))(MANYVECTOR_SUBVEC(c, i),
+                                                     MANYVECTOR_SUBVEC(x, i),
+                                                     MANYVECTOR_SUBVEC(m, i));
+      val    = (val && subval);
     }
   }
+  SUNCheckLastErrNoRet();
 
   return (val);
 }
@@ -1352,30 +1572,36 @@ sunrealtype MVAPPEND(N_VMinQuotientLocal)(N_Vector num, N_Vector denom)
   SUNFunctionBegin(num->sunctx);
   sunindextype i;
   sunrealtype min, lmin;
+  SUNDIALS_MAYBE_UNUSED int nt = MANYVECTOR_NUM_THREADS(num);
 
   /* initialize output*/
   min = SUN_BIG_REAL;
 
+  MV_OMP(omp parallel for private(lmin) reduction(min : min) schedule(static)
+           num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(num); i++)
   {
     /* check for nvminquotientlocal in subvector */
     if (MANYVECTOR_SUBVEC(num, i)->ops->nvminquotientlocal)
     {
-      lmin = N_VMinQuotientLocal(MANYVECTOR_SUBVEC(num, i),
-                                 MANYVECTOR_SUBVEC(denom, i));
-      SUNCheckLastErrNoRet();
-      min = (min < lmin) ? min : lmin;
+      lmin = MV_SUBVEC_OP(nt, N_VMinQuotientLocal, nvminquotientlocal,
+                          MANYVECTOR_SUBVEC(num, i))(MANYVECTOR_SUBVEC(num, i),
+                                                     MANYVECTOR_SUBVEC(denom,
+                                                                       i));
+      min  = (min < lmin) ? min : lmin;
 
       /* otherwise, call nvmin and accumulate to overall min */
     }
     else
     {
-      lmin = N_VMinQuotient(MANYVECTOR_SUBVEC(num, i),
-                            MANYVECTOR_SUBVEC(denom, i));
-      SUNCheckLastErrNoRet();
-      min = (min < lmin) ? min : lmin;
+      lmin = MV_SUBVEC_OP(nt, N_VMinQuotient, nvminquotient,
+                          MANYVECTOR_SUBVEC(num, i))(MANYVECTOR_SUBVEC(num, i),
+                                                     MANYVECTOR_SUBVEC(denom,
+                                                                       i));
+      min  = (min < lmin) ? min : lmin;
     }
   }
+  SUNCheckLastErrNoRet();
 
   return (min);
 }
@@ -1460,6 +1686,37 @@ SUNErrCode N_VDotProdMultiAllReduce_MPIManyVector(int nvec_total, N_Vector x,
 
   return SUN_SUCCESS;
 }
+
+SUNErrCode N_VDotProdMultiAllReduceBegin_MPIManyVector(int nvec_total,
+                                                       N_Vector x,
+                                                       sunrealtype* sum)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  if (MANYVECTOR_COMM(x) == MPI_COMM_NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  /* only one reduction may be pending on a vector */
+  SUNAssert(MANYVECTOR_CONTENT(x)->request == MPI_REQUEST_NULL,
+            SUN_ERR_ARG_INCOMPATIBLE);
+
+  /* start the reduction, the buffer must not be accessed until it completes */
+  SUNCheckMPICall(MPI_Iallreduce(MPI_IN_PLACE, sum, nvec_total,
+                                 MPI_SUNREALTYPE, MPI_SUM, MANYVECTOR_COMM(x),
+                                 &(MANYVECTOR_CONTENT(x)->request)));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VDotProdMultiAllReduceEnd_MPIManyVector(N_Vector x)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  /* complete the pending reduction (if any) */
+  SUNCheckMPICall(
+    MPI_Wait(&(MANYVECTOR_CONTENT(x)->request), MPI_STATUS_IGNORE));
+
+  return SUN_SUCCESS;
+}
 #endif
 
 /* -----------------------------------------------------------------
@@ -1480,25 +1737,34 @@ SUNErrCode MVAPPEND(N_VLinearCombination)(int nvec, sunrealtype* c, N_Vector* X,
 {
   SUNFunctionBegin(z->sunctx);
   sunindextype i, j;
-  N_Vector* Xsub;
+  N_Vector *Xsub, *Xt;
+  SUNErrCode ierr, retval = SUN_SUCCESS;
+  int nt                  = MANYVECTOR_NUM_THREADS(z);
 
-  /* create array of nvec N_Vector pointers for reuse within loop */
+  /* create array of nvec N_Vector pointers per thread for reuse within loop */
   Xsub = NULL;
-  Xsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Xsub = (N_Vector*)malloc(nt * nvec * sizeof(N_Vector));
   SUNAssert(Xsub, SUN_ERR_MALLOC_FAIL);
 
   /* perform operation by calling N_VLinearCombination for each subvector */
+  MV_OMP(omp parallel for private(j, ierr, Xt) reduction(min : retval)
+           schedule(static) num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(z); i++)
   {
     /* for each subvector, create the array of subvectors of X */
-    for (j = 0; j < nvec; j++) { Xsub[j] = MANYVECTOR_SUBVEC(X[j], i); }
+    Xt = Xsub + MV_THREAD_NUM() * nvec;
+    for (j = 0; j < nvec; j++) { Xt[j] = MANYVECTOR_SUBVEC(X[j], i); }
 
     /* now call N_VLinearCombination for this array of subvectors */
-    SUNCheckCall(N_VLinearCombination(nvec, c, Xsub, MANYVECTOR_SUBVEC(z, i)));
+    ierr = MV_SUBVEC_FUSED(nt, N_VLinearCombination,
+                           SubvecLinearCombination)(nvec, c, Xt,
+                                                    MANYVECTOR_SUBVEC(z, i));
+    retval = SUNMIN(retval, ierr);
   }
 
   /* clean up and return */
   free(Xsub);
+  SUNCheckCall(retval);
   return SUN_SUCCESS;
 }
 
@@ -1516,32 +1782,42 @@ SUNErrCode MVAPPEND(N_VScaleAddMulti)(int nvec, sunrealtype* a, N_Vector x,
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i, j;
-  N_Vector *Ysub, *Zsub;
+  N_Vector *Ysub, *Zsub, *Yt, *Zt;
+  SUNErrCode ierr, retval = SUN_SUCCESS;
+  int nt                  = MANYVECTOR_NUM_THREADS(x);
 
-  /* create arrays of nvec N_Vector pointers for reuse within loop */
+  /* create arrays of nvec N_Vector pointers per thread for reuse within loop */
   Ysub = Zsub = NULL;
-  Ysub        = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Ysub        = (N_Vector*)malloc(nt * nvec * sizeof(N_Vector));
   SUNAssert(Ysub, SUN_ERR_MALLOC_FAIL);
-  Zsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Zsub = (N_Vector*)malloc(nt * nvec * sizeof(N_Vector));
   SUNAssert(Zsub, SUN_ERR_MALLOC_FAIL);
 
   /* perform operation by calling N_VScaleAddMulti for each subvector */
+  MV_OMP(omp parallel for private(j, ierr, Yt, Zt) reduction(min : retval)
+           schedule(static) num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     /* for each subvector, create the array of subvectors of Y and Z */
+    Yt = Ysub + MV_THREAD_NUM() * nvec;
+    Zt = Zsub + MV_THREAD_NUM() * nvec;
     for (j = 0; j < nvec; j++)
     {
-      Ysub[j] = MANYVECTOR_SUBVEC(Y[j], i);
-      Zsub[j] = MANYVECTOR_SUBVEC(Z[j], i);
+      Yt[j] = MANYVECTOR_SUBVEC(Y[j], i);
+      Zt[j] = MANYVECTOR_SUBVEC(Z[j], i);
     }
 
     /* now call N_VScaleAddMulti for this array of subvectors */
-    SUNCheckCall(N_VScaleAddMulti(nvec, a, MANYVECTOR_SUBVEC(x, i), Ysub, Zsub));
+    ierr = MV_SUBVEC_FUSED(nt, N_VScaleAddMulti,
+                           SubvecScaleAddMulti)(nvec, a,
+                                                MANYVECTOR_SUBVEC(x, i), Yt, Zt);
+    retval = SUNMIN(retval, ierr);
   }
 
   /* clean up and return */
   free(Ysub);
   free(Zsub);
+  SUNCheckCall(retval);
   return SUN_SUCCESS;
 }
 
@@ -1598,40 +1874,51 @@ SUNErrCode MVAPPEND(N_VLinearSumVectorArray)(int nvec, sunrealtype a,
 {
   SUNFunctionBegin(X[0]->sunctx);
   sunindextype i, j;
-  N_Vector *Xsub, *Ysub, *Zsub;
+  N_Vector *Xsub, *Ysub, *Zsub, *Xt, *Yt, *Zt;
+  SUNErrCode ierr, retval = SUN_SUCCESS;
+  int nt;
 
   SUNAssert(nvec > 0, SUN_ERR_ARG_OUTOFRANGE);
+  nt = MANYVECTOR_NUM_THREADS(X[0]);
 
-  /* create arrays of nvec N_Vector pointers for reuse within loop */
+  /* create arrays of nvec N_Vector pointers per thread for reuse within loop */
   Xsub = NULL;
   Ysub = NULL;
   Zsub = NULL;
-  Xsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Xsub = (N_Vector*)malloc(nt * nvec * sizeof(N_Vector));
   SUNAssert(Xsub, SUN_ERR_MALLOC_FAIL);
-  Ysub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Ysub = (N_Vector*)malloc(nt * nvec * sizeof(N_Vector));
   SUNAssert(Ysub, SUN_ERR_MALLOC_FAIL);
-  Zsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Zsub = (N_Vector*)malloc(nt * nvec * sizeof(N_Vector));
   SUNAssert(Zsub, SUN_ERR_MALLOC_FAIL);
 
   /* perform operation by calling N_VLinearSumVectorArray for each subvector */
+  MV_OMP(omp parallel for private(j, ierr, Xt, Yt, Zt) reduction(min : retval)
+           schedule(static) num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(X[0]); i++)
   {
     /* for each subvector, create the array of subvectors of X, Y and Z */
+    Xt = Xsub + MV_THREAD_NUM() * nvec;
+    Yt = Ysub + MV_THREAD_NUM() * nvec;
+    Zt = Zsub + MV_THREAD_NUM() * nvec;
     for (j = 0; j < nvec; j++)
     {
-      Xsub[j] = MANYVECTOR_SUBVEC(X[j], i);
-      Ysub[j] = MANYVECTOR_SUBVEC(Y[j], i);
-      Zsub[j] = MANYVECTOR_SUBVEC(Z[j], i);
+      Xt[j] = MANYVECTOR_SUBVEC(X[j], i);
+      Yt[j] = MANYVECTOR_SUBVEC(Y[j], i);
+      Zt[j] = MANYVECTOR_SUBVEC(Z[j], i);
     }
 
     /* now call N_VLinearSumVectorArray for this array of subvectors */
-    SUNCheckCall(N_VLinearSumVectorArray(nvec, a, Xsub, b, Ysub, Zsub));
+    ierr = MV_SUBVEC_FUSED(nt, N_VLinearSumVectorArray,
+                           SubvecLinearSumVectorArray)(nvec, a, Xt, b, Yt, Zt);
+    retval = SUNMIN(retval, ierr);
   }
 
   /* clean up and return */
   free(Xsub);
   free(Ysub);
   free(Zsub);
+  SUNCheckCall(retval);
   return SUN_SUCCESS;
 }
 
@@ -1649,35 +1936,45 @@ SUNErrCode MVAPPEND(N_VScaleVectorArray)(int nvec, sunrealtype* c, N_Vector* X,
 {
   SUNFunctionBegin(X[0]->sunctx);
   sunindextype i, j;
-  N_Vector *Xsub, *Zsub;
+  N_Vector *Xsub, *Zsub, *Xt, *Zt;
+  SUNErrCode ierr, retval = SUN_SUCCESS;
+  int nt;
 
   SUNAssert(nvec > 0, SUN_ERR_ARG_OUTOFRANGE);
+  nt = MANYVECTOR_NUM_THREADS(X[0]);
 
-  /* create arrays of nvec N_Vector pointers for reuse within loop */
+  /* create arrays of nvec N_Vector pointers per thread for reuse within loop */
   Xsub = NULL;
   Zsub = NULL;
-  Xsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Xsub = (N_Vector*)malloc(nt * nvec * sizeof(N_Vector));
   SUNAssert(Xsub, SUN_ERR_MALLOC_FAIL);
-  Zsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Zsub = (N_Vector*)malloc(nt * nvec * sizeof(N_Vector));
   SUNAssert(Zsub, SUN_ERR_MALLOC_FAIL);
 
   /* perform operation by calling N_VScaleVectorArray for each subvector */
+  MV_OMP(omp parallel for private(j, ierr, Xt, Zt) reduction(min : retval)
+           schedule(static) num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(X[0]); i++)
   {
     /* for each subvector, create the array of subvectors of X, Y and Z */
+    Xt = Xsub + MV_THREAD_NUM() * nvec;
+    Zt = Zsub + MV_THREAD_NUM() * nvec;
     for (j = 0; j < nvec; j++)
     {
-      Xsub[j] = MANYVECTOR_SUBVEC(X[j], i);
-      Zsub[j] = MANYVECTOR_SUBVEC(Z[j], i);
+      Xt[j] = MANYVECTOR_SUBVEC(X[j], i);
+      Zt[j] = MANYVECTOR_SUBVEC(Z[j], i);
     }
 
     /* now call N_VScaleVectorArray for this array of subvectors */
-    SUNCheckCall(N_VScaleVectorArray(nvec, c, Xsub, Zsub));
+    ierr = MV_SUBVEC_FUSED(nt, N_VScaleVectorArray,
+                           SubvecScaleVectorArray)(nvec, c, Xt, Zt);
+    retval = SUNMIN(retval, ierr);
   }
 
   /* clean up and return */
   free(Xsub);
   free(Zsub);
+  SUNCheckCall(retval);
   return SUN_SUCCESS;
 }
 
@@ -1692,27 +1989,36 @@ SUNErrCode MVAPPEND(N_VConstVectorArray)(int nvec, sunrealtype c, N_Vector* Z)
 {
   SUNFunctionBegin(Z[0]->sunctx);
   sunindextype i, j;
-  N_Vector* Zsub;
+  N_Vector *Zsub, *Zt;
+  SUNErrCode ierr, retval = SUN_SUCCESS;
+  int nt;
 
   SUNAssert(nvec > 0, SUN_ERR_ARG_OUTOFRANGE);
+  nt = MANYVECTOR_NUM_THREADS(Z[0]);
 
-  /* create array of N_Vector pointers for reuse within loop */
+  /* create array of N_Vector pointers per thread for reuse within loop */
   Zsub = NULL;
-  Zsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Zsub = (N_Vector*)malloc(nt * nvec * sizeof(N_Vector));
   SUNAssert(Zsub, SUN_ERR_MALLOC_FAIL);
 
   /* perform operation by calling N_VConstVectorArray for each subvector */
+  MV_OMP(omp parallel for private(j, ierr, Zt) reduction(min : retval)
+           schedule(static) num_threads(nt) if (nt > 1))
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(Z[0]); i++)
   {
     /* for each subvector, create the array of subvectors of X, Y and Z */
-    for (j = 0; j < nvec; j++) { Zsub[j] = MANYVECTOR_SUBVEC(Z[j], i); }
+    Zt = Zsub + MV_THREAD_NUM() * nvec;
+    for (j = 0; j < nvec; j++) { Zt[j] = MANYVECTOR_SUBVEC(Z[j], i); }
 
     /* now call N_VConstVectorArray for this array of subvectors */
-    SUNCheckCall(N_VConstVectorArray(nvec, c, Zsub));
+    ierr = MV_SUBVEC_FUSED(nt, N_VConstVectorArray,
+                           SubvecConstVectorArray)(nvec, c, Zt);
+    retval = SUNMIN(retval, ierr);
   }
 
   /* clean up and return */
   free(Zsub);
+  SUNCheckCall(retval);
   return SUN_SUCCESS;
 }
 
@@ -2060,7 +2366,10 @@ static N_Vector ManyVectorClone(N_Vector w, sunbooleantype cloneempty)
 
   /* Set scalar components */
 #ifdef MANYVECTOR_BUILD_WITH_MPI
-  content->comm = MPI_COMM_NULL;
+  content->comm    = MPI_COMM_NULL;
+  content->request = MPI_REQUEST_NULL;
+#else
+  content->num_threads = MANYVECTOR_CONTENT(w)->num_threads;
 #endif
   content->num_subvectors = MANYVECTOR_NUM_SUBVECS(w);
   content->global_length  = MANYVECTOR_GLOBLENGTH(w);
@@ -2104,6 +2413,87 @@ static N_Vector ManyVectorClone(N_Vector w, sunbooleantype cloneempty)
   return (v);
 }
 
+/* The following functions perform a fused operation on a set of subvectors
+   within a threaded loop.  They call the subvector operation through its ops
+   table or, if it is not provided, apply the same fallback as the generic
+   N_V* wrapper, without touching the profiler of the shared SUNContext. */
+static SUNErrCode SubvecLinearCombination(int nvec, sunrealtype* c, N_Vector* X,
+                                          N_Vector z)
+{
+  int i;
+
+  if (z->ops->nvlinearcombination != NULL)
+  {
+    return (z->ops->nvlinearcombination(nvec, c, X, z));
+  }
+
+  z->ops->nvscale(c[0], X[0], z);
+  for (i = 1; i < nvec; i++)
+  {
+    z->ops->nvlinearsum(c[i], X[i], SUN_RCONST(1.0), z, z);
+  }
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode SubvecScaleAddMulti(int nvec, sunrealtype* a, N_Vector x,
+                                      N_Vector* Y, N_Vector* Z)
+{
+  int i;
+
+  if (x->ops->nvscaleaddmulti != NULL)
+  {
+    return (x->ops->nvscaleaddmulti(nvec, a, x, Y, Z));
+  }
+
+  for (i = 0; i < nvec; i++)
+  {
+    x->ops->nvlinearsum(a[i], x, SUN_RCONST(1.0), Y[i], Z[i]);
+  }
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode SubvecLinearSumVectorArray(int nvec, sunrealtype a,
+                                             N_Vector* X, sunrealtype b,
+                                             N_Vector* Y, N_Vector* Z)
+{
+  int i;
+
+  if (Z[0]->ops->nvlinearsumvectorarray != NULL)
+  {
+    return (Z[0]->ops->nvlinearsumvectorarray(nvec, a, X, b, Y, Z));
+  }
+
+  for (i = 0; i < nvec; i++) { Z[0]->ops->nvlinearsum(a, X[i], b, Y[i], Z[i]); }
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode SubvecScaleVectorArray(int nvec, sunrealtype* c, N_Vector* X,
+                                         N_Vector* Z)
+{
+  int i;
+
+  if (Z[0]->ops->nvscalevectorarray != NULL)
+  {
+    return (Z[0]->ops->nvscalevectorarray(nvec, c, X, Z));
+  }
+
+  for (i = 0; i < nvec; i++) { Z[0]->ops->nvscale(c[i], X[i], Z[i]); }
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode SubvecConstVectorArray(int nvec, sunrealtype c, N_Vector* Z)
+{
+  int i;
+
+  if (Z[0]->ops->nvconstvectorarray != NULL)
+  {
+    return (Z[0]->ops->nvconstvectorarray(nvec, c, Z));
+  }
+
+  for (i = 0; i < nvec; i++) { Z[0]->ops->nvconst(c, Z[i]); }
+  return SUN_SUCCESS;
+}
+
 #ifdef MANYVECTOR_BUILD_WITH_MPI
 /* This function returns the rank of this task in the MPI communicator
    associated with the input N_Vector.  If the input N_Vector is MPI-unaware, it
@@ -2126,3 +2516,35 @@ static int SubvectorMPIRank(N_Vector x)
   return rank;
 }
 #endif
+
+#ifndef MANYVECTOR_BUILD_WITH_MPI
+/* This function allocates the array of subvector contributions used by the
+   threaded sums.  On failure the error is recorded in the SUNContext and NULL
+   is returned. */
+static sunrealtype* ManyVectorContribArray(N_Vector x)
+{
+  sunrealtype* contribs = NULL;
+  contribs =
+    (sunrealtype*)malloc(MANYVECTOR_NUM_SUBVECS(x) * sizeof(sunrealtype));
+  if (contribs == NULL)
+  {
+    SUNHandleErrWithMsg(__LINE__, __func__, __FILE__, NULL, SUN_ERR_MALLOC_FAIL,
+                        x->sunctx);
+  }
+  return (contribs);
+}
+
+/* This function adds the subvector contributions in subvector order, so a
+   threaded sum is identical to the sum computed with one thread, and frees
+   the array. */
+static sunrealtype ManyVectorOrderedSum(N_Vector x, sunrealtype* contribs)
+{
+  sunindextype i;
+  sunrealtype sum = ZERO;
+
+  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++) { sum += contribs[i]; }
+  free(contribs);
+
+  return (sum);
+}
+#endif
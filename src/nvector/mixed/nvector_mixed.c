@@ -0,0 +1,890 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for a mixed precision
+ * implementation of the NVECTOR package. The data is stored in
+ * single precision, element-wise operations compute in sunrealtype,
+ * and sums in reductions are accumulated in at least double
+ * precision. Operations are threaded with OpenMP when available.
+ * -----------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <nvector/nvector_mixed.h>
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_core.h>
+#include <sundials/sundials_errors.h>
+
+#include "sundials_macros.h"
+
+#define ZERO   SUN_RCONST(0.0)
+#define HALF   SUN_RCONST(0.5)
+#define ONE    SUN_RCONST(1.0)
+#define ONEPT5 SUN_RCONST(1.5)
+
+/* OpenMP directives, omitted when the library is not compiled with OpenMP */
+#ifdef _OPENMP
+#define NV_OMP_MX(directive) _Pragma(#directive)
+#else
+#define NV_OMP_MX(directive)
+#endif
+
+/* Type used to accumulate sums in reductions */
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+typedef sunrealtype nvaccumtype;
+#else
+typedef double nvaccumtype;
+#endif
+
+/*
+ * -----------------------------------------------------------------
+ * exported functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Returns vector type ID. Used to identify vector implementation
+ * from abstract N_Vector interface.
+ */
+N_Vector_ID N_VGetVectorID_Mixed(SUNDIALS_MAYBE_UNUSED N_Vector v)
+{
+  return SUNDIALS_NVEC_MIXED;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new empty vector
+ */
+
+N_Vector N_VNewEmpty_Mixed(sunindextype length, int num_threads,
+                           SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  N_Vector v;
+  N_VectorContent_Mixed content;
+
+  SUNAssertNull(length >= 0, SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssertNull(num_threads >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* Create vector */
+  v = NULL;
+  v = N_VNewEmpty(sunctx);
+  SUNCheckLastErrNull();
+
+  /* Attach operations */
+
+  /* constructors, destructors, and utility operations */
+  v->ops->nvgetvectorid    = N_VGetVectorID_Mixed;
+  v->ops->nvclone          = N_VClone_Mixed;
+  v->ops->nvcloneempty     = N_VCloneEmpty_Mixed;
+  v->ops->nvdestroy        = N_VDestroy_Mixed;
+  v->ops->nvgetlength      = N_VGetLength_Mixed;
+  v->ops->nvgetlocallength = N_VGetLength_Mixed;
+
+  /* standard vector operations */
+  v->ops->nvlinearsum    = N_VLinearSum_Mixed;
+  v->ops->nvconst        = N_VConst_Mixed;
+  v->ops->nvprod         = N_VProd_Mixed;
+  v->ops->nvdiv          = N_VDiv_Mixed;
+  v->ops->nvscale        = N_VScale_Mixed;
+  v->ops->nvabs          = N_VAbs_Mixed;
+  v->ops->nvinv          = N_VInv_Mixed;
+  v->ops->nvaddconst     = N_VAddConst_Mixed;
+  v->ops->nvdotprod      = N_VDotProd_Mixed;
+  v->ops->nvmaxnorm      = N_VMaxNorm_Mixed;
+  v->ops->nvwrmsnormmask = N_VWrmsNormMask_Mixed;
+  v->ops->nvwrmsnorm     = N_VWrmsNorm_Mixed;
+  v->ops->nvmin          = N_VMin_Mixed;
+  v->ops->nvwl2norm      = N_VWL2Norm_Mixed;
+  v->ops->nvl1norm       = N_VL1Norm_Mixed;
+  v->ops->nvcompare      = N_VCompare_Mixed;
+  v->ops->nvinvtest      = N_VInvTest_Mixed;
+  v->ops->nvconstrmask   = N_VConstrMask_Mixed;
+  v->ops->nvminquotient  = N_VMinQuotient_Mixed;
+
+  /* fused and vector array operations use the generic implementations */
+
+  /* local reduction kernels */
+  v->ops->nvdotprodlocal     = N_VDotProd_Mixed;
+  v->ops->nvmaxnormlocal     = N_VMaxNorm_Mixed;
+  v->ops->nvminlocal         = N_VMin_Mixed;
+  v->ops->nvl1normlocal      = N_VL1Norm_Mixed;
+  v->ops->nvinvtestlocal     = N_VInvTest_Mixed;
+  v->ops->nvconstrmasklocal  = N_VConstrMask_Mixed;
+  v->ops->nvminquotientlocal = N_VMinQuotient_Mixed;
+  v->ops->nvwsqrsumlocal     = N_VWSqrSumLocal_Mixed;
+  v->ops->nvwsqrsummasklocal = N_VWSqrSumMaskLocal_Mixed;
+
+  /* XBraid interface operations */
+  v->ops->nvbufsize   = N_VBufSize_Mixed;
+  v->ops->nvbufpack   = N_VBufPack_Mixed;
+  v->ops->nvbufunpack = N_VBufUnpack_Mixed;
+
+  /* debugging functions */
+  v->ops->nvprint     = N_VPrint_Mixed;
+  v->ops->nvprintfile = N_VPrintFile_Mixed;
+
+  /* Create content */
+  content = NULL;
+  content = (N_VectorContent_Mixed)malloc(sizeof *content);
+  SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
+
+  /* Attach content */
+  v->content = content;
+
+  /* Initialize content */
+  content->length      = length;
+  content->own_data    = SUNFALSE;
+  content->data        = NULL;
+  content->num_threads = num_threads;
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new vector
+ */
+
+N_Vector N_VNew_Mixed(sunindextype length, int num_threads, SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  N_Vector v;
+  float* data;
+
+  v = NULL;
+  v = N_VNewEmpty_Mixed(length, num_threads, sunctx);
+  SUNCheckLastErrNull();
+
+  /* Create data */
+  data = NULL;
+  if (length > 0)
+  {
+    data = (float*)malloc(length * sizeof(float));
+    SUNAssertNull(data, SUN_ERR_MALLOC_FAIL);
+  }
+
+  /* Attach data */
+  NV_OWN_DATA_MX(v) = SUNTRUE;
+  NV_DATA_MX(v)     = data;
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a vector with user data component
+ */
+
+N_Vector N_VMake_Mixed(sunindextype length, float* v_data, int num_threads,
+                       SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  N_Vector v;
+
+  v = NULL;
+  v = N_VNewEmpty_Mixed(length, num_threads, sunctx);
+  SUNCheckLastErrNull();
+
+  if (length > 0)
+  {
+    /* Attach data */
+    NV_OWN_DATA_MX(v) = SUNFALSE;
+    NV_DATA_MX(v)     = v_data;
+  }
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to return number of vector elements
+ */
+
+sunindextype N_VGetLength_Mixed(N_Vector v) { return NV_LENGTH_MX(v); }
+
+/* ----------------------------------------------------------------------------
+ * Function to print a vector to stdout
+ */
+
+void N_VPrint_Mixed(N_Vector x) { N_VPrintFile_Mixed(x, stdout); }
+
+/* ----------------------------------------------------------------------------
+ * Function to print a vector to outfile
+ */
+
+void N_VPrintFile_Mixed(N_Vector x, FILE* outfile)
+{
+  sunindextype i, N;
+  float* xd;
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+
+  for (i = 0; i < N; i++)
+  {
+    fprintf(outfile, SUN_FORMAT_E "\n", (sunrealtype)xd[i]);
+  }
+
+  return;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * implementation of vector operations
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Create new vector from existing vector without attaching data
+ */
+
+N_Vector N_VCloneEmpty_Mixed(N_Vector w)
+{
+  SUNFunctionBegin(w->sunctx);
+  N_Vector v;
+  N_VectorContent_Mixed content;
+
+  /* Create vector */
+  v = NULL;
+  v = N_VNewEmpty(w->sunctx);
+  SUNCheckLastErrNull();
+
+  /* Attach operations */
+  SUNCheckCallNull(N_VCopyOps(w, v));
+
+  /* Create content */
+  content = NULL;
+  content = (N_VectorContent_Mixed)malloc(sizeof *content);
+  SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
+
+  /* Attach content */
+  v->content = content;
+
+  /* Initialize content */
+  content->length      = NV_LENGTH_MX(w);
+  content->own_data    = SUNFALSE;
+  content->data        = NULL;
+  content->num_threads = NV_NUM_THREADS_MX(w);
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Create new vector from existing vector and attach data
+ */
+
+N_Vector N_VClone_Mixed(N_Vector w)
+{
+  SUNFunctionBegin(w->sunctx);
+  N_Vector v;
+  float* data;
+  sunindextype length;
+
+  v = NULL;
+  v = N_VCloneEmpty_Mixed(w);
+  SUNCheckLastErrNull();
+
+  length = NV_LENGTH_MX(w);
+
+  /* Create data */
+  data = NULL;
+  if (length > 0)
+  {
+    data = (float*)malloc(length * sizeof(float));
+    SUNAssertNull(data, SUN_ERR_MALLOC_FAIL);
+  }
+
+  /* Attach data */
+  NV_OWN_DATA_MX(v) = SUNTRUE;
+  NV_DATA_MX(v)     = data;
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Destroy vector and free vector memory
+ */
+
+void N_VDestroy_Mixed(N_Vector v)
+{
+  if (v == NULL) { return; }
+
+  /* free content */
+  if (v->content != NULL)
+  {
+    /* free data array if it's owned by the vector */
+    if (NV_OWN_DATA_MX(v) && NV_DATA_MX(v) != NULL)
+    {
+      free(NV_DATA_MX(v));
+      NV_DATA_MX(v) = NULL;
+    }
+    free(v->content);
+    v->content = NULL;
+  }
+
+  /* free ops and vector */
+  if (v->ops != NULL)
+  {
+    free(v->ops);
+    v->ops = NULL;
+  }
+  free(v);
+  v = NULL;
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute linear combination z[i] = a*x[i]+b*y[i]
+ */
+
+void N_VLinearSum_Mixed(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
+                        N_Vector z)
+{
+  sunindextype i, N;
+  float *xd, *yd, *zd;
+  int nt;
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  yd = NV_DATA_MX(y);
+  zd = NV_DATA_MX(z);
+  nt = NV_NUM_THREADS_MX(x);
+
+  NV_OMP_MX(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++)
+  {
+    zd[i] = (float)((a * (sunrealtype)xd[i]) + (b * (sunrealtype)yd[i]));
+  }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Assigns constant value to all vector elements, z[i] = c
+ */
+
+void N_VConst_Mixed(sunrealtype c, N_Vector z)
+{
+  sunindextype i, N;
+  float* zd;
+  float cf;
+  int nt;
+
+  N  = NV_LENGTH_MX(z);
+  zd = NV_DATA_MX(z);
+  nt = NV_NUM_THREADS_MX(z);
+  cf = (float)c;
+
+  NV_OMP_MX(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++) { zd[i] = cf; }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute componentwise product z[i] = x[i]*y[i]
+ */
+
+void N_VProd_Mixed(N_Vector x, N_Vector y, N_Vector z)
+{
+  sunindextype i, N;
+  float *xd, *yd, *zd;
+  int nt;
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  yd = NV_DATA_MX(y);
+  zd = NV_DATA_MX(z);
+  nt = NV_NUM_THREADS_MX(x);
+
+  NV_OMP_MX(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++)
+  {
+    zd[i] = (float)((sunrealtype)xd[i] * (sunrealtype)yd[i]);
+  }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute componentwise division z[i] = x[i]/y[i]
+ */
+
+void N_VDiv_Mixed(N_Vector x, N_Vector y, N_Vector z)
+{
+  sunindextype i, N;
+  float *xd, *yd, *zd;
+  int nt;
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  yd = NV_DATA_MX(y);
+  zd = NV_DATA_MX(z);
+  nt = NV_NUM_THREADS_MX(x);
+
+  NV_OMP_MX(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++)
+  {
+    zd[i] = (float)((sunrealtype)xd[i] / (sunrealtype)yd[i]);
+  }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute scaler multiplication z[i] = c*x[i]
+ */
+
+void N_VScale_Mixed(sunrealtype c, N_Vector x, N_Vector z)
+{
+  sunindextype i, N;
+  float *xd, *zd;
+  int nt;
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  zd = NV_DATA_MX(z);
+  nt = NV_NUM_THREADS_MX(x);
+
+  NV_OMP_MX(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++) { zd[i] = (float)(c * (sunrealtype)xd[i]); }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute absolute value of vector components z[i] = SUNRabs(x[i])
+ */
+
+void N_VAbs_Mixed(N_Vector x, N_Vector z)
+{
+  sunindextype i, N;
+  float *xd, *zd;
+  int nt;
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  zd = NV_DATA_MX(z);
+  nt = NV_NUM_THREADS_MX(x);
+
+  NV_OMP_MX(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++) { zd[i] = (xd[i] < 0.0f) ? -xd[i] : xd[i]; }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute componentwise inverse z[i] = 1 / x[i]
+ */
+
+void N_VInv_Mixed(N_Vector x, N_Vector z)
+{
+  sunindextype i, N;
+  float *xd, *zd;
+  int nt;
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  zd = NV_DATA_MX(z);
+  nt = NV_NUM_THREADS_MX(x);
+
+  NV_OMP_MX(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++) { zd[i] = (float)(ONE / (sunrealtype)xd[i]); }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute componentwise addition of a scaler to a vector z[i] = x[i] + b
+ */
+
+void N_VAddConst_Mixed(N_Vector x, sunrealtype b, N_Vector z)
+{
+  sunindextype i, N;
+  float *xd, *zd;
+  int nt;
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  zd = NV_DATA_MX(z);
+  nt = NV_NUM_THREADS_MX(x);
+
+  NV_OMP_MX(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++) { zd[i] = (float)((sunrealtype)xd[i] + b); }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Computes the dot product of two vectors, a = sum(x[i]*y[i])
+ */
+
+sunrealtype N_VDotProd_Mixed(N_Vector x, N_Vector y)
+{
+  sunindextype i, N;
+  nvaccumtype sum;
+  float *xd, *yd;
+  int nt;
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  yd = NV_DATA_MX(y);
+  nt = NV_NUM_THREADS_MX(x);
+
+  sum = 0.0;
+
+  NV_OMP_MX(omp parallel for reduction(+ : sum) schedule(static)
+              num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++) { sum += (nvaccumtype)xd[i] * (nvaccumtype)yd[i]; }
+
+  return ((sunrealtype)sum);
+}
+
+/* ----------------------------------------------------------------------------
+ * Computes max norm of a vector
+ */
+
+sunrealtype N_VMaxNorm_Mixed(N_Vector x)
+{
+  sunindextype i, N;
+  float max, *xd;
+  int nt;
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  nt = NV_NUM_THREADS_MX(x);
+
+  max = 0.0f;
+
+  NV_OMP_MX(omp parallel for reduction(max : max) schedule(static)
+              num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++)
+  {
+    if (xd[i] > max) { max = xd[i]; }
+    else if (-xd[i] > max) { max = -xd[i]; }
+  }
+
+  return ((sunrealtype)max);
+}
+
+/* ----------------------------------------------------------------------------
+ * Computes weighted root mean square norm of a vector
+ */
+
+sunrealtype N_VWrmsNorm_Mixed(N_Vector x, N_Vector w)
+{
+  return (SUNRsqrt(N_VWSqrSumLocal_Mixed(x, w) / (NV_LENGTH_MX(x))));
+}
+
+/* ----------------------------------------------------------------------------
+ * Computes weighted root mean square norm of a masked vector
+ */
+
+sunrealtype N_VWrmsNormMask_Mixed(N_Vector x, N_Vector w, N_Vector id)
+{
+  return (SUNRsqrt(N_VWSqrSumMaskLocal_Mixed(x, w, id) / (NV_LENGTH_MX(x))));
+}
+
+/* ----------------------------------------------------------------------------
+ * Finds the minimun component of a vector
+ */
+
+sunrealtype N_VMin_Mixed(N_Vector x)
+{
+  sunindextype i, N;
+  float min, *xd;
+  int nt;
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  nt = NV_NUM_THREADS_MX(x);
+
+  min = xd[0];
+
+  NV_OMP_MX(omp parallel for reduction(min : min) schedule(static)
+              num_threads(nt) if (nt > 1))
+  for (i = 1; i < N; i++)
+  {
+    if (xd[i] < min) { min = xd[i]; }
+  }
+
+  return ((sunrealtype)min);
+}
+
+/* ----------------------------------------------------------------------------
+ * Computes weighted L2 norm of a vector
+ */
+
+sunrealtype N_VWL2Norm_Mixed(N_Vector x, N_Vector w)
+{
+  return (SUNRsqrt(N_VWSqrSumLocal_Mixed(x, w)));
+}
+
+/* ----------------------------------------------------------------------------
+ * Computes L1 norm of a vector
+ */
+
+sunrealtype N_VL1Norm_Mixed(N_Vector x)
+{
+  sunindextype i, N;
+  nvaccumtype sum;
+  float* xd;
+  int nt;
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  nt = NV_NUM_THREADS_MX(x);
+
+  sum = 0.0;
+
+  NV_OMP_MX(omp parallel for reduction(+ : sum) schedule(static)
+              num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++)
+  {
+    sum += (xd[i] < 0.0f) ? -(nvaccumtype)xd[i] : (nvaccumtype)xd[i];
+  }
+
+  return ((sunrealtype)sum);
+}
+
+/* ----------------------------------------------------------------------------
+ * Compare vector component values to a scaler
+ */
+
+void N_VCompare_Mixed(sunrealtype c, N_Vector x, N_Vector z)
+{
+  sunindextype i, N;
+  float *xd, *zd;
+  int nt;
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  zd = NV_DATA_MX(z);
+  nt = NV_NUM_THREADS_MX(x);
+
+  NV_OMP_MX(omp parallel for schedule(static) num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++)
+  {
+    zd[i] = (SUNRabs((sunrealtype)xd[i]) >= c) ? 1.0f : 0.0f;
+  }
+
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute componentwise inverse z[i] = ONE/x[i] and checks if x[i] == ZERO
+ */
+
+sunbooleantype N_VInvTest_Mixed(N_Vector x, N_Vector z)
+{
+  sunindextype i, N;
+  float *xd, *zd;
+  int nt, nzero;
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  zd = NV_DATA_MX(z);
+  nt = NV_NUM_THREADS_MX(x);
+
+  nzero = 0;
+
+  NV_OMP_MX(omp parallel for reduction(+ : nzero) schedule(static)
+              num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++)
+  {
+    if (xd[i] == 0.0f) { nzero++; }
+    else { zd[i] = (float)(ONE / (sunrealtype)xd[i]); }
+  }
+
+  return (nzero > 0) ? SUNFALSE : SUNTRUE;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute constraint mask of a vector
+ */
+
+sunbooleantype N_VConstrMask_Mixed(N_Vector c, N_Vector x, N_Vector m)
+{
+  sunindextype i, N;
+  sunrealtype ci, xci;
+  float *cd, *xd, *md;
+  int nt, nviolated;
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  cd = NV_DATA_MX(c);
+  md = NV_DATA_MX(m);
+  nt = NV_NUM_THREADS_MX(x);
+
+  nviolated = 0;
+
+  NV_OMP_MX(omp parallel for private(ci, xci) reduction(+ : nviolated)
+              schedule(static) num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++)
+  {
+    md[i] = 0.0f;
+
+    /* Continue if no constraints were set for the variable */
+    if (cd[i] == 0.0f) { continue; }
+
+    /* Check if a set constraint has been violated */
+    ci  = (sunrealtype)cd[i];
+    xci = (sunrealtype)xd[i] * ci;
+    if ((SUNRabs(ci) > ONEPT5 && xci <= ZERO) ||
+        (SUNRabs(ci) > HALF && xci < ZERO))
+    {
+      md[i] = 1.0f;
+      nviolated++;
+    }
+  }
+
+  /* Return false if any constraint was violated */
+  return (nviolated > 0) ? SUNFALSE : SUNTRUE;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute minimum componentwise quotient
+ */
+
+sunrealtype N_VMinQuotient_Mixed(N_Vector num, N_Vector denom)
+{
+  sunindextype i, N;
+  sunrealtype min, q;
+  float *nd, *dd;
+  int nt;
+
+  N  = NV_LENGTH_MX(num);
+  nd = NV_DATA_MX(num);
+  dd = NV_DATA_MX(denom);
+  nt = NV_NUM_THREADS_MX(num);
+
+  min = SUN_BIG_REAL;
+
+  NV_OMP_MX(omp parallel for private(q) reduction(min : min) schedule(static)
+              num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++)
+  {
+    if (dd[i] == 0.0f) { continue; }
+    q = (sunrealtype)nd[i] / (sunrealtype)dd[i];
+    if (q < min) { min = q; }
+  }
+
+  return (min);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * single buffer reduction operations
+ * -----------------------------------------------------------------
+ */
+
+sunrealtype N_VWSqrSumLocal_Mixed(N_Vector x, N_Vector w)
+{
+  sunindextype i, N;
+  nvaccumtype sum, prodi;
+  float *xd, *wd;
+  int nt;
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  wd = NV_DATA_MX(w);
+  nt = NV_NUM_THREADS_MX(x);
+
+  sum = 0.0;
+
+  NV_OMP_MX(omp parallel for private(prodi) reduction(+ : sum)
+              schedule(static) num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++)
+  {
+    prodi = (nvaccumtype)xd[i] * (nvaccumtype)wd[i];
+    sum += prodi * prodi;
+  }
+
+  return ((sunrealtype)sum);
+}
+
+sunrealtype N_VWSqrSumMaskLocal_Mixed(N_Vector x, N_Vector w, N_Vector id)
+{
+  sunindextype i, N;
+  nvaccumtype sum, prodi;
+  float *xd, *wd, *idd;
+  int nt;
+
+  N   = NV_LENGTH_MX(x);
+  xd  = NV_DATA_MX(x);
+  wd  = NV_DATA_MX(w);
+  idd = NV_DATA_MX(id);
+  nt  = NV_NUM_THREADS_MX(x);
+
+  sum = 0.0;
+
+  NV_OMP_MX(omp parallel for private(prodi) reduction(+ : sum)
+              schedule(static) num_threads(nt) if (nt > 1))
+  for (i = 0; i < N; i++)
+  {
+    if (idd[i] > 0.0f)
+    {
+      prodi = (nvaccumtype)xd[i] * (nvaccumtype)wd[i];
+      sum += prodi * prodi;
+    }
+  }
+
+  return ((sunrealtype)sum);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * OPTIONAL XBraid interface operations
+ * -----------------------------------------------------------------
+ */
+
+SUNErrCode N_VBufSize_Mixed(N_Vector x, sunindextype* size)
+{
+  SUNFunctionBegin(x->sunctx);
+  SUNAssert(size, SUN_ERR_ARG_CORRUPT);
+  *size = NV_LENGTH_MX(x) * ((sunindextype)sizeof(float));
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VBufPack_Mixed(N_Vector x, void* buf)
+{
+  SUNFunctionBegin(x->sunctx);
+  sunindextype i, N;
+  float* xd = NULL;
+  float* bd = NULL;
+
+  SUNAssert(buf, SUN_ERR_ARG_CORRUPT);
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  bd = (float*)buf;
+
+  for (i = 0; i < N; i++) { bd[i] = xd[i]; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VBufUnpack_Mixed(N_Vector x, void* buf)
+{
+  SUNFunctionBegin(x->sunctx);
+  sunindextype i, N;
+  float* xd = NULL;
+  float* bd = NULL;
+
+  SUNAssert(buf, SUN_ERR_ARG_CORRUPT);
+
+  N  = NV_LENGTH_MX(x);
+  xd = NV_DATA_MX(x);
+  bd = (float*)buf;
+
+  for (i = 0; i < N; i++) { xd[i] = bd[i]; }
+
+  return SUN_SUCCESS;
+}
@@ -0,0 +1,625 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for a memory-mapped (out-of-core)
+ * implementation of the NVECTOR package. An mmap vector is a serial
+ * vector whose data is a mapping of a file, so the vector operations
+ * are those of the serial vector and only the constructors, the
+ * destructor, and the functions that replace the data differ.
+ * -----------------------------------------------------------------*/
+
+#if !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <nvector/nvector_mmap.h>
+#include <sundials/priv/sundials_context_impl.h>
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_core.h>
+#include <sundials/sundials_errors.h>
+
+#include "sundials_macros.h"
+
+/* Template of the names of the (unlinked) files backing the vectors */
+#define FILE_TEMPLATE "sundials_nvmmap_XXXXXX"
+
+/* Private functions for the serial vector underlying an mmap vector */
+static SUNErrCode VExtend_Mmap(N_Vector v, const char* dir);
+static void VUnmap_Mmap(N_Vector v);
+
+/* Private functions for the file mappings */
+static sunrealtype* VMap_Mmap(const char* dir, const char* filename,
+                              size_t size, SUNContext sunctx);
+static const char* VDefaultDir_Mmap(void);
+static char* VDirName_Mmap(const char* filename);
+static void VPages_Mmap(N_Vector v, void** start, size_t* len);
+static int VAdvise_Mmap(N_Vector v, int advice);
+
+/*
+ * -----------------------------------------------------------------
+ * exported functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new empty mmap vector
+ */
+
+N_Vector N_VNewEmpty_Mmap(sunindextype length, SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  N_Vector v;
+  SUNErrCode err;
+
+  /* Create an empty serial vector and extend it */
+  v = NULL;
+  v = N_VNewEmpty_Serial(length, sunctx);
+  SUNCheckLastErrNull();
+
+  err = VExtend_Mmap(v, NULL);
+  if (err != SUN_SUCCESS)
+  {
+    N_VDestroy_Serial(v);
+    SUNCheckCallNull(err);
+  }
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new mmap vector backed by an anonymous (unlinked) file
+ * in the directory dir. If dir is NULL, the directory is given by the
+ * environment variable TMPDIR or is /tmp.
+ */
+
+N_Vector N_VNew_Mmap(sunindextype length, const char* dir, SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  N_Vector v;
+  sunrealtype* data;
+  SUNErrCode err;
+  size_t size;
+
+  SUNAssertNull(length >= 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  v = NULL;
+  v = N_VNewEmpty_Serial(length, sunctx);
+  SUNCheckLastErrNull();
+
+  /* Save the directory for the files of clones */
+  err = VExtend_Mmap(v, dir);
+  if (err != SUN_SUCCESS)
+  {
+    N_VDestroy_Serial(v);
+    SUNCheckCallNull(err);
+  }
+
+  /* Create data */
+  if (length > 0)
+  {
+    size = (size_t)length * sizeof(sunrealtype);
+    data = VMap_Mmap(NV_DIR_MM(v), NULL, size, sunctx);
+    if (data == NULL)
+    {
+      N_VDestroy_Mmap(v);
+      return NULL;
+    }
+
+    /* Attach data */
+    NV_OWN_DATA_MM(v) = SUNTRUE;
+    NV_DATA_MM(v)     = data;
+    NV_MAP_SIZE_MM(v) = size;
+  }
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new mmap vector backed by the file filename. The file
+ * is created if it does not exist and is kept when the vector is destroyed,
+ * the data of an existing file is not modified. Clones of the vector are
+ * backed by anonymous files in the directory of filename.
+ */
+
+N_Vector N_VNewFile_Mmap(sunindextype length, const char* filename,
+                         SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  N_Vector v;
+  sunrealtype* data;
+  char* dir;
+  SUNErrCode err;
+  size_t size;
+
+  SUNAssertNull(length >= 0, SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssertNull(filename, SUN_ERR_ARG_CORRUPT);
+
+  v = NULL;
+  v = N_VNewEmpty_Serial(length, sunctx);
+  SUNCheckLastErrNull();
+
+  /* Save the directory for the files of clones */
+  dir = VDirName_Mmap(filename);
+  err = (dir == NULL) ? SUN_ERR_MALLOC_FAIL : VExtend_Mmap(v, dir);
+  free(dir);
+  if (err != SUN_SUCCESS)
+  {
+    N_VDestroy_Serial(v);
+    SUNCheckCallNull(err);
+  }
+
+  /* Create data */
+  if (length > 0)
+  {
+    size = (size_t)length * sizeof(sunrealtype);
+    data = VMap_Mmap(NULL, filename, size, sunctx);
+    if (data == NULL)
+    {
+      N_VDestroy_Mmap(v);
+      return NULL;
+    }
+
+    /* Attach data */
+    NV_OWN_DATA_MM(v) = SUNTRUE;
+    NV_DATA_MM(v)     = data;
+    NV_MAP_SIZE_MM(v) = size;
+  }
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create an mmap N_Vector with user data component
+ */
+
+N_Vector N_VMake_Mmap(sunindextype length, sunrealtype* v_data,
+                      SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  N_Vector v;
+
+  SUNAssertNull(length >= 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  v = NULL;
+  v = N_VNewEmpty_Mmap(length, sunctx);
+  SUNCheckLastErrNull();
+
+  if (length > 0)
+  {
+    /* Attach data */
+    NV_OWN_DATA_MM(v) = SUNFALSE;
+    NV_DATA_MM(v)     = v_data;
+  }
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------
+ * Returns vector type ID. Used to identify vector implementation
+ * from abstract N_Vector interface.
+ */
+N_Vector_ID N_VGetVectorID_Mmap(SUNDIALS_MAYBE_UNUSED N_Vector v)
+{
+  return SUNDIALS_NVEC_MMAP;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to write the mapped data of a vector back to its file
+ */
+
+SUNErrCode N_VSync_Mmap(N_Vector v)
+{
+  SUNFunctionBegin(v->sunctx);
+  void* start;
+  size_t len;
+
+  if (NV_MAP_SIZE_MM(v) == 0 || NV_LENGTH_MM(v) == 0) { return SUN_SUCCESS; }
+
+  /* execute pending operations that write the data */
+  SUNCheckCall(N_VFlushDeferredOps_Serial(v));
+
+  VPages_Mmap(v, &start, &len);
+  if (msync(start, len, MS_SYNC) != 0)
+  {
+    SUNHandleErrWithFmtMsg(__LINE__, __func__, __FILE__, "msync failed: %s",
+                           SUN_ERR_OP_FAIL, SUNCTX_, strerror(errno));
+    return SUN_ERR_OP_FAIL;
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to start reading the data of a vector into memory before it is
+ * used, e.g., a vector that was released or a file with stored data
+ */
+
+SUNErrCode N_VPrefetch_Mmap(N_Vector v)
+{
+  SUNFunctionBegin(v->sunctx);
+
+#if defined(MADV_WILLNEED)
+  if (VAdvise_Mmap(v, MADV_WILLNEED) != 0)
+  {
+    SUNHandleErrWithFmtMsg(__LINE__, __func__, __FILE__, "madvise failed: %s",
+                           SUN_ERR_OP_FAIL, SUNCTX_, strerror(errno));
+    return SUN_ERR_OP_FAIL;
+  }
+#endif
+
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to write the data of a vector that will not be used for a while
+ * back to its file and release its pages so the memory can be reused. The
+ * data is read from the file again when the vector is next accessed.
+ */
+
+SUNErrCode N_VRelease_Mmap(N_Vector v)
+{
+  SUNFunctionBegin(v->sunctx);
+  int err = 0;
+
+  SUNCheckCall(N_VSync_Mmap(v));
+
+  /* MADV_PAGEOUT reclaims the pages, older kernels only support dropping them
+     from the mapping and leave them in the page cache */
+#if defined(MADV_PAGEOUT)
+  err = VAdvise_Mmap(v, MADV_PAGEOUT);
+#if defined(MADV_DONTNEED)
+  if (err != 0 && errno == EINVAL) { err = VAdvise_Mmap(v, MADV_DONTNEED); }
+#endif
+#elif defined(MADV_DONTNEED)
+  err = VAdvise_Mmap(v, MADV_DONTNEED);
+#endif
+
+  if (err != 0)
+  {
+    SUNHandleErrWithFmtMsg(__LINE__, __func__, __FILE__, "madvise failed: %s",
+                           SUN_ERR_OP_FAIL, SUNCTX_, strerror(errno));
+    return SUN_ERR_OP_FAIL;
+  }
+
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * implementation of vector operations
+ * -----------------------------------------------------------------
+ */
+
+N_Vector N_VCloneEmpty_Mmap(N_Vector w)
+{
+  SUNFunctionBegin(w->sunctx);
+  N_Vector v;
+  SUNErrCode err;
+
+  /* Clone the serial vector, sharing the deferred operations of w */
+  v = NULL;
+  v = N_VCloneEmpty_Serial(w);
+  SUNCheckLastErrNull();
+
+  err = VExtend_Mmap(v, NV_DIR_MM(w));
+  if (err != SUN_SUCCESS)
+  {
+    N_VDestroy_Serial(v);
+    SUNCheckCallNull(err);
+  }
+
+  return (v);
+}
+
+N_Vector N_VClone_Mmap(N_Vector w)
+{
+  SUNFunctionBegin(w->sunctx);
+  N_Vector v;
+  sunrealtype* data;
+  size_t size;
+
+  v = NULL;
+  v = N_VCloneEmpty_Mmap(w);
+  SUNCheckLastErrNull();
+
+  /* Create data */
+  if (NV_LENGTH_MM(w) > 0)
+  {
+    size = (size_t)NV_LENGTH_MM(w) * sizeof(sunrealtype);
+    data = VMap_Mmap(NV_DIR_MM(w), NULL, size, w->sunctx);
+    if (data == NULL)
+    {
+      N_VDestroy_Mmap(v);
+      return NULL;
+    }
+
+    /* Attach data */
+    NV_OWN_DATA_MM(v) = SUNTRUE;
+    NV_DATA_MM(v)     = data;
+    NV_MAP_SIZE_MM(v) = size;
+  }
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create an array of mmap vectors backed by a single file. The
+ * mapping is owned by the first vector of the array.
+ */
+
+N_Vector* N_VCloneVectorArrayContiguous_Mmap(int count, N_Vector w)
+{
+  SUNFunctionBegin(w->sunctx);
+  int j;
+  N_Vector* vs;
+  sunrealtype* data;
+  sunindextype length;
+  size_t size;
+
+  SUNAssertNull(count > 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  vs = NULL;
+  vs = N_VCloneEmptyVectorArray(count, w);
+  SUNCheckLastErrNull();
+
+  length = NV_LENGTH_MM(w);
+
+  /* Create data */
+  if (length > 0)
+  {
+    size = (size_t)count * (size_t)length * sizeof(sunrealtype);
+    data = VMap_Mmap(NV_DIR_MM(w), NULL, size, w->sunctx);
+    if (data == NULL)
+    {
+      N_VDestroyVectorArray(vs, count);
+      return NULL;
+    }
+
+    /* Attach data */
+    for (j = 0; j < count; j++)
+    {
+      NV_OWN_DATA_MM(vs[j]) = (j == 0) ? SUNTRUE : SUNFALSE;
+      NV_DATA_MM(vs[j])     = data + j * length;
+      NV_MAP_SIZE_MM(vs[j]) = (j == 0) ? size : length * sizeof(sunrealtype);
+    }
+  }
+
+  return (vs);
+}
+
+void N_VDestroy_Mmap(N_Vector v)
+{
+  if (v == NULL) { return; }
+
+  if (v->content != NULL)
+  {
+    /* execute pending operations that may use the data, then unmap it */
+    N_VFlushDeferredOps_Serial(v);
+    VUnmap_Mmap(v);
+    free(NV_DIR_MM(v));
+    NV_DIR_MM(v) = NULL;
+  }
+
+  /* free the serial content, ops, and vector */
+  N_VDestroy_Serial(v);
+}
+
+void N_VSetArrayPointer_Mmap(sunrealtype* v_data, N_Vector v)
+{
+  /* the user data replaces the mapping */
+  if (NV_LENGTH_MM(v) > 0)
+  {
+    N_VFlushDeferredOps_Serial(v);
+    VUnmap_Mmap(v);
+  }
+
+  N_VSetArrayPointer_Serial(v_data, v);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * private functions for the serial vector underlying an mmap vector
+ * -----------------------------------------------------------------
+ */
+
+/* Replaces the content of the serial vector v with an mmap content holding a
+   copy of it and a copy of dir, and attaches the mmap operations */
+static SUNErrCode VExtend_Mmap(N_Vector v, const char* dir)
+{
+  N_VectorContent_Mmap content;
+
+  content = (N_VectorContent_Mmap)malloc(sizeof *content);
+  if (content == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  content->serial   = *NV_CONTENT_S(v);
+  content->map_size = 0;
+  content->dir      = NULL;
+  free(v->content);
+  v->content = content;
+
+  if (dir != NULL)
+  {
+    content->dir = (char*)malloc(strlen(dir) + 1);
+    if (content->dir == NULL) { return SUN_ERR_MALLOC_FAIL; }
+    strcpy(content->dir, dir);
+  }
+
+  /* all other operations are those of the serial vector */
+  v->ops->nvgetvectorid     = N_VGetVectorID_Mmap;
+  v->ops->nvclone           = N_VClone_Mmap;
+  v->ops->nvcloneempty      = N_VCloneEmpty_Mmap;
+  v->ops->nvdestroy         = N_VDestroy_Mmap;
+  v->ops->nvsetarraypointer = N_VSetArrayPointer_Mmap;
+
+  v->ops->nvclonevectorarraycontiguous = N_VCloneVectorArrayContiguous_Mmap;
+
+  return SUN_SUCCESS;
+}
+
+/* Unmaps the data of v if it owns the mapping and detaches it */
+static void VUnmap_Mmap(N_Vector v)
+{
+  if (NV_OWN_DATA_MM(v) && NV_DATA_MM(v) != NULL)
+  {
+    munmap(NV_DATA_MM(v), NV_MAP_SIZE_MM(v));
+    NV_DATA_MM(v) = NULL;
+  }
+  NV_OWN_DATA_MM(v) = SUNFALSE;
+  NV_MAP_SIZE_MM(v) = 0;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * private functions for the file mappings
+ * -----------------------------------------------------------------
+ */
+
+/* Maps size bytes of the file filename or, if filename is NULL, of a new
+   anonymous file in dir. The file is extended to size bytes if it is smaller.
+   Returns NULL on failure. */
+static sunrealtype* VMap_Mmap(const char* dir, const char* filename,
+                              size_t size, SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  int fd;
+  char* path;
+  void* data;
+  struct stat st;
+
+  if (filename != NULL)
+  {
+    fd = open(filename, O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+    {
+      SUNHandleErrWithFmtMsg(__LINE__, __func__, __FILE__,
+                             "Unable to open %s: %s", SUN_ERR_FILE_OPEN,
+                             SUNCTX_, filename, strerror(errno));
+      return NULL;
+    }
+  }
+  else
+  {
+    if (dir == NULL) { dir = VDefaultDir_Mmap(); }
+
+    path = (char*)malloc(strlen(dir) + sizeof(FILE_TEMPLATE) + 1);
+    SUNAssertNull(path, SUN_ERR_MALLOC_FAIL);
+    sprintf(path, "%s/%s", dir, FILE_TEMPLATE);
+
+    /* the file is removed as soon as it is mapped */
+    fd = mkstemp(path);
+    if (fd < 0)
+    {
+      SUNHandleErrWithFmtMsg(__LINE__, __func__, __FILE__,
+                             "Unable to create a file in %s: %s",
+                             SUN_ERR_FILE_OPEN, SUNCTX_, dir, strerror(errno));
+      free(path);
+      return NULL;
+    }
+    unlink(path);
+    free(path);
+  }
+
+  /* extend the file, the blocks are allocated when the pages are written */
+  if (fstat(fd, &st) != 0 ||
+      ((size_t)st.st_size < size && ftruncate(fd, (off_t)size) != 0))
+  {
+    SUNHandleErrWithFmtMsg(__LINE__, __func__, __FILE__,
+                           "Unable to resize the vector file: %s",
+                           SUN_ERR_FILE_OPEN, SUNCTX_, strerror(errno));
+    close(fd);
+    return NULL;
+  }
+
+  /* the mapping keeps a reference to the file */
+  data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+  {
+    SUNHandleErrWithFmtMsg(__LINE__, __func__, __FILE__, "mmap failed: %s",
+                           SUN_ERR_MEM_FAIL, SUNCTX_, strerror(errno));
+    return NULL;
+  }
+
+  /* the vector operations stream through the data, so let the kernel read
+     ahead aggressively and drop the pages behind */
+#if defined(MADV_SEQUENTIAL)
+  (void)madvise(data, size, MADV_SEQUENTIAL);
+#endif
+
+  return (sunrealtype*)data;
+}
+
+/* Returns the default directory for the files backing the vectors */
+static const char* VDefaultDir_Mmap(void)
+{
+  const char* dir = getenv("TMPDIR");
+  return (dir != NULL && dir[0] != '\0') ? dir : "/tmp";
+}
+
+/* Returns a copy of the directory part of filename */
+static char* VDirName_Mmap(const char* filename)
+{
+  const char* slash = strrchr(filename, '/');
+  const char* dir   = ".";
+  size_t len        = 1;
+  char* copy;
+
+  if (slash == filename)
+  {
+    dir = "/";
+    len = 1;
+  }
+  else if (slash != NULL)
+  {
+    dir = filename;
+    len = (size_t)(slash - filename);
+  }
+
+  copy = (char*)malloc(len + 1);
+  if (copy == NULL) { return NULL; }
+  memcpy(copy, dir, len);
+  copy[len] = '\0';
+
+  return copy;
+}
+
+/* Returns the range of whole pages holding the data of v */
+static void VPages_Mmap(N_Vector v, void** start, size_t* len)
+{
+  uintptr_t page  = (uintptr_t)sysconf(_SC_PAGESIZE);
+  uintptr_t first = (uintptr_t)NV_DATA_MM(v) & ~(page - 1);
+  uintptr_t last  = (uintptr_t)(NV_DATA_MM(v) + NV_LENGTH_MM(v));
+
+  *start = (void*)first;
+  *len   = (size_t)(last - first);
+}
+
+/* Applies the madvise advice to the pages holding the data of v */
+static int VAdvise_Mmap(N_Vector v, int advice)
+{
+  void* start;
+  size_t len;
+
+  if (NV_MAP_SIZE_MM(v) == 0 || NV_LENGTH_MM(v) == 0) { return 0; }
+
+  VPages_Mmap(v, &start, &len);
+  return madvise(start, len, advice);
+}
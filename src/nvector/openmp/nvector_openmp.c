@@ -32,12 +32,21 @@
 #include <sundials/sundials_errors.h>
 
 #include "sundials_macros.h"
+#include "sundials_nvector_affinity.h"
+#include "sundials_nvector_deferred.h"
+#include "sundials_nvector_multivec.h"
+#include "sundials_nvector_reproducible.h"
 
 #define ZERO   SUN_RCONST(0.0)
 #define HALF   SUN_RCONST(0.5)
 #define ONE    SUN_RCONST(1.0)
 #define ONEPT5 SUN_RCONST(1.5)
 
+#define NV_DEFERRED_OMP(v) (NV_CONTENT_OMP(v)->deferred)
+
+/* Private function to place new data with the kernel schedule */
+static void VFirstTouch_OpenMP(N_Vector v);
+
 /* Private functions for special cases of vector operations */
 static void VCopy_OpenMP(N_Vector x, N_Vector z);             /* z=x */
 static void VSum_OpenMP(N_Vector x, N_Vector y, N_Vector z);  /* z=x+y     */
@@ -74,6 +83,34 @@ static void VaxpyVectorArray_OpenMP(int nvec, sunrealtype a, N_Vector* X,
                                     N_Vector* Y); /* Y <- aX+Y
                                                                      */
 
+/* Private functions for deferred operations */
+static sunbooleantype VDefer_OpenMP(SUNDeferredOpType type, sunrealtype a,
+                                    sunrealtype b, N_Vector x, N_Vector y,
+                                    N_Vector z);
+static void VExecute_OpenMP(SUNDeferredOps d);
+static void VFlush_OpenMP(N_Vector v);
+static void VFlushArray_OpenMP(int nvec, N_Vector* V);
+static void VReady_OpenMP(N_Vector v);
+static void VReadyArray_OpenMP(int nvec, N_Vector* V);
+static SUNDeferredOps VFuse_OpenMP(N_Vector x, N_Vector y);
+static sunbooleantype VOverlap_OpenMP(N_Vector u, N_Vector v);
+static sunbooleantype VAlias_OpenMP(N_Vector t, N_Vector v);
+
+/* Private function for reductions independent of the number of threads */
+static sunrealtype VSumRepro_OpenMP(SUNReproSumType type, N_Vector x,
+                                    N_Vector y, N_Vector id);
+
+/* Private functions for vector arrays stored in a single block */
+static sunrealtype* VBlock_OpenMP(int nvec, N_Vector* X);
+static void VRange_OpenMP(sunindextype N, sunindextype* start,
+                          sunindextype* end);
+
+/* Maximum number of columns in a threaded multiple dot product pass */
+#define NV_BLOCK_NCOL_OMP 16
+
+/* Number of elements per block in the fused linear combination norm */
+#define NV_NORM_BLOCK_OMP 1024
+
 /*
  * -----------------------------------------------------------------
  * exported functions
@@ -120,6 +157,8 @@ N_Vector N_VNewEmpty_OpenMP(sunindextype length, int num_threads,
   v->ops->nvgetlength       = N_VGetLength_OpenMP;
   v->ops->nvgetlocallength  = N_VGetLength_OpenMP;
 
+  v->ops->nvclonevectorarraycontiguous = N_VCloneVectorArrayContiguous_OpenMP;
+
   /* standard vector operations */
   v->ops->nvlinearsum    = N_VLinearSum_OpenMP;
   v->ops->nvconst        = N_VConst_OpenMP;
@@ -175,10 +214,13 @@ N_Vector N_VNewEmpty_OpenMP(sunindextype length, int num_threads,
   v->content = content;
 
   /* Initialize content */
-  content->length      = length;
-  content->num_threads = num_threads;
-  content->own_data    = SUNFALSE;
-  content->data        = NULL;
+  content->length       = length;
+  content->num_threads  = num_threads;
+  content->affinity     = SUN_AFFINITY_NONE;
+  content->own_data     = SUNFALSE;
+  content->data         = NULL;
+  content->deferred     = NULL;
+  content->reproducible = SUNFALSE;
 
   return (v);
 }
@@ -188,6 +230,23 @@ N_Vector N_VNewEmpty_OpenMP(sunindextype length, int num_threads,
  */
 
 N_Vector N_VNew_OpenMP(sunindextype length, int num_threads, SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  N_Vector v;
+
+  v = NULL;
+  v = N_VNewWithAffinity_OpenMP(length, num_threads, SUN_AFFINITY_NONE, sunctx);
+  SUNCheckLastErrNull();
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new vector with a thread affinity policy
+ */
+
+N_Vector N_VNewWithAffinity_OpenMP(sunindextype length, int num_threads,
+                                   SUNAffinity affinity, SUNContext sunctx)
 {
   SUNFunctionBegin(sunctx);
   N_Vector v;
@@ -199,6 +258,8 @@ N_Vector N_VNew_OpenMP(sunindextype length, int num_threads, SUNContext sunctx)
   v = N_VNewEmpty_OpenMP(length, num_threads, sunctx);
   SUNCheckLastErrNull();
 
+  NV_AFFINITY_OMP(v) = affinity;
+
   /* Create data */
   data = NULL;
   if (length > 0)
@@ -209,6 +270,8 @@ N_Vector N_VNew_OpenMP(sunindextype length, int num_threads, SUNContext sunctx)
     /* Attach data */
     NV_OWN_DATA_OMP(v) = SUNTRUE;
     NV_DATA_OMP(v)     = data;
+
+    VFirstTouch_OpenMP(v);
   }
 
   return (v);
@@ -240,6 +303,38 @@ N_Vector N_VMake_OpenMP(sunindextype length, sunrealtype* v_data,
   return (v);
 }
 
+/* ----------------------------------------------------------------------------
+ * Function to create an OpenMP N_Vector that aliases the elements
+ * [offset, offset + length) of the vector w without copying them. The view
+ * does not own its data and has the same operations and number of threads as
+ * w, clones of the view are OpenMP vectors of the view length with their own
+ * data.
+ */
+
+N_Vector N_VMakeView_OpenMP(N_Vector w, sunindextype offset, sunindextype length)
+{
+  SUNFunctionBegin(w->sunctx);
+  N_Vector v;
+
+  SUNAssertNull(offset >= 0, SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssertNull(length >= 0, SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssertNull(offset + length <= NV_LENGTH_OMP(w), SUN_ERR_ARG_OUTOFRANGE);
+
+  v = NULL;
+  v = N_VCloneEmpty_OpenMP(w);
+  SUNCheckLastErrNull();
+
+  /* the view shares the recorder of w attached by the clone, so pending
+     operations writing w are executed before the view is read */
+
+  /* Attach data */
+  NV_LENGTH_OMP(v)   = length;
+  NV_OWN_DATA_OMP(v) = SUNFALSE;
+  NV_DATA_OMP(v)     = (length > 0) ? NV_DATA_OMP(w) + offset : NULL;
+
+  return (v);
+}
+
 /* ----------------------------------------------------------------------------
  * Function to return number of vector elements
  */
@@ -262,6 +357,8 @@ void N_VPrintFile_OpenMP(N_Vector x, FILE* outfile)
 
   xd = NULL;
 
+  VReady_OpenMP(x);
+
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
 
@@ -304,10 +401,13 @@ N_Vector N_VCloneEmpty_OpenMP(N_Vector w)
   v->content = content;
 
   /* Initialize content */
-  content->length      = NV_LENGTH_OMP(w);
-  content->num_threads = NV_NUM_THREADS_OMP(w);
-  content->own_data    = SUNFALSE;
-  content->data        = NULL;
+  content->length       = NV_LENGTH_OMP(w);
+  content->num_threads  = NV_NUM_THREADS_OMP(w);
+  content->affinity     = NV_AFFINITY_OMP(w);
+  content->own_data     = SUNFALSE;
+  content->data         = NULL;
+  content->deferred     = sunDeferredRetain(NV_DEFERRED_OMP(w));
+  content->reproducible = NV_REPRODUCIBLE_OMP(w);
 
   return (v);
 }
@@ -341,9 +441,53 @@ N_Vector N_VClone_OpenMP(N_Vector w)
   NV_OWN_DATA_OMP(v) = SUNTRUE;
   NV_DATA_OMP(v)     = data;
 
+  /* Place the data like the data of w */
+  if (length > 0) { VFirstTouch_OpenMP(v); }
+
   return (v);
 }
 
+/* ----------------------------------------------------------------------------
+ * Create an array of vectors whose data are the columns of a single
+ * column-major block. The block is owned by the first vector, so the vectors
+ * must be destroyed together, e.g., with N_VDestroyVectorArray.
+ */
+
+N_Vector* N_VCloneVectorArrayContiguous_OpenMP(int count, N_Vector w)
+{
+  SUNFunctionBegin(w->sunctx);
+  int j;
+  N_Vector* vs;
+  sunrealtype* data;
+  sunindextype length;
+
+  SUNAssertNull(count > 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  vs = NULL;
+  vs = N_VCloneEmptyVectorArray(count, w);
+  SUNCheckLastErrNull();
+
+  length = NV_LENGTH_OMP(w);
+
+  /* Create data */
+  data = NULL;
+  if (length > 0)
+  {
+    data = (sunrealtype*)malloc(count * length * sizeof(sunrealtype));
+    SUNAssertNull(data, SUN_ERR_MALLOC_FAIL);
+
+    /* Attach data and place each column like the data of w */
+    for (j = 0; j < count; j++)
+    {
+      NV_OWN_DATA_OMP(vs[j]) = (j == 0) ? SUNTRUE : SUNFALSE;
+      NV_DATA_OMP(vs[j])     = data + j * length;
+      VFirstTouch_OpenMP(vs[j]);
+    }
+  }
+
+  return (vs);
+}
+
 /* ----------------------------------------------------------------------------
  * Destroy vector and free vector memory
  */
@@ -355,6 +499,11 @@ void N_VDestroy_OpenMP(N_Vector v)
   /* free content */
   if (v->content != NULL)
   {
+    /* execute pending operations that may use the data and free the recorder */
+    VFlush_OpenMP(v);
+    sunDeferredRelease(NV_DEFERRED_OMP(v));
+    NV_DEFERRED_OMP(v) = NULL;
+
     /* free data array if it's owned by the vector */
     if (NV_OWN_DATA_OMP(v) && NV_DATA_OMP(v) != NULL)
     {
@@ -400,6 +549,7 @@ void N_VSpace_OpenMP(N_Vector v, sunindextype* lrw, sunindextype* liw)
 
 sunrealtype* N_VGetArrayPointer_OpenMP(N_Vector v)
 {
+  VFlush_OpenMP(v);
   return ((sunrealtype*)NV_DATA_OMP(v));
 }
 
@@ -409,6 +559,7 @@ sunrealtype* N_VGetArrayPointer_OpenMP(N_Vector v)
 
 void N_VSetArrayPointer_OpenMP(sunrealtype* v_data, N_Vector v)
 {
+  VFlush_OpenMP(v);
   if (NV_LENGTH_OMP(v) > 0) { NV_DATA_OMP(v) = v_data; }
 
   return;
@@ -429,6 +580,8 @@ void N_VLinearSum_OpenMP(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
   i  = 0; /* initialize to suppress clang warning */
   xd = yd = zd = NULL;
 
+  if (VDefer_OpenMP(sunDeferredLinearSumType(a, b), a, b, x, y, z)) { return; }
+
   if ((b == ONE) && (z == y))
   { /* BLAS usage: axpy y <- ax+y */
     Vaxpy_OpenMP(a, x, y);
@@ -528,6 +681,8 @@ void N_VConst_OpenMP(sunrealtype c, N_Vector z)
   i  = 0; /* initialize to suppress clang warning */
   zd = NULL;
 
+  if (VDefer_OpenMP(SUN_DEFERRED_CONST, c, ZERO, NULL, NULL, z)) { return; }
+
   N  = NV_LENGTH_OMP(z);
   zd = NV_DATA_OMP(z);
 
@@ -550,6 +705,8 @@ void N_VProd_OpenMP(N_Vector x, N_Vector y, N_Vector z)
   i  = 0; /* initialize to suppress clang warning */
   xd = yd = zd = NULL;
 
+  if (VDefer_OpenMP(SUN_DEFERRED_PROD, ZERO, ZERO, x, y, z)) { return; }
+
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
   yd = NV_DATA_OMP(y);
@@ -574,6 +731,8 @@ void N_VDiv_OpenMP(N_Vector x, N_Vector y, N_Vector z)
   i  = 0; /* initialize to suppress clang warning */
   xd = yd = zd = NULL;
 
+  if (VDefer_OpenMP(SUN_DEFERRED_DIV, ZERO, ZERO, x, y, z)) { return; }
+
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
   yd = NV_DATA_OMP(y);
@@ -598,6 +757,8 @@ void N_VScale_OpenMP(sunrealtype c, N_Vector x, N_Vector z)
   i  = 0; /* initialize to suppress clang warning */
   xd = zd = NULL;
 
+  if (VDefer_OpenMP(SUN_DEFERRED_SCALE, c, ZERO, x, NULL, z)) { return; }
+
   if (z == x)
   { /* BLAS usage: scale x <- cx */
     VScaleBy_OpenMP(c, x);
@@ -632,6 +793,8 @@ void N_VAbs_OpenMP(N_Vector x, N_Vector z)
   i  = 0; /* initialize to suppress clang warning */
   xd = zd = NULL;
 
+  if (VDefer_OpenMP(SUN_DEFERRED_ABS, ZERO, ZERO, x, NULL, z)) { return; }
+
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
   zd = NV_DATA_OMP(z);
@@ -654,6 +817,8 @@ void N_VInv_OpenMP(N_Vector x, N_Vector z)
   i  = 0; /* initialize to suppress clang warning */
   xd = zd = NULL;
 
+  if (VDefer_OpenMP(SUN_DEFERRED_INV, ZERO, ZERO, x, NULL, z)) { return; }
+
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
   zd = NV_DATA_OMP(z);
@@ -677,6 +842,8 @@ void N_VAddConst_OpenMP(N_Vector x, sunrealtype b, N_Vector z)
   i  = 0; /* initialize to suppress clang warning */
   xd = zd = NULL;
 
+  if (VDefer_OpenMP(SUN_DEFERRED_ADDCONST, ZERO, b, x, NULL, z)) { return; }
+
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
   zd = NV_DATA_OMP(z);
@@ -694,17 +861,43 @@ void N_VAddConst_OpenMP(N_Vector x, sunrealtype b, N_Vector z)
 
 sunrealtype N_VDotProd_OpenMP(N_Vector x, N_Vector y)
 {
-  sunindextype i, N;
-  sunrealtype sum, *xd, *yd;
+  sunindextype i, N, k, nblocks, start, end;
+  sunrealtype sum, *xd, *yd, *td;
+  SUNDeferredOps d;
 
   i   = 0; /* initialize to suppress clang warning */
   sum = ZERO;
   xd = yd = NULL;
 
+  if (NV_REPRODUCIBLE_OMP(x))
+  {
+    return (VSumRepro_OpenMP(SUN_REPRO_DOTPROD, x, y, NULL));
+  }
+
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
   yd = NV_DATA_OMP(y);
 
+  /* fuse pending operations writing x or y into the reduction */
+  d = VFuse_OpenMP(x, y);
+  if (d)
+  {
+    td      = NV_DATA_OMP(d->target);
+    nblocks = (N + SUN_DEFERRED_BLOCK - 1) / SUN_DEFERRED_BLOCK;
+#pragma omp parallel for default(none) private(i, k, start, end)        \
+  shared(d, N, nblocks, xd, yd, td) reduction(+ : sum) schedule(static) \
+  num_threads(NV_NUM_THREADS_OMP(x))
+    for (k = 0; k < nblocks; k++)
+    {
+      start = k * SUN_DEFERRED_BLOCK;
+      end   = SUNMIN(start + SUN_DEFERRED_BLOCK, N);
+      sunDeferredRunBlock(d, td, start, end);
+      for (i = start; i < end; i++) { sum += xd[i] * yd[i]; }
+    }
+    sunDeferredClear(d);
+    return (sum);
+  }
+
 #pragma omp parallel for default(none) private(i) shared(N, xd, yd) \
   reduction(+ : sum) schedule(static) num_threads(NV_NUM_THREADS_OMP(x))
   for (i = 0; i < N; i++) { sum += xd[i] * yd[i]; }
@@ -718,8 +911,9 @@ sunrealtype N_VDotProd_OpenMP(N_Vector x, N_Vector y)
 
 sunrealtype N_VMaxNorm_OpenMP(N_Vector x)
 {
-  sunindextype i, N;
+  sunindextype i, N, k, nblocks, start, end;
   sunrealtype tmax, max, *xd;
+  SUNDeferredOps d;
 
   i   = 0; /* initialize to suppress clang warning */
   max = ZERO;
@@ -728,6 +922,35 @@ sunrealtype N_VMaxNorm_OpenMP(N_Vector x)
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
 
+  /* fuse pending operations writing x into the reduction */
+  d = VFuse_OpenMP(x, NULL);
+  if (d)
+  {
+    nblocks = (N + SUN_DEFERRED_BLOCK - 1) / SUN_DEFERRED_BLOCK;
+#pragma omp parallel default(none) private(i, k, start, end, tmax) \
+  shared(d, N, nblocks, max, xd) num_threads(NV_NUM_THREADS_OMP(x))
+    {
+      tmax = ZERO;
+#pragma omp for schedule(static)
+      for (k = 0; k < nblocks; k++)
+      {
+        start = k * SUN_DEFERRED_BLOCK;
+        end   = SUNMIN(start + SUN_DEFERRED_BLOCK, N);
+        sunDeferredRunBlock(d, xd, start, end);
+        for (i = start; i < end; i++)
+        {
+          if (SUNRabs(xd[i]) > tmax) { tmax = SUNRabs(xd[i]); }
+        }
+      }
+#pragma omp critical
+      {
+        if (tmax > max) { max = tmax; }
+      }
+    }
+    sunDeferredClear(d);
+    return (max);
+  }
+
 #pragma omp parallel default(none) private(i, tmax) shared(N, max, xd) \
   num_threads(NV_NUM_THREADS_OMP(x))
   {
@@ -775,9 +998,10 @@ sunrealtype N_VWrmsNormMask_OpenMP(N_Vector x, N_Vector w, N_Vector id)
 
 sunrealtype N_VMin_OpenMP(N_Vector x)
 {
-  sunindextype i, N;
+  sunindextype i, N, k, nblocks, start, end;
   sunrealtype min, *xd;
   sunrealtype tmin;
+  SUNDeferredOps d;
 
   i  = 0; /* initialize to suppress clang warning */
   xd = NULL;
@@ -785,6 +1009,43 @@ sunrealtype N_VMin_OpenMP(N_Vector x)
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
 
+  /* fuse pending operations writing x into the reduction */
+  d = VFuse_OpenMP(x, NULL);
+  if (d)
+  {
+    /* the first block is executed up front to initialize the minimum */
+    end = SUNMIN(SUN_DEFERRED_BLOCK, N);
+    sunDeferredRunBlock(d, xd, 0, end);
+    min = xd[0];
+
+    nblocks = (N + SUN_DEFERRED_BLOCK - 1) / SUN_DEFERRED_BLOCK;
+#pragma omp parallel default(none) private(i, k, start, end, tmin) \
+  shared(d, N, nblocks, min, xd) num_threads(NV_NUM_THREADS_OMP(x))
+    {
+      tmin = xd[0];
+#pragma omp for schedule(static)
+      for (k = 0; k < nblocks; k++)
+      {
+        start = k * SUN_DEFERRED_BLOCK;
+        end   = SUNMIN(start + SUN_DEFERRED_BLOCK, N);
+        if (k > 0) { sunDeferredRunBlock(d, xd, start, end); }
+        for (i = start; i < end; i++)
+        {
+          if (xd[i] < tmin) { tmin = xd[i]; }
+        }
+      }
+      if (tmin < min)
+      {
+#pragma omp critical
+        {
+          if (tmin < min) { min = tmin; }
+        }
+      }
+    }
+    sunDeferredClear(d);
+    return (min);
+  }
+
   min = xd[0];
 
 #pragma omp parallel default(none) private(i, tmin) shared(N, min, xd) \
@@ -821,6 +1082,14 @@ sunrealtype N_VWL2Norm_OpenMP(N_Vector x, N_Vector w)
   sum = ZERO;
   xd = wd = NULL;
 
+  if (NV_REPRODUCIBLE_OMP(x))
+  {
+    return (SUNRsqrt(VSumRepro_OpenMP(SUN_REPRO_WSQRSUM, x, w, NULL)));
+  }
+
+  VReady_OpenMP(x);
+  VReady_OpenMP(w);
+
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
   wd = NV_DATA_OMP(w);
@@ -845,6 +1114,13 @@ sunrealtype N_VL1Norm_OpenMP(N_Vector x)
   sum = ZERO;
   xd  = NULL;
 
+  if (NV_REPRODUCIBLE_OMP(x))
+  {
+    return (VSumRepro_OpenMP(SUN_REPRO_L1NORM, x, NULL, NULL));
+  }
+
+  VReady_OpenMP(x);
+
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
 
@@ -867,6 +1143,8 @@ void N_VCompare_OpenMP(sunrealtype c, N_Vector x, N_Vector z)
   i  = 0; /* initialize to suppress clang warning */
   xd = zd = NULL;
 
+  if (VDefer_OpenMP(SUN_DEFERRED_COMPARE, c, ZERO, x, NULL, z)) { return; }
+
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
   zd = NV_DATA_OMP(z);
@@ -890,6 +1168,9 @@ sunbooleantype N_VInvTest_OpenMP(N_Vector x, N_Vector z)
   i  = 0; /* initialize to suppress clang warning */
   xd = zd = NULL;
 
+  VReady_OpenMP(x);
+  VFlush_OpenMP(z);
+
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
   zd = NV_DATA_OMP(z);
@@ -922,6 +1203,10 @@ sunbooleantype N_VConstrMask_OpenMP(N_Vector c, N_Vector x, N_Vector m)
   i  = 0; /* initialize to suppress clang warning */
   cd = xd = md = NULL;
 
+  VReady_OpenMP(c);
+  VReady_OpenMP(x);
+  VFlush_OpenMP(m);
+
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
   cd = NV_DATA_OMP(c);
@@ -960,6 +1245,9 @@ sunrealtype N_VMinQuotient_OpenMP(N_Vector num, N_Vector denom)
   i  = 0; /* initialize to suppress clang warning */
   nd = dd = NULL;
 
+  VReady_OpenMP(num);
+  VReady_OpenMP(denom);
+
   N  = NV_LENGTH_OMP(num);
   nd = NV_DATA_OMP(num);
   dd = NV_DATA_OMP(denom);
@@ -997,17 +1285,43 @@ sunrealtype N_VMinQuotient_OpenMP(N_Vector num, N_Vector denom)
 
 sunrealtype N_VWSqrSumLocal_OpenMP(N_Vector x, N_Vector w)
 {
-  sunindextype i, N;
-  sunrealtype sum, *xd, *wd;
+  sunindextype i, N, k, nblocks, start, end;
+  sunrealtype sum, *xd, *wd, *td;
+  SUNDeferredOps d;
 
   i   = 0; /* initialize to suppress clang warning */
   sum = ZERO;
   xd = wd = NULL;
 
+  if (NV_REPRODUCIBLE_OMP(x))
+  {
+    return (VSumRepro_OpenMP(SUN_REPRO_WSQRSUM, x, w, NULL));
+  }
+
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
   wd = NV_DATA_OMP(w);
 
+  /* fuse pending operations writing x or w into the reduction */
+  d = VFuse_OpenMP(x, w);
+  if (d)
+  {
+    td      = NV_DATA_OMP(d->target);
+    nblocks = (N + SUN_DEFERRED_BLOCK - 1) / SUN_DEFERRED_BLOCK;
+#pragma omp parallel for default(none) private(i, k, start, end)        \
+  shared(d, N, nblocks, xd, wd, td) reduction(+ : sum) schedule(static) \
+  num_threads(NV_NUM_THREADS_OMP(x))
+    for (k = 0; k < nblocks; k++)
+    {
+      start = k * SUN_DEFERRED_BLOCK;
+      end   = SUNMIN(start + SUN_DEFERRED_BLOCK, N);
+      sunDeferredRunBlock(d, td, start, end);
+      for (i = start; i < end; i++) { sum += SUNSQR(xd[i] * wd[i]); }
+    }
+    sunDeferredClear(d);
+    return (sum);
+  }
+
 #pragma omp parallel for default(none) private(i) shared(N, xd, wd) \
   reduction(+ : sum) schedule(static) num_threads(NV_NUM_THREADS_OMP(x))
   for (i = 0; i < N; i++) { sum += SUNSQR(xd[i] * wd[i]); }
@@ -1028,6 +1342,15 @@ sunrealtype N_VWSqrSumMaskLocal_OpenMP(N_Vector x, N_Vector w, N_Vector id)
   sum = ZERO;
   xd = wd = idd = NULL;
 
+  if (NV_REPRODUCIBLE_OMP(x))
+  {
+    return (VSumRepro_OpenMP(SUN_REPRO_WSQRSUMMASK, x, w, id));
+  }
+
+  VReady_OpenMP(x);
+  VReady_OpenMP(w);
+  VReady_OpenMP(id);
+
   N   = NV_LENGTH_OMP(x);
   xd  = NV_DATA_OMP(x);
   wd  = NV_DATA_OMP(w);
@@ -1081,10 +1404,35 @@ SUNErrCode N_VLinearCombination_OpenMP(int nvec, sunrealtype* c, N_Vector* X,
     return SUN_SUCCESS;
   }
 
+  /* execute pending operations on the vectors */
+  VReadyArray_OpenMP(nvec, X);
+  VFlush_OpenMP(z);
+
   /* get vector length and data array */
   N  = NV_LENGTH_OMP(z);
   zd = NV_DATA_OMP(z);
 
+  /*
+   * X[0] = c[0] * X[0] + sum{ c[i] * X[i] } or z = sum{ c[i] * X[i] } with the
+   * X[i] (other than z) stored in a single block
+   */
+  if (X[0] == z) { xd = VBlock_OpenMP(nvec - 1, X + 1); }
+  else { xd = VBlock_OpenMP(nvec, X); }
+
+  i = (X[0] == z) ? 1 : 0;
+  if (xd != NULL && !sunMultiVecOverlaps(zd, N, xd, (nvec - i) * N))
+  {
+#pragma omp parallel default(none) shared(nvec, N, c, i, xd, zd) \
+  num_threads(NV_NUM_THREADS_OMP(z))
+    {
+      sunindextype start, end;
+      VRange_OpenMP(N, &start, &end);
+      sunMultiVecGemvN(end - start, nvec - i, xd + start, N, c + i,
+                       (i == 1) ? c[0] : ZERO, zd + start);
+    }
+    return SUN_SUCCESS;
+  }
+
   /*
    * X[0] += c[i]*X[i], i = 1,...,nvec-1
    */
@@ -1169,10 +1517,33 @@ SUNErrCode N_VScaleAddMulti_OpenMP(int nvec, sunrealtype* a, N_Vector x,
     return SUN_SUCCESS;
   }
 
+  /* execute pending operations on the vectors */
+  VReady_OpenMP(x);
+  VReadyArray_OpenMP(nvec, Y);
+  VFlushArray_OpenMP(nvec, Z);
+
   /* get vector length and data array */
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
 
+  /*
+   * Z[i][j] = Y[i][j] + a[i] * x[j] with Y and Z stored in blocks
+   */
+  yd = VBlock_OpenMP(nvec, Y);
+  zd = (Y == Z) ? yd : VBlock_OpenMP(nvec, Z);
+  if (yd != NULL && zd != NULL)
+  {
+#pragma omp parallel default(none) shared(nvec, N, a, xd, yd, zd) \
+  num_threads(NV_NUM_THREADS_OMP(x))
+    {
+      sunindextype start, end;
+      VRange_OpenMP(N, &start, &end);
+      sunMultiVecScaleAdd(end - start, nvec, a, xd + start, yd + start, N,
+                          zd + start, N);
+    }
+    return SUN_SUCCESS;
+  }
+
   /*
    * Y[i][j] += a[i] * x[j]
    */
@@ -1233,6 +1604,19 @@ SUNErrCode N_VDotProdMulti_OpenMP(int nvec, N_Vector x, N_Vector* Y,
     return SUN_SUCCESS;
   }
 
+  if (NV_REPRODUCIBLE_OMP(x))
+  {
+    for (i = 0; i < nvec; i++)
+    {
+      dotprods[i] = VSumRepro_OpenMP(SUN_REPRO_DOTPROD, x, Y[i], NULL);
+    }
+    return SUN_SUCCESS;
+  }
+
+  /* execute pending operations on the vectors */
+  VReady_OpenMP(x);
+  VReadyArray_OpenMP(nvec, Y);
+
   /* get vector length and data array */
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
@@ -1240,6 +1624,34 @@ SUNErrCode N_VDotProdMulti_OpenMP(int nvec, N_Vector x, N_Vector* Y,
   /* initialize dot products */
   for (i = 0; i < nvec; i++) { dotprods[i] = ZERO; }
 
+  /* compute multiple dot products with Y stored in a block, each thread
+     computes the products over its rows for up to NV_BLOCK_NCOL_OMP columns
+     at a time */
+  yd = VBlock_OpenMP(nvec, Y);
+  if (yd != NULL)
+  {
+#pragma omp parallel default(none) private(i, j) \
+  shared(nvec, N, xd, yd, dotprods) num_threads(NV_NUM_THREADS_OMP(x))
+    {
+      int ncol;
+      sunindextype start, end;
+      sunrealtype sums[NV_BLOCK_NCOL_OMP];
+
+      VRange_OpenMP(N, &start, &end);
+      for (i = 0; i < nvec; i += NV_BLOCK_NCOL_OMP)
+      {
+        ncol = SUNMIN(NV_BLOCK_NCOL_OMP, nvec - i);
+        sunMultiVecGemvT(end - start, ncol, yd + i * N + start, N, xd + start,
+                         sums);
+#pragma omp critical
+        {
+          for (j = 0; j < ncol; j++) { dotprods[i + j] += sums[j]; }
+        }
+      }
+    }
+    return SUN_SUCCESS;
+  }
+
   /* compute multiple dot products */
 #pragma omp parallel default(none) private(i, j, yd, sum) \
   shared(nvec, Y, N, xd, dotprods) num_threads(NV_NUM_THREADS_OMP(x))
@@ -1260,6 +1672,123 @@ SUNErrCode N_VDotProdMulti_OpenMP(int nvec, N_Vector x, N_Vector* Y,
   return SUN_SUCCESS;
 }
 
+sunrealtype N_VLinearSumWrmsNorm_OpenMP(sunrealtype a, N_Vector x,
+                                        sunrealtype b, N_Vector y, N_Vector z,
+                                        N_Vector w)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  sunindextype i, N;
+  sunrealtype sum, *xd, *yd, *zd, *wd;
+
+  i   = 0; /* initialize to suppress clang warning */
+  sum = ZERO;
+  xd = yd = zd = wd = NULL;
+
+  if (NV_REPRODUCIBLE_OMP(z))
+  {
+    N_VLinearSum_OpenMP(a, x, b, y, z);
+    SUNCheckLastErrNoRet();
+    sum = VSumRepro_OpenMP(SUN_REPRO_WSQRSUM, z, w, NULL);
+    return (SUNRsqrt(sum / NV_LENGTH_OMP(z)));
+  }
+
+  /* execute pending operations on the vectors */
+  VReady_OpenMP(x);
+  VReady_OpenMP(y);
+  VReady_OpenMP(w);
+  VFlush_OpenMP(z);
+
+  N  = NV_LENGTH_OMP(z);
+  xd = NV_DATA_OMP(x);
+  yd = NV_DATA_OMP(y);
+  zd = NV_DATA_OMP(z);
+  wd = NV_DATA_OMP(w);
+
+#pragma omp parallel for default(none) private(i) \
+  shared(N, a, b, xd, yd, zd, wd) reduction(+ : sum) schedule(static) \
+  num_threads(NV_NUM_THREADS_OMP(z))
+  for (i = 0; i < N; i++)
+  {
+    zd[i] = (a * xd[i]) + (b * yd[i]);
+    sum += SUNSQR(zd[i] * wd[i]);
+  }
+
+  return (SUNRsqrt(sum / N));
+}
+
+SUNErrCode N_VLinearCombinationWrmsNorm_OpenMP(int nvec, sunrealtype* c,
+                                               N_Vector* X, N_Vector z,
+                                               N_Vector w, sunrealtype* nrm)
+{
+  SUNFunctionBegin(X[0]->sunctx);
+
+  int i;
+  sunindextype j, N;
+  sunrealtype sum, *zd, *wd;
+
+  i   = 0; /* initialize to suppress clang warning */
+  j   = 0;
+  sum = ZERO;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* should have called N_VLinearSumWrmsNorm */
+  if (nvec == 2)
+  {
+    *nrm = N_VLinearSumWrmsNorm_OpenMP(c[0], X[0], c[1], X[1], z, w);
+    SUNCheckLastErr();
+    return SUN_SUCCESS;
+  }
+
+  if (NV_REPRODUCIBLE_OMP(z))
+  {
+    SUNCheckCall(N_VLinearCombination_OpenMP(nvec, c, X, z));
+    sum  = VSumRepro_OpenMP(SUN_REPRO_WSQRSUM, z, w, NULL);
+    *nrm = SUNRsqrt(sum / NV_LENGTH_OMP(z));
+    return SUN_SUCCESS;
+  }
+
+  /* execute pending operations on the vectors */
+  VReadyArray_OpenMP(nvec, X);
+  VReady_OpenMP(w);
+  VFlush_OpenMP(z);
+
+  N  = NV_LENGTH_OMP(z);
+  zd = NV_DATA_OMP(z);
+  wd = NV_DATA_OMP(w);
+
+  /* each thread computes z = sum{ c[i] * X[i] } over its rows one block at a
+     time and accumulates the weighted square sum of the block while it is in
+     cache, X[0] may be z */
+#pragma omp parallel default(none) private(i, j) \
+  shared(nvec, c, X, N, zd, wd) reduction(+ : sum) \
+  num_threads(NV_NUM_THREADS_OMP(z))
+  {
+    sunindextype start, end, bstart, bend;
+    sunrealtype* xd;
+
+    VRange_OpenMP(N, &start, &end);
+    for (bstart = start; bstart < end; bstart += NV_NORM_BLOCK_OMP)
+    {
+      bend = SUNMIN(bstart + NV_NORM_BLOCK_OMP, end);
+      xd   = NV_DATA_OMP(X[0]);
+      for (j = bstart; j < bend; j++) { zd[j] = c[0] * xd[j]; }
+      for (i = 1; i < nvec; i++)
+      {
+        xd = NV_DATA_OMP(X[i]);
+        for (j = bstart; j < bend; j++) { zd[j] += c[i] * xd[j]; }
+      }
+      for (j = bstart; j < bend; j++) { sum += SUNSQR(zd[j] * wd[j]); }
+    }
+  }
+
+  *nrm = SUNRsqrt(sum / N);
+
+  return SUN_SUCCESS;
+}
+
 /*
  * -----------------------------------------------------------------
  * vector array operations
@@ -1295,6 +1824,11 @@ SUNErrCode N_VLinearSumVectorArray_OpenMP(int nvec, sunrealtype a, N_Vector* X,
     return SUN_SUCCESS;
   }
 
+  /* execute pending operations on the vectors */
+  VReadyArray_OpenMP(nvec, X);
+  VReadyArray_OpenMP(nvec, Y);
+  VFlushArray_OpenMP(nvec, Z);
+
   /* BLAS usage: axpy y <- ax+y */
   if ((b == ONE) && (Z == Y))
   {
@@ -1416,6 +1950,10 @@ SUNErrCode N_VScaleVectorArray_OpenMP(int nvec, sunrealtype* c, N_Vector* X,
     return SUN_SUCCESS;
   }
 
+  /* execute pending operations on the vectors */
+  VReadyArray_OpenMP(nvec, X);
+  VFlushArray_OpenMP(nvec, Z);
+
   /* get vector length */
   N = NV_LENGTH_OMP(Z[0]);
 
@@ -1476,6 +2014,9 @@ SUNErrCode N_VConstVectorArray_OpenMP(int nvec, sunrealtype c, N_Vector* Z)
     return SUN_SUCCESS;
   }
 
+  /* execute pending operations on the vectors */
+  VFlushArray_OpenMP(nvec, Z);
+
   /* get vector length */
   N = NV_LENGTH_OMP(Z[0]);
 
@@ -1519,6 +2060,21 @@ SUNErrCode N_VWrmsNormVectorArray_OpenMP(int nvec, N_Vector* X, N_Vector* W,
     return SUN_SUCCESS;
   }
 
+  if (NV_REPRODUCIBLE_OMP(X[0]))
+  {
+    N = NV_LENGTH_OMP(X[0]);
+    for (i = 0; i < nvec; i++)
+    {
+      sum    = VSumRepro_OpenMP(SUN_REPRO_WSQRSUM, X[i], W[i], NULL);
+      nrm[i] = SUNRsqrt(sum / N);
+    }
+    return SUN_SUCCESS;
+  }
+
+  /* execute pending operations on the vectors */
+  VReadyArray_OpenMP(nvec, X);
+  VReadyArray_OpenMP(nvec, W);
+
   /* get vector length */
   N = NV_LENGTH_OMP(X[0]);
 
@@ -1574,6 +2130,22 @@ SUNErrCode N_VWrmsNormMaskVectorArray_OpenMP(int nvec, N_Vector* X, N_Vector* W,
     return SUN_SUCCESS;
   }
 
+  if (NV_REPRODUCIBLE_OMP(X[0]))
+  {
+    N = NV_LENGTH_OMP(X[0]);
+    for (i = 0; i < nvec; i++)
+    {
+      sum    = VSumRepro_OpenMP(SUN_REPRO_WSQRSUMMASK, X[i], W[i], id);
+      nrm[i] = SUNRsqrt(sum / N);
+    }
+    return SUN_SUCCESS;
+  }
+
+  /* execute pending operations on the vectors */
+  VReadyArray_OpenMP(nvec, X);
+  VReadyArray_OpenMP(nvec, W);
+  VReady_OpenMP(id);
+
   /* get vector length and mask data array */
   N   = NV_LENGTH_OMP(X[0]);
   idd = NV_DATA_OMP(id);
@@ -1676,6 +2248,14 @@ SUNErrCode N_VScaleAddMultiVectorArray_OpenMP(int nvec, int nsum,
    * Compute multiple linear sums
    * ---------------------------- */
 
+  /* execute pending operations on the vectors */
+  VReadyArray_OpenMP(nvec, X);
+  for (j = 0; j < nsum; j++)
+  {
+    VReadyArray_OpenMP(nvec, Y[j]);
+    VFlushArray_OpenMP(nvec, Z[j]);
+  }
+
   /* get vector length */
   N = NV_LENGTH_OMP(X[0]);
 
@@ -1806,6 +2386,10 @@ SUNErrCode N_VLinearCombinationVectorArray_OpenMP(int nvec, int nsum,
    * Compute linear combination
    * -------------------------- */
 
+  /* execute pending operations on the vectors */
+  for (i = 0; i < nsum; i++) { VReadyArray_OpenMP(nvec, X[i]); }
+  VFlushArray_OpenMP(nvec, Z);
+
   /* get vector length */
   N = NV_LENGTH_OMP(Z[0]);
 
@@ -1902,6 +2486,8 @@ SUNErrCode N_VBufPack_OpenMP(N_Vector x, void* buf)
 
   SUNAssert(buf, SUN_ERR_ARG_CORRUPT);
 
+  VReady_OpenMP(x);
+
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
   bd = (sunrealtype*)buf;
@@ -1922,6 +2508,8 @@ SUNErrCode N_VBufUnpack_OpenMP(N_Vector x, void* buf)
 
   SUNAssert(buf, SUN_ERR_ARG_CORRUPT);
 
+  VFlush_OpenMP(x);
+
   N  = NV_LENGTH_OMP(x);
   xd = NV_DATA_OMP(x);
   bd = (sunrealtype*)buf;
@@ -2420,6 +3008,219 @@ static void VaxpyVectorArray_OpenMP(int nvec, sunrealtype a, N_Vector* X,
   }
 }
 
+/*
+ * -----------------------------------------------------------------
+ * private functions for data placement
+ * -----------------------------------------------------------------
+ */
+
+/* Initializes new data in parallel with the static schedule used by the
+   vector kernels so that, under a first-touch page placement policy, each
+   thread's share of the data resides in the memory closest to that thread.
+   When the vector has an affinity policy, threads are pinned while touching
+   the data and their previous CPU masks are restored afterwards. */
+static void VFirstTouch_OpenMP(N_Vector v)
+{
+  sunindextype i, N;
+  sunrealtype* vd;
+  SUNAffinity affinity;
+  sunAffinityMask saved;
+
+  N        = NV_LENGTH_OMP(v);
+  vd       = NV_DATA_OMP(v);
+  affinity = NV_AFFINITY_OMP(v);
+
+  if (affinity != SUN_AFFINITY_NONE) { sunAffinityInit(); }
+
+#pragma omp parallel default(none) private(i, saved) shared(N, vd, affinity) \
+  num_threads(NV_NUM_THREADS_OMP(v))
+  {
+    sunAffinityPin(affinity, omp_get_thread_num(), omp_get_num_threads(),
+                   &saved);
+#pragma omp for schedule(static)
+    for (i = 0; i < N; i++) { vd[i] = ZERO; }
+    sunAffinityRestore(&saved);
+  }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * private functions for vector arrays stored in a single block
+ * -----------------------------------------------------------------
+ */
+
+/* Returns the data of X[0] if the data of X[0],...,X[nvec-1] are the columns
+   of a single column-major block (e.g., the vectors were created with
+   N_VCloneVectorArrayContiguous_OpenMP), otherwise NULL */
+static sunrealtype* VBlock_OpenMP(int nvec, N_Vector* X)
+{
+  int i;
+  sunindextype N  = NV_LENGTH_OMP(X[0]);
+  sunrealtype* xd = NV_DATA_OMP(X[0]);
+
+  if (N == 0 || xd == NULL) { return NULL; }
+
+  for (i = 1; i < nvec; i++)
+  {
+    if (NV_DATA_OMP(X[i]) != xd + i * N) { return NULL; }
+  }
+
+  return xd;
+}
+
+/* Computes the range of rows [start, end) of the calling thread in a parallel
+   region, the rows are split into contiguous ranges like the static schedule
+   used by the other kernels so threads work on the data they placed */
+static void VRange_OpenMP(sunindextype N, sunindextype* start,
+                          sunindextype* end)
+{
+  sunindextype tid = (sunindextype)omp_get_thread_num();
+  sunindextype nt  = (sunindextype)omp_get_num_threads();
+  sunindextype q   = N / nt;
+  sunindextype r   = N % nt;
+
+  *start = tid * q + SUNMIN(tid, r);
+  *end   = *start + q + ((tid < r) ? 1 : 0);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * private functions for deferred operations
+ * -----------------------------------------------------------------
+ */
+
+/* Records z = op(x, y) when z has deferred operations enabled and x and y
+   (if used) share its recorder. Otherwise pending operations on the vectors
+   are executed and SUNFALSE is returned so the caller computes z now. */
+static sunbooleantype VDefer_OpenMP(SUNDeferredOpType type, sunrealtype a,
+                                    sunrealtype b, N_Vector x, N_Vector y,
+                                    N_Vector z)
+{
+  SUNDeferredOps d = NV_DEFERRED_OMP(z);
+  sunbooleantype shifted;
+
+  /* an operand overlapping z at other indices (e.g., a view of z) must be
+     read before z is written, which a chain executed block by block does
+     not guarantee */
+  shifted = (x && NV_DATA_OMP(x) != NV_DATA_OMP(z) && VOverlap_OpenMP(x, z)) ||
+            (y && NV_DATA_OMP(y) != NV_DATA_OMP(z) && VOverlap_OpenMP(y, z));
+
+  if (d && !shifted && (x == NULL || NV_DEFERRED_OMP(x) == d) &&
+      (y == NULL || NV_DEFERRED_OMP(y) == d))
+  {
+    /* a chain only writes one vector */
+    if (d->nops > 0 && (d->target != z || d->nops == SUN_DEFERRED_MAX_OPS))
+    {
+      VExecute_OpenMP(d);
+    }
+    sunDeferredRecord(d, z, type, a, b, x ? NV_DATA_OMP(x) : NULL,
+                      y ? NV_DATA_OMP(y) : NULL);
+    return SUNTRUE;
+  }
+
+  if (x) { VReady_OpenMP(x); }
+  if (y) { VReady_OpenMP(y); }
+  VFlush_OpenMP(z);
+
+  return SUNFALSE;
+}
+
+/* Executes the pending operations in a recorder */
+static void VExecute_OpenMP(SUNDeferredOps d)
+{
+  sunindextype N, k, nblocks, start, end;
+  sunrealtype* zd;
+
+  N       = NV_LENGTH_OMP(d->target);
+  zd      = NV_DATA_OMP(d->target);
+  nblocks = (N + SUN_DEFERRED_BLOCK - 1) / SUN_DEFERRED_BLOCK;
+
+#pragma omp parallel for default(none) private(k, start, end) \
+  shared(d, N, nblocks, zd) schedule(static)                  \
+  num_threads(NV_NUM_THREADS_OMP(d->target))
+  for (k = 0; k < nblocks; k++)
+  {
+    start = k * SUN_DEFERRED_BLOCK;
+    end   = SUNMIN(start + SUN_DEFERRED_BLOCK, N);
+    sunDeferredRunBlock(d, zd, start, end);
+  }
+
+  sunDeferredClear(d);
+}
+
+/* Executes any pending operations in the recorder of v. Used before v is
+   written, as pending operations may read v. */
+static void VFlush_OpenMP(N_Vector v)
+{
+  SUNDeferredOps d = NV_DEFERRED_OMP(v);
+  if (d && d->nops > 0) { VExecute_OpenMP(d); }
+}
+
+static void VFlushArray_OpenMP(int nvec, N_Vector* V)
+{
+  int i;
+  for (i = 0; i < nvec; i++) { VFlush_OpenMP(V[i]); }
+}
+
+/* Executes pending operations writing v or a vector overlapping v (e.g., a
+   view of v). Used before v is read. */
+static void VReady_OpenMP(N_Vector v)
+{
+  SUNDeferredOps d = NV_DEFERRED_OMP(v);
+  if (d && d->nops > 0 && VOverlap_OpenMP(d->target, v)) { VExecute_OpenMP(d); }
+}
+
+static void VReadyArray_OpenMP(int nvec, N_Vector* V)
+{
+  int i;
+  for (i = 0; i < nvec; i++) { VReady_OpenMP(V[i]); }
+}
+
+/* Returns the recorder with pending operations writing x or y (if not
+   NULL) so a reduction over x and y can execute them block by block.
+   Pending operations writing the other vector, or writing a vector that
+   overlaps x or y (e.g., the parent of a view), are executed. */
+static SUNDeferredOps VFuse_OpenMP(N_Vector x, N_Vector y)
+{
+  SUNDeferredOps dx = NV_DEFERRED_OMP(x);
+  SUNDeferredOps dy = y ? NV_DEFERRED_OMP(y) : NULL;
+
+  if (dx && dx->nops > 0 &&
+      (VAlias_OpenMP(dx->target, x) || (y && VAlias_OpenMP(dx->target, y))))
+  {
+    VExecute_OpenMP(dx);
+  }
+  if (dy && dy->nops > 0 &&
+      (VAlias_OpenMP(dy->target, y) || VAlias_OpenMP(dy->target, x)))
+  {
+    VExecute_OpenMP(dy);
+  }
+
+  if (dx && (dx->nops == 0 || dx->target != x)) { dx = NULL; }
+  if (dy && (dy->nops == 0 || dy->target != y)) { dy = NULL; }
+
+  if (dx && dy && dx != dy)
+  {
+    VExecute_OpenMP(dy);
+    dy = NULL;
+  }
+
+  return (dx ? dx : dy);
+}
+
+/* Returns SUNTRUE if u and v are the same vector or their data overlap */
+static sunbooleantype VOverlap_OpenMP(N_Vector u, N_Vector v)
+{
+  return (u == v || sunDeferredOverlap(NV_DATA_OMP(u), NV_LENGTH_OMP(u),
+                                       NV_DATA_OMP(v), NV_LENGTH_OMP(v)));
+}
+
+/* Returns SUNTRUE if v is not t but their data overlap */
+static sunbooleantype VAlias_OpenMP(N_Vector t, N_Vector v)
+{
+  return (t != v && VOverlap_OpenMP(t, v));
+}
+
 /*
  * -----------------------------------------------------------------
  * Enable / Disable fused and vector array operations
@@ -2431,9 +3232,11 @@ SUNErrCode N_VEnableFusedOps_OpenMP(N_Vector v, sunbooleantype tf)
   if (tf)
   {
     /* enable all fused vector operations */
-    v->ops->nvlinearcombination = N_VLinearCombination_OpenMP;
-    v->ops->nvscaleaddmulti     = N_VScaleAddMulti_OpenMP;
-    v->ops->nvdotprodmulti      = N_VDotProdMulti_OpenMP;
+    v->ops->nvlinearcombination         = N_VLinearCombination_OpenMP;
+    v->ops->nvscaleaddmulti             = N_VScaleAddMulti_OpenMP;
+    v->ops->nvdotprodmulti              = N_VDotProdMulti_OpenMP;
+    v->ops->nvlinearsumwrmsnorm         = N_VLinearSumWrmsNorm_OpenMP;
+    v->ops->nvlinearcombinationwrmsnorm = N_VLinearCombinationWrmsNorm_OpenMP;
     /* enable all vector array operations */
     v->ops->nvlinearsumvectorarray     = N_VLinearSumVectorArray_OpenMP;
     v->ops->nvscalevectorarray         = N_VScaleVectorArray_OpenMP;
@@ -2449,9 +3252,11 @@ SUNErrCode N_VEnableFusedOps_OpenMP(N_Vector v, sunbooleantype tf)
   else
   {
     /* disable all fused vector operations */
-    v->ops->nvlinearcombination = NULL;
-    v->ops->nvscaleaddmulti     = NULL;
-    v->ops->nvdotprodmulti      = NULL;
+    v->ops->nvlinearcombination         = NULL;
+    v->ops->nvscaleaddmulti             = NULL;
+    v->ops->nvdotprodmulti              = NULL;
+    v->ops->nvlinearsumwrmsnorm         = NULL;
+    v->ops->nvlinearcombinationwrmsnorm = NULL;
     /* disable all vector array operations */
     v->ops->nvlinearsumvectorarray         = NULL;
     v->ops->nvscalevectorarray             = NULL;
@@ -2487,6 +3292,20 @@ SUNErrCode N_VEnableDotProdMulti_OpenMP(N_Vector v, sunbooleantype tf)
   return SUN_SUCCESS;
 }
 
+SUNErrCode N_VEnableLinearSumWrmsNorm_OpenMP(N_Vector v, sunbooleantype tf)
+{
+  v->ops->nvlinearsumwrmsnorm = tf ? N_VLinearSumWrmsNorm_OpenMP : NULL;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnableLinearCombinationWrmsNorm_OpenMP(N_Vector v,
+                                                     sunbooleantype tf)
+{
+  v->ops->nvlinearcombinationwrmsnorm = tf ? N_VLinearCombinationWrmsNorm_OpenMP
+                                           : NULL;
+  return SUN_SUCCESS;
+}
+
 SUNErrCode N_VEnableLinearSumVectorArray_OpenMP(N_Vector v, sunbooleantype tf)
 {
   v->ops->nvlinearsumvectorarray = tf ? N_VLinearSumVectorArray_OpenMP : NULL;
@@ -2532,3 +3351,83 @@ SUNErrCode N_VEnableLinearCombinationVectorArray_OpenMP(N_Vector v,
     tf ? N_VLinearCombinationVectorArray_OpenMP : NULL;
   return SUN_SUCCESS;
 }
+
+/*
+ * -----------------------------------------------------------------
+ * Enable / Disable and execute deferred operations
+ * -----------------------------------------------------------------
+ */
+
+SUNErrCode N_VEnableDeferredOps_OpenMP(N_Vector v, sunbooleantype tf)
+{
+  SUNFunctionBegin(v->sunctx);
+
+  if (tf)
+  {
+    /* create a recorder, clones created from v will share it */
+    if (NV_DEFERRED_OMP(v) == NULL)
+    {
+      NV_DEFERRED_OMP(v) = sunDeferredCreate();
+      SUNAssert(NV_DEFERRED_OMP(v), SUN_ERR_MALLOC_FAIL);
+    }
+  }
+  else if (NV_DEFERRED_OMP(v))
+  {
+    /* execute pending operations and detach v from the recorder */
+    VFlush_OpenMP(v);
+    sunDeferredRelease(NV_DEFERRED_OMP(v));
+    NV_DEFERRED_OMP(v) = NULL;
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VFlushDeferredOps_OpenMP(N_Vector v)
+{
+  VFlush_OpenMP(v);
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Enable / Disable reproducible reductions
+ * -----------------------------------------------------------------
+ */
+
+SUNErrCode N_VEnableReproducibleReductions_OpenMP(N_Vector v, sunbooleantype tf)
+{
+  NV_REPRODUCIBLE_OMP(v) = tf;
+  return SUN_SUCCESS;
+}
+
+/* Computes a sum over x (and y and id if not NULL) by chunks whose bounds only
+   depend on the vector length. The chunk sums are combined with a fixed tree
+   so the result does not depend on the number of threads. */
+static sunrealtype VSumRepro_OpenMP(SUNReproSumType type, N_Vector x,
+                                    N_Vector y, N_Vector id)
+{
+  int k;
+  sunindextype N;
+  sunrealtype *xd, *yd, *idd;
+  sunrealtype partial[SUN_REPRO_NCHUNKS];
+
+  /* execute pending operations on the vectors */
+  VReady_OpenMP(x);
+  if (y) { VReady_OpenMP(y); }
+  if (id) { VReady_OpenMP(id); }
+
+  N   = NV_LENGTH_OMP(x);
+  xd  = NV_DATA_OMP(x);
+  yd  = y ? NV_DATA_OMP(y) : NULL;
+  idd = id ? NV_DATA_OMP(id) : NULL;
+
+#pragma omp parallel for default(none) private(k) \
+  shared(type, N, xd, yd, idd, partial) schedule(static) \
+  num_threads(NV_NUM_THREADS_OMP(x))
+  for (k = 0; k < SUN_REPRO_NCHUNKS; k++)
+  {
+    partial[k] = sunReproChunkSum(type, N, k, xd, yd, idd);
+  }
+
+  return (sunReproCombine(partial));
+}
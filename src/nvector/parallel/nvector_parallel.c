@@ -26,12 +26,16 @@
 #include <sundials/sundials_types.h>
 
 #include "sundials_macros.h"
+#include "sundials_nvector_multivec.h"
 
 #define ZERO   SUN_RCONST(0.0)
 #define HALF   SUN_RCONST(0.5)
 #define ONE    SUN_RCONST(1.0)
 #define ONEPT5 SUN_RCONST(1.5)
 
+/* Number of elements per block in the fused linear combination norm */
+#define NV_NORM_BLOCK_P 1024
+
 /* Private functions for special cases of vector operations */
 static void VCopy_Parallel(N_Vector x, N_Vector z);             /* z=x       */
 static void VSum_Parallel(N_Vector x, N_Vector y, N_Vector z);  /* z=x+y     */
@@ -65,6 +69,9 @@ static void VLin2VectorArray_Parallel(int nvec, sunrealtype a, N_Vector* X,
 static void VaxpyVectorArray_Parallel(int nvec, sunrealtype a, N_Vector* X,
                                       N_Vector* Y); /* Y <- aX+Y */
 
+/* Private function for vector arrays stored in a single block */
+static sunrealtype* VBlock_Parallel(int nvec, N_Vector* X);
+
 /*
  * -----------------------------------------------------------------
  * exported functions
@@ -117,6 +124,8 @@ N_Vector N_VNewEmpty_Parallel(MPI_Comm comm, sunindextype local_length,
   v->ops->nvgetlength       = N_VGetLength_Parallel;
   v->ops->nvgetlocallength  = N_VGetLocalLength_Parallel;
 
+  v->ops->nvclonevectorarraycontiguous = N_VCloneVectorArrayContiguous_Parallel;
+
   /* standard vector operations */
   v->ops->nvlinearsum    = N_VLinearSum_Parallel;
   v->ops->nvconst        = N_VConst_Parallel;
@@ -152,8 +161,10 @@ N_Vector N_VNewEmpty_Parallel(MPI_Comm comm, sunindextype local_length,
   v->ops->nvwsqrsummasklocal = N_VWSqrSumMaskLocal_Parallel;
 
   /* single buffer reduction operations */
-  v->ops->nvdotprodmultilocal     = N_VDotProdMultiLocal_Parallel;
-  v->ops->nvdotprodmultiallreduce = N_VDotProdMultiAllReduce_Parallel;
+  v->ops->nvdotprodmultilocal          = N_VDotProdMultiLocal_Parallel;
+  v->ops->nvdotprodmultiallreduce      = N_VDotProdMultiAllReduce_Parallel;
+  v->ops->nvdotprodmultiallreducebegin = N_VDotProdMultiAllReduceBegin_Parallel;
+  v->ops->nvdotprodmultiallreduceend   = N_VDotProdMultiAllReduceEnd_Parallel;
 
   /* XBraid interface operations */
   v->ops->nvbufsize   = N_VBufSize_Parallel;
@@ -176,6 +187,7 @@ N_Vector N_VNewEmpty_Parallel(MPI_Comm comm, sunindextype local_length,
   content->local_length  = local_length;
   content->global_length = global_length;
   content->comm          = comm;
+  content->request       = MPI_REQUEST_NULL;
   content->own_data      = SUNFALSE;
   content->data          = NULL;
 
@@ -325,6 +337,7 @@ N_Vector N_VCloneEmpty_Parallel(N_Vector w)
   content->local_length  = NV_LOCLENGTH_P(w);
   content->global_length = NV_GLOBLENGTH_P(w);
   content->comm          = NV_COMM_P(w);
+  content->request       = MPI_REQUEST_NULL;
   content->own_data      = SUNFALSE;
   content->data          = NULL;
 
@@ -360,6 +373,47 @@ N_Vector N_VClone_Parallel(N_Vector w)
   return (v);
 }
 
+/* ----------------------------------------------------------------------------
+ * Function to clone an array of vectors whose local data are the columns of a
+ * single column-major block. The block is owned by the first vector, so the
+ * vectors must be destroyed together, e.g., with N_VDestroyVectorArray.
+ */
+
+N_Vector* N_VCloneVectorArrayContiguous_Parallel(int count, N_Vector w)
+{
+  SUNFunctionBegin(w->sunctx);
+  int j;
+  N_Vector* vs;
+  sunrealtype* data;
+  sunindextype local_length;
+
+  SUNAssertNull(count > 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  vs = NULL;
+  vs = N_VCloneEmptyVectorArray(count, w);
+  SUNCheckLastErrNull();
+
+  local_length = NV_LOCLENGTH_P(w);
+
+  /* Create data */
+  if (local_length > 0)
+  {
+    /* Allocate memory */
+    data = NULL;
+    data = (sunrealtype*)malloc(count * local_length * sizeof(sunrealtype));
+    SUNAssertNull(data, SUN_ERR_MALLOC_FAIL);
+
+    /* Attach data */
+    for (j = 0; j < count; j++)
+    {
+      NV_OWN_DATA_P(vs[j]) = (j == 0) ? SUNTRUE : SUNFALSE;
+      NV_DATA_P(vs[j])     = data + j * local_length;
+    }
+  }
+
+  return (vs);
+}
+
 void N_VDestroy_Parallel(N_Vector v)
 {
   if (v == NULL) { return; }
@@ -1008,6 +1062,23 @@ SUNErrCode N_VLinearCombination_Parallel(int nvec, sunrealtype* c, N_Vector* X,
   N  = NV_LOCLENGTH_P(z);
   zd = NV_DATA_P(z);
 
+  /*
+   * X[0] = c[0] * X[0] + sum{ c[i] * X[i] } or z = sum{ c[i] * X[i] } with the
+   * X[i] (other than z) stored in a single block
+   */
+  if (X[0] == z) { xd = VBlock_Parallel(nvec - 1, X + 1); }
+  else { xd = VBlock_Parallel(nvec, X); }
+
+  if (xd != NULL)
+  {
+    i = (X[0] == z) ? 1 : 0;
+    if (!sunMultiVecOverlaps(zd, N, xd, (nvec - i) * N))
+    {
+      sunMultiVecGemvN(N, nvec - i, xd, N, c + i, (i == 1) ? c[0] : ZERO, zd);
+      return SUN_SUCCESS;
+    }
+  }
+
   /*
    * X[0] += c[i]*X[i], i = 1,...,nvec-1
    */
@@ -1073,6 +1144,17 @@ SUNErrCode N_VScaleAddMulti_Parallel(int nvec, sunrealtype* a, N_Vector x,
   N  = NV_LOCLENGTH_P(x);
   xd = NV_DATA_P(x);
 
+  /*
+   * Z[i][j] = Y[i][j] + a[i] * x[j] with Y and Z stored in blocks
+   */
+  yd = VBlock_Parallel(nvec, Y);
+  zd = (Y == Z) ? yd : VBlock_Parallel(nvec, Z);
+  if (yd != NULL && zd != NULL)
+  {
+    sunMultiVecScaleAdd(N, nvec, a, xd, yd, N, zd, N);
+    return SUN_SUCCESS;
+  }
+
   /*
    * Y[i][j] += a[i] * x[j]
    */
@@ -1125,11 +1207,16 @@ SUNErrCode N_VDotProdMulti_Parallel(int nvec, N_Vector x, N_Vector* Y,
   comm = NV_COMM_P(x);
 
   /* compute multiple dot products */
-  for (i = 0; i < nvec; i++)
+  yd = VBlock_Parallel(nvec, Y);
+  if (yd != NULL) { sunMultiVecGemvT(N, nvec, yd, N, xd, dotprods); }
+  else
   {
-    yd          = NV_DATA_P(Y[i]);
-    dotprods[i] = ZERO;
-    for (j = 0; j < N; j++) { dotprods[i] += xd[j] * yd[j]; }
+    for (i = 0; i < nvec; i++)
+    {
+      yd          = NV_DATA_P(Y[i]);
+      dotprods[i] = ZERO;
+      for (j = 0; j < N; j++) { dotprods[i] += xd[j] * yd[j]; }
+    }
   }
 
   SUNCheckMPICall(MPI_Allreduce(MPI_IN_PLACE, dotprods, nvec, MPI_SUNREALTYPE,
@@ -1138,6 +1225,85 @@ SUNErrCode N_VDotProdMulti_Parallel(int nvec, N_Vector x, N_Vector* Y,
   return SUN_SUCCESS;
 }
 
+sunrealtype N_VLinearSumWrmsNorm_Parallel(sunrealtype a, N_Vector x,
+                                          sunrealtype b, N_Vector y, N_Vector z,
+                                          N_Vector w)
+{
+  SUNFunctionBegin(x->sunctx);
+  sunindextype i, N;
+  sunrealtype lsum, gsum, *xd, *yd, *zd, *wd;
+
+  lsum = ZERO;
+  xd = yd = zd = wd = NULL;
+
+  N  = NV_LOCLENGTH_P(z);
+  xd = NV_DATA_P(x);
+  yd = NV_DATA_P(y);
+  zd = NV_DATA_P(z);
+  wd = NV_DATA_P(w);
+
+  for (i = 0; i < N; i++)
+  {
+    zd[i] = (a * xd[i]) + (b * yd[i]);
+    lsum += SUNSQR(zd[i] * wd[i]);
+  }
+
+  SUNCheckMPICallNoRet(
+    MPI_Allreduce(&lsum, &gsum, 1, MPI_SUNREALTYPE, MPI_SUM, NV_COMM_P(z)));
+  return (SUNRsqrt(gsum / (NV_GLOBLENGTH_P(z))));
+}
+
+SUNErrCode N_VLinearCombinationWrmsNorm_Parallel(int nvec, sunrealtype* c,
+                                                 N_Vector* X, N_Vector z,
+                                                 N_Vector w, sunrealtype* nrm)
+{
+  SUNFunctionBegin(X[0]->sunctx);
+
+  int i;
+  sunindextype j, N, start, end;
+  sunrealtype lsum, gsum;
+  sunrealtype* zd = NULL;
+  sunrealtype* wd = NULL;
+  sunrealtype* xd = NULL;
+
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* should have called N_VLinearSumWrmsNorm */
+  if (nvec == 2)
+  {
+    *nrm = N_VLinearSumWrmsNorm_Parallel(c[0], X[0], c[1], X[1], z, w);
+    SUNCheckLastErr();
+    return SUN_SUCCESS;
+  }
+
+  /* get vector length and data array */
+  N  = NV_LOCLENGTH_P(z);
+  zd = NV_DATA_P(z);
+  wd = NV_DATA_P(w);
+
+  /* z = sum{ c[i] * X[i] } one block at a time, accumulating the weighted
+     square sum of the block while it is in cache, X[0] may be z */
+  lsum = ZERO;
+  for (start = 0; start < N; start += NV_NORM_BLOCK_P)
+  {
+    end = SUNMIN(start + NV_NORM_BLOCK_P, N);
+    xd  = NV_DATA_P(X[0]);
+    for (j = start; j < end; j++) { zd[j] = c[0] * xd[j]; }
+    for (i = 1; i < nvec; i++)
+    {
+      xd = NV_DATA_P(X[i]);
+      for (j = start; j < end; j++) { zd[j] += c[i] * xd[j]; }
+    }
+    for (j = start; j < end; j++) { lsum += SUNSQR(zd[j] * wd[j]); }
+  }
+
+  SUNCheckMPICall(
+    MPI_Allreduce(&lsum, &gsum, 1, MPI_SUNREALTYPE, MPI_SUM, NV_COMM_P(z)));
+  *nrm = SUNRsqrt(gsum / (NV_GLOBLENGTH_P(z)));
+
+  return SUN_SUCCESS;
+}
+
 /*
  * -----------------------------------------------------------------
  * single buffer reduction operations
@@ -1161,11 +1327,16 @@ SUNErrCode N_VDotProdMultiLocal_Parallel(int nvec, N_Vector x, N_Vector* Y,
   xd = NV_DATA_P(x);
 
   /* compute multiple dot products */
-  for (i = 0; i < nvec; i++)
+  yd = VBlock_Parallel(nvec, Y);
+  if (yd != NULL) { sunMultiVecGemvT(N, nvec, yd, N, xd, dotprods); }
+  else
   {
-    yd          = NV_DATA_P(Y[i]);
-    dotprods[i] = ZERO;
-    for (j = 0; j < N; j++) { dotprods[i] += xd[j] * yd[j]; }
+    for (i = 0; i < nvec; i++)
+    {
+      yd          = NV_DATA_P(Y[i]);
+      dotprods[i] = ZERO;
+      for (j = 0; j < N; j++) { dotprods[i] += xd[j] * yd[j]; }
+    }
   }
 
   return SUN_SUCCESS;
@@ -1188,6 +1359,35 @@ SUNErrCode N_VDotProdMultiAllReduce_Parallel(int nvec, N_Vector x,
   return SUN_SUCCESS;
 }
 
+SUNErrCode N_VDotProdMultiAllReduceBegin_Parallel(int nvec, N_Vector x,
+                                                  sunrealtype* sum)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* only one reduction may be pending on a vector */
+  SUNAssert(NV_CONTENT_P(x)->request == MPI_REQUEST_NULL,
+            SUN_ERR_ARG_INCOMPATIBLE);
+
+  /* start the reduction, the buffer must not be accessed until it completes */
+  SUNCheckMPICall(MPI_Iallreduce(MPI_IN_PLACE, sum, nvec, MPI_SUNREALTYPE,
+                                 MPI_SUM, NV_COMM_P(x),
+                                 &(NV_CONTENT_P(x)->request)));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VDotProdMultiAllReduceEnd_Parallel(N_Vector x)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  /* complete the pending reduction (if any) */
+  SUNCheckMPICall(MPI_Wait(&(NV_CONTENT_P(x)->request), MPI_STATUS_IGNORE));
+
+  return SUN_SUCCESS;
+}
+
 /*
  * -----------------------------------------------------------------
  * vector array operations
@@ -2116,6 +2316,31 @@ static void VaxpyVectorArray_Parallel(int nvec, sunrealtype a, N_Vector* X,
   }
 }
 
+/*
+ * -----------------------------------------------------------------
+ * private functions for vector arrays stored in a single block
+ * -----------------------------------------------------------------
+ */
+
+/* Returns the local data of X[0] if the local data of X[0],...,X[nvec-1] are
+   the columns of a single column-major block (e.g., the vectors were created
+   with N_VCloneVectorArrayContiguous_Parallel), otherwise NULL */
+static sunrealtype* VBlock_Parallel(int nvec, N_Vector* X)
+{
+  int i;
+  sunindextype N  = NV_LOCLENGTH_P(X[0]);
+  sunrealtype* xd = NV_DATA_P(X[0]);
+
+  if (N == 0 || xd == NULL) { return NULL; }
+
+  for (i = 1; i < nvec; i++)
+  {
+    if (NV_DATA_P(X[i]) != xd + i * N) { return NULL; }
+  }
+
+  return xd;
+}
+
 /*
  * -----------------------------------------------------------------
  * Enable / Disable fused and vector array operations
@@ -2129,9 +2354,11 @@ SUNErrCode N_VEnableFusedOps_Parallel(N_Vector v, sunbooleantype tf)
   if (tf)
   {
     /* enable all fused vector operations */
-    v->ops->nvlinearcombination = N_VLinearCombination_Parallel;
-    v->ops->nvscaleaddmulti     = N_VScaleAddMulti_Parallel;
-    v->ops->nvdotprodmulti      = N_VDotProdMulti_Parallel;
+    v->ops->nvlinearcombination         = N_VLinearCombination_Parallel;
+    v->ops->nvscaleaddmulti             = N_VScaleAddMulti_Parallel;
+    v->ops->nvdotprodmulti              = N_VDotProdMulti_Parallel;
+    v->ops->nvlinearsumwrmsnorm         = N_VLinearSumWrmsNorm_Parallel;
+    v->ops->nvlinearcombinationwrmsnorm = N_VLinearCombinationWrmsNorm_Parallel;
     /* enable all vector array operations */
     v->ops->nvlinearsumvectorarray     = N_VLinearSumVectorArray_Parallel;
     v->ops->nvscalevectorarray         = N_VScaleVectorArray_Parallel;
@@ -2147,9 +2374,11 @@ SUNErrCode N_VEnableFusedOps_Parallel(N_Vector v, sunbooleantype tf)
   else
   {
     /* disable all fused vector operations */
-    v->ops->nvlinearcombination = NULL;
-    v->ops->nvscaleaddmulti     = NULL;
-    v->ops->nvdotprodmulti      = NULL;
+    v->ops->nvlinearcombination         = NULL;
+    v->ops->nvscaleaddmulti             = NULL;
+    v->ops->nvdotprodmulti              = NULL;
+    v->ops->nvlinearsumwrmsnorm         = NULL;
+    v->ops->nvlinearcombinationwrmsnorm = NULL;
     /* disable all vector array operations */
     v->ops->nvlinearsumvectorarray         = NULL;
     v->ops->nvscalevectorarray             = NULL;
@@ -2198,6 +2427,32 @@ SUNErrCode N_VEnableDotProdMulti_Parallel(N_Vector v, sunbooleantype tf)
   return SUN_SUCCESS;
 }
 
+SUNErrCode N_VEnableLinearSumWrmsNorm_Parallel(N_Vector v, sunbooleantype tf)
+{
+  SUNFunctionBegin(v->sunctx);
+
+  /* enable/disable operation */
+  if (tf) { v->ops->nvlinearsumwrmsnorm = N_VLinearSumWrmsNorm_Parallel; }
+  else { v->ops->nvlinearsumwrmsnorm = NULL; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnableLinearCombinationWrmsNorm_Parallel(N_Vector v,
+                                                       sunbooleantype tf)
+{
+  SUNFunctionBegin(v->sunctx);
+
+  /* enable/disable operation */
+  if (tf)
+  {
+    v->ops->nvlinearcombinationwrmsnorm = N_VLinearCombinationWrmsNorm_Parallel;
+  }
+  else { v->ops->nvlinearcombinationwrmsnorm = NULL; }
+
+  return SUN_SUCCESS;
+}
+
 SUNErrCode N_VEnableLinearSumVectorArray_Parallel(N_Vector v, sunbooleantype tf)
 {
   SUNFunctionBegin(v->sunctx);
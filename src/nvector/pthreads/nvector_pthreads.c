@@ -22,6 +22,7 @@
  * -----------------------------------------------------------------*/
 
 #include <math.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -32,12 +33,80 @@
 #include <sundials/sundials_errors.h>
 
 #include "sundials_macros.h"
+#include "sundials_nvector_affinity.h"
+#include "sundials_nvector_reproducible.h"
 
 #define ZERO   SUN_RCONST(0.0)
 #define HALF   SUN_RCONST(0.5)
 #define ONE    SUN_RCONST(1.0)
 #define ONEPT5 SUN_RCONST(1.5)
 
+#define NV_POOL_PT(v) (NV_CONTENT_PT(v)->pool)
+
+/* Size of a cache line in bytes, used to pad per-thread reduction values so
+   threads do not write to the same line (false sharing) */
+#define NV_CACHE_LINE_PT 64
+
+/* Shared state of the worker pool is accessed with atomic builtins when
+   available. Idle threads (and the calling thread waiting for completion)
+   poll the state NV_SPIN_COUNT_PT times before blocking on a condition
+   variable. Without atomics the state is only accessed under the pool lock
+   and threads block immediately. */
+#if defined(__GNUC__) || defined(__clang__)
+#define NV_SPIN_COUNT_PT         4096
+#define NV_ATOMIC_LOAD_PT(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define NV_ATOMIC_STORE_PT(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define NV_ATOMIC_DEC_PT(p)      __atomic_sub_fetch((p), 1, __ATOMIC_ACQ_REL)
+#else
+#define NV_SPIN_COUNT_PT         0
+#define NV_ATOMIC_LOAD_PT(p)     (*(p))
+#define NV_ATOMIC_STORE_PT(p, v) (*(p) = (v))
+#define NV_ATOMIC_DEC_PT(p)      (--(*(p)))
+#endif
+
+/* Persistent worker thread information */
+typedef struct _Pthreads_Worker
+{
+  struct _Pthreads_Pool* pool; /* pool the worker belongs to */
+  int id;                      /* worker (thread data) index */
+  pthread_t thread;            /* worker thread handle       */
+} Pthreads_Worker;
+
+/* Pool of persistent threads that execute the companion functions. The
+   calling thread acts as thread 0 and num_threads - 1 workers wait for
+   work to be posted by incrementing the generation counter. The pool is
+   shared (reference counted) by all vectors with the same context, number
+   of threads, and affinity policy. */
+struct _Pthreads_Pool
+{
+  SUNContext sunctx;           /* context of the vectors using the pool   */
+  int num_threads;             /* number of threads including caller      */
+  SUNAffinity affinity;        /* policy used to pin the threads          */
+  int num_workers;             /* number of running worker threads        */
+  int refcount;                /* number of vectors using the pool        */
+  struct _Pthreads_Pool* next; /* next pool in the list of pools          */
+  Pthreads_Worker* workers;    /* persistent worker threads               */
+  Pthreads_Data* thread_data;  /* thread data passed to companion funcs   */
+  void* partials_mem;          /* allocation backing the partials array   */
+  sunrealtype* partials;       /* cache-line aligned per-thread partials  */
+  int partials_stride;         /* number of partial values per thread     */
+  void* (*work)(void*);        /* companion function to execute           */
+  unsigned long generation;    /* counter incremented to post new work    */
+  int pending;                 /* number of workers still executing       */
+  int shutdown;                /* flag telling the workers to exit        */
+  pthread_mutex_t dispatch;    /* serializes operations using the pool    */
+  pthread_mutex_t lock;        /* protects the condition variables below  */
+  pthread_cond_t work_ready;   /* signaled when work is posted            */
+  pthread_cond_t work_done;    /* signaled when the last worker finishes  */
+};
+
+typedef struct _Pthreads_Pool Pthreads_Pool;
+
+/* List of the existing pools. The list and the pool reference counts are
+   protected by nv_pools_lock. */
+static Pthreads_Pool* nv_pools       = NULL;
+static pthread_mutex_t nv_pools_lock = PTHREAD_MUTEX_INITIALIZER;
+
 /* Private functions for special cases of vector operations */
 static void VCopy_Pthreads(N_Vector x, N_Vector z);             /* z=x       */
 static void VSum_Pthreads(N_Vector x, N_Vector y, N_Vector z);  /* z=x+y     */
@@ -114,6 +183,8 @@ static void* Vaxpy_PT(void* thread_data);
 static void* nvLinearCombinationPt(void* thread_data);
 static void* nvScaleAddMultiPt(void* thread_data);
 static void* nvDotProdMultiPt(void* thread_data);
+static void* nvLinearSumWrmsNormPt(void* thread_data);
+static void* nvLinearCombinationWrmsNormPt(void* thread_data);
 
 /* Pthread companion functions for vector array operations */
 static void* nvLinearSumVectorArrayPt(void* thread_data);
@@ -144,6 +215,32 @@ static void nvSplitLoop(int myid, int* nthreads, sunindextype* N,
 /* Function to initialize thread data */
 static void nvInitThreadData(Pthreads_Data* thread_data);
 
+/* Number of elements per block in the fused linear combination norm */
+#define NV_NORM_BLOCK_PT 1024
+
+/* Functions for reductions independent of the number of threads */
+static sunrealtype VSumRepro_Pthreads(SUNReproSumType type, N_Vector x,
+                                      N_Vector y, N_Vector id);
+static void* nvSumReproPt(void* thread_data);
+
+/* Function to create an empty vector with a given thread affinity */
+static N_Vector VNewEmpty_Pthreads(sunindextype length, int num_threads,
+                                   SUNAffinity affinity, SUNContext sunctx);
+
+/* Functions to manage the persistent worker pool */
+static Pthreads_Pool* nvPoolAcquire(SUNContext sunctx, int num_threads,
+                                    SUNAffinity affinity);
+static Pthreads_Pool* nvPoolCreate(SUNContext sunctx, int num_threads,
+                                   SUNAffinity affinity);
+static Pthreads_Pool* nvPoolRetain(Pthreads_Pool* pool);
+static void nvPoolRelease(Pthreads_Pool* pool);
+static void nvPoolFree(Pthreads_Pool* pool);
+static Pthreads_Data* nvPoolBegin(Pthreads_Pool* pool, int nvals);
+static sunrealtype* nvPoolPartial(Pthreads_Pool* pool, int id);
+static void nvPoolRun(Pthreads_Pool* pool, void* (*work)(void*));
+static void nvPoolEnd(Pthreads_Pool* pool);
+static void* nvPoolWorker(void* worker_data);
+
 /*
  * -----------------------------------------------------------------
  * exported functions
@@ -165,6 +262,17 @@ N_Vector_ID N_VGetVectorID_Pthreads(SUNDIALS_MAYBE_UNUSED N_Vector v)
 
 N_Vector N_VNewEmpty_Pthreads(sunindextype length, int num_threads,
                               SUNContext sunctx)
+{
+  return VNewEmpty_Pthreads(length, num_threads, SUN_AFFINITY_NONE, sunctx);
+}
+
+/* ----------------------------------------------------------------------------
+ * Private function to create a new empty vector with a worker pool using the
+ * given thread affinity policy
+ */
+
+static N_Vector VNewEmpty_Pthreads(sunindextype length, int num_threads,
+                                   SUNAffinity affinity, SUNContext sunctx)
 {
   SUNFunctionBegin(sunctx);
 
@@ -246,10 +354,18 @@ N_Vector N_VNewEmpty_Pthreads(sunindextype length, int num_threads,
   v->content = content;
 
   /* Initialize content */
-  content->length      = length;
-  content->num_threads = num_threads;
-  content->own_data    = SUNFALSE;
-  content->data        = NULL;
+  content->length       = length;
+  content->num_threads  = num_threads;
+  content->affinity     = affinity;
+  content->own_data     = SUNFALSE;
+  content->data         = NULL;
+  content->pool         = NULL;
+  content->reproducible = SUNFALSE;
+
+  /* Attach the worker pool shared by the vectors of this context with the
+     same number of threads and affinity policy */
+  content->pool = nvPoolAcquire(sunctx, num_threads, affinity);
+  SUNAssertNull(content->pool, SUN_ERR_MALLOC_FAIL);
 
   return (v);
 }
@@ -262,13 +378,32 @@ N_Vector N_VNew_Pthreads(sunindextype length, int num_threads, SUNContext sunctx
 {
   SUNFunctionBegin(sunctx);
 
+  N_Vector v;
+
+  v = NULL;
+  v = N_VNewWithAffinity_Pthreads(length, num_threads, SUN_AFFINITY_NONE,
+                                  sunctx);
+  SUNCheckLastErrNull();
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new vector with a thread affinity policy
+ */
+
+N_Vector N_VNewWithAffinity_Pthreads(sunindextype length, int num_threads,
+                                     SUNAffinity affinity, SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+
   N_Vector v;
   sunrealtype* data;
 
   SUNAssertNull(length >= 0, SUN_ERR_ARG_OUTOFRANGE);
 
   v = NULL;
-  v = N_VNewEmpty_Pthreads(length, num_threads, sunctx);
+  v = VNewEmpty_Pthreads(length, num_threads, affinity, sunctx);
   SUNCheckLastErrNull();
 
   /* Create data */
@@ -282,6 +417,10 @@ N_Vector N_VNew_Pthreads(sunindextype length, int num_threads, SUNContext sunctx
     /* Attach data */
     NV_OWN_DATA_PT(v) = SUNTRUE;
     NV_DATA_PT(v)     = data;
+
+    /* Touch the data with the thread splitting used by the kernels so
+       that pages are placed close to the threads that use them */
+    N_VConst_Pthreads(ZERO, v);
   }
 
   return (v);
@@ -379,10 +518,13 @@ N_Vector N_VCloneEmpty_Pthreads(N_Vector w)
   v->content = content;
 
   /* Initialize content */
-  content->length      = NV_LENGTH_PT(w);
-  content->num_threads = NV_NUM_THREADS_PT(w);
-  content->own_data    = SUNFALSE;
-  content->data        = NULL;
+  content->length       = NV_LENGTH_PT(w);
+  content->num_threads  = NV_NUM_THREADS_PT(w);
+  content->affinity     = NV_AFFINITY_PT(w);
+  content->own_data     = SUNFALSE;
+  content->data         = NULL;
+  content->pool         = nvPoolRetain(NV_POOL_PT(w));
+  content->reproducible = NV_REPRODUCIBLE_PT(w);
 
   return (v);
 }
@@ -416,6 +558,10 @@ N_Vector N_VClone_Pthreads(N_Vector w)
     /* Attach data */
     NV_OWN_DATA_PT(v) = SUNTRUE;
     NV_DATA_PT(v)     = data;
+
+    /* Touch the data with the thread splitting used by the kernels so
+       that pages are placed close to the threads that use them */
+    N_VConst_Pthreads(ZERO, v);
   }
 
   return (v);
@@ -437,6 +583,8 @@ void N_VDestroy_Pthreads(N_Vector v)
       free(NV_DATA_PT(v));
       NV_DATA_PT(v) = NULL;
     }
+    nvPoolRelease(NV_POOL_PT(v));
+    NV_POOL_PT(v) = NULL;
     free(v->content);
     v->content = NULL;
   }
@@ -501,9 +649,8 @@ void N_VLinearSum_Pthreads(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   sunrealtype c;
   N_Vector v1, v2;
@@ -584,18 +731,13 @@ void N_VLinearSum_Pthreads(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
      (2) a == 0.0, b == other - user should have called N_VScale
      (3) a,b == other, a !=b, a != -b */
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = (pthread_t*)malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -610,18 +752,13 @@ void N_VLinearSum_Pthreads(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvLinearSumPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvLinearSumPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -653,7 +790,7 @@ static void* nvLinearSumPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = (a * xd[i]) + (b * yd[i]); }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -666,21 +803,15 @@ void N_VConst_Pthreads(sunrealtype c, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(z);
-  nthreads = NV_NUM_THREADS_PT(z);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(z);
+  nthreads    = NV_NUM_THREADS_PT(z);
+  pool        = NV_POOL_PT(z);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -693,18 +824,13 @@ void N_VConst_Pthreads(sunrealtype c, N_Vector z)
     /* pack thread data */
     thread_data[i].c1 = c;
     thread_data[i].v1 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvConstPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvConstPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -733,7 +859,7 @@ static void* nvConstPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = c; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -746,21 +872,15 @@ void N_VProd_Pthreads(N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -774,18 +894,13 @@ void N_VProd_Pthreads(N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvProdPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvProdPt);
 
   /* clean up and exit */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -814,7 +929,7 @@ static void* nvProdPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i] * yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -827,21 +942,15 @@ void N_VDiv_Pthreads(N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -855,18 +964,13 @@ void N_VDiv_Pthreads(N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvDivPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvDivPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -895,7 +999,7 @@ static void* nvDivPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i] / yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -908,9 +1012,8 @@ void N_VScale_Pthreads(sunrealtype c, N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   if (z == x)
   { /* BLAS usage: scale x <- cx */
@@ -930,18 +1033,13 @@ void N_VScale_Pthreads(sunrealtype c, N_Vector x, N_Vector z)
   }
   else
   {
-    /* allocate threads and thread data structs */
-    N        = NV_LENGTH_PT(x);
-    nthreads = NV_NUM_THREADS_PT(x);
-    threads  = malloc(nthreads * sizeof(pthread_t));
-    SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-    thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+    /* get thread data structs from the worker pool */
+    N           = NV_LENGTH_PT(x);
+    nthreads    = NV_NUM_THREADS_PT(x);
+    pool        = NV_POOL_PT(x);
+    thread_data = nvPoolBegin(pool, 0);
     SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-    /* set thread attributes */
-    pthread_attr_init(&attr);
-    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
     for (i = 0; i < nthreads; i++)
     {
       /* initialize thread data */
@@ -954,18 +1052,13 @@ void N_VScale_Pthreads(sunrealtype c, N_Vector x, N_Vector z)
       thread_data[i].c1 = c;
       thread_data[i].v1 = NV_DATA_PT(x);
       thread_data[i].v2 = NV_DATA_PT(z);
-
-      /* create threads and call pthread companion function */
-      pthread_create(&threads[i], &attr, nvScalePt, (void*)&thread_data[i]);
     }
 
-    /* wait for all threads to finish */
-    for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+    /* run companion function on the worker pool */
+    nvPoolRun(pool, nvScalePt);
 
     /* clean up */
-    pthread_attr_destroy(&attr);
-    free(threads);
-    free(thread_data);
+    nvPoolEnd(pool);
   }
 
   return;
@@ -996,7 +1089,7 @@ static void* nvScalePt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = c * xd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1009,21 +1102,15 @@ void N_VAbs_Pthreads(N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -1036,18 +1123,13 @@ void N_VAbs_Pthreads(N_Vector x, N_Vector z)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvAbsPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvAbsPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -1075,7 +1157,7 @@ static void* nvAbsPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = SUNRabs(xd[i]); }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1088,21 +1170,15 @@ void N_VInv_Pthreads(N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -1115,18 +1191,13 @@ void N_VInv_Pthreads(N_Vector x, N_Vector z)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvInvPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvInvPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -1154,7 +1225,7 @@ static void* nvInvPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = ONE / xd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1167,21 +1238,15 @@ void N_VAddConst_Pthreads(N_Vector x, sunrealtype b, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -1195,18 +1260,13 @@ void N_VAddConst_Pthreads(N_Vector x, sunrealtype b, N_Vector z)
     thread_data[i].c1 = b;
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvAddConstPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvAddConstPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -1236,7 +1296,7 @@ static void* nvAddConstPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i] + b; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1249,26 +1309,21 @@ sunrealtype N_VDotProd_Pthreads(N_Vector x, N_Vector y)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
   sunrealtype sum = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  if (NV_REPRODUCIBLE_PT(x))
+  {
+    return (VSumRepro_Pthreads(SUN_REPRO_DOTPROD, x, y, NULL));
+  }
 
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 1);
+  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -1279,23 +1334,19 @@ sunrealtype N_VDotProd_Pthreads(N_Vector x, N_Vector y)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1           = NV_DATA_PT(x);
-    thread_data[i].v2           = NV_DATA_PT(y);
-    thread_data[i].global_val   = &sum;
-    thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvDotProdPt, (void*)&thread_data[i]);
+    thread_data[i].v1        = NV_DATA_PT(x);
+    thread_data[i].v2        = NV_DATA_PT(y);
+    thread_data[i].local_val = nvPoolPartial(pool, i);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvDotProdPt);
+
+  /* combine partial sums in thread order */
+  for (i = 0; i < nthreads; i++) { sum += thread_data[i].local_val[0]; }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return (sum);
 }
@@ -1308,9 +1359,8 @@ static void* nvDotProdPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype *xd, *yd;
-  sunrealtype local_sum, *global_sum;
+  sunrealtype local_sum;
   Pthreads_Data* my_data;
-  pthread_mutex_t* global_mutex;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
@@ -1318,9 +1368,6 @@ static void* nvDotProdPt(void* thread_data)
   xd = my_data->v1;
   yd = my_data->v2;
 
-  global_sum   = my_data->global_val;
-  global_mutex = my_data->global_mutex;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -1328,13 +1375,11 @@ static void* nvDotProdPt(void* thread_data)
   local_sum = ZERO;
   for (i = start; i < end; i++) { local_sum += xd[i] * yd[i]; }
 
-  /* update global sum */
-  pthread_mutex_lock(global_mutex);
-  *global_sum += local_sum;
-  pthread_mutex_unlock(global_mutex);
+  /* store local sum in padded per-thread slot */
+  my_data->local_val[0] = local_sum;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1347,27 +1392,17 @@ sunrealtype N_VMaxNorm_Pthreads(N_Vector x)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
   sunrealtype max = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 1);
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -1377,22 +1412,21 @@ sunrealtype N_VMaxNorm_Pthreads(N_Vector x)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1           = NV_DATA_PT(x);
-    thread_data[i].global_val   = &max;
-    thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvMaxNormPt, (void*)&thread_data[i]);
+    thread_data[i].v1        = NV_DATA_PT(x);
+    thread_data[i].local_val = nvPoolPartial(pool, i);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvMaxNormPt);
+
+  /* combine partial maxima */
+  for (i = 0; i < nthreads; i++)
+  {
+    max = SUNMAX(max, thread_data[i].local_val[0]);
+  }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return (max);
 }
@@ -1405,18 +1439,14 @@ static void* nvMaxNormPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype* xd;
-  sunrealtype local_max, *global_max;
+  sunrealtype local_max;
   Pthreads_Data* my_data;
-  pthread_mutex_t* global_mutex;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
 
   xd = my_data->v1;
 
-  global_max   = my_data->global_val;
-  global_mutex = my_data->global_mutex;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -1427,13 +1457,11 @@ static void* nvMaxNormPt(void* thread_data)
     if (SUNRabs(xd[i]) > local_max) { local_max = SUNRabs(xd[i]); }
   }
 
-  /* update global max */
-  pthread_mutex_lock(global_mutex);
-  if (local_max > *global_max) { *global_max = local_max; }
-  pthread_mutex_unlock(global_mutex);
+  /* store local max in padded per-thread slot */
+  my_data->local_val[0] = local_max;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1458,26 +1486,21 @@ sunrealtype N_VWSqrSumLocal_Pthreads(N_Vector x, N_Vector w)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
   sunrealtype sum = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  if (NV_REPRODUCIBLE_PT(x))
+  {
+    return (VSumRepro_Pthreads(SUN_REPRO_WSQRSUM, x, w, NULL));
+  }
 
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 1);
+  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -1488,23 +1511,19 @@ sunrealtype N_VWSqrSumLocal_Pthreads(N_Vector x, N_Vector w)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1           = NV_DATA_PT(x);
-    thread_data[i].v2           = NV_DATA_PT(w);
-    thread_data[i].global_val   = &sum;
-    thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvWSqrSumPt, (void*)&thread_data[i]);
+    thread_data[i].v1        = NV_DATA_PT(x);
+    thread_data[i].v2        = NV_DATA_PT(w);
+    thread_data[i].local_val = nvPoolPartial(pool, i);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvWSqrSumPt);
+
+  /* combine partial sums in thread order */
+  for (i = 0; i < nthreads; i++) { sum += thread_data[i].local_val[0]; }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return (sum);
 }
@@ -1517,9 +1536,8 @@ static void* nvWSqrSumPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype *xd, *wd;
-  sunrealtype local_sum, *global_sum;
+  sunrealtype local_sum;
   Pthreads_Data* my_data;
-  pthread_mutex_t* global_mutex;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
@@ -1527,9 +1545,6 @@ static void* nvWSqrSumPt(void* thread_data)
   xd = my_data->v1;
   wd = my_data->v2;
 
-  global_sum   = my_data->global_val;
-  global_mutex = my_data->global_mutex;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -1537,13 +1552,11 @@ static void* nvWSqrSumPt(void* thread_data)
   local_sum = ZERO;
   for (i = start; i < end; i++) { local_sum += SUNSQR(xd[i] * wd[i]); }
 
-  /* update global sum */
-  pthread_mutex_lock(global_mutex);
-  *global_sum += local_sum;
-  pthread_mutex_unlock(global_mutex);
+  /* store local sum in padded per-thread slot */
+  my_data->local_val[0] = local_sum;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1568,26 +1581,21 @@ sunrealtype N_VWSqrSumMaskLocal_Pthreads(N_Vector x, N_Vector w, N_Vector id)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
   sunrealtype sum = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  if (NV_REPRODUCIBLE_PT(x))
+  {
+    return (VSumRepro_Pthreads(SUN_REPRO_WSQRSUMMASK, x, w, id));
+  }
 
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 1);
+  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -1598,24 +1606,20 @@ sunrealtype N_VWSqrSumMaskLocal_Pthreads(N_Vector x, N_Vector w, N_Vector id)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1           = NV_DATA_PT(x);
-    thread_data[i].v2           = NV_DATA_PT(w);
-    thread_data[i].v3           = NV_DATA_PT(id);
-    thread_data[i].global_val   = &sum;
-    thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvWSqrSumMaskPt, (void*)&thread_data[i]);
+    thread_data[i].v1        = NV_DATA_PT(x);
+    thread_data[i].v2        = NV_DATA_PT(w);
+    thread_data[i].v3        = NV_DATA_PT(id);
+    thread_data[i].local_val = nvPoolPartial(pool, i);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvWSqrSumMaskPt);
+
+  /* combine partial sums in thread order */
+  for (i = 0; i < nthreads; i++) { sum += thread_data[i].local_val[0]; }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return (sum);
 }
@@ -1628,9 +1632,8 @@ static void* nvWSqrSumMaskPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype *xd, *wd, *idd;
-  sunrealtype local_sum, *global_sum;
+  sunrealtype local_sum;
   Pthreads_Data* my_data;
-  pthread_mutex_t* global_mutex;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
@@ -1639,9 +1642,6 @@ static void* nvWSqrSumMaskPt(void* thread_data)
   wd  = my_data->v2;
   idd = my_data->v3;
 
-  global_sum   = my_data->global_val;
-  global_mutex = my_data->global_mutex;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -1652,13 +1652,11 @@ static void* nvWSqrSumMaskPt(void* thread_data)
     if (idd[i] > ZERO) { local_sum += SUNSQR(xd[i] * wd[i]); }
   }
 
-  /* update global sum */
-  pthread_mutex_lock(global_mutex);
-  *global_sum += local_sum;
-  pthread_mutex_unlock(global_mutex);
+  /* store local sum in padded per-thread slot */
+  my_data->local_val[0] = local_sum;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1671,30 +1669,20 @@ sunrealtype N_VMin_Pthreads(N_Vector x)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
   sunrealtype min;
 
   /* initialize global min */
   min = NV_Ith_PT(x, 0);
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 1);
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -1704,22 +1692,22 @@ sunrealtype N_VMin_Pthreads(N_Vector x)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1           = NV_DATA_PT(x);
-    thread_data[i].global_val   = &min;
-    thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvMinPt, (void*)&thread_data[i]);
+    thread_data[i].v1         = NV_DATA_PT(x);
+    thread_data[i].global_val = &min;
+    thread_data[i].local_val  = nvPoolPartial(pool, i);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvMinPt);
+
+  /* combine partial minima */
+  for (i = 0; i < nthreads; i++)
+  {
+    min = SUNMIN(min, thread_data[i].local_val[0]);
+  }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return (min);
 }
@@ -1734,15 +1722,13 @@ static void* nvMinPt(void* thread_data)
   sunrealtype* xd;
   sunrealtype local_min, *global_min;
   Pthreads_Data* my_data;
-  pthread_mutex_t* global_mutex;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
 
   xd = my_data->v1;
 
-  global_min   = my_data->global_val;
-  global_mutex = my_data->global_mutex;
+  global_min = my_data->global_val;
 
   start = my_data->start;
   end   = my_data->end;
@@ -1754,13 +1740,11 @@ static void* nvMinPt(void* thread_data)
     if (xd[i] < local_min) { local_min = xd[i]; }
   }
 
-  /* update global min */
-  pthread_mutex_lock(global_mutex);
-  if (local_min < *global_min) { *global_min = local_min; }
-  pthread_mutex_unlock(global_mutex);
+  /* store local min in padded per-thread slot */
+  my_data->local_val[0] = local_min;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1773,26 +1757,21 @@ sunrealtype N_VWL2Norm_Pthreads(N_Vector x, N_Vector w)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
   sunrealtype sum = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  if (NV_REPRODUCIBLE_PT(x))
+  {
+    return (SUNRsqrt(VSumRepro_Pthreads(SUN_REPRO_WSQRSUM, x, w, NULL)));
+  }
 
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 1);
+  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -1803,23 +1782,19 @@ sunrealtype N_VWL2Norm_Pthreads(N_Vector x, N_Vector w)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1           = NV_DATA_PT(x);
-    thread_data[i].v2           = NV_DATA_PT(w);
-    thread_data[i].global_val   = &sum;
-    thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvWL2NormPt, (void*)&thread_data[i]);
+    thread_data[i].v1        = NV_DATA_PT(x);
+    thread_data[i].v2        = NV_DATA_PT(w);
+    thread_data[i].local_val = nvPoolPartial(pool, i);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvWL2NormPt);
+
+  /* combine partial sums in thread order */
+  for (i = 0; i < nthreads; i++) { sum += thread_data[i].local_val[0]; }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return (SUNRsqrt(sum));
 }
@@ -1832,9 +1807,8 @@ static void* nvWL2NormPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype *xd, *wd;
-  sunrealtype local_sum, *global_sum;
+  sunrealtype local_sum;
   Pthreads_Data* my_data;
-  pthread_mutex_t* global_mutex;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
@@ -1842,9 +1816,6 @@ static void* nvWL2NormPt(void* thread_data)
   xd = my_data->v1;
   wd = my_data->v2;
 
-  global_sum   = my_data->global_val;
-  global_mutex = my_data->global_mutex;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -1852,13 +1823,11 @@ static void* nvWL2NormPt(void* thread_data)
   local_sum = ZERO;
   for (i = start; i < end; i++) { local_sum += SUNSQR(xd[i] * wd[i]); }
 
-  /* update global sum */
-  pthread_mutex_lock(global_mutex);
-  *global_sum += local_sum;
-  pthread_mutex_unlock(global_mutex);
+  /* store local sum in padded per-thread slot */
+  my_data->local_val[0] = local_sum;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1871,26 +1840,21 @@ sunrealtype N_VL1Norm_Pthreads(N_Vector x)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
   sunrealtype sum = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  if (NV_REPRODUCIBLE_PT(x))
+  {
+    return (VSumRepro_Pthreads(SUN_REPRO_L1NORM, x, NULL, NULL));
+  }
 
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 1);
+  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -1901,22 +1865,18 @@ sunrealtype N_VL1Norm_Pthreads(N_Vector x)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1           = NV_DATA_PT(x);
-    thread_data[i].global_val   = &sum;
-    thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvL1NormPt, (void*)&thread_data[i]);
+    thread_data[i].v1        = NV_DATA_PT(x);
+    thread_data[i].local_val = nvPoolPartial(pool, i);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvL1NormPt);
+
+  /* combine partial sums in thread order */
+  for (i = 0; i < nthreads; i++) { sum += thread_data[i].local_val[0]; }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return (sum);
 }
@@ -1929,18 +1889,14 @@ static void* nvL1NormPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype* xd;
-  sunrealtype local_sum, *global_sum;
+  sunrealtype local_sum;
   Pthreads_Data* my_data;
-  pthread_mutex_t* global_mutex;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
 
   xd = my_data->v1;
 
-  global_sum   = my_data->global_val;
-  global_mutex = my_data->global_mutex;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -1948,13 +1904,11 @@ static void* nvL1NormPt(void* thread_data)
   local_sum = ZERO;
   for (i = start; i < end; i++) { local_sum += SUNRabs(xd[i]); }
 
-  /* update global sum */
-  pthread_mutex_lock(global_mutex);
-  *global_sum += local_sum;
-  pthread_mutex_unlock(global_mutex);
+  /* store local sum in padded per-thread slot */
+  my_data->local_val[0] = local_sum;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1967,21 +1921,15 @@ void N_VCompare_Pthreads(sunrealtype c, N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -1995,18 +1943,13 @@ void N_VCompare_Pthreads(sunrealtype c, N_Vector x, N_Vector z)
     thread_data[i].c1 = c;
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvComparePt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvComparePt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -2036,7 +1979,7 @@ static void* nvComparePt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = (SUNRabs(xd[i]) >= c) ? ONE : ZERO; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -2049,24 +1992,18 @@ sunbooleantype N_VInvTest_Pthreads(N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   sunrealtype val = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 1);
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -2076,21 +2013,22 @@ sunbooleantype N_VInvTest_Pthreads(N_Vector x, N_Vector z)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1         = NV_DATA_PT(x);
-    thread_data[i].v2         = NV_DATA_PT(z);
-    thread_data[i].global_val = &val;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvInvTestPt, (void*)&thread_data[i]);
+    thread_data[i].v1        = NV_DATA_PT(x);
+    thread_data[i].v2        = NV_DATA_PT(z);
+    thread_data[i].local_val = nvPoolPartial(pool, i);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvInvTestPt);
+
+  /* combine partial flags */
+  for (i = 0; i < nthreads; i++)
+  {
+    if (thread_data[i].local_val[0] > ZERO) { val = ONE; }
+  }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   if (val > ZERO) { return (SUNFALSE); }
   else { return (SUNTRUE); }
@@ -2104,7 +2042,7 @@ static void* nvInvTestPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype *xd, *zd;
-  sunrealtype local_val, *global_val;
+  sunrealtype local_val;
   Pthreads_Data* my_data;
 
   /* extract thread data */
@@ -2113,8 +2051,6 @@ static void* nvInvTestPt(void* thread_data)
   xd = my_data->v1;
   zd = my_data->v2;
 
-  global_val = my_data->global_val;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -2126,11 +2062,11 @@ static void* nvInvTestPt(void* thread_data)
     else { zd[i] = ONE / xd[i]; }
   }
 
-  /* update global val */
-  if (local_val > ZERO) { *global_val = local_val; }
+  /* store local flag in padded per-thread slot */
+  my_data->local_val[0] = local_val;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -2143,24 +2079,18 @@ sunbooleantype N_VConstrMask_Pthreads(N_Vector c, N_Vector x, N_Vector m)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   sunrealtype val = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 1);
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -2170,22 +2100,23 @@ sunbooleantype N_VConstrMask_Pthreads(N_Vector c, N_Vector x, N_Vector m)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1         = NV_DATA_PT(c);
-    thread_data[i].v2         = NV_DATA_PT(x);
-    thread_data[i].v3         = NV_DATA_PT(m);
-    thread_data[i].global_val = &val;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvConstrMaskPt, (void*)&thread_data[i]);
+    thread_data[i].v1        = NV_DATA_PT(c);
+    thread_data[i].v2        = NV_DATA_PT(x);
+    thread_data[i].v3        = NV_DATA_PT(m);
+    thread_data[i].local_val = nvPoolPartial(pool, i);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvConstrMaskPt);
+
+  /* combine partial flags */
+  for (i = 0; i < nthreads; i++)
+  {
+    if (thread_data[i].local_val[0] > ZERO) { val = ONE; }
+  }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   if (val > ZERO) { return (SUNFALSE); }
   else { return (SUNTRUE); }
@@ -2199,7 +2130,7 @@ static void* nvConstrMaskPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype *cd, *xd, *md;
-  sunrealtype local_val, *global_val;
+  sunrealtype local_val;
   Pthreads_Data* my_data;
 
   /* extract thread data */
@@ -2209,8 +2140,6 @@ static void* nvConstrMaskPt(void* thread_data)
   xd = my_data->v2;
   md = my_data->v3;
 
-  global_val = my_data->global_val;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -2231,11 +2160,11 @@ static void* nvConstrMaskPt(void* thread_data)
     }
   }
 
-  /* update global val */
-  if (local_val > ZERO) { *global_val = local_val; }
+  /* store local flag in padded per-thread slot */
+  my_data->local_val[0] = local_val;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -2248,27 +2177,17 @@ sunrealtype N_VMinQuotient_Pthreads(N_Vector num, N_Vector denom)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
   sunrealtype min = SUN_BIG_REAL;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(num);
-  nthreads = NV_NUM_THREADS_PT(num);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(num);
+  nthreads    = NV_NUM_THREADS_PT(num);
+  pool        = NV_POOL_PT(num);
+  thread_data = nvPoolBegin(pool, 1);
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -2278,23 +2197,22 @@ sunrealtype N_VMinQuotient_Pthreads(N_Vector num, N_Vector denom)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1           = NV_DATA_PT(num);
-    thread_data[i].v2           = NV_DATA_PT(denom);
-    thread_data[i].global_val   = &min;
-    thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvMinQuotientPt, (void*)&thread_data[i]);
+    thread_data[i].v1        = NV_DATA_PT(num);
+    thread_data[i].v2        = NV_DATA_PT(denom);
+    thread_data[i].local_val = nvPoolPartial(pool, i);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvMinQuotientPt);
+
+  /* combine partial minima */
+  for (i = 0; i < nthreads; i++)
+  {
+    min = SUNMIN(min, thread_data[i].local_val[0]);
+  }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return (min);
 }
@@ -2307,9 +2225,8 @@ static void* nvMinQuotientPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype *nd, *dd;
-  sunrealtype local_min, *global_min;
+  sunrealtype local_min;
   Pthreads_Data* my_data;
-  pthread_mutex_t* global_mutex;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
@@ -2317,9 +2234,6 @@ static void* nvMinQuotientPt(void* thread_data)
   nd = my_data->v1;
   dd = my_data->v2;
 
-  global_min   = my_data->global_val;
-  global_mutex = my_data->global_mutex;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -2331,13 +2245,11 @@ static void* nvMinQuotientPt(void* thread_data)
     local_min = SUNMIN(local_min, nd[i] / dd[i]);
   }
 
-  /* update global min */
-  pthread_mutex_lock(global_mutex);
-  if (local_min < *global_min) { *global_min = local_min; }
-  pthread_mutex_unlock(global_mutex);
+  /* store local min in padded per-thread slot */
+  my_data->local_val[0] = local_min;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -2357,9 +2269,8 @@ SUNErrCode N_VLinearCombination_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -2381,17 +2292,12 @@ SUNErrCode N_VLinearCombination_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
   }
 
   /* get vector length and data array */
-  N        = NV_LENGTH_PT(z);
-  nthreads = NV_NUM_THREADS_PT(z);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  N           = NV_LENGTH_PT(z);
+  nthreads    = NV_NUM_THREADS_PT(z);
+  pool        = NV_POOL_PT(z);
+  thread_data = nvPoolBegin(pool, 0);
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -2405,19 +2311,13 @@ SUNErrCode N_VLinearCombination_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
     thread_data[i].cvals = c;
     thread_data[i].Y1    = X;
     thread_data[i].x1    = z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvLinearCombinationPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvLinearCombinationPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return SUN_SUCCESS;
 }
@@ -2455,7 +2355,7 @@ static void* nvLinearCombinationPt(void* thread_data)
       xd = NV_DATA_PT(my_data->Y1[i]);
       for (j = start; j < end; j++) { zd[j] += c[i] * xd[j]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -2469,7 +2369,7 @@ static void* nvLinearCombinationPt(void* thread_data)
       xd = NV_DATA_PT(my_data->Y1[i]);
       for (j = start; j < end; j++) { zd[j] += c[i] * xd[j]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -2482,7 +2382,7 @@ static void* nvLinearCombinationPt(void* thread_data)
     xd = NV_DATA_PT(my_data->Y1[i]);
     for (j = start; j < end; j++) { zd[j] += c[i] * xd[j]; }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -2496,9 +2396,8 @@ SUNErrCode N_VScaleAddMulti_Pthreads(int nvec, sunrealtype* a, N_Vector x,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -2512,17 +2411,12 @@ SUNErrCode N_VScaleAddMulti_Pthreads(int nvec, sunrealtype* a, N_Vector x,
   }
 
   /* get vector length and data array */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -2537,18 +2431,13 @@ SUNErrCode N_VScaleAddMulti_Pthreads(int nvec, sunrealtype* a, N_Vector x,
     thread_data[i].x1    = x;
     thread_data[i].Y1    = Y;
     thread_data[i].Y2    = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvScaleAddMultiPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvScaleAddMultiPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return SUN_SUCCESS;
 }
@@ -2587,7 +2476,7 @@ static void* nvScaleAddMultiPt(void* thread_data)
       yd = NV_DATA_PT(my_data->Y1[i]);
       for (j = start; j < end; j++) { yd[j] += a[i] * xd[j]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -2599,7 +2488,7 @@ static void* nvScaleAddMultiPt(void* thread_data)
     zd = NV_DATA_PT(my_data->Y2[i]);
     for (j = start; j < end; j++) { zd[j] = a[i] * xd[j] + yd[j]; }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -2612,11 +2501,9 @@ SUNErrCode N_VDotProdMulti_Pthreads(int nvec, N_Vector x, N_Vector* Y,
   SUNFunctionBegin(x->sunctx);
 
   sunindextype N;
-  int i, nthreads;
-  pthread_t* threads;
+  int i, j, nthreads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -2632,20 +2519,21 @@ SUNErrCode N_VDotProdMulti_Pthreads(int nvec, N_Vector x, N_Vector* Y,
   /* initialize output array */
   for (i = 0; i < nvec; i++) { dotprods[i] = ZERO; }
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  if (NV_REPRODUCIBLE_PT(x))
+  {
+    for (i = 0; i < nvec; i++)
+    {
+      dotprods[i] = VSumRepro_Pthreads(SUN_REPRO_DOTPROD, x, Y[i], NULL);
+    }
+    return SUN_SUCCESS;
+  }
 
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, nvec);
+  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -2656,25 +2544,26 @@ SUNErrCode N_VDotProdMulti_Pthreads(int nvec, N_Vector x, N_Vector* Y,
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].nvec  = nvec;
-    thread_data[i].x1    = x;
-    thread_data[i].Y1    = Y;
-    thread_data[i].cvals = dotprods;
+    thread_data[i].nvec      = nvec;
+    thread_data[i].local_val = nvPoolPartial(pool, i);
+    thread_data[i].x1        = x;
+    thread_data[i].Y1        = Y;
+  }
 
-    thread_data[i].global_mutex = &global_mutex;
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvDotProdMultiPt);
 
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvDotProdMultiPt, (void*)&thread_data[i]);
+  /* combine partial sums in thread order */
+  for (j = 0; j < nvec; j++)
+  {
+    for (i = 0; i < nthreads; i++)
+    {
+      dotprods[j] += thread_data[i].local_val[j];
+    }
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return SUN_SUCCESS;
 }
@@ -2687,23 +2576,19 @@ static void* nvDotProdMultiPt(void* thread_data)
 {
   Pthreads_Data* my_data;
   sunindextype j, start, end;
-  pthread_mutex_t* lock;
 
   int i;
   sunrealtype sum;
-  sunrealtype* dotprods = NULL;
-  sunrealtype* xd       = NULL;
-  sunrealtype* yd       = NULL;
+  sunrealtype* xd = NULL;
+  sunrealtype* yd = NULL;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
 
   start = my_data->start;
   end   = my_data->end;
-  lock  = my_data->global_mutex;
 
-  xd       = NV_DATA_PT(my_data->x1);
-  dotprods = my_data->cvals;
+  xd = NV_DATA_PT(my_data->x1);
 
   /* compute multiple dot products */
   for (i = 0; i < my_data->nvec; i++)
@@ -2711,74 +2596,294 @@ static void* nvDotProdMultiPt(void* thread_data)
     yd  = NV_DATA_PT(my_data->Y1[i]);
     sum = ZERO;
     for (j = start; j < end; j++) { sum += xd[j] * yd[j]; }
-    /* update global sum */
-    pthread_mutex_lock(lock);
-    dotprods[i] += sum;
-    pthread_mutex_unlock(lock);
+    /* store local sum in padded per-thread slot */
+    my_data->local_val[i] = sum;
   }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
-/*
- * -----------------------------------------------------------------------------
- * vector array operations
- * -----------------------------------------------------------------------------
+/* -----------------------------------------------------------------------------
+ * Compute the linear sum z = a*x + b*y and its weighted root mean square norm
+ */
+
+sunrealtype N_VLinearSumWrmsNorm_Pthreads(sunrealtype a, N_Vector x,
+                                          sunrealtype b, N_Vector y, N_Vector z,
+                                          N_Vector w)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  sunindextype N;
+  int i, nthreads;
+  Pthreads_Pool* pool;
+  Pthreads_Data* thread_data;
+  sunrealtype sum = ZERO;
+
+  if (NV_REPRODUCIBLE_PT(z))
+  {
+    N_VLinearSum_Pthreads(a, x, b, y, z);
+    SUNCheckLastErrNoRet();
+    sum = VSumRepro_Pthreads(SUN_REPRO_WSQRSUM, z, w, NULL);
+    return (SUNRsqrt(sum / NV_LENGTH_PT(z)));
+  }
+
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(z);
+  nthreads    = NV_NUM_THREADS_PT(z);
+  pool        = NV_POOL_PT(z);
+  thread_data = nvPoolBegin(pool, 1);
+  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
+
+  for (i = 0; i < nthreads; i++)
+  {
+    /* initialize thread data */
+    nvInitThreadData(&thread_data[i]);
+
+    /* compute start and end loop index for thread */
+    nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
+
+    /* pack thread data */
+    thread_data[i].c1        = a;
+    thread_data[i].c2        = b;
+    thread_data[i].v1        = NV_DATA_PT(x);
+    thread_data[i].v2        = NV_DATA_PT(y);
+    thread_data[i].v3        = NV_DATA_PT(z);
+    thread_data[i].x1        = w;
+    thread_data[i].local_val = nvPoolPartial(pool, i);
+  }
+
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvLinearSumWrmsNormPt);
+
+  /* combine partial sums in thread order */
+  for (i = 0; i < nthreads; i++) { sum += thread_data[i].local_val[0]; }
+
+  /* clean up and return */
+  nvPoolEnd(pool);
+
+  return (SUNRsqrt(sum / N));
+}
+
+/* -----------------------------------------------------------------------------
+ * Pthread companion function to N_VLinearSumWrmsNorm
  */
 
+static void* nvLinearSumWrmsNormPt(void* thread_data)
+{
+  sunindextype i, start, end;
+  sunrealtype a, b, *xd, *yd, *zd, *wd;
+  sunrealtype local_sum;
+  Pthreads_Data* my_data;
+
+  /* extract thread data */
+  my_data = (Pthreads_Data*)thread_data;
+
+  a  = my_data->c1;
+  b  = my_data->c2;
+  xd = my_data->v1;
+  yd = my_data->v2;
+  zd = my_data->v3;
+  wd = NV_DATA_PT(my_data->x1);
+
+  start = my_data->start;
+  end   = my_data->end;
+
+  /* compute the linear sum and its weighted square sum */
+  local_sum = ZERO;
+  for (i = start; i < end; i++)
+  {
+    zd[i] = (a * xd[i]) + (b * yd[i]);
+    local_sum += SUNSQR(zd[i] * wd[i]);
+  }
+
+  /* store local sum in padded per-thread slot */
+  my_data->local_val[0] = local_sum;
+
+  /* exit */
+  return (NULL);
+}
+
 /* -----------------------------------------------------------------------------
- * Compute multiple linear sums Z[i] = a*X[i] + b*Y[i]
+ * Compute the linear combination z = sum{ c[i] * X[i] } and its weighted root
+ * mean square norm
  */
 
-SUNErrCode N_VLinearSumVectorArray_Pthreads(int nvec, sunrealtype a,
-                                            N_Vector* X, sunrealtype b,
-                                            N_Vector* Y, N_Vector* Z)
+SUNErrCode N_VLinearCombinationWrmsNorm_Pthreads(int nvec, sunrealtype* c,
+                                                 N_Vector* X, N_Vector z,
+                                                 N_Vector w, sunrealtype* nrm)
 {
   SUNFunctionBegin(X[0]->sunctx);
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  sunrealtype c;
-  N_Vector* V1;
-  N_Vector* V2;
-  sunbooleantype test;
+  sunrealtype sum = ZERO;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
 
-  /* should have called N_VLinearSum */
-  if (nvec == 1)
+  /* should have called N_VLinearSumWrmsNorm */
+  if (nvec == 2)
   {
-    N_VLinearSum_Pthreads(a, X[0], b, Y[0], Z[0]);
+    *nrm = N_VLinearSumWrmsNorm_Pthreads(c[0], X[0], c[1], X[1], z, w);
     SUNCheckLastErr();
     return SUN_SUCCESS;
   }
 
-  /* BLAS usage: axpy y <- ax+y */
-  if ((b == ONE) && (Z == Y))
+  if (NV_REPRODUCIBLE_PT(z))
   {
-    VaxpyVectorArray_Pthreads(nvec, a, X, Y);
+    SUNCheckCall(N_VLinearCombination_Pthreads(nvec, c, X, z));
+    sum  = VSumRepro_Pthreads(SUN_REPRO_WSQRSUM, z, w, NULL);
+    *nrm = SUNRsqrt(sum / NV_LENGTH_PT(z));
     return SUN_SUCCESS;
   }
 
-  /* BLAS usage: axpy x <- by+x */
-  if ((a == ONE) && (Z == X))
-  {
-    VaxpyVectorArray_Pthreads(nvec, b, Y, X);
-    return SUN_SUCCESS;
-  }
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(z);
+  nthreads    = NV_NUM_THREADS_PT(z);
+  pool        = NV_POOL_PT(z);
+  thread_data = nvPoolBegin(pool, 1);
+  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* Case: a == b == 1.0 */
-  if ((a == ONE) && (b == ONE))
+  for (i = 0; i < nthreads; i++)
   {
-    VSumVectorArray_Pthreads(nvec, X, Y, Z);
-    return SUN_SUCCESS;
-  }
+    /* initialize thread data */
+    nvInitThreadData(&thread_data[i]);
+
+    /* compute start and end loop index for thread */
+    nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
+
+    /* pack thread data */
+    thread_data[i].nvec      = nvec;
+    thread_data[i].cvals     = c;
+    thread_data[i].Y1        = X;
+    thread_data[i].x1        = z;
+    thread_data[i].x2        = w;
+    thread_data[i].local_val = nvPoolPartial(pool, i);
+  }
+
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvLinearCombinationWrmsNormPt);
+
+  /* combine partial sums in thread order */
+  for (i = 0; i < nthreads; i++) { sum += thread_data[i].local_val[0]; }
+
+  /* clean up and return */
+  nvPoolEnd(pool);
+
+  *nrm = SUNRsqrt(sum / N);
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------------------
+ * Pthread companion function to N_VLinearCombinationWrmsNorm
+ */
+
+static void* nvLinearCombinationWrmsNormPt(void* thread_data)
+{
+  Pthreads_Data* my_data;
+  sunindextype j, start, end, bstart, bend;
+
+  int i;
+  sunrealtype local_sum;
+  sunrealtype* c  = NULL;
+  sunrealtype* xd = NULL;
+  sunrealtype* zd = NULL;
+  sunrealtype* wd = NULL;
+
+  /* extract thread data */
+  my_data = (Pthreads_Data*)thread_data;
+
+  start = my_data->start;
+  end   = my_data->end;
+
+  c  = my_data->cvals;
+  zd = NV_DATA_PT(my_data->x1);
+  wd = NV_DATA_PT(my_data->x2);
+
+  /* compute z = sum{ c[i] * X[i] } one block at a time and accumulate the
+     weighted square sum of the block while it is in cache, X[0] may be z */
+  local_sum = ZERO;
+  for (bstart = start; bstart < end; bstart += NV_NORM_BLOCK_PT)
+  {
+    bend = SUNMIN(bstart + NV_NORM_BLOCK_PT, end);
+    xd   = NV_DATA_PT(my_data->Y1[0]);
+    for (j = bstart; j < bend; j++) { zd[j] = c[0] * xd[j]; }
+    for (i = 1; i < my_data->nvec; i++)
+    {
+      xd = NV_DATA_PT(my_data->Y1[i]);
+      for (j = bstart; j < bend; j++) { zd[j] += c[i] * xd[j]; }
+    }
+    for (j = bstart; j < bend; j++) { local_sum += SUNSQR(zd[j] * wd[j]); }
+  }
+
+  /* store local sum in padded per-thread slot */
+  my_data->local_val[0] = local_sum;
+
+  /* exit */
+  return (NULL);
+}
+
+/*
+ * -----------------------------------------------------------------------------
+ * vector array operations
+ * -----------------------------------------------------------------------------
+ */
+
+/* -----------------------------------------------------------------------------
+ * Compute multiple linear sums Z[i] = a*X[i] + b*Y[i]
+ */
+
+SUNErrCode N_VLinearSumVectorArray_Pthreads(int nvec, sunrealtype a,
+                                            N_Vector* X, sunrealtype b,
+                                            N_Vector* Y, N_Vector* Z)
+{
+  SUNFunctionBegin(X[0]->sunctx);
+
+  sunindextype N;
+  int i, nthreads;
+  Pthreads_Pool* pool;
+  Pthreads_Data* thread_data;
+
+  sunrealtype c;
+  N_Vector* V1;
+  N_Vector* V2;
+  sunbooleantype test;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* should have called N_VLinearSum */
+  if (nvec == 1)
+  {
+    N_VLinearSum_Pthreads(a, X[0], b, Y[0], Z[0]);
+    SUNCheckLastErr();
+    return SUN_SUCCESS;
+  }
+
+  /* BLAS usage: axpy y <- ax+y */
+  if ((b == ONE) && (Z == Y))
+  {
+    VaxpyVectorArray_Pthreads(nvec, a, X, Y);
+    return SUN_SUCCESS;
+  }
+
+  /* BLAS usage: axpy x <- by+x */
+  if ((a == ONE) && (Z == X))
+  {
+    VaxpyVectorArray_Pthreads(nvec, b, Y, X);
+    return SUN_SUCCESS;
+  }
+
+  /* Case: a == b == 1.0 */
+  if ((a == ONE) && (b == ONE))
+  {
+    VSumVectorArray_Pthreads(nvec, X, Y, Z);
+    return SUN_SUCCESS;
+  }
 
   /* Cases:                    */
   /*   (1) a == 1.0, b = -1.0, */
@@ -2837,17 +2942,12 @@ SUNErrCode N_VLinearSumVectorArray_Pthreads(int nvec, sunrealtype a,
   /*   (3) a,b == other, a !=b, a != -b                            */
 
   /* get vector length and data array */
-  N        = NV_LENGTH_PT(Z[0]);
-  nthreads = NV_NUM_THREADS_PT(Z[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  N           = NV_LENGTH_PT(Z[0]);
+  nthreads    = NV_NUM_THREADS_PT(Z[0]);
+  pool        = NV_POOL_PT(Z[0]);
+  thread_data = nvPoolBegin(pool, 0);
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -2863,19 +2963,13 @@ SUNErrCode N_VLinearSumVectorArray_Pthreads(int nvec, sunrealtype a,
     thread_data[i].Y1   = X;
     thread_data[i].Y2   = Y;
     thread_data[i].Y3   = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvLinearSumVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvLinearSumVectorArrayPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return SUN_SUCCESS;
 }
@@ -2914,7 +3008,7 @@ static void* nvLinearSumVectorArrayPt(void* thread_data)
   }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -2928,9 +3022,8 @@ SUNErrCode N_VScaleVectorArray_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -2944,17 +3037,12 @@ SUNErrCode N_VScaleVectorArray_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
   }
 
   /* get vector length and data array */
-  N        = NV_LENGTH_PT(Z[0]);
-  nthreads = NV_NUM_THREADS_PT(Z[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  N           = NV_LENGTH_PT(Z[0]);
+  nthreads    = NV_NUM_THREADS_PT(Z[0]);
+  pool        = NV_POOL_PT(Z[0]);
+  thread_data = nvPoolBegin(pool, 0);
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -2968,19 +3056,13 @@ SUNErrCode N_VScaleVectorArray_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
     thread_data[i].cvals = c;
     thread_data[i].Y1    = X;
     thread_data[i].Y2    = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvScaleVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvScaleVectorArrayPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return SUN_SUCCESS;
 }
@@ -3017,7 +3099,7 @@ static void* nvScaleVectorArrayPt(void* thread_data)
       xd = NV_DATA_PT(my_data->Y1[i]);
       for (j = start; j < end; j++) { xd[j] *= c[i]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -3029,7 +3111,7 @@ static void* nvScaleVectorArrayPt(void* thread_data)
     zd = NV_DATA_PT(my_data->Y2[i]);
     for (j = start; j < end; j++) { zd[j] = c[i] * xd[j]; }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -3042,9 +3124,8 @@ SUNErrCode N_VConstVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* Z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -3058,17 +3139,12 @@ SUNErrCode N_VConstVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* Z)
   }
 
   /* get vector length and data array */
-  N        = NV_LENGTH_PT(Z[0]);
-  nthreads = NV_NUM_THREADS_PT(Z[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  N           = NV_LENGTH_PT(Z[0]);
+  nthreads    = NV_NUM_THREADS_PT(Z[0]);
+  pool        = NV_POOL_PT(Z[0]);
+  thread_data = nvPoolBegin(pool, 0);
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -3081,19 +3157,13 @@ SUNErrCode N_VConstVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* Z)
     thread_data[i].nvec = nvec;
     thread_data[i].c1   = c;
     thread_data[i].Y1   = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvConstVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvConstVectorArrayPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return SUN_SUCCESS;
 }
@@ -3124,7 +3194,7 @@ static void* nvConstVectorArrayPt(void* thread_data)
   }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -3137,11 +3207,9 @@ SUNErrCode N_VWrmsNormVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* W,
   SUNFunctionBegin(X[0]->sunctx);
 
   sunindextype N;
-  int i, nthreads;
-  pthread_t* threads;
+  int i, j, nthreads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -3157,20 +3225,23 @@ SUNErrCode N_VWrmsNormVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* W,
   /* initialize output array */
   for (i = 0; i < nvec; i++) { nrm[i] = ZERO; }
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  if (NV_REPRODUCIBLE_PT(X[0]))
+  {
+    N = NV_LENGTH_PT(X[0]);
+    for (i = 0; i < nvec; i++)
+    {
+      nrm[i] = VSumRepro_Pthreads(SUN_REPRO_WSQRSUM, X[i], W[i], NULL);
+      nrm[i] = SUNRsqrt(nrm[i] / N);
+    }
+    return SUN_SUCCESS;
+  }
 
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
+  pool        = NV_POOL_PT(X[0]);
+  thread_data = nvPoolBegin(pool, nvec);
+  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -3181,29 +3252,29 @@ SUNErrCode N_VWrmsNormVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* W,
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].nvec  = nvec;
-    thread_data[i].Y1    = X;
-    thread_data[i].Y2    = W;
-    thread_data[i].cvals = nrm;
+    thread_data[i].nvec      = nvec;
+    thread_data[i].local_val = nvPoolPartial(pool, i);
+    thread_data[i].Y1        = X;
+    thread_data[i].Y2        = W;
+  }
 
-    thread_data[i].global_mutex = &global_mutex;
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvWrmsNormVectorArrayPt);
 
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvWrmsNormVectorArrayPt,
-                   (void*)&thread_data[i]);
+  /* combine partial sums in thread order */
+  for (j = 0; j < nvec; j++)
+  {
+    for (i = 0; i < nthreads; i++)
+    {
+      nrm[j] += thread_data[i].local_val[j];
+    }
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
   /* finalize wrms calculation */
   for (i = 0; i < nvec; i++) { nrm[i] = SUNRsqrt(nrm[i] / N); }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return SUN_SUCCESS;
 }
@@ -3216,11 +3287,9 @@ static void* nvWrmsNormVectorArrayPt(void* thread_data)
 {
   Pthreads_Data* my_data;
   sunindextype j, start, end;
-  pthread_mutex_t* lock;
 
   int i;
   sunrealtype sum;
-  sunrealtype* nrm = NULL;
   sunrealtype* xd  = NULL;
   sunrealtype* wd  = NULL;
 
@@ -3229,9 +3298,6 @@ static void* nvWrmsNormVectorArrayPt(void* thread_data)
 
   start = my_data->start;
   end   = my_data->end;
-  lock  = my_data->global_mutex;
-
-  nrm = my_data->cvals;
 
   /* compute the WRMS norm for each vector in the vector array */
   for (i = 0; i < my_data->nvec; i++)
@@ -3240,14 +3306,12 @@ static void* nvWrmsNormVectorArrayPt(void* thread_data)
     wd  = NV_DATA_PT(my_data->Y2[i]);
     sum = ZERO;
     for (j = start; j < end; j++) { sum += SUNSQR(xd[j] * wd[j]); }
-    /* update global sum */
-    pthread_mutex_lock(lock);
-    nrm[i] += sum;
-    pthread_mutex_unlock(lock);
+    /* store local sum in padded per-thread slot */
+    my_data->local_val[i] = sum;
   }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -3260,11 +3324,9 @@ SUNErrCode N_VWrmsNormMaskVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector*
   SUNFunctionBegin(X[0]->sunctx);
 
   sunindextype N;
-  int i, nthreads;
-  pthread_t* threads;
+  int i, j, nthreads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -3280,20 +3342,23 @@ SUNErrCode N_VWrmsNormMaskVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector*
   /* initialize output array */
   for (i = 0; i < nvec; i++) { nrm[i] = ZERO; }
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  if (NV_REPRODUCIBLE_PT(X[0]))
+  {
+    N = NV_LENGTH_PT(X[0]);
+    for (i = 0; i < nvec; i++)
+    {
+      nrm[i] = VSumRepro_Pthreads(SUN_REPRO_WSQRSUMMASK, X[i], W[i], id);
+      nrm[i] = SUNRsqrt(nrm[i] / N);
+    }
+    return SUN_SUCCESS;
+  }
 
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
+  pool        = NV_POOL_PT(X[0]);
+  thread_data = nvPoolBegin(pool, nvec);
+  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -3304,30 +3369,30 @@ SUNErrCode N_VWrmsNormMaskVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector*
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].nvec  = nvec;
-    thread_data[i].Y1    = X;
-    thread_data[i].Y2    = W;
-    thread_data[i].x1    = id;
-    thread_data[i].cvals = nrm;
+    thread_data[i].nvec      = nvec;
+    thread_data[i].local_val = nvPoolPartial(pool, i);
+    thread_data[i].Y1        = X;
+    thread_data[i].Y2        = W;
+    thread_data[i].x1        = id;
+  }
 
-    thread_data[i].global_mutex = &global_mutex;
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvWrmsNormMaskVectorArrayPt);
 
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvWrmsNormMaskVectorArrayPt,
-                   (void*)&thread_data[i]);
+  /* combine partial sums in thread order */
+  for (j = 0; j < nvec; j++)
+  {
+    for (i = 0; i < nthreads; i++)
+    {
+      nrm[j] += thread_data[i].local_val[j];
+    }
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
   /* finalize wrms calculation */
   for (i = 0; i < nvec; i++) { nrm[i] = SUNRsqrt(nrm[i] / N); }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return SUN_SUCCESS;
 }
@@ -3340,11 +3405,9 @@ static void* nvWrmsNormMaskVectorArrayPt(void* thread_data)
 {
   Pthreads_Data* my_data;
   sunindextype j, start, end;
-  pthread_mutex_t* lock;
 
   int i;
   sunrealtype sum;
-  sunrealtype* nrm = NULL;
   sunrealtype* xd  = NULL;
   sunrealtype* wd  = NULL;
   sunrealtype* idd = NULL;
@@ -3354,9 +3417,7 @@ static void* nvWrmsNormMaskVectorArrayPt(void* thread_data)
 
   start = my_data->start;
   end   = my_data->end;
-  lock  = my_data->global_mutex;
 
-  nrm = my_data->cvals;
   idd = NV_DATA_PT(my_data->x1);
 
   /* compute the WRMS norm for each vector in the vector array */
@@ -3369,14 +3430,12 @@ static void* nvWrmsNormMaskVectorArrayPt(void* thread_data)
     {
       if (idd[j] > ZERO) { sum += SUNSQR(xd[j] * wd[j]); }
     }
-    /* update global sum */
-    pthread_mutex_lock(lock);
-    nrm[i] += sum;
-    pthread_mutex_unlock(lock);
+    /* store local sum in padded per-thread slot */
+    my_data->local_val[i] = sum;
   }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -3391,9 +3450,8 @@ SUNErrCode N_VScaleAddMultiVectorArray_Pthreads(int nvec, int nsum,
 
   sunindextype N;
   int i, j, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   N_Vector* YY;
   N_Vector* ZZ;
@@ -3450,17 +3508,12 @@ SUNErrCode N_VScaleAddMultiVectorArray_Pthreads(int nvec, int nsum,
    * ---------------------------- */
 
   /* get vector length and data array */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
+  pool        = NV_POOL_PT(X[0]);
+  thread_data = nvPoolBegin(pool, 0);
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -3476,19 +3529,13 @@ SUNErrCode N_VScaleAddMultiVectorArray_Pthreads(int nvec, int nsum,
     thread_data[i].Y1    = X;
     thread_data[i].ZZ1   = Y;
     thread_data[i].ZZ2   = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvScaleAddMultiVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvScaleAddMultiVectorArrayPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return SUN_SUCCESS;
 }
@@ -3530,7 +3577,7 @@ static void* nvScaleAddMultiVectorArrayPt(void* thread_data)
         for (k = start; k < end; k++) { yd[k] += a[j] * xd[k]; }
       }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -3546,7 +3593,7 @@ static void* nvScaleAddMultiVectorArrayPt(void* thread_data)
       for (k = start; k < end; k++) { zd[k] = a[j] * xd[k] + yd[k]; }
     }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -3561,9 +3608,8 @@ SUNErrCode N_VLinearCombinationVectorArray_Pthreads(int nvec, int nsum,
 
   sunindextype N;
   int i, j, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   sunrealtype* ctmp;
   N_Vector* Y;
@@ -3635,17 +3681,12 @@ SUNErrCode N_VLinearCombinationVectorArray_Pthreads(int nvec, int nsum,
    * -------------------------- */
 
   /* get vector length and data array */
-  N        = NV_LENGTH_PT(Z[0]);
-  nthreads = NV_NUM_THREADS_PT(Z[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  N           = NV_LENGTH_PT(Z[0]);
+  nthreads    = NV_NUM_THREADS_PT(Z[0]);
+  pool        = NV_POOL_PT(Z[0]);
+  thread_data = nvPoolBegin(pool, 0);
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -3660,19 +3701,13 @@ SUNErrCode N_VLinearCombinationVectorArray_Pthreads(int nvec, int nsum,
     thread_data[i].cvals = c;
     thread_data[i].ZZ1   = X;
     thread_data[i].Y1    = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvLinearCombinationVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvLinearCombinationVectorArrayPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return SUN_SUCCESS;
 }
@@ -3714,7 +3749,7 @@ static void* nvLinearCombinationVectorArrayPt(void* thread_data)
         for (k = start; k < end; k++) { zd[k] += c[i] * xd[k]; }
       }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -3732,7 +3767,7 @@ static void* nvLinearCombinationVectorArrayPt(void* thread_data)
         for (k = start; k < end; k++) { zd[k] += c[i] * xd[k]; }
       }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -3749,7 +3784,7 @@ static void* nvLinearCombinationVectorArrayPt(void* thread_data)
       for (k = start; k < end; k++) { zd[k] += c[i] * xd[k]; }
     }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -3778,24 +3813,18 @@ SUNErrCode N_VBufPack_Pthreads(N_Vector x, void* buf)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   SUNAssert(buf, SUN_ERR_ARG_CORRUPT);
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -3807,18 +3836,13 @@ SUNErrCode N_VBufPack_Pthreads(N_Vector x, void* buf)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = (sunrealtype*)buf;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VBufPack_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VBufPack_PT);
 
   /* clean up */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return SUN_SUCCESS;
 }
@@ -3846,7 +3870,7 @@ static void* VBufPack_PT(void* thread_data)
   for (i = start; i < end; i++) { bd[i] = xd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -3859,24 +3883,18 @@ SUNErrCode N_VBufUnpack_Pthreads(N_Vector x, void* buf)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   SUNAssert(buf, SUN_ERR_ARG_CORRUPT);
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -3888,18 +3906,13 @@ SUNErrCode N_VBufUnpack_Pthreads(N_Vector x, void* buf)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = (sunrealtype*)buf;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VBufUnpack_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VBufUnpack_PT);
 
   /* clean up */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return SUN_SUCCESS;
 }
@@ -3927,7 +3940,7 @@ static void* VBufUnpack_PT(void* thread_data)
   for (i = start; i < end; i++) { xd[i] = bd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -3946,21 +3959,15 @@ static void VCopy_Pthreads(N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -3973,18 +3980,13 @@ static void VCopy_Pthreads(N_Vector x, N_Vector z)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VCopy_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VCopy_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -4012,7 +4014,7 @@ static void* VCopy_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4025,21 +4027,15 @@ static void VSum_Pthreads(N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4053,18 +4049,13 @@ static void VSum_Pthreads(N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VSum_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VSum_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -4093,7 +4084,7 @@ static void* VSum_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i] + yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4106,21 +4097,15 @@ static void VDiff_Pthreads(N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4134,18 +4119,13 @@ static void VDiff_Pthreads(N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VDiff_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VDiff_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -4174,7 +4154,7 @@ static void* VDiff_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i] - yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4187,21 +4167,15 @@ static void VNeg_Pthreads(N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4214,18 +4188,13 @@ static void VNeg_Pthreads(N_Vector x, N_Vector z)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VNeg_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VNeg_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -4253,7 +4222,7 @@ static void* VNeg_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = -xd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4266,21 +4235,15 @@ static void VScaleSum_Pthreads(sunrealtype c, N_Vector x, N_Vector y, N_Vector z
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4295,18 +4258,13 @@ static void VScaleSum_Pthreads(sunrealtype c, N_Vector x, N_Vector y, N_Vector z
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VScaleSum_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VScaleSum_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -4337,7 +4295,7 @@ static void* VScaleSum_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = c * (xd[i] + yd[i]); }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4350,21 +4308,15 @@ static void VScaleDiff_Pthreads(sunrealtype c, N_Vector x, N_Vector y, N_Vector
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4379,18 +4331,13 @@ static void VScaleDiff_Pthreads(sunrealtype c, N_Vector x, N_Vector y, N_Vector
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VScaleDiff_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VScaleDiff_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -4421,7 +4368,7 @@ static void* VScaleDiff_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = c * (xd[i] - yd[i]); }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4434,21 +4381,15 @@ static void VLin1_Pthreads(sunrealtype a, N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4463,18 +4404,13 @@ static void VLin1_Pthreads(sunrealtype a, N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VLin1_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VLin1_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -4505,7 +4441,7 @@ static void* VLin1_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = (a * xd[i]) + yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4518,21 +4454,15 @@ static void VLin2_Pthreads(sunrealtype a, N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4547,18 +4477,13 @@ static void VLin2_Pthreads(sunrealtype a, N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VLin2_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VLin2_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -4589,7 +4514,7 @@ static void* VLin2_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = (a * xd[i]) - yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4602,21 +4527,15 @@ static void Vaxpy_Pthreads(sunrealtype a, N_Vector x, N_Vector y)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4630,18 +4549,13 @@ static void Vaxpy_Pthreads(sunrealtype a, N_Vector x, N_Vector y)
     thread_data[i].c1 = a;
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, Vaxpy_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, Vaxpy_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -4673,7 +4587,7 @@ static void* Vaxpy_PT(void* thread_data)
     for (i = start; i < end; i++) { yd[i] += xd[i]; }
 
     /* exit */
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   if (a == -ONE)
@@ -4681,13 +4595,13 @@ static void* Vaxpy_PT(void* thread_data)
     for (i = start; i < end; i++) { yd[i] -= xd[i]; }
 
     /* exit */
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   for (i = start; i < end; i++) { yd[i] += a * xd[i]; }
 
   /* return */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4700,21 +4614,15 @@ static void VScaleBy_Pthreads(sunrealtype a, N_Vector x)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4727,18 +4635,13 @@ static void VScaleBy_Pthreads(sunrealtype a, N_Vector x)
     /* pack thread data */
     thread_data[i].c1 = a;
     thread_data[i].v1 = NV_DATA_PT(x);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VScaleBy_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VScaleBy_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 
   return;
 }
@@ -4767,7 +4670,7 @@ static void* VScaleBy_PT(void* thread_data)
   for (i = start; i < end; i++) { xd[i] *= a; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -4783,23 +4686,17 @@ static void VSumVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* Y,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
+  pool        = NV_POOL_PT(X[0]);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* pack thread data, distribute loop indices, and create threads/call kernel */
+  /* pack thread data and distribute loop indices */
   for (i = 0; i < nthreads; i++)
   {
     nvInitThreadData(&thread_data[i]);
@@ -4810,18 +4707,13 @@ static void VSumVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* Y,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VSumVectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VSumVectorArray_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 }
 
 static void* VSumVectorArray_PT(void* thread_data)
@@ -4846,7 +4738,7 @@ static void* VSumVectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = xd[j] + yd[j]; }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VDiffVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* Y,
@@ -4856,23 +4748,17 @@ static void VDiffVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* Y,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
+  pool        = NV_POOL_PT(X[0]);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* pack thread data, distribute loop indices, and create threads/call kernel */
+  /* pack thread data and distribute loop indices */
   for (i = 0; i < nthreads; i++)
   {
     nvInitThreadData(&thread_data[i]);
@@ -4883,18 +4769,13 @@ static void VDiffVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* Y,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VDiffVectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VDiffVectorArray_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 }
 
 static void* VDiffVectorArray_PT(void* thread_data)
@@ -4919,7 +4800,7 @@ static void* VDiffVectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = xd[j] - yd[j]; }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VScaleSumVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
@@ -4929,23 +4810,17 @@ static void VScaleSumVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
+  pool        = NV_POOL_PT(X[0]);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* pack thread data, distribute loop indices, and create threads/call kernel */
+  /* pack thread data and distribute loop indices */
   for (i = 0; i < nthreads; i++)
   {
     nvInitThreadData(&thread_data[i]);
@@ -4957,18 +4832,13 @@ static void VScaleSumVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VScaleSumVectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VScaleSumVectorArray_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 }
 
 static void* VScaleSumVectorArray_PT(void* thread_data)
@@ -4995,7 +4865,7 @@ static void* VScaleSumVectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = c * (xd[j] + yd[j]); }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VScaleDiffVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
@@ -5005,23 +4875,17 @@ static void VScaleDiffVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
+  pool        = NV_POOL_PT(X[0]);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* pack thread data, distribute loop indices, and create threads/call kernel */
+  /* pack thread data and distribute loop indices */
   for (i = 0; i < nthreads; i++)
   {
     nvInitThreadData(&thread_data[i]);
@@ -5033,18 +4897,13 @@ static void VScaleDiffVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VScaleDiffVectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VScaleDiffVectorArray_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 }
 
 static void* VScaleDiffVectorArray_PT(void* thread_data)
@@ -5071,7 +4930,7 @@ static void* VScaleDiffVectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = c * (xd[j] - yd[j]); }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VLin1VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
@@ -5081,23 +4940,17 @@ static void VLin1VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
+  pool        = NV_POOL_PT(X[0]);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* pack thread data, distribute loop indices, and create threads/call kernel */
+  /* pack thread data and distribute loop indices */
   for (i = 0; i < nthreads; i++)
   {
     nvInitThreadData(&thread_data[i]);
@@ -5109,18 +4962,13 @@ static void VLin1VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VLin1VectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VLin1VectorArray_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 }
 
 static void* VLin1VectorArray_PT(void* thread_data)
@@ -5147,7 +4995,7 @@ static void* VLin1VectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = (a * xd[j]) + yd[j]; }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VLin2VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
@@ -5157,23 +5005,17 @@ static void VLin2VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
+  pool        = NV_POOL_PT(X[0]);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* pack thread data, distribute loop indices, and create threads/call kernel */
+  /* pack thread data and distribute loop indices */
   for (i = 0; i < nthreads; i++)
   {
     nvInitThreadData(&thread_data[i]);
@@ -5185,18 +5027,13 @@ static void VLin2VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VLin2VectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VLin2VectorArray_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 }
 
 static void* VLin2VectorArray_PT(void* thread_data)
@@ -5223,7 +5060,7 @@ static void* VLin2VectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = (a * xd[j]) - yd[j]; }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VaxpyVectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
@@ -5233,23 +5070,17 @@ static void VaxpyVectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
+  Pthreads_Pool* pool;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the worker pool */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
+  pool        = NV_POOL_PT(X[0]);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* pack thread data, distribute loop indices, and create threads/call kernel */
+  /* pack thread data and distribute loop indices */
   for (i = 0; i < nthreads; i++)
   {
     nvInitThreadData(&thread_data[i]);
@@ -5260,18 +5091,13 @@ static void VaxpyVectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
     thread_data[i].Y2   = Y;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VaxpyVectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, VaxpyVectorArray_PT);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  nvPoolEnd(pool);
 }
 
 static void* VaxpyVectorArray_PT(void* thread_data)
@@ -5297,7 +5123,7 @@ static void* VaxpyVectorArray_PT(void* thread_data)
       yd = NV_DATA_PT(my_data->Y2[i]);
       for (j = start; j < end; j++) { yd[j] += xd[j]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   if (a == -ONE)
@@ -5308,7 +5134,7 @@ static void* VaxpyVectorArray_PT(void* thread_data)
       yd = NV_DATA_PT(my_data->Y2[i]);
       for (j = start; j < end; j++) { yd[j] -= xd[j]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   for (i = 0; i < my_data->nvec; i++)
@@ -5317,7 +5143,7 @@ static void* VaxpyVectorArray_PT(void* thread_data)
     yd = NV_DATA_PT(my_data->Y2[i]);
     for (j = start; j < end; j++) { yd[j] += a * xd[j]; }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -5374,6 +5200,7 @@ static void nvInitThreadData(Pthreads_Data* thread_data)
   thread_data->v3           = NULL;
   thread_data->global_val   = NULL;
   thread_data->global_mutex = NULL;
+  thread_data->local_val    = NULL;
 
   thread_data->nvec  = ZERO;
   thread_data->nsum  = ZERO;
@@ -5383,6 +5210,369 @@ static void nvInitThreadData(Pthreads_Data* thread_data)
   thread_data->Y3    = NULL;
 }
 
+/* ----------------------------------------------------------------------------
+ * Attach a vector to the pool for the given context, number of threads, and
+ * affinity policy, creating the pool if it does not exist yet. Returns NULL if
+ * a new pool could not be created.
+ */
+
+static Pthreads_Pool* nvPoolAcquire(SUNContext sunctx, int num_threads,
+                                    SUNAffinity affinity)
+{
+  Pthreads_Pool* pool;
+
+  pthread_mutex_lock(&nv_pools_lock);
+
+  for (pool = nv_pools; pool != NULL; pool = pool->next)
+  {
+    if (pool->sunctx == sunctx && pool->num_threads == num_threads &&
+        pool->affinity == affinity)
+    {
+      pool->refcount++;
+      break;
+    }
+  }
+
+  if (pool == NULL)
+  {
+    pool = nvPoolCreate(sunctx, num_threads, affinity);
+    if (pool != NULL)
+    {
+      pool->next = nv_pools;
+      nv_pools   = pool;
+    }
+  }
+
+  pthread_mutex_unlock(&nv_pools_lock);
+
+  return pool;
+}
+
+/* ----------------------------------------------------------------------------
+ * Create a pool with num_threads - 1 persistent workers (the calling thread
+ * acts as thread 0). Unless the affinity policy is SUN_AFFINITY_NONE, each
+ * worker is pinned to a CPU. The calling thread belongs to the user and is not
+ * pinned. Returns NULL if memory or threads could not be created.
+ */
+
+static Pthreads_Pool* nvPoolCreate(SUNContext sunctx, int num_threads,
+                                   SUNAffinity affinity)
+{
+  int i, nalloc;
+  Pthreads_Pool* pool;
+
+  pool = (Pthreads_Pool*)malloc(sizeof(*pool));
+  if (pool == NULL) { return NULL; }
+
+  nalloc = SUNMAX(num_threads, 1);
+
+  pool->sunctx          = sunctx;
+  pool->num_threads     = num_threads;
+  pool->affinity        = affinity;
+  pool->num_workers     = 0;
+  pool->refcount        = 1;
+  pool->next            = NULL;
+  pool->workers         = NULL;
+  pool->thread_data     = NULL;
+  pool->partials_mem    = NULL;
+  pool->partials        = NULL;
+  pool->partials_stride = 0;
+  pool->work            = NULL;
+  pool->generation      = 0;
+  pool->pending         = 0;
+  pool->shutdown        = 0;
+
+  pthread_mutex_init(&pool->dispatch, NULL);
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->work_ready, NULL);
+  pthread_cond_init(&pool->work_done, NULL);
+
+  pool->thread_data = (Pthreads_Data*)malloc(nalloc * sizeof(Pthreads_Data));
+  if (pool->thread_data == NULL)
+  {
+    nvPoolFree(pool);
+    return NULL;
+  }
+  for (i = 0; i < nalloc; i++) { nvInitThreadData(&pool->thread_data[i]); }
+
+  /* reserve space for one partial value per thread */
+  if (nvPoolBegin(pool, 1) == NULL)
+  {
+    nvPoolFree(pool);
+    return NULL;
+  }
+  nvPoolEnd(pool);
+
+  /* record the available CPUs before any pool thread is pinned */
+  if (affinity != SUN_AFFINITY_NONE) { sunAffinityInit(); }
+
+  if (num_threads > 1)
+  {
+    pool->workers =
+      (Pthreads_Worker*)malloc((num_threads - 1) * sizeof(Pthreads_Worker));
+    if (pool->workers == NULL)
+    {
+      nvPoolFree(pool);
+      return NULL;
+    }
+
+    for (i = 0; i < num_threads - 1; i++)
+    {
+      pool->workers[i].pool = pool;
+      pool->workers[i].id   = i + 1;
+      if (pthread_create(&pool->workers[i].thread, NULL, nvPoolWorker,
+                         (void*)&pool->workers[i]))
+      {
+        nvPoolFree(pool);
+        return NULL;
+      }
+      pool->num_workers++;
+    }
+  }
+
+  return pool;
+}
+
+/* ----------------------------------------------------------------------------
+ * Attach another vector (e.g., a clone) to an existing pool
+ */
+
+static Pthreads_Pool* nvPoolRetain(Pthreads_Pool* pool)
+{
+  pthread_mutex_lock(&nv_pools_lock);
+  pool->refcount++;
+  pthread_mutex_unlock(&nv_pools_lock);
+  return pool;
+}
+
+/* ----------------------------------------------------------------------------
+ * Detach a vector from a pool, the last vector removes the pool from the list
+ * of pools and frees it
+ */
+
+static void nvPoolRelease(Pthreads_Pool* pool)
+{
+  int refcount;
+  Pthreads_Pool** link;
+
+  if (pool == NULL) { return; }
+
+  pthread_mutex_lock(&nv_pools_lock);
+  refcount = --pool->refcount;
+  if (refcount == 0)
+  {
+    for (link = &nv_pools; *link != NULL; link = &(*link)->next)
+    {
+      if (*link == pool)
+      {
+        *link = pool->next;
+        break;
+      }
+    }
+  }
+  pthread_mutex_unlock(&nv_pools_lock);
+
+  if (refcount == 0) { nvPoolFree(pool); }
+}
+
+/* ----------------------------------------------------------------------------
+ * Stop the workers of a pool that is no longer used and free the pool
+ */
+
+static void nvPoolFree(Pthreads_Pool* pool)
+{
+  int i;
+
+  /* wake the workers and tell them to exit */
+  pthread_mutex_lock(&pool->lock);
+  NV_ATOMIC_STORE_PT(&pool->shutdown, 1);
+  NV_ATOMIC_STORE_PT(&pool->generation, pool->generation + 1);
+  pthread_cond_broadcast(&pool->work_ready);
+  pthread_mutex_unlock(&pool->lock);
+
+  for (i = 0; i < pool->num_workers; i++)
+  {
+    pthread_join(pool->workers[i].thread, NULL);
+  }
+
+  pthread_cond_destroy(&pool->work_done);
+  pthread_cond_destroy(&pool->work_ready);
+  pthread_mutex_destroy(&pool->lock);
+  pthread_mutex_destroy(&pool->dispatch);
+
+  free(pool->workers);
+  free(pool->thread_data);
+  free(pool->partials_mem);
+  free(pool);
+}
+
+/* ----------------------------------------------------------------------------
+ * Acquire the pool thread data for an operation needing nvals partial
+ * (reduction) values per thread. Operations on vectors sharing a pool are
+ * serialized until nvPoolEnd is called. Returns NULL if the partials array
+ * could not be resized.
+ */
+
+static Pthreads_Data* nvPoolBegin(Pthreads_Pool* pool, int nvals)
+{
+  int per_line, stride, nalloc;
+  void* mem;
+  uintptr_t addr;
+
+  pthread_mutex_lock(&pool->dispatch);
+
+  if (nvals > pool->partials_stride)
+  {
+    /* round up the values per thread to a whole number of cache lines */
+    per_line = SUNMAX((int)(NV_CACHE_LINE_PT / sizeof(sunrealtype)), 1);
+    stride   = ((nvals + per_line - 1) / per_line) * per_line;
+    nalloc   = SUNMAX(pool->num_threads, 1);
+
+    mem = malloc(nalloc * stride * sizeof(sunrealtype) + NV_CACHE_LINE_PT);
+    if (mem == NULL)
+    {
+      pthread_mutex_unlock(&pool->dispatch);
+      return NULL;
+    }
+
+    /* align the start of the array to a cache line */
+    addr = ((uintptr_t)mem + NV_CACHE_LINE_PT - 1) &
+           ~((uintptr_t)NV_CACHE_LINE_PT - 1);
+
+    free(pool->partials_mem);
+    pool->partials_mem    = mem;
+    pool->partials        = (sunrealtype*)addr;
+    pool->partials_stride = stride;
+  }
+
+  return pool->thread_data;
+}
+
+/* ----------------------------------------------------------------------------
+ * Padded partial values for thread id
+ */
+
+static sunrealtype* nvPoolPartial(Pthreads_Pool* pool, int id)
+{
+  return pool->partials + (size_t)id * pool->partials_stride;
+}
+
+/* ----------------------------------------------------------------------------
+ * Execute a companion function on all threads and wait for completion. The
+ * workers are woken by incrementing the generation counter, the calling
+ * thread computes the thread 0 share, and then waits for the pending worker
+ * count to reach zero. Waiting threads poll before blocking so back-to-back
+ * operations avoid the cost of sleeping and waking.
+ */
+
+static void nvPoolRun(Pthreads_Pool* pool, void* (*work)(void*))
+{
+  int spin;
+
+  if (pool->num_threads < 1) { return; }
+
+  if (pool->num_workers > 0)
+  {
+    pthread_mutex_lock(&pool->lock);
+    pool->work = work;
+    NV_ATOMIC_STORE_PT(&pool->pending, pool->num_workers);
+    NV_ATOMIC_STORE_PT(&pool->generation, pool->generation + 1);
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+  }
+
+  work((void*)&pool->thread_data[0]);
+
+  if (pool->num_workers > 0)
+  {
+    for (spin = 0; spin < NV_SPIN_COUNT_PT; spin++)
+    {
+      if (NV_ATOMIC_LOAD_PT(&pool->pending) == 0) { break; }
+    }
+    if (spin == NV_SPIN_COUNT_PT)
+    {
+      pthread_mutex_lock(&pool->lock);
+      while (NV_ATOMIC_LOAD_PT(&pool->pending) != 0)
+      {
+        pthread_cond_wait(&pool->work_done, &pool->lock);
+      }
+      pthread_mutex_unlock(&pool->lock);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------------
+ * Release the pool thread data acquired with nvPoolBegin
+ */
+
+static void nvPoolEnd(Pthreads_Pool* pool)
+{
+  pthread_mutex_unlock(&pool->dispatch);
+}
+
+/* ----------------------------------------------------------------------------
+ * Main loop of a persistent worker thread
+ */
+
+static void* nvPoolWorker(void* worker_data)
+{
+  int spin, pending;
+  unsigned long seen;
+  Pthreads_Worker* worker;
+  Pthreads_Pool* pool;
+
+  worker = (Pthreads_Worker*)worker_data;
+  pool   = worker->pool;
+  seen   = 0;
+
+  sunAffinityPin(pool->affinity, worker->id, pool->num_threads, NULL);
+
+  for (;;)
+  {
+    /* wait for new work (or shutdown) to be posted */
+    for (spin = 0; spin < NV_SPIN_COUNT_PT; spin++)
+    {
+      if (NV_ATOMIC_LOAD_PT(&pool->generation) != seen) { break; }
+    }
+    if (spin == NV_SPIN_COUNT_PT)
+    {
+      pthread_mutex_lock(&pool->lock);
+      while (NV_ATOMIC_LOAD_PT(&pool->generation) == seen)
+      {
+        pthread_cond_wait(&pool->work_ready, &pool->lock);
+      }
+      pthread_mutex_unlock(&pool->lock);
+    }
+    seen = NV_ATOMIC_LOAD_PT(&pool->generation);
+
+    if (NV_ATOMIC_LOAD_PT(&pool->shutdown)) { break; }
+
+    /* compute this thread's share */
+    pool->work((void*)&pool->thread_data[worker->id]);
+
+    /* the last worker to finish wakes the calling thread */
+    if (NV_SPIN_COUNT_PT > 0)
+    {
+      pending = NV_ATOMIC_DEC_PT(&pool->pending);
+      if (pending == 0)
+      {
+        pthread_mutex_lock(&pool->lock);
+        pthread_cond_signal(&pool->work_done);
+        pthread_mutex_unlock(&pool->lock);
+      }
+    }
+    else
+    {
+      pthread_mutex_lock(&pool->lock);
+      pending = NV_ATOMIC_DEC_PT(&pool->pending);
+      if (pending == 0) { pthread_cond_signal(&pool->work_done); }
+      pthread_mutex_unlock(&pool->lock);
+    }
+  }
+
+  return (NULL);
+}
+
 /*
  * -----------------------------------------------------------------
  * Enable / Disable fused and vector array operations
@@ -5394,9 +5584,11 @@ SUNErrCode N_VEnableFusedOps_Pthreads(N_Vector v, sunbooleantype tf)
   if (tf)
   {
     /* enable all fused vector operations */
-    v->ops->nvlinearcombination = N_VLinearCombination_Pthreads;
-    v->ops->nvscaleaddmulti     = N_VScaleAddMulti_Pthreads;
-    v->ops->nvdotprodmulti      = N_VDotProdMulti_Pthreads;
+    v->ops->nvlinearcombination         = N_VLinearCombination_Pthreads;
+    v->ops->nvscaleaddmulti             = N_VScaleAddMulti_Pthreads;
+    v->ops->nvdotprodmulti              = N_VDotProdMulti_Pthreads;
+    v->ops->nvlinearsumwrmsnorm         = N_VLinearSumWrmsNorm_Pthreads;
+    v->ops->nvlinearcombinationwrmsnorm = N_VLinearCombinationWrmsNorm_Pthreads;
     /* enable all vector array operations */
     v->ops->nvlinearsumvectorarray     = N_VLinearSumVectorArray_Pthreads;
     v->ops->nvscalevectorarray         = N_VScaleVectorArray_Pthreads;
@@ -5412,9 +5604,11 @@ SUNErrCode N_VEnableFusedOps_Pthreads(N_Vector v, sunbooleantype tf)
   else
   {
     /* disable all fused vector operations */
-    v->ops->nvlinearcombination = NULL;
-    v->ops->nvscaleaddmulti     = NULL;
-    v->ops->nvdotprodmulti      = NULL;
+    v->ops->nvlinearcombination         = NULL;
+    v->ops->nvscaleaddmulti             = NULL;
+    v->ops->nvdotprodmulti              = NULL;
+    v->ops->nvlinearsumwrmsnorm         = NULL;
+    v->ops->nvlinearcombinationwrmsnorm = NULL;
     /* disable all vector array operations */
     v->ops->nvlinearsumvectorarray         = NULL;
     v->ops->nvscalevectorarray             = NULL;
@@ -5450,6 +5644,20 @@ SUNErrCode N_VEnableDotProdMulti_Pthreads(N_Vector v, sunbooleantype tf)
   return SUN_SUCCESS;
 }
 
+SUNErrCode N_VEnableLinearSumWrmsNorm_Pthreads(N_Vector v, sunbooleantype tf)
+{
+  v->ops->nvlinearsumwrmsnorm = tf ? N_VLinearSumWrmsNorm_Pthreads : NULL;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnableLinearCombinationWrmsNorm_Pthreads(N_Vector v,
+                                                       sunbooleantype tf)
+{
+  v->ops->nvlinearcombinationwrmsnorm =
+    tf ? N_VLinearCombinationWrmsNorm_Pthreads : NULL;
+  return SUN_SUCCESS;
+}
+
 SUNErrCode N_VEnableLinearSumVectorArray_Pthreads(N_Vector v, sunbooleantype tf)
 {
   v->ops->nvlinearsumvectorarray = tf ? N_VLinearSumVectorArray_Pthreads : NULL;
@@ -5496,3 +5704,93 @@ SUNErrCode N_VEnableLinearCombinationVectorArray_Pthreads(N_Vector v,
     tf ? N_VLinearCombinationVectorArray_Pthreads : NULL;
   return SUN_SUCCESS;
 }
+
+/*
+ * -----------------------------------------------------------------
+ * Enable / Disable reproducible reductions
+ * -----------------------------------------------------------------
+ */
+
+SUNErrCode N_VEnableReproducibleReductions_Pthreads(N_Vector v,
+                                                    sunbooleantype tf)
+{
+  NV_REPRODUCIBLE_PT(v) = tf;
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Computes a sum over x (and y and id if not NULL) by chunks whose bounds only
+ * depend on the vector length. The chunks are split between the threads and
+ * the chunk sums are combined with a fixed tree, so the result does not depend
+ * on the number of threads.
+ */
+
+static sunrealtype VSumRepro_Pthreads(SUNReproSumType type, N_Vector x,
+                                      N_Vector y, N_Vector id)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  sunindextype nchunks = SUN_REPRO_NCHUNKS;
+  int i, nthreads;
+  Pthreads_Pool* pool;
+  Pthreads_Data* thread_data;
+  sunrealtype partial[SUN_REPRO_NCHUNKS];
+
+  /* get thread data structs from the worker pool */
+  nthreads    = NV_NUM_THREADS_PT(x);
+  pool        = NV_POOL_PT(x);
+  thread_data = nvPoolBegin(pool, 0);
+  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
+
+  for (i = 0; i < nthreads; i++)
+  {
+    /* initialize thread data */
+    nvInitThreadData(&thread_data[i]);
+
+    /* compute start and end chunk index for thread */
+    nvSplitLoop(i, &nthreads, &nchunks, &thread_data[i].start,
+                &thread_data[i].end);
+
+    /* pack thread data, the sum type is passed in nvec */
+    thread_data[i].nvec       = (int)type;
+    thread_data[i].x1         = x;
+    thread_data[i].v1         = NV_DATA_PT(x);
+    thread_data[i].v2         = y ? NV_DATA_PT(y) : NULL;
+    thread_data[i].v3         = id ? NV_DATA_PT(id) : NULL;
+    thread_data[i].global_val = partial;
+  }
+
+  /* run companion function on the worker pool */
+  nvPoolRun(pool, nvSumReproPt);
+
+  /* clean up */
+  nvPoolEnd(pool);
+
+  /* combine chunk sums */
+  return (sunReproCombine(partial));
+}
+
+/* ----------------------------------------------------------------------------
+ * Pthread companion function to VSumRepro_Pthreads
+ */
+
+static void* nvSumReproPt(void* thread_data)
+{
+  sunindextype k;
+  Pthreads_Data* my_data;
+
+  /* extract thread data */
+  my_data = (Pthreads_Data*)thread_data;
+
+  /* compute the sums of the chunks assigned to this thread */
+  for (k = my_data->start; k < my_data->end; k++)
+  {
+    my_data->global_val[k] = sunReproChunkSum((SUNReproSumType)my_data->nvec,
+                                              NV_LENGTH_PT(my_data->x1), (int)k,
+                                              my_data->v1, my_data->v2,
+                                              my_data->v3);
+  }
+
+  /* exit */
+  return (NULL);
+}
@@ -25,13 +25,22 @@
 #include <sundials/sundials_core.h>
 #include <sundials/sundials_errors.h>
 
+#include "nvector_serial_kernels.h"
 #include "sundials_macros.h"
+#include "sundials_nvector_deferred.h"
+#include "sundials_nvector_multivec.h"
 
 #define ZERO   SUN_RCONST(0.0)
 #define HALF   SUN_RCONST(0.5)
 #define ONE    SUN_RCONST(1.0)
 #define ONEPT5 SUN_RCONST(1.5)
 
+#define NV_DEFERRED_S(v) (NV_CONTENT_S(v)->deferred)
+
+/* number of elements per block in the fused norm operations, the block of z
+   is still in cache when its weighted square sum is computed */
+#define NV_NORM_BLOCK_S 1024
+
 /* Private functions for special cases of vector operations */
 static void VCopy_Serial(N_Vector x, N_Vector z);             /* z=x       */
 static void VSum_Serial(N_Vector x, N_Vector y, N_Vector z);  /* z=x+y     */
@@ -64,6 +73,22 @@ static void VLin2VectorArray_Serial(int nvec, sunrealtype a, N_Vector* X,
 static void VaxpyVectorArray_Serial(int nvec, sunrealtype a, N_Vector* X,
                                     N_Vector* Y); /* Y <- aX+Y */
 
+/* Private functions for deferred operations */
+static sunbooleantype VDefer_Serial(SUNDeferredOpType type, sunrealtype a,
+                                    sunrealtype b, N_Vector x, N_Vector y,
+                                    N_Vector z);
+static void VExecute_Serial(SUNDeferredOps d);
+static void VFlush_Serial(N_Vector v);
+static void VFlushArray_Serial(int nvec, N_Vector* V);
+static void VReady_Serial(N_Vector v);
+static void VReadyArray_Serial(int nvec, N_Vector* V);
+static SUNDeferredOps VFuse_Serial(N_Vector x, N_Vector y);
+static sunbooleantype VOverlap_Serial(N_Vector u, N_Vector v);
+static sunbooleantype VAlias_Serial(N_Vector t, N_Vector v);
+
+/* Private function for vector arrays stored in a single block */
+static sunrealtype* VBlock_Serial(int nvec, N_Vector* X);
+
 /*
  * -----------------------------------------------------------------
  * exported functions
@@ -100,6 +125,8 @@ N_Vector N_VNewEmpty_Serial(sunindextype length, SUNContext sunctx)
   v->ops->nvgetlength       = N_VGetLength_Serial;
   v->ops->nvgetlocallength  = N_VGetLength_Serial;
 
+  v->ops->nvclonevectorarraycontiguous = N_VCloneVectorArrayContiguous_Serial;
+
   /* standard vector operations */
   v->ops->nvlinearsum    = N_VLinearSum_Serial;
   v->ops->nvconst        = N_VConst_Serial;
@@ -158,6 +185,7 @@ N_Vector N_VNewEmpty_Serial(sunindextype length, SUNContext sunctx)
   content->length   = length;
   content->own_data = SUNFALSE;
   content->data     = NULL;
+  content->deferred = NULL;
 
   return (v);
 }
@@ -219,6 +247,37 @@ N_Vector N_VMake_Serial(sunindextype length, sunrealtype* v_data,
   return (v);
 }
 
+/* ----------------------------------------------------------------------------
+ * Function to create a serial N_Vector that aliases the elements
+ * [offset, offset + length) of the vector w without copying them. The view
+ * does not own its data and has the same operations as w, clones of the view
+ * are serial vectors of the view length with their own data.
+ */
+
+N_Vector N_VMakeView_Serial(N_Vector w, sunindextype offset, sunindextype length)
+{
+  SUNFunctionBegin(w->sunctx);
+  N_Vector v;
+
+  SUNAssertNull(offset >= 0, SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssertNull(length >= 0, SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssertNull(offset + length <= NV_LENGTH_S(w), SUN_ERR_ARG_OUTOFRANGE);
+
+  v = NULL;
+  v = N_VCloneEmpty_Serial(w);
+  SUNCheckLastErrNull();
+
+  /* the view shares the recorder of w attached by the clone, so pending
+     operations writing w are executed before the view is read */
+
+  /* Attach data */
+  NV_LENGTH_S(v)   = length;
+  NV_OWN_DATA_S(v) = SUNFALSE;
+  NV_DATA_S(v)     = (length > 0) ? NV_DATA_S(w) + offset : NULL;
+
+  return (v);
+}
+
 /* ----------------------------------------------------------------
  * Returns vector type ID. Used to identify vector implementation
  * from abstract N_Vector interface.
@@ -255,6 +314,8 @@ void N_VPrintFile_Serial(N_Vector x, FILE* outfile)
 
   xd = NULL;
 
+  VReady_Serial(x);
+
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
 
@@ -295,6 +356,7 @@ N_Vector N_VCloneEmpty_Serial(N_Vector w)
   content->length   = NV_LENGTH_S(w);
   content->own_data = SUNFALSE;
   content->data     = NULL;
+  content->deferred = sunDeferredRetain(NV_DEFERRED_S(w));
 
   return (v);
 }
@@ -327,6 +389,46 @@ N_Vector N_VClone_Serial(N_Vector w)
   return (v);
 }
 
+/* ----------------------------------------------------------------------------
+ * Function to clone an array of vectors whose data are the columns of a single
+ * column-major block. The block is owned by the first vector, so the vectors
+ * must be destroyed together, e.g., with N_VDestroyVectorArray.
+ */
+
+N_Vector* N_VCloneVectorArrayContiguous_Serial(int count, N_Vector w)
+{
+  SUNFunctionBegin(w->sunctx);
+  int j;
+  N_Vector* vs;
+  sunrealtype* data;
+  sunindextype length;
+
+  SUNAssertNull(count > 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  vs = NULL;
+  vs = N_VCloneEmptyVectorArray(count, w);
+  SUNCheckLastErrNull();
+
+  length = NV_LENGTH_S(w);
+
+  /* Create data */
+  data = NULL;
+  if (length > 0)
+  {
+    data = (sunrealtype*)malloc(count * length * sizeof(sunrealtype));
+    SUNAssertNull(data, SUN_ERR_MALLOC_FAIL);
+
+    /* Attach data */
+    for (j = 0; j < count; j++)
+    {
+      NV_OWN_DATA_S(vs[j]) = (j == 0) ? SUNTRUE : SUNFALSE;
+      NV_DATA_S(vs[j])     = data + j * length;
+    }
+  }
+
+  return (vs);
+}
+
 void N_VDestroy_Serial(N_Vector v)
 {
   if (v == NULL) { return; }
@@ -334,6 +436,11 @@ void N_VDestroy_Serial(N_Vector v)
   /* free content */
   if (v->content != NULL)
   {
+    /* execute pending operations that may use the data and free the recorder */
+    VFlush_Serial(v);
+    sunDeferredRelease(NV_DEFERRED_S(v));
+    NV_DEFERRED_S(v) = NULL;
+
     /* free data array if it's owned by the vector */
     if (NV_OWN_DATA_S(v) && NV_DATA_S(v) != NULL)
     {
@@ -371,11 +478,13 @@ void N_VSpace_Serial(N_Vector v, sunindextype* lrw, sunindextype* liw)
 
 sunrealtype* N_VGetArrayPointer_Serial(N_Vector v)
 {
+  VFlush_Serial(v);
   return ((sunrealtype*)NV_DATA_S(v));
 }
 
 void N_VSetArrayPointer_Serial(sunrealtype* v_data, N_Vector v)
 {
+  VFlush_Serial(v);
   if (NV_LENGTH_S(v) > 0) { NV_DATA_S(v) = v_data; }
 
   return;
@@ -384,13 +493,15 @@ void N_VSetArrayPointer_Serial(sunrealtype* v_data, N_Vector v)
 void N_VLinearSum_Serial(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
                          N_Vector z)
 {
-  sunindextype i, N;
+  sunindextype N;
   sunrealtype c, *xd, *yd, *zd;
   N_Vector v1, v2;
   sunbooleantype test;
 
   xd = yd = zd = NULL;
 
+  if (VDefer_Serial(sunDeferredLinearSumType(a, b), a, b, x, y, z)) { return; }
+
   if ((b == ONE) && (z == y))
   { /* BLAS usage: axpy y <- ax+y */
     Vaxpy_Serial(a, x, y);
@@ -471,7 +582,7 @@ void N_VLinearSum_Serial(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
   yd = NV_DATA_S(y);
   zd = NV_DATA_S(z);
 
-  for (i = 0; i < N; i++) { zd[i] = (a * xd[i]) + (b * yd[i]); }
+  nvSerialGetKernels()->axpby(N, a, xd, b, yd, zd);
 
   return;
 }
@@ -483,6 +594,8 @@ void N_VConst_Serial(sunrealtype c, N_Vector z)
 
   zd = NULL;
 
+  if (VDefer_Serial(SUN_DEFERRED_CONST, c, ZERO, NULL, NULL, z)) { return; }
+
   N  = NV_LENGTH_S(z);
   zd = NV_DATA_S(z);
 
@@ -498,6 +611,8 @@ void N_VProd_Serial(N_Vector x, N_Vector y, N_Vector z)
 
   xd = yd = zd = NULL;
 
+  if (VDefer_Serial(SUN_DEFERRED_PROD, ZERO, ZERO, x, y, z)) { return; }
+
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
   yd = NV_DATA_S(y);
@@ -515,6 +630,8 @@ void N_VDiv_Serial(N_Vector x, N_Vector y, N_Vector z)
 
   xd = yd = zd = NULL;
 
+  if (VDefer_Serial(SUN_DEFERRED_DIV, ZERO, ZERO, x, y, z)) { return; }
+
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
   yd = NV_DATA_S(y);
@@ -527,11 +644,13 @@ void N_VDiv_Serial(N_Vector x, N_Vector y, N_Vector z)
 
 void N_VScale_Serial(sunrealtype c, N_Vector x, N_Vector z)
 {
-  sunindextype i, N;
+  sunindextype N;
   sunrealtype *xd, *zd;
 
   xd = zd = NULL;
 
+  if (VDefer_Serial(SUN_DEFERRED_SCALE, c, ZERO, x, NULL, z)) { return; }
+
   if (z == x)
   { /* BLAS usage: scale x <- cx */
     VScaleBy_Serial(c, x);
@@ -545,7 +664,7 @@ void N_VScale_Serial(sunrealtype c, N_Vector x, N_Vector z)
     N  = NV_LENGTH_S(x);
     xd = NV_DATA_S(x);
     zd = NV_DATA_S(z);
-    for (i = 0; i < N; i++) { zd[i] = c * xd[i]; }
+    nvSerialGetKernels()->scale(N, c, xd, zd);
   }
 
   return;
@@ -558,6 +677,8 @@ void N_VAbs_Serial(N_Vector x, N_Vector z)
 
   xd = zd = NULL;
 
+  if (VDefer_Serial(SUN_DEFERRED_ABS, ZERO, ZERO, x, NULL, z)) { return; }
+
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
   zd = NV_DATA_S(z);
@@ -574,6 +695,8 @@ void N_VInv_Serial(N_Vector x, N_Vector z)
 
   xd = zd = NULL;
 
+  if (VDefer_Serial(SUN_DEFERRED_INV, ZERO, ZERO, x, NULL, z)) { return; }
+
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
   zd = NV_DATA_S(z);
@@ -590,6 +713,8 @@ void N_VAddConst_Serial(N_Vector x, sunrealtype b, N_Vector z)
 
   xd = zd = NULL;
 
+  if (VDefer_Serial(SUN_DEFERRED_ADDCONST, ZERO, b, x, NULL, z)) { return; }
+
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
   zd = NV_DATA_S(z);
@@ -601,8 +726,9 @@ void N_VAddConst_Serial(N_Vector x, sunrealtype b, N_Vector z)
 
 sunrealtype N_VDotProd_Serial(N_Vector x, N_Vector y)
 {
-  sunindextype i, N;
+  sunindextype N, start, end;
   sunrealtype sum, *xd, *yd;
+  SUNDeferredOps d;
 
   sum = ZERO;
   xd = yd = NULL;
@@ -611,15 +737,30 @@ sunrealtype N_VDotProd_Serial(N_Vector x, N_Vector y)
   xd = NV_DATA_S(x);
   yd = NV_DATA_S(y);
 
-  for (i = 0; i < N; i++) { sum += xd[i] * yd[i]; }
+  /* fuse pending operations writing x or y into the reduction */
+  d = VFuse_Serial(x, y);
+  if (d)
+  {
+    for (start = 0; start < N; start += SUN_DEFERRED_BLOCK)
+    {
+      end = SUNMIN(start + SUN_DEFERRED_BLOCK, N);
+      sunDeferredRunBlock(d, NV_DATA_S(d->target), start, end);
+      sum += nvSerialGetKernels()->dot(end - start, xd + start, yd + start);
+    }
+    sunDeferredClear(d);
+    return (sum);
+  }
+
+  sum = nvSerialGetKernels()->dot(N, xd, yd);
 
   return (sum);
 }
 
 sunrealtype N_VMaxNorm_Serial(N_Vector x)
 {
-  sunindextype i, N;
+  sunindextype i, N, start, end;
   sunrealtype max, *xd;
+  SUNDeferredOps d;
 
   max = ZERO;
   xd  = NULL;
@@ -627,6 +768,23 @@ sunrealtype N_VMaxNorm_Serial(N_Vector x)
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
 
+  /* fuse pending operations writing x into the reduction */
+  d = VFuse_Serial(x, NULL);
+  if (d)
+  {
+    for (start = 0; start < N; start += SUN_DEFERRED_BLOCK)
+    {
+      end = SUNMIN(start + SUN_DEFERRED_BLOCK, N);
+      sunDeferredRunBlock(d, xd, start, end);
+      for (i = start; i < end; i++)
+      {
+        if (SUNRabs(xd[i]) > max) { max = SUNRabs(xd[i]); }
+      }
+    }
+    sunDeferredClear(d);
+    return (max);
+  }
+
   for (i = 0; i < N; i++)
   {
     if (SUNRabs(xd[i]) > max) { max = SUNRabs(xd[i]); }
@@ -646,8 +804,9 @@ sunrealtype N_VWrmsNorm_Serial(N_Vector x, N_Vector w)
 
 sunrealtype N_VWSqrSumLocal_Serial(N_Vector x, N_Vector w)
 {
-  sunindextype i, N;
-  sunrealtype sum, prodi, *xd, *wd;
+  sunindextype N, start, end;
+  sunrealtype sum, *xd, *wd;
+  SUNDeferredOps d;
 
   sum = ZERO;
   xd = wd = NULL;
@@ -656,12 +815,22 @@ sunrealtype N_VWSqrSumLocal_Serial(N_Vector x, N_Vector w)
   xd = NV_DATA_S(x);
   wd = NV_DATA_S(w);
 
-  for (i = 0; i < N; i++)
+  /* fuse pending operations writing x or w into the reduction */
+  d = VFuse_Serial(x, w);
+  if (d)
   {
-    prodi = xd[i] * wd[i];
-    sum += SUNSQR(prodi);
+    for (start = 0; start < N; start += SUN_DEFERRED_BLOCK)
+    {
+      end = SUNMIN(start + SUN_DEFERRED_BLOCK, N);
+      sunDeferredRunBlock(d, NV_DATA_S(d->target), start, end);
+      sum += nvSerialGetKernels()->wsqrsum(end - start, xd + start, wd + start);
+    }
+    sunDeferredClear(d);
+    return (sum);
   }
 
+  sum = nvSerialGetKernels()->wsqrsum(N, xd, wd);
+
   return (sum);
 }
 
@@ -682,6 +851,10 @@ sunrealtype N_VWSqrSumMaskLocal_Serial(N_Vector x, N_Vector w, N_Vector id)
   sum = ZERO;
   xd = wd = idd = NULL;
 
+  VReady_Serial(x);
+  VReady_Serial(w);
+  VReady_Serial(id);
+
   N   = NV_LENGTH_S(x);
   xd  = NV_DATA_S(x);
   wd  = NV_DATA_S(w);
@@ -701,14 +874,34 @@ sunrealtype N_VWSqrSumMaskLocal_Serial(N_Vector x, N_Vector w, N_Vector id)
 
 sunrealtype N_VMin_Serial(N_Vector x)
 {
-  sunindextype i, N;
+  sunindextype i, N, start, end;
   sunrealtype min, *xd;
+  SUNDeferredOps d;
 
   xd = NULL;
 
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
 
+  /* fuse pending operations writing x into the reduction */
+  d = VFuse_Serial(x, NULL);
+  if (d)
+  {
+    min = SUN_BIG_REAL;
+    for (start = 0; start < N; start += SUN_DEFERRED_BLOCK)
+    {
+      end = SUNMIN(start + SUN_DEFERRED_BLOCK, N);
+      sunDeferredRunBlock(d, xd, start, end);
+      if (start == 0) { min = xd[0]; }
+      for (i = start; i < end; i++)
+      {
+        if (xd[i] < min) { min = xd[i]; }
+      }
+    }
+    sunDeferredClear(d);
+    return (min);
+  }
+
   min = xd[0];
 
   for (i = 1; i < N; i++)
@@ -727,6 +920,9 @@ sunrealtype N_VWL2Norm_Serial(N_Vector x, N_Vector w)
   sum = ZERO;
   xd = wd = NULL;
 
+  VReady_Serial(x);
+  VReady_Serial(w);
+
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
   wd = NV_DATA_S(w);
@@ -748,6 +944,8 @@ sunrealtype N_VL1Norm_Serial(N_Vector x)
   sum = ZERO;
   xd  = NULL;
 
+  VReady_Serial(x);
+
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
 
@@ -763,6 +961,8 @@ void N_VCompare_Serial(sunrealtype c, N_Vector x, N_Vector z)
 
   xd = zd = NULL;
 
+  if (VDefer_Serial(SUN_DEFERRED_COMPARE, c, ZERO, x, NULL, z)) { return; }
+
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
   zd = NV_DATA_S(z);
@@ -780,6 +980,9 @@ sunbooleantype N_VInvTest_Serial(N_Vector x, N_Vector z)
 
   xd = zd = NULL;
 
+  VReady_Serial(x);
+  VFlush_Serial(z);
+
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
   zd = NV_DATA_S(z);
@@ -803,6 +1006,10 @@ sunbooleantype N_VConstrMask_Serial(N_Vector c, N_Vector x, N_Vector m)
 
   cd = xd = md = NULL;
 
+  VReady_Serial(c);
+  VReady_Serial(x);
+  VFlush_Serial(m);
+
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
   cd = NV_DATA_S(c);
@@ -835,6 +1042,9 @@ sunrealtype N_VMinQuotient_Serial(N_Vector num, N_Vector denom)
 
   nd = dd = NULL;
 
+  VReady_Serial(num);
+  VReady_Serial(denom);
+
   N  = NV_LENGTH_S(num);
   nd = NV_DATA_S(num);
   dd = NV_DATA_S(denom);
@@ -871,9 +1081,10 @@ SUNErrCode N_VLinearCombination_Serial(int nvec, sunrealtype* c, N_Vector* X,
   SUNFunctionBegin(X[0]->sunctx);
 
   int i;
-  sunindextype j, N;
+  sunindextype N;
   sunrealtype* zd = NULL;
   sunrealtype* xd = NULL;
+  const NVSerialKernels* kn;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -894,9 +1105,31 @@ SUNErrCode N_VLinearCombination_Serial(int nvec, sunrealtype* c, N_Vector* X,
     return SUN_SUCCESS;
   }
 
-  /* get vector length and data array */
+  /* execute pending operations on the vectors */
+  VReadyArray_Serial(nvec, X);
+  VFlush_Serial(z);
+
+  /* get vector length, data array, and kernels */
   N  = NV_LENGTH_S(z);
   zd = NV_DATA_S(z);
+  kn = nvSerialGetKernels();
+
+  /*
+   * X[0] = c[0] * X[0] + sum{ c[i] * X[i] } or z = sum{ c[i] * X[i] } with the
+   * X[i] (other than z) stored in a single block
+   */
+  if (X[0] == z) { xd = VBlock_Serial(nvec - 1, X + 1); }
+  else { xd = VBlock_Serial(nvec, X); }
+
+  if (xd != NULL)
+  {
+    i = (X[0] == z) ? 1 : 0;
+    if (!sunMultiVecOverlaps(zd, N, xd, (nvec - i) * N))
+    {
+      sunMultiVecGemvN(N, nvec - i, xd, N, c + i, (i == 1) ? c[0] : ZERO, zd);
+      return SUN_SUCCESS;
+    }
+  }
 
   /*
    * X[0] += c[i]*X[i], i = 1,...,nvec-1
@@ -906,7 +1139,7 @@ SUNErrCode N_VLinearCombination_Serial(int nvec, sunrealtype* c, N_Vector* X,
     for (i = 1; i < nvec; i++)
     {
       xd = NV_DATA_S(X[i]);
-      for (j = 0; j < N; j++) { zd[j] += c[i] * xd[j]; }
+      kn->axpy(N, c[i], xd, zd);
     }
     return SUN_SUCCESS;
   }
@@ -916,11 +1149,11 @@ SUNErrCode N_VLinearCombination_Serial(int nvec, sunrealtype* c, N_Vector* X,
    */
   if (X[0] == z)
   {
-    for (j = 0; j < N; j++) { zd[j] *= c[0]; }
+    kn->scale(N, c[0], zd, zd);
     for (i = 1; i < nvec; i++)
     {
       xd = NV_DATA_S(X[i]);
-      for (j = 0; j < N; j++) { zd[j] += c[i] * xd[j]; }
+      kn->axpy(N, c[i], xd, zd);
     }
     return SUN_SUCCESS;
   }
@@ -929,11 +1162,11 @@ SUNErrCode N_VLinearCombination_Serial(int nvec, sunrealtype* c, N_Vector* X,
    * z = sum{ c[i] * X[i] }, i = 0,...,nvec-1
    */
   xd = NV_DATA_S(X[0]);
-  for (j = 0; j < N; j++) { zd[j] = c[0] * xd[j]; }
+  kn->scale(N, c[0], xd, zd);
   for (i = 1; i < nvec; i++)
   {
     xd = NV_DATA_S(X[i]);
-    for (j = 0; j < N; j++) { zd[j] += c[i] * xd[j]; }
+    kn->axpy(N, c[i], xd, zd);
   }
   return SUN_SUCCESS;
 }
@@ -943,10 +1176,11 @@ SUNErrCode N_VScaleAddMulti_Serial(int nvec, sunrealtype* a, N_Vector x,
 {
   SUNFunctionBegin(x->sunctx);
   int i;
-  sunindextype j, N;
+  sunindextype N;
   sunrealtype* xd = NULL;
   sunrealtype* yd = NULL;
   sunrealtype* zd = NULL;
+  const NVSerialKernels* kn;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -959,9 +1193,26 @@ SUNErrCode N_VScaleAddMulti_Serial(int nvec, sunrealtype* a, N_Vector x,
     return SUN_SUCCESS;
   }
 
-  /* get vector length and data array */
+  /* execute pending operations on the vectors */
+  VReady_Serial(x);
+  VReadyArray_Serial(nvec, Y);
+  VFlushArray_Serial(nvec, Z);
+
+  /* get vector length, data array, and kernels */
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
+  kn = nvSerialGetKernels();
+
+  /*
+   * Z[i][j] = Y[i][j] + a[i] * x[j] with Y and Z stored in blocks
+   */
+  yd = VBlock_Serial(nvec, Y);
+  zd = (Y == Z) ? yd : VBlock_Serial(nvec, Z);
+  if (yd != NULL && zd != NULL)
+  {
+    sunMultiVecScaleAdd(N, nvec, a, xd, yd, N, zd, N);
+    return SUN_SUCCESS;
+  }
 
   /*
    * Y[i][j] += a[i] * x[j]
@@ -971,7 +1222,7 @@ SUNErrCode N_VScaleAddMulti_Serial(int nvec, sunrealtype* a, N_Vector x,
     for (i = 0; i < nvec; i++)
     {
       yd = NV_DATA_S(Y[i]);
-      for (j = 0; j < N; j++) { yd[j] += a[i] * xd[j]; }
+      kn->axpy(N, a[i], xd, yd);
     }
     return SUN_SUCCESS;
   }
@@ -983,7 +1234,7 @@ SUNErrCode N_VScaleAddMulti_Serial(int nvec, sunrealtype* a, N_Vector x,
   {
     yd = NV_DATA_S(Y[i]);
     zd = NV_DATA_S(Z[i]);
-    for (j = 0; j < N; j++) { zd[j] = a[i] * xd[j] + yd[j]; }
+    kn->axpby(N, a[i], xd, ONE, yd, zd);
   }
   return SUN_SUCCESS;
 }
@@ -993,9 +1244,10 @@ SUNErrCode N_VDotProdMulti_Serial(int nvec, N_Vector x, N_Vector* Y,
 {
   SUNFunctionBegin(x->sunctx);
   int i;
-  sunindextype j, N;
+  sunindextype N;
   sunrealtype* xd = NULL;
   sunrealtype* yd = NULL;
+  const NVSerialKernels* kn;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -1008,18 +1260,116 @@ SUNErrCode N_VDotProdMulti_Serial(int nvec, N_Vector x, N_Vector* Y,
     return SUN_SUCCESS;
   }
 
-  /* get vector length and data array */
+  /* execute pending operations on the vectors */
+  VReady_Serial(x);
+  VReadyArray_Serial(nvec, Y);
+
+  /* get vector length, data array, and kernels */
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
+  kn = nvSerialGetKernels();
+
+  /* compute multiple dot products with Y stored in a block */
+  yd = VBlock_Serial(nvec, Y);
+  if (yd != NULL)
+  {
+    sunMultiVecGemvT(N, nvec, yd, N, xd, dotprods);
+    return SUN_SUCCESS;
+  }
 
   /* compute multiple dot products */
   for (i = 0; i < nvec; i++)
   {
     yd          = NV_DATA_S(Y[i]);
-    dotprods[i] = ZERO;
-    for (j = 0; j < N; j++) { dotprods[i] += xd[j] * yd[j]; }
+    dotprods[i] = kn->dot(N, xd, yd);
+  }
+
+  return SUN_SUCCESS;
+}
+
+sunrealtype N_VLinearSumWrmsNorm_Serial(sunrealtype a, N_Vector x,
+                                        sunrealtype b, N_Vector y, N_Vector z,
+                                        N_Vector w)
+{
+  sunindextype N, start, end;
+  sunrealtype sum, *xd, *yd, *zd, *wd;
+  const NVSerialKernels* kn;
+
+  sum = ZERO;
+  xd = yd = zd = wd = NULL;
+
+  /* execute pending operations on the vectors */
+  VReady_Serial(x);
+  VReady_Serial(y);
+  VReady_Serial(w);
+  VFlush_Serial(z);
+
+  N  = NV_LENGTH_S(z);
+  xd = NV_DATA_S(x);
+  yd = NV_DATA_S(y);
+  zd = NV_DATA_S(z);
+  wd = NV_DATA_S(w);
+  kn = nvSerialGetKernels();
+
+  /* compute z one block at a time and accumulate the weighted square sum of
+     the block before moving to the next one */
+  for (start = 0; start < N; start += NV_NORM_BLOCK_S)
+  {
+    end = SUNMIN(start + NV_NORM_BLOCK_S, N);
+    kn->axpby(end - start, a, xd + start, b, yd + start, zd + start);
+    sum += kn->wsqrsum(end - start, zd + start, wd + start);
   }
 
+  return (SUNRsqrt(sum / N));
+}
+
+SUNErrCode N_VLinearCombinationWrmsNorm_Serial(int nvec, sunrealtype* c,
+                                               N_Vector* X, N_Vector z,
+                                               N_Vector w, sunrealtype* nrm)
+{
+  SUNFunctionBegin(X[0]->sunctx);
+
+  int i;
+  sunindextype N, start, end;
+  sunrealtype sum, *zd, *wd;
+  const NVSerialKernels* kn;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* should have called N_VLinearSumWrmsNorm */
+  if (nvec == 2)
+  {
+    *nrm = N_VLinearSumWrmsNorm_Serial(c[0], X[0], c[1], X[1], z, w);
+    SUNCheckLastErr();
+    return SUN_SUCCESS;
+  }
+
+  /* execute pending operations on the vectors */
+  VReadyArray_Serial(nvec, X);
+  VReady_Serial(w);
+  VFlush_Serial(z);
+
+  N   = NV_LENGTH_S(z);
+  zd  = NV_DATA_S(z);
+  wd  = NV_DATA_S(w);
+  kn  = nvSerialGetKernels();
+  sum = ZERO;
+
+  /* z = sum{ c[i] * X[i] } one block at a time, X[0] may be z */
+  for (start = 0; start < N; start += NV_NORM_BLOCK_S)
+  {
+    end = SUNMIN(start + NV_NORM_BLOCK_S, N);
+    kn->scale(end - start, c[0], NV_DATA_S(X[0]) + start, zd + start);
+    for (i = 1; i < nvec; i++)
+    {
+      kn->axpy(end - start, c[i], NV_DATA_S(X[i]) + start, zd + start);
+    }
+    sum += kn->wsqrsum(end - start, zd + start, wd + start);
+  }
+
+  *nrm = SUNRsqrt(sum / N);
+
   return SUN_SUCCESS;
 }
 
@@ -1035,11 +1385,12 @@ SUNErrCode N_VLinearSumVectorArray_Serial(int nvec, sunrealtype a, N_Vector* X,
   SUNFunctionBegin(X[0]->sunctx);
 
   int i;
-  sunindextype j, N;
+  sunindextype N;
   sunrealtype* xd = NULL;
   sunrealtype* yd = NULL;
   sunrealtype* zd = NULL;
   sunrealtype c;
+  const NVSerialKernels* kn;
   N_Vector* V1;
   N_Vector* V2;
   sunbooleantype test;
@@ -1055,6 +1406,11 @@ SUNErrCode N_VLinearSumVectorArray_Serial(int nvec, sunrealtype a, N_Vector* X,
     return SUN_SUCCESS;
   }
 
+  /* execute pending operations on the vectors */
+  VReadyArray_Serial(nvec, X);
+  VReadyArray_Serial(nvec, Y);
+  VFlushArray_Serial(nvec, Z);
+
   /* BLAS usage: axpy y <- ax+y */
   if ((b == ONE) && (Z == Y))
   {
@@ -1132,8 +1488,9 @@ SUNErrCode N_VLinearSumVectorArray_Serial(int nvec, sunrealtype a, N_Vector* X,
   /*   (2) a == 0.0, b == other - user should have called N_VScale */
   /*   (3) a,b == other, a !=b, a != -b                            */
 
-  /* get vector length */
-  N = NV_LENGTH_S(Z[0]);
+  /* get vector length and kernels */
+  N  = NV_LENGTH_S(Z[0]);
+  kn = nvSerialGetKernels();
 
   /* compute linear sum for each vector pair in vector arrays */
   for (i = 0; i < nvec; i++)
@@ -1141,7 +1498,7 @@ SUNErrCode N_VLinearSumVectorArray_Serial(int nvec, sunrealtype a, N_Vector* X,
     xd = NV_DATA_S(X[i]);
     yd = NV_DATA_S(Y[i]);
     zd = NV_DATA_S(Z[i]);
-    for (j = 0; j < N; j++) { zd[j] = a * xd[j] + b * yd[j]; }
+    kn->axpby(N, a, xd, b, yd, zd);
   }
 
   return SUN_SUCCESS;
@@ -1167,6 +1524,10 @@ SUNErrCode N_VScaleVectorArray_Serial(int nvec, sunrealtype* c, N_Vector* X,
     return SUN_SUCCESS;
   }
 
+  /* execute pending operations on the vectors */
+  VReadyArray_Serial(nvec, X);
+  VFlushArray_Serial(nvec, Z);
+
   /* get vector length */
   N = NV_LENGTH_S(Z[0]);
 
@@ -1213,6 +1574,9 @@ SUNErrCode N_VConstVectorArray_Serial(int nvec, sunrealtype c, N_Vector* Z)
     return SUN_SUCCESS;
   }
 
+  /* execute pending operations on the vectors */
+  VFlushArray_Serial(nvec, Z);
+
   /* get vector length */
   N = NV_LENGTH_S(Z[0]);
 
@@ -1231,9 +1595,10 @@ SUNErrCode N_VWrmsNormVectorArray_Serial(int nvec, N_Vector* X, N_Vector* W,
 {
   SUNFunctionBegin(X[0]->sunctx);
   int i;
-  sunindextype j, N;
+  sunindextype N;
   sunrealtype* wd = NULL;
   sunrealtype* xd = NULL;
+  const NVSerialKernels* kn;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -1246,17 +1611,20 @@ SUNErrCode N_VWrmsNormVectorArray_Serial(int nvec, N_Vector* X, N_Vector* W,
     return SUN_SUCCESS;
   }
 
-  /* get vector length */
-  N = NV_LENGTH_S(X[0]);
+  /* execute pending operations on the vectors */
+  VReadyArray_Serial(nvec, X);
+  VReadyArray_Serial(nvec, W);
+
+  /* get vector length and kernels */
+  N  = NV_LENGTH_S(X[0]);
+  kn = nvSerialGetKernels();
 
   /* compute the WRMS norm for each vector in the vector array */
   for (i = 0; i < nvec; i++)
   {
     xd     = NV_DATA_S(X[i]);
     wd     = NV_DATA_S(W[i]);
-    nrm[i] = ZERO;
-    for (j = 0; j < N; j++) { nrm[i] += SUNSQR(xd[j] * wd[j]); }
-    nrm[i] = SUNRsqrt(nrm[i] / N);
+    nrm[i] = SUNRsqrt(kn->wsqrsum(N, xd, wd) / N);
   }
 
   return SUN_SUCCESS;
@@ -1283,6 +1651,11 @@ SUNErrCode N_VWrmsNormMaskVectorArray_Serial(int nvec, N_Vector* X, N_Vector* W,
     return SUN_SUCCESS;
   }
 
+  /* execute pending operations on the vectors */
+  VReadyArray_Serial(nvec, X);
+  VReadyArray_Serial(nvec, W);
+  VReady_Serial(id);
+
   /* get vector length and mask data array */
   N   = NV_LENGTH_S(X[0]);
   idd = NV_DATA_S(id);
@@ -1309,10 +1682,11 @@ SUNErrCode N_VScaleAddMultiVectorArray_Serial(int nvec, int nsum,
 {
   SUNFunctionBegin(X[0]->sunctx);
   int i, j;
-  sunindextype k, N;
+  sunindextype N;
   sunrealtype* xd = NULL;
   sunrealtype* yd = NULL;
   sunrealtype* zd = NULL;
+  const NVSerialKernels* kn;
   N_Vector* YY;
   N_Vector* ZZ;
 
@@ -1368,8 +1742,17 @@ SUNErrCode N_VScaleAddMultiVectorArray_Serial(int nvec, int nsum,
    * Compute multiple linear sums
    * ---------------------------- */
 
-  /* get vector length */
-  N = NV_LENGTH_S(X[0]);
+  /* execute pending operations on the vectors */
+  VReadyArray_Serial(nvec, X);
+  for (j = 0; j < nsum; j++)
+  {
+    VReadyArray_Serial(nvec, Y[j]);
+    VFlushArray_Serial(nvec, Z[j]);
+  }
+
+  /* get vector length and kernels */
+  N  = NV_LENGTH_S(X[0]);
+  kn = nvSerialGetKernels();
 
   /*
    * Y[i][j] += a[i] * x[j]
@@ -1382,7 +1765,7 @@ SUNErrCode N_VScaleAddMultiVectorArray_Serial(int nvec, int nsum,
       for (j = 0; j < nsum; j++)
       {
         yd = NV_DATA_S(Y[j][i]);
-        for (k = 0; k < N; k++) { yd[k] += a[j] * xd[k]; }
+        kn->axpy(N, a[j], xd, yd);
       }
     }
     return SUN_SUCCESS;
@@ -1398,7 +1781,7 @@ SUNErrCode N_VScaleAddMultiVectorArray_Serial(int nvec, int nsum,
     {
       yd = NV_DATA_S(Y[j][i]);
       zd = NV_DATA_S(Z[j][i]);
-      for (k = 0; k < N; k++) { zd[k] = a[j] * xd[k] + yd[k]; }
+      kn->axpby(N, a[j], xd, ONE, yd, zd);
     }
   }
   return SUN_SUCCESS;
@@ -1409,13 +1792,13 @@ SUNErrCode N_VLinearCombinationVectorArray_Serial(int nvec, int nsum,
                                                   N_Vector* Z)
 {
   SUNFunctionBegin(X[0][0]->sunctx);
-  int i;          /* vector arrays index in summation [0,nsum) */
-  int j;          /* vector index in vector array     [0,nvec) */
-  sunindextype k; /* element index in vector          [0,N)    */
+  int i; /* vector arrays index in summation [0,nsum) */
+  int j; /* vector index in vector array     [0,nvec) */
   sunindextype N;
   sunrealtype* zd = NULL;
   sunrealtype* xd = NULL;
   sunrealtype* ctmp;
+  const NVSerialKernels* kn;
   N_Vector* Y;
 
   /* invalid number of vectors */
@@ -1485,8 +1868,13 @@ SUNErrCode N_VLinearCombinationVectorArray_Serial(int nvec, int nsum,
    * Compute linear combination
    * -------------------------- */
 
-  /* get vector length */
-  N = NV_LENGTH_S(Z[0]);
+  /* execute pending operations on the vectors */
+  for (i = 0; i < nsum; i++) { VReadyArray_Serial(nvec, X[i]); }
+  VFlushArray_Serial(nvec, Z);
+
+  /* get vector length and kernels */
+  N  = NV_LENGTH_S(Z[0]);
+  kn = nvSerialGetKernels();
 
   /*
    * X[0][j] += c[i]*X[i][j], i = 1,...,nvec-1
@@ -1499,7 +1887,7 @@ SUNErrCode N_VLinearCombinationVectorArray_Serial(int nvec, int nsum,
       for (i = 1; i < nsum; i++)
       {
         xd = NV_DATA_S(X[i][j]);
-        for (k = 0; k < N; k++) { zd[k] += c[i] * xd[k]; }
+        kn->axpy(N, c[i], xd, zd);
       }
     }
     return SUN_SUCCESS;
@@ -1513,11 +1901,11 @@ SUNErrCode N_VLinearCombinationVectorArray_Serial(int nvec, int nsum,
     for (j = 0; j < nvec; j++)
     {
       zd = NV_DATA_S(Z[j]);
-      for (k = 0; k < N; k++) { zd[k] *= c[0]; }
+      kn->scale(N, c[0], zd, zd);
       for (i = 1; i < nsum; i++)
       {
         xd = NV_DATA_S(X[i][j]);
-        for (k = 0; k < N; k++) { zd[k] += c[i] * xd[k]; }
+        kn->axpy(N, c[i], xd, zd);
       }
     }
     return SUN_SUCCESS;
@@ -1530,11 +1918,11 @@ SUNErrCode N_VLinearCombinationVectorArray_Serial(int nvec, int nsum,
   {
     xd = NV_DATA_S(X[0][j]);
     zd = NV_DATA_S(Z[j]);
-    for (k = 0; k < N; k++) { zd[k] = c[0] * xd[k]; }
+    kn->scale(N, c[0], xd, zd);
     for (i = 1; i < nsum; i++)
     {
       xd = NV_DATA_S(X[i][j]);
-      for (k = 0; k < N; k++) { zd[k] += c[i] * xd[k]; }
+      kn->axpy(N, c[i], xd, zd);
     }
   }
   return SUN_SUCCESS;
@@ -1561,6 +1949,8 @@ SUNErrCode N_VBufPack_Serial(N_Vector x, void* buf)
 
   SUNAssert(buf, SUN_ERR_ARG_CORRUPT);
 
+  VReady_Serial(x);
+
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
   bd = (sunrealtype*)buf;
@@ -1579,6 +1969,8 @@ SUNErrCode N_VBufUnpack_Serial(N_Vector x, void* buf)
 
   SUNAssert(buf, SUN_ERR_ARG_CORRUPT);
 
+  VFlush_Serial(x);
+
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
   bd = (sunrealtype*)buf;
@@ -1612,7 +2004,7 @@ static void VCopy_Serial(N_Vector x, N_Vector z)
 
 static void VSum_Serial(N_Vector x, N_Vector y, N_Vector z)
 {
-  sunindextype i, N;
+  sunindextype N;
   sunrealtype *xd, *yd, *zd;
 
   xd = yd = zd = NULL;
@@ -1622,14 +2014,14 @@ static void VSum_Serial(N_Vector x, N_Vector y, N_Vector z)
   yd = NV_DATA_S(y);
   zd = NV_DATA_S(z);
 
-  for (i = 0; i < N; i++) { zd[i] = xd[i] + yd[i]; }
+  nvSerialGetKernels()->axpby(N, ONE, xd, ONE, yd, zd);
 
   return;
 }
 
 static void VDiff_Serial(N_Vector x, N_Vector y, N_Vector z)
 {
-  sunindextype i, N;
+  sunindextype N;
   sunrealtype *xd, *yd, *zd;
 
   xd = yd = zd = NULL;
@@ -1639,7 +2031,7 @@ static void VDiff_Serial(N_Vector x, N_Vector y, N_Vector z)
   yd = NV_DATA_S(y);
   zd = NV_DATA_S(z);
 
-  for (i = 0; i < N; i++) { zd[i] = xd[i] - yd[i]; }
+  nvSerialGetKernels()->axpby(N, ONE, xd, -ONE, yd, zd);
 
   return;
 }
@@ -1696,7 +2088,7 @@ static void VScaleDiff_Serial(sunrealtype c, N_Vector x, N_Vector y, N_Vector z)
 
 static void VLin1_Serial(sunrealtype a, N_Vector x, N_Vector y, N_Vector z)
 {
-  sunindextype i, N;
+  sunindextype N;
   sunrealtype *xd, *yd, *zd;
 
   xd = yd = zd = NULL;
@@ -1706,14 +2098,14 @@ static void VLin1_Serial(sunrealtype a, N_Vector x, N_Vector y, N_Vector z)
   yd = NV_DATA_S(y);
   zd = NV_DATA_S(z);
 
-  for (i = 0; i < N; i++) { zd[i] = (a * xd[i]) + yd[i]; }
+  nvSerialGetKernels()->axpby(N, a, xd, ONE, yd, zd);
 
   return;
 }
 
 static void VLin2_Serial(sunrealtype a, N_Vector x, N_Vector y, N_Vector z)
 {
-  sunindextype i, N;
+  sunindextype N;
   sunrealtype *xd, *yd, *zd;
 
   xd = yd = zd = NULL;
@@ -1723,14 +2115,14 @@ static void VLin2_Serial(sunrealtype a, N_Vector x, N_Vector y, N_Vector z)
   yd = NV_DATA_S(y);
   zd = NV_DATA_S(z);
 
-  for (i = 0; i < N; i++) { zd[i] = (a * xd[i]) - yd[i]; }
+  nvSerialGetKernels()->axpby(N, a, xd, -ONE, yd, zd);
 
   return;
 }
 
 static void Vaxpy_Serial(sunrealtype a, N_Vector x, N_Vector y)
 {
-  sunindextype i, N;
+  sunindextype N;
   sunrealtype *xd, *yd;
 
   xd = yd = NULL;
@@ -1739,26 +2131,14 @@ static void Vaxpy_Serial(sunrealtype a, N_Vector x, N_Vector y)
   xd = NV_DATA_S(x);
   yd = NV_DATA_S(y);
 
-  if (a == ONE)
-  {
-    for (i = 0; i < N; i++) { yd[i] += xd[i]; }
-    return;
-  }
-
-  if (a == -ONE)
-  {
-    for (i = 0; i < N; i++) { yd[i] -= xd[i]; }
-    return;
-  }
-
-  for (i = 0; i < N; i++) { yd[i] += a * xd[i]; }
+  nvSerialGetKernels()->axpy(N, a, xd, yd);
 
   return;
 }
 
 static void VScaleBy_Serial(sunrealtype a, N_Vector x)
 {
-  sunindextype i, N;
+  sunindextype N;
   sunrealtype* xd;
 
   xd = NULL;
@@ -1766,7 +2146,7 @@ static void VScaleBy_Serial(sunrealtype a, N_Vector x)
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
 
-  for (i = 0; i < N; i++) { xd[i] *= a; }
+  nvSerialGetKernels()->scale(N, a, xd, xd);
 
   return;
 }
@@ -1780,19 +2160,21 @@ static void VScaleBy_Serial(sunrealtype a, N_Vector x)
 static void VSumVectorArray_Serial(int nvec, N_Vector* X, N_Vector* Y, N_Vector* Z)
 {
   int i;
-  sunindextype j, N;
+  sunindextype N;
   sunrealtype* xd = NULL;
   sunrealtype* yd = NULL;
   sunrealtype* zd = NULL;
+  const NVSerialKernels* kn;
 
-  N = NV_LENGTH_S(X[0]);
+  N  = NV_LENGTH_S(X[0]);
+  kn = nvSerialGetKernels();
 
   for (i = 0; i < nvec; i++)
   {
     xd = NV_DATA_S(X[i]);
     yd = NV_DATA_S(Y[i]);
     zd = NV_DATA_S(Z[i]);
-    for (j = 0; j < N; j++) { zd[j] = xd[j] + yd[j]; }
+    kn->axpby(N, ONE, xd, ONE, yd, zd);
   }
 }
 
@@ -1800,19 +2182,21 @@ static void VDiffVectorArray_Serial(int nvec, N_Vector* X, N_Vector* Y,
                                     N_Vector* Z)
 {
   int i;
-  sunindextype j, N;
+  sunindextype N;
   sunrealtype* xd = NULL;
   sunrealtype* yd = NULL;
   sunrealtype* zd = NULL;
+  const NVSerialKernels* kn;
 
-  N = NV_LENGTH_S(X[0]);
+  N  = NV_LENGTH_S(X[0]);
+  kn = nvSerialGetKernels();
 
   for (i = 0; i < nvec; i++)
   {
     xd = NV_DATA_S(X[i]);
     yd = NV_DATA_S(Y[i]);
     zd = NV_DATA_S(Z[i]);
-    for (j = 0; j < N; j++) { zd[j] = xd[j] - yd[j]; }
+    kn->axpby(N, ONE, xd, -ONE, yd, zd);
   }
 }
 
@@ -1860,19 +2244,21 @@ static void VLin1VectorArray_Serial(int nvec, sunrealtype a, N_Vector* X,
                                     N_Vector* Y, N_Vector* Z)
 {
   int i;
-  sunindextype j, N;
+  sunindextype N;
   sunrealtype* xd = NULL;
   sunrealtype* yd = NULL;
   sunrealtype* zd = NULL;
+  const NVSerialKernels* kn;
 
-  N = NV_LENGTH_S(X[0]);
+  N  = NV_LENGTH_S(X[0]);
+  kn = nvSerialGetKernels();
 
   for (i = 0; i < nvec; i++)
   {
     xd = NV_DATA_S(X[i]);
     yd = NV_DATA_S(Y[i]);
     zd = NV_DATA_S(Z[i]);
-    for (j = 0; j < N; j++) { zd[j] = (a * xd[j]) + yd[j]; }
+    kn->axpby(N, a, xd, ONE, yd, zd);
   }
 }
 
@@ -1880,19 +2266,21 @@ static void VLin2VectorArray_Serial(int nvec, sunrealtype a, N_Vector* X,
                                     N_Vector* Y, N_Vector* Z)
 {
   int i;
-  sunindextype j, N;
+  sunindextype N;
   sunrealtype* xd = NULL;
   sunrealtype* yd = NULL;
   sunrealtype* zd = NULL;
+  const NVSerialKernels* kn;
 
-  N = NV_LENGTH_S(X[0]);
+  N  = NV_LENGTH_S(X[0]);
+  kn = nvSerialGetKernels();
 
   for (i = 0; i < nvec; i++)
   {
     xd = NV_DATA_S(X[i]);
     yd = NV_DATA_S(Y[i]);
     zd = NV_DATA_S(Z[i]);
-    for (j = 0; j < N; j++) { zd[j] = (a * xd[j]) - yd[j]; }
+    kn->axpby(N, a, xd, -ONE, yd, zd);
   }
 }
 
@@ -1900,40 +2288,178 @@ static void VaxpyVectorArray_Serial(int nvec, sunrealtype a, N_Vector* X,
                                     N_Vector* Y)
 {
   int i;
-  sunindextype j, N;
+  sunindextype N;
   sunrealtype* xd = NULL;
   sunrealtype* yd = NULL;
+  const NVSerialKernels* kn;
 
-  N = NV_LENGTH_S(X[0]);
+  N  = NV_LENGTH_S(X[0]);
+  kn = nvSerialGetKernels();
 
-  if (a == ONE)
+  for (i = 0; i < nvec; i++)
   {
-    for (i = 0; i < nvec; i++)
-    {
-      xd = NV_DATA_S(X[i]);
-      yd = NV_DATA_S(Y[i]);
-      for (j = 0; j < N; j++) { yd[j] += xd[j]; }
-    }
-    return;
+    xd = NV_DATA_S(X[i]);
+    yd = NV_DATA_S(Y[i]);
+    kn->axpy(N, a, xd, yd);
   }
+}
 
-  if (a == -ONE)
+/*
+ * -----------------------------------------------------------------
+ * private functions for deferred operations
+ * -----------------------------------------------------------------
+ */
+
+/* Records z = op(x, y) when z has deferred operations enabled and x and y
+   (if used) share its recorder. Otherwise pending operations on the vectors
+   are executed and SUNFALSE is returned so the caller computes z now. */
+static sunbooleantype VDefer_Serial(SUNDeferredOpType type, sunrealtype a,
+                                    sunrealtype b, N_Vector x, N_Vector y,
+                                    N_Vector z)
+{
+  SUNDeferredOps d = NV_DEFERRED_S(z);
+  sunbooleantype shifted;
+
+  /* an operand overlapping z at other indices (e.g., a view of z) must be
+     read before z is written, which a chain executed block by block does
+     not guarantee */
+  shifted = (x && NV_DATA_S(x) != NV_DATA_S(z) && VOverlap_Serial(x, z)) ||
+            (y && NV_DATA_S(y) != NV_DATA_S(z) && VOverlap_Serial(y, z));
+
+  if (d && !shifted && (x == NULL || NV_DEFERRED_S(x) == d) &&
+      (y == NULL || NV_DEFERRED_S(y) == d))
   {
-    for (i = 0; i < nvec; i++)
+    /* a chain only writes one vector */
+    if (d->nops > 0 && (d->target != z || d->nops == SUN_DEFERRED_MAX_OPS))
     {
-      xd = NV_DATA_S(X[i]);
-      yd = NV_DATA_S(Y[i]);
-      for (j = 0; j < N; j++) { yd[j] -= xd[j]; }
+      VExecute_Serial(d);
     }
-    return;
+    sunDeferredRecord(d, z, type, a, b, x ? NV_DATA_S(x) : NULL,
+                      y ? NV_DATA_S(y) : NULL);
+    return SUNTRUE;
   }
 
-  for (i = 0; i < nvec; i++)
+  if (x) { VReady_Serial(x); }
+  if (y) { VReady_Serial(y); }
+  VFlush_Serial(z);
+
+  return SUNFALSE;
+}
+
+/* Executes the pending operations in a recorder */
+static void VExecute_Serial(SUNDeferredOps d)
+{
+  sunindextype N, start, end;
+  sunrealtype* zd;
+
+  N  = NV_LENGTH_S(d->target);
+  zd = NV_DATA_S(d->target);
+
+  for (start = 0; start < N; start += SUN_DEFERRED_BLOCK)
   {
-    xd = NV_DATA_S(X[i]);
-    yd = NV_DATA_S(Y[i]);
-    for (j = 0; j < N; j++) { yd[j] += a * xd[j]; }
+    end = SUNMIN(start + SUN_DEFERRED_BLOCK, N);
+    sunDeferredRunBlock(d, zd, start, end);
+  }
+
+  sunDeferredClear(d);
+}
+
+/* Executes any pending operations in the recorder of v. Used before v is
+   written, as pending operations may read v. */
+static void VFlush_Serial(N_Vector v)
+{
+  SUNDeferredOps d = NV_DEFERRED_S(v);
+  if (d && d->nops > 0) { VExecute_Serial(d); }
+}
+
+static void VFlushArray_Serial(int nvec, N_Vector* V)
+{
+  int i;
+  for (i = 0; i < nvec; i++) { VFlush_Serial(V[i]); }
+}
+
+/* Executes pending operations writing v or a vector overlapping v (e.g., a
+   view of v). Used before v is read. */
+static void VReady_Serial(N_Vector v)
+{
+  SUNDeferredOps d = NV_DEFERRED_S(v);
+  if (d && d->nops > 0 && VOverlap_Serial(d->target, v)) { VExecute_Serial(d); }
+}
+
+static void VReadyArray_Serial(int nvec, N_Vector* V)
+{
+  int i;
+  for (i = 0; i < nvec; i++) { VReady_Serial(V[i]); }
+}
+
+/* Returns the recorder with pending operations writing x or y (if not
+   NULL) so a reduction over x and y can execute them block by block.
+   Pending operations writing the other vector, or writing a vector that
+   overlaps x or y (e.g., the parent of a view), are executed. */
+static SUNDeferredOps VFuse_Serial(N_Vector x, N_Vector y)
+{
+  SUNDeferredOps dx = NV_DEFERRED_S(x);
+  SUNDeferredOps dy = y ? NV_DEFERRED_S(y) : NULL;
+
+  if (dx && dx->nops > 0 &&
+      (VAlias_Serial(dx->target, x) || (y && VAlias_Serial(dx->target, y))))
+  {
+    VExecute_Serial(dx);
+  }
+  if (dy && dy->nops > 0 &&
+      (VAlias_Serial(dy->target, y) || VAlias_Serial(dy->target, x)))
+  {
+    VExecute_Serial(dy);
+  }
+
+  if (dx && (dx->nops == 0 || dx->target != x)) { dx = NULL; }
+  if (dy && (dy->nops == 0 || dy->target != y)) { dy = NULL; }
+
+  if (dx && dy && dx != dy)
+  {
+    VExecute_Serial(dy);
+    dy = NULL;
+  }
+
+  return (dx ? dx : dy);
+}
+
+/* Returns SUNTRUE if u and v are the same vector or their data overlap */
+static sunbooleantype VOverlap_Serial(N_Vector u, N_Vector v)
+{
+  return (u == v || sunDeferredOverlap(NV_DATA_S(u), NV_LENGTH_S(u),
+                                       NV_DATA_S(v), NV_LENGTH_S(v)));
+}
+
+/* Returns SUNTRUE if v is not t but their data overlap */
+static sunbooleantype VAlias_Serial(N_Vector t, N_Vector v)
+{
+  return (t != v && VOverlap_Serial(t, v));
+}
+
+/*
+ * -----------------------------------------------------------------
+ * private functions for vector arrays stored in a single block
+ * -----------------------------------------------------------------
+ */
+
+/* Returns the data of X[0] if the data of X[0],...,X[nvec-1] are the columns
+   of a single column-major block (e.g., the vectors were created with
+   N_VCloneVectorArrayContiguous_Serial), otherwise NULL */
+static sunrealtype* VBlock_Serial(int nvec, N_Vector* X)
+{
+  int i;
+  sunindextype N  = NV_LENGTH_S(X[0]);
+  sunrealtype* xd = NV_DATA_S(X[0]);
+
+  if (N == 0 || xd == NULL) { return NULL; }
+
+  for (i = 1; i < nvec; i++)
+  {
+    if (NV_DATA_S(X[i]) != xd + i * N) { return NULL; }
   }
+
+  return xd;
 }
 
 /*
@@ -1947,9 +2473,11 @@ SUNErrCode N_VEnableFusedOps_Serial(N_Vector v, sunbooleantype tf)
   if (tf)
   {
     /* enable all fused vector operations */
-    v->ops->nvlinearcombination = N_VLinearCombination_Serial;
-    v->ops->nvscaleaddmulti     = N_VScaleAddMulti_Serial;
-    v->ops->nvdotprodmulti      = N_VDotProdMulti_Serial;
+    v->ops->nvlinearcombination         = N_VLinearCombination_Serial;
+    v->ops->nvscaleaddmulti             = N_VScaleAddMulti_Serial;
+    v->ops->nvdotprodmulti              = N_VDotProdMulti_Serial;
+    v->ops->nvlinearsumwrmsnorm         = N_VLinearSumWrmsNorm_Serial;
+    v->ops->nvlinearcombinationwrmsnorm = N_VLinearCombinationWrmsNorm_Serial;
     /* enable all vector array operations */
     v->ops->nvlinearsumvectorarray     = N_VLinearSumVectorArray_Serial;
     v->ops->nvscalevectorarray         = N_VScaleVectorArray_Serial;
@@ -1965,9 +2493,11 @@ SUNErrCode N_VEnableFusedOps_Serial(N_Vector v, sunbooleantype tf)
   else
   {
     /* disable all fused vector operations */
-    v->ops->nvlinearcombination = NULL;
-    v->ops->nvscaleaddmulti     = NULL;
-    v->ops->nvdotprodmulti      = NULL;
+    v->ops->nvlinearcombination         = NULL;
+    v->ops->nvscaleaddmulti             = NULL;
+    v->ops->nvdotprodmulti              = NULL;
+    v->ops->nvlinearsumwrmsnorm         = NULL;
+    v->ops->nvlinearcombinationwrmsnorm = NULL;
     /* disable all vector array operations */
     v->ops->nvlinearsumvectorarray         = NULL;
     v->ops->nvscalevectorarray             = NULL;
@@ -2003,6 +2533,20 @@ SUNErrCode N_VEnableDotProdMulti_Serial(N_Vector v, sunbooleantype tf)
   return SUN_SUCCESS;
 }
 
+SUNErrCode N_VEnableLinearSumWrmsNorm_Serial(N_Vector v, sunbooleantype tf)
+{
+  v->ops->nvlinearsumwrmsnorm = tf ? N_VLinearSumWrmsNorm_Serial : NULL;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnableLinearCombinationWrmsNorm_Serial(N_Vector v,
+                                                     sunbooleantype tf)
+{
+  v->ops->nvlinearcombinationwrmsnorm = tf ? N_VLinearCombinationWrmsNorm_Serial
+                                           : NULL;
+  return SUN_SUCCESS;
+}
+
 SUNErrCode N_VEnableLinearSumVectorArray_Serial(N_Vector v, sunbooleantype tf)
 {
   v->ops->nvlinearsumvectorarray = tf ? N_VLinearSumVectorArray_Serial : NULL;
@@ -2048,3 +2592,39 @@ SUNErrCode N_VEnableLinearCombinationVectorArray_Serial(N_Vector v,
     tf ? N_VLinearCombinationVectorArray_Serial : NULL;
   return SUN_SUCCESS;
 }
+
+/*
+ * -----------------------------------------------------------------
+ * Enable / Disable and execute deferred operations
+ * -----------------------------------------------------------------
+ */
+
+SUNErrCode N_VEnableDeferredOps_Serial(N_Vector v, sunbooleantype tf)
+{
+  SUNFunctionBegin(v->sunctx);
+
+  if (tf)
+  {
+    /* create a recorder, clones created from v will share it */
+    if (NV_DEFERRED_S(v) == NULL)
+    {
+      NV_DEFERRED_S(v) = sunDeferredCreate();
+      SUNAssert(NV_DEFERRED_S(v), SUN_ERR_MALLOC_FAIL);
+    }
+  }
+  else if (NV_DEFERRED_S(v))
+  {
+    /* execute pending operations and detach v from the recorder */
+    VFlush_Serial(v);
+    sunDeferredRelease(NV_DEFERRED_S(v));
+    NV_DEFERRED_S(v) = NULL;
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VFlushDeferredOps_Serial(N_Vector v)
+{
+  VFlush_Serial(v);
+  return SUN_SUCCESS;
+}
@@ -0,0 +1,607 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for the streaming kernels used
+ * by the serial NVECTOR. The vectorized kernels use separate
+ * multiplies and adds (no FMA) so the element-wise kernels produce
+ * the same results as the portable C kernels. The vectorized
+ * reductions use several independent accumulators to hide the add
+ * latency and may differ from a sequential sum in the last bits.
+ * The portable reductions are sequential sums, so selecting "none"
+ * reproduces the results of earlier releases bitwise.
+ * -----------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sundials/sundials_types.h>
+
+#include "nvector_serial_kernels.h"
+
+#define ZERO SUN_RCONST(0.0)
+
+/* The vectorized kernels are only available in double precision */
+#if defined(SUNDIALS_DOUBLE_PRECISION) && \
+  (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define NV_SERIAL_X86_SIMD
+#include <immintrin.h>
+#define NV_TARGET_AVX2   __attribute__((target("avx2")))
+#define NV_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+#if defined(SUNDIALS_DOUBLE_PRECISION) && defined(__aarch64__) && \
+  defined(__ARM_NEON)
+#define NV_SERIAL_NEON_SIMD
+#include <arm_neon.h>
+#endif
+
+/*
+ * -----------------------------------------------------------------
+ * portable kernels
+ * -----------------------------------------------------------------
+ */
+
+static void axpby_C(sunindextype n, sunrealtype a, const sunrealtype* x,
+                    sunrealtype b, const sunrealtype* y, sunrealtype* z)
+{
+  sunindextype i;
+  for (i = 0; i < n; i++) { z[i] = (a * x[i]) + (b * y[i]); }
+}
+
+static void axpy_C(sunindextype n, sunrealtype a, const sunrealtype* x,
+                   sunrealtype* y)
+{
+  sunindextype i;
+  for (i = 0; i < n; i++) { y[i] += a * x[i]; }
+}
+
+static void scale_C(sunindextype n, sunrealtype a, const sunrealtype* x,
+                    sunrealtype* z)
+{
+  sunindextype i;
+  for (i = 0; i < n; i++) { z[i] = a * x[i]; }
+}
+
+static sunrealtype dot_C(sunindextype n, const sunrealtype* x,
+                         const sunrealtype* y)
+{
+  sunindextype i;
+  sunrealtype sum = ZERO;
+
+  for (i = 0; i < n; i++) { sum += x[i] * y[i]; }
+
+  return (sum);
+}
+
+static sunrealtype wsqrsum_C(sunindextype n, const sunrealtype* x,
+                             const sunrealtype* w)
+{
+  sunindextype i;
+  sunrealtype sum = ZERO;
+  sunrealtype prodi;
+
+  for (i = 0; i < n; i++)
+  {
+    prodi = x[i] * w[i];
+    sum += prodi * prodi;
+  }
+
+  return (sum);
+}
+
+static const NVSerialKernels nvKernelsC = {"none", axpby_C, axpy_C, scale_C,
+                                           dot_C, wsqrsum_C};
+
+/*
+ * -----------------------------------------------------------------
+ * AVX2 kernels
+ * -----------------------------------------------------------------
+ */
+
+#ifdef NV_SERIAL_X86_SIMD
+
+NV_TARGET_AVX2 static void axpby_AVX2(sunindextype n, sunrealtype a,
+                                      const sunrealtype* x, sunrealtype b,
+                                      const sunrealtype* y, sunrealtype* z)
+{
+  sunindextype i;
+  __m256d va = _mm256_set1_pd(a);
+  __m256d vb = _mm256_set1_pd(b);
+
+  for (i = 0; i + 8 <= n; i += 8)
+  {
+    __m256d x0 = _mm256_loadu_pd(x + i);
+    __m256d x1 = _mm256_loadu_pd(x + i + 4);
+    __m256d y0 = _mm256_loadu_pd(y + i);
+    __m256d y1 = _mm256_loadu_pd(y + i + 4);
+    _mm256_storeu_pd(z + i, _mm256_add_pd(_mm256_mul_pd(va, x0),
+                                          _mm256_mul_pd(vb, y0)));
+    _mm256_storeu_pd(z + i + 4, _mm256_add_pd(_mm256_mul_pd(va, x1),
+                                              _mm256_mul_pd(vb, y1)));
+  }
+  for (; i < n; i++) { z[i] = (a * x[i]) + (b * y[i]); }
+}
+
+NV_TARGET_AVX2 static void axpy_AVX2(sunindextype n, sunrealtype a,
+                                     const sunrealtype* x, sunrealtype* y)
+{
+  sunindextype i;
+  __m256d va = _mm256_set1_pd(a);
+
+  for (i = 0; i + 8 <= n; i += 8)
+  {
+    __m256d x0 = _mm256_loadu_pd(x + i);
+    __m256d x1 = _mm256_loadu_pd(x + i + 4);
+    __m256d y0 = _mm256_loadu_pd(y + i);
+    __m256d y1 = _mm256_loadu_pd(y + i + 4);
+    _mm256_storeu_pd(y + i, _mm256_add_pd(y0, _mm256_mul_pd(va, x0)));
+    _mm256_storeu_pd(y + i + 4, _mm256_add_pd(y1, _mm256_mul_pd(va, x1)));
+  }
+  for (; i < n; i++) { y[i] += a * x[i]; }
+}
+
+NV_TARGET_AVX2 static void scale_AVX2(sunindextype n, sunrealtype a,
+                                      const sunrealtype* x, sunrealtype* z)
+{
+  sunindextype i;
+  __m256d va = _mm256_set1_pd(a);
+
+  for (i = 0; i + 8 <= n; i += 8)
+  {
+    __m256d x0 = _mm256_loadu_pd(x + i);
+    __m256d x1 = _mm256_loadu_pd(x + i + 4);
+    _mm256_storeu_pd(z + i, _mm256_mul_pd(va, x0));
+    _mm256_storeu_pd(z + i + 4, _mm256_mul_pd(va, x1));
+  }
+  for (; i < n; i++) { z[i] = a * x[i]; }
+}
+
+NV_TARGET_AVX2 static sunrealtype hsum_AVX2(__m256d s0, __m256d s1,
+                                            __m256d s2, __m256d s3)
+{
+  double tmp[4];
+  _mm256_storeu_pd(tmp, _mm256_add_pd(_mm256_add_pd(s0, s1),
+                                      _mm256_add_pd(s2, s3)));
+  return ((tmp[0] + tmp[1]) + (tmp[2] + tmp[3]));
+}
+
+NV_TARGET_AVX2 static sunrealtype dot_AVX2(sunindextype n, const sunrealtype* x,
+                                           const sunrealtype* y)
+{
+  sunindextype i;
+  sunrealtype sum;
+  __m256d s0 = _mm256_setzero_pd();
+  __m256d s1 = _mm256_setzero_pd();
+  __m256d s2 = _mm256_setzero_pd();
+  __m256d s3 = _mm256_setzero_pd();
+
+  for (i = 0; i + 16 <= n; i += 16)
+  {
+    s0 = _mm256_add_pd(s0, _mm256_mul_pd(_mm256_loadu_pd(x + i),
+                                         _mm256_loadu_pd(y + i)));
+    s1 = _mm256_add_pd(s1, _mm256_mul_pd(_mm256_loadu_pd(x + i + 4),
+                                         _mm256_loadu_pd(y + i + 4)));
+    s2 = _mm256_add_pd(s2, _mm256_mul_pd(_mm256_loadu_pd(x + i + 8),
+                                         _mm256_loadu_pd(y + i + 8)));
+    s3 = _mm256_add_pd(s3, _mm256_mul_pd(_mm256_loadu_pd(x + i + 12),
+                                         _mm256_loadu_pd(y + i + 12)));
+  }
+  for (; i + 4 <= n; i += 4)
+  {
+    s0 = _mm256_add_pd(s0, _mm256_mul_pd(_mm256_loadu_pd(x + i),
+                                         _mm256_loadu_pd(y + i)));
+  }
+
+  sum = hsum_AVX2(s0, s1, s2, s3);
+  for (; i < n; i++) { sum += x[i] * y[i]; }
+
+  return (sum);
+}
+
+NV_TARGET_AVX2 static sunrealtype wsqrsum_AVX2(sunindextype n,
+                                               const sunrealtype* x,
+                                               const sunrealtype* w)
+{
+  sunindextype i;
+  sunrealtype sum, prodi;
+  __m256d p0, p1, p2, p3;
+  __m256d s0 = _mm256_setzero_pd();
+  __m256d s1 = _mm256_setzero_pd();
+  __m256d s2 = _mm256_setzero_pd();
+  __m256d s3 = _mm256_setzero_pd();
+
+  for (i = 0; i + 16 <= n; i += 16)
+  {
+    p0 = _mm256_mul_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(w + i));
+    p1 = _mm256_mul_pd(_mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(w + i + 4));
+    p2 = _mm256_mul_pd(_mm256_loadu_pd(x + i + 8), _mm256_loadu_pd(w + i + 8));
+    p3 = _mm256_mul_pd(_mm256_loadu_pd(x + i + 12),
+                       _mm256_loadu_pd(w + i + 12));
+    s0 = _mm256_add_pd(s0, _mm256_mul_pd(p0, p0));
+    s1 = _mm256_add_pd(s1, _mm256_mul_pd(p1, p1));
+    s2 = _mm256_add_pd(s2, _mm256_mul_pd(p2, p2));
+    s3 = _mm256_add_pd(s3, _mm256_mul_pd(p3, p3));
+  }
+  for (; i + 4 <= n; i += 4)
+  {
+    p0 = _mm256_mul_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(w + i));
+    s0 = _mm256_add_pd(s0, _mm256_mul_pd(p0, p0));
+  }
+
+  sum = hsum_AVX2(s0, s1, s2, s3);
+  for (; i < n; i++)
+  {
+    prodi = x[i] * w[i];
+    sum += prodi * prodi;
+  }
+
+  return (sum);
+}
+
+static const NVSerialKernels nvKernelsAVX2 = {"avx2", axpby_AVX2, axpy_AVX2,
+                                              scale_AVX2, dot_AVX2,
+                                              wsqrsum_AVX2};
+
+/*
+ * -----------------------------------------------------------------
+ * AVX-512 kernels
+ * -----------------------------------------------------------------
+ */
+
+NV_TARGET_AVX512 static void axpby_AVX512(sunindextype n, sunrealtype a,
+                                          const sunrealtype* x, sunrealtype b,
+                                          const sunrealtype* y, sunrealtype* z)
+{
+  sunindextype i;
+  __m512d va = _mm512_set1_pd(a);
+  __m512d vb = _mm512_set1_pd(b);
+
+  for (i = 0; i + 16 <= n; i += 16)
+  {
+    __m512d x0 = _mm512_loadu_pd(x + i);
+    __m512d x1 = _mm512_loadu_pd(x + i + 8);
+    __m512d y0 = _mm512_loadu_pd(y + i);
+    __m512d y1 = _mm512_loadu_pd(y + i + 8);
+    _mm512_storeu_pd(z + i, _mm512_add_pd(_mm512_mul_pd(va, x0),
+                                          _mm512_mul_pd(vb, y0)));
+    _mm512_storeu_pd(z + i + 8, _mm512_add_pd(_mm512_mul_pd(va, x1),
+                                              _mm512_mul_pd(vb, y1)));
+  }
+  for (; i < n; i++) { z[i] = (a * x[i]) + (b * y[i]); }
+}
+
+NV_TARGET_AVX512 static void axpy_AVX512(sunindextype n, sunrealtype a,
+                                         const sunrealtype* x, sunrealtype* y)
+{
+  sunindextype i;
+  __m512d va = _mm512_set1_pd(a);
+
+  for (i = 0; i + 16 <= n; i += 16)
+  {
+    __m512d x0 = _mm512_loadu_pd(x + i);
+    __m512d x1 = _mm512_loadu_pd(x + i + 8);
+    __m512d y0 = _mm512_loadu_pd(y + i);
+    __m512d y1 = _mm512_loadu_pd(y + i + 8);
+    _mm512_storeu_pd(y + i, _mm512_add_pd(y0, _mm512_mul_pd(va, x0)));
+    _mm512_storeu_pd(y + i + 8, _mm512_add_pd(y1, _mm512_mul_pd(va, x1)));
+  }
+  for (; i < n; i++) { y[i] += a * x[i]; }
+}
+
+NV_TARGET_AVX512 static void scale_AVX512(sunindextype n, sunrealtype a,
+                                          const sunrealtype* x, sunrealtype* z)
+{
+  sunindextype i;
+  __m512d va = _mm512_set1_pd(a);
+
+  for (i = 0; i + 16 <= n; i += 16)
+  {
+    __m512d x0 = _mm512_loadu_pd(x + i);
+    __m512d x1 = _mm512_loadu_pd(x + i + 8);
+    _mm512_storeu_pd(z + i, _mm512_mul_pd(va, x0));
+    _mm512_storeu_pd(z + i + 8, _mm512_mul_pd(va, x1));
+  }
+  for (; i < n; i++) { z[i] = a * x[i]; }
+}
+
+NV_TARGET_AVX512 static sunrealtype hsum_AVX512(__m512d s0, __m512d s1,
+                                                __m512d s2, __m512d s3)
+{
+  double tmp[8];
+  _mm512_storeu_pd(tmp, _mm512_add_pd(_mm512_add_pd(s0, s1),
+                                      _mm512_add_pd(s2, s3)));
+  return (((tmp[0] + tmp[1]) + (tmp[2] + tmp[3])) +
+          ((tmp[4] + tmp[5]) + (tmp[6] + tmp[7])));
+}
+
+NV_TARGET_AVX512 static sunrealtype dot_AVX512(sunindextype n,
+                                               const sunrealtype* x,
+                                               const sunrealtype* y)
+{
+  sunindextype i;
+  sunrealtype sum;
+  __m512d s0 = _mm512_setzero_pd();
+  __m512d s1 = _mm512_setzero_pd();
+  __m512d s2 = _mm512_setzero_pd();
+  __m512d s3 = _mm512_setzero_pd();
+
+  for (i = 0; i + 32 <= n; i += 32)
+  {
+    s0 = _mm512_add_pd(s0, _mm512_mul_pd(_mm512_loadu_pd(x + i),
+                                         _mm512_loadu_pd(y + i)));
+    s1 = _mm512_add_pd(s1, _mm512_mul_pd(_mm512_loadu_pd(x + i + 8),
+                                         _mm512_loadu_pd(y + i + 8)));
+    s2 = _mm512_add_pd(s2, _mm512_mul_pd(_mm512_loadu_pd(x + i + 16),
+                                         _mm512_loadu_pd(y + i + 16)));
+    s3 = _mm512_add_pd(s3, _mm512_mul_pd(_mm512_loadu_pd(x + i + 24),
+                                         _mm512_loadu_pd(y + i + 24)));
+  }
+  for (; i + 8 <= n; i += 8)
+  {
+    s0 = _mm512_add_pd(s0, _mm512_mul_pd(_mm512_loadu_pd(x + i),
+                                         _mm512_loadu_pd(y + i)));
+  }
+
+  sum = hsum_AVX512(s0, s1, s2, s3);
+  for (; i < n; i++) { sum += x[i] * y[i]; }
+
+  return (sum);
+}
+
+NV_TARGET_AVX512 static sunrealtype wsqrsum_AVX512(sunindextype n,
+                                                   const sunrealtype* x,
+                                                   const sunrealtype* w)
+{
+  sunindextype i;
+  sunrealtype sum, prodi;
+  __m512d p0, p1, p2, p3;
+  __m512d s0 = _mm512_setzero_pd();
+  __m512d s1 = _mm512_setzero_pd();
+  __m512d s2 = _mm512_setzero_pd();
+  __m512d s3 = _mm512_setzero_pd();
+
+  for (i = 0; i + 32 <= n; i += 32)
+  {
+    p0 = _mm512_mul_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(w + i));
+    p1 = _mm512_mul_pd(_mm512_loadu_pd(x + i + 8), _mm512_loadu_pd(w + i + 8));
+    p2 = _mm512_mul_pd(_mm512_loadu_pd(x + i + 16),
+                       _mm512_loadu_pd(w + i + 16));
+    p3 = _mm512_mul_pd(_mm512_loadu_pd(x + i + 24),
+                       _mm512_loadu_pd(w + i + 24));
+    s0 = _mm512_add_pd(s0, _mm512_mul_pd(p0, p0));
+    s1 = _mm512_add_pd(s1, _mm512_mul_pd(p1, p1));
+    s2 = _mm512_add_pd(s2, _mm512_mul_pd(p2, p2));
+    s3 = _mm512_add_pd(s3, _mm512_mul_pd(p3, p3));
+  }
+  for (; i + 8 <= n; i += 8)
+  {
+    p0 = _mm512_mul_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(w + i));
+    s0 = _mm512_add_pd(s0, _mm512_mul_pd(p0, p0));
+  }
+
+  sum = hsum_AVX512(s0, s1, s2, s3);
+  for (; i < n; i++)
+  {
+    prodi = x[i] * w[i];
+    sum += prodi * prodi;
+  }
+
+  return (sum);
+}
+
+static const NVSerialKernels nvKernelsAVX512 = {"avx512", axpby_AVX512,
+                                                axpy_AVX512, scale_AVX512,
+                                                dot_AVX512, wsqrsum_AVX512};
+
+#endif /* NV_SERIAL_X86_SIMD */
+
+/*
+ * -----------------------------------------------------------------
+ * NEON kernels
+ * -----------------------------------------------------------------
+ */
+
+#ifdef NV_SERIAL_NEON_SIMD
+
+static void axpby_NEON(sunindextype n, sunrealtype a, const sunrealtype* x,
+                       sunrealtype b, const sunrealtype* y, sunrealtype* z)
+{
+  sunindextype i;
+  float64x2_t va = vdupq_n_f64(a);
+  float64x2_t vb = vdupq_n_f64(b);
+
+  for (i = 0; i + 4 <= n; i += 4)
+  {
+    float64x2_t x0 = vld1q_f64(x + i);
+    float64x2_t x1 = vld1q_f64(x + i + 2);
+    float64x2_t y0 = vld1q_f64(y + i);
+    float64x2_t y1 = vld1q_f64(y + i + 2);
+    vst1q_f64(z + i, vaddq_f64(vmulq_f64(va, x0), vmulq_f64(vb, y0)));
+    vst1q_f64(z + i + 2, vaddq_f64(vmulq_f64(va, x1), vmulq_f64(vb, y1)));
+  }
+  for (; i < n; i++) { z[i] = (a * x[i]) + (b * y[i]); }
+}
+
+static void axpy_NEON(sunindextype n, sunrealtype a, const sunrealtype* x,
+                      sunrealtype* y)
+{
+  sunindextype i;
+  float64x2_t va = vdupq_n_f64(a);
+
+  for (i = 0; i + 4 <= n; i += 4)
+  {
+    float64x2_t x0 = vld1q_f64(x + i);
+    float64x2_t x1 = vld1q_f64(x + i + 2);
+    float64x2_t y0 = vld1q_f64(y + i);
+    float64x2_t y1 = vld1q_f64(y + i + 2);
+    vst1q_f64(y + i, vaddq_f64(y0, vmulq_f64(va, x0)));
+    vst1q_f64(y + i + 2, vaddq_f64(y1, vmulq_f64(va, x1)));
+  }
+  for (; i < n; i++) { y[i] += a * x[i]; }
+}
+
+static void scale_NEON(sunindextype n, sunrealtype a, const sunrealtype* x,
+                       sunrealtype* z)
+{
+  sunindextype i;
+  float64x2_t va = vdupq_n_f64(a);
+
+  for (i = 0; i + 4 <= n; i += 4)
+  {
+    vst1q_f64(z + i, vmulq_f64(va, vld1q_f64(x + i)));
+    vst1q_f64(z + i + 2, vmulq_f64(va, vld1q_f64(x + i + 2)));
+  }
+  for (; i < n; i++) { z[i] = a * x[i]; }
+}
+
+static sunrealtype dot_NEON(sunindextype n, const sunrealtype* x,
+                            const sunrealtype* y)
+{
+  sunindextype i;
+  sunrealtype sum;
+  float64x2_t s0 = vdupq_n_f64(ZERO);
+  float64x2_t s1 = vdupq_n_f64(ZERO);
+  float64x2_t s2 = vdupq_n_f64(ZERO);
+  float64x2_t s3 = vdupq_n_f64(ZERO);
+
+  for (i = 0; i + 8 <= n; i += 8)
+  {
+    s0 = vaddq_f64(s0, vmulq_f64(vld1q_f64(x + i), vld1q_f64(y + i)));
+    s1 = vaddq_f64(s1, vmulq_f64(vld1q_f64(x + i + 2), vld1q_f64(y + i + 2)));
+    s2 = vaddq_f64(s2, vmulq_f64(vld1q_f64(x + i + 4), vld1q_f64(y + i + 4)));
+    s3 = vaddq_f64(s3, vmulq_f64(vld1q_f64(x + i + 6), vld1q_f64(y + i + 6)));
+  }
+  for (; i + 2 <= n; i += 2)
+  {
+    s0 = vaddq_f64(s0, vmulq_f64(vld1q_f64(x + i), vld1q_f64(y + i)));
+  }
+
+  sum = vaddvq_f64(vaddq_f64(vaddq_f64(s0, s1), vaddq_f64(s2, s3)));
+  for (; i < n; i++) { sum += x[i] * y[i]; }
+
+  return (sum);
+}
+
+static sunrealtype wsqrsum_NEON(sunindextype n, const sunrealtype* x,
+                                const sunrealtype* w)
+{
+  sunindextype i;
+  sunrealtype sum, prodi;
+  float64x2_t p0, p1, p2, p3;
+  float64x2_t s0 = vdupq_n_f64(ZERO);
+  float64x2_t s1 = vdupq_n_f64(ZERO);
+  float64x2_t s2 = vdupq_n_f64(ZERO);
+  float64x2_t s3 = vdupq_n_f64(ZERO);
+
+  for (i = 0; i + 8 <= n; i += 8)
+  {
+    p0 = vmulq_f64(vld1q_f64(x + i), vld1q_f64(w + i));
+    p1 = vmulq_f64(vld1q_f64(x + i + 2), vld1q_f64(w + i + 2));
+    p2 = vmulq_f64(vld1q_f64(x + i + 4), vld1q_f64(w + i + 4));
+    p3 = vmulq_f64(vld1q_f64(x + i + 6), vld1q_f64(w + i + 6));
+    s0 = vaddq_f64(s0, vmulq_f64(p0, p0));
+    s1 = vaddq_f64(s1, vmulq_f64(p1, p1));
+    s2 = vaddq_f64(s2, vmulq_f64(p2, p2));
+    s3 = vaddq_f64(s3, vmulq_f64(p3, p3));
+  }
+  for (; i + 2 <= n; i += 2)
+  {
+    p0 = vmulq_f64(vld1q_f64(x + i), vld1q_f64(w + i));
+    s0 = vaddq_f64(s0, vmulq_f64(p0, p0));
+  }
+
+  sum = vaddvq_f64(vaddq_f64(vaddq_f64(s0, s1), vaddq_f64(s2, s3)));
+  for (; i < n; i++)
+  {
+    prodi = x[i] * w[i];
+    sum += prodi * prodi;
+  }
+
+  return (sum);
+}
+
+static const NVSerialKernels nvKernelsNEON = {"neon", axpby_NEON, axpy_NEON,
+                                              scale_NEON, dot_NEON,
+                                              wsqrsum_NEON};
+
+#endif /* NV_SERIAL_NEON_SIMD */
+
+/*
+ * -----------------------------------------------------------------
+ * kernel selection
+ * -----------------------------------------------------------------
+ */
+
+/* Returns the widest kernels supported by the host CPU */
+static const NVSerialKernels* nvDefaultKernels(void)
+{
+#if defined(NV_SERIAL_X86_SIMD)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) { return &nvKernelsAVX512; }
+  if (__builtin_cpu_supports("avx2")) { return &nvKernelsAVX2; }
+#elif defined(NV_SERIAL_NEON_SIMD)
+  return &nvKernelsNEON;
+#endif
+
+  return &nvKernelsC;
+}
+
+/* Returns the kernels named by SUNDIALS_NVECTOR_SERIAL_SIMD, or the default
+   kernels (with a warning) if the named kernels are unknown or not supported
+   by this build and host */
+static const NVSerialKernels* nvSelectKernels(void)
+{
+  const char* simd_env = getenv("SUNDIALS_NVECTOR_SERIAL_SIMD");
+  const NVSerialKernels* k;
+
+  if (simd_env == NULL || simd_env[0] == '\0') { return nvDefaultKernels(); }
+
+  if (!strcmp(simd_env, "none")) { return &nvKernelsC; }
+
+#if defined(NV_SERIAL_X86_SIMD)
+  __builtin_cpu_init();
+  if (!strcmp(simd_env, "avx512") && __builtin_cpu_supports("avx512f"))
+  {
+    return &nvKernelsAVX512;
+  }
+  if (!strcmp(simd_env, "avx2") && __builtin_cpu_supports("avx2"))
+  {
+    return &nvKernelsAVX2;
+  }
+#elif defined(NV_SERIAL_NEON_SIMD)
+  if (!strcmp(simd_env, "neon")) { return &nvKernelsNEON; }
+#endif
+
+  k = nvDefaultKernels();
+  fprintf(stderr,
+          "[WARNING][%s] SUNDIALS_NVECTOR_SERIAL_SIMD=%s is not supported, "
+          "using %s\n",
+          __func__, simd_env, k->name);
+  return k;
+}
+
+const NVSerialKernels* nvSerialGetKernels(void)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  /* the selection is idempotent, so concurrent first calls are harmless */
+  static const NVSerialKernels* kernels = NULL;
+  const NVSerialKernels* k = __atomic_load_n(&kernels, __ATOMIC_ACQUIRE);
+  if (k == NULL)
+  {
+    k = nvSelectKernels();
+    __atomic_store_n(&kernels, k, __ATOMIC_RELEASE);
+  }
+  return k;
+#else
+  return &nvKernelsC;
+#endif
+}
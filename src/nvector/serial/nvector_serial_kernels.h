@@ -0,0 +1,66 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Private header for the streaming kernels used by the serial
+ * NVECTOR. A table of kernels is selected once at runtime based
+ * on the instruction sets supported by the host CPU (AVX2 or
+ * AVX-512 on x86-64, NEON on AArch64) with a portable C fallback.
+ *
+ * All kernels accept arrays that alias exactly (e.g., z == x) but
+ * not arrays that partially overlap.
+ * -----------------------------------------------------------------*/
+
+#ifndef _NVECTOR_SERIAL_KERNELS_H
+#define _NVECTOR_SERIAL_KERNELS_H
+
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+  /* name of the instruction set used by the kernels */
+  const char* name;
+
+  /* z = a x + b y */
+  void (*axpby)(sunindextype n, sunrealtype a, const sunrealtype* x,
+                sunrealtype b, const sunrealtype* y, sunrealtype* z);
+
+  /* y = a x + y */
+  void (*axpy)(sunindextype n, sunrealtype a, const sunrealtype* x,
+               sunrealtype* y);
+
+  /* z = a x */
+  void (*scale)(sunindextype n, sunrealtype a, const sunrealtype* x,
+                sunrealtype* z);
+
+  /* sum_i x_i y_i */
+  sunrealtype (*dot)(sunindextype n, const sunrealtype* x,
+                     const sunrealtype* y);
+
+  /* sum_i (x_i w_i)^2 */
+  sunrealtype (*wsqrsum)(sunindextype n, const sunrealtype* x,
+                         const sunrealtype* w);
+} NVSerialKernels;
+
+/* Returns the kernel table for the host CPU. A kernel table can be selected
+   by setting the environment variable SUNDIALS_NVECTOR_SERIAL_SIMD to one
+   of "none", "avx2", "avx512", or "neon". If the selected kernels are not
+   supported, a warning is printed and the default kernels are used. */
+const NVSerialKernels* nvSerialGetKernels(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
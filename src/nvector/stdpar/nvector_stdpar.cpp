@@ -0,0 +1,1128 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for the C++17 parallel algorithms
+ * (stdpar) implementation of the NVECTOR package.
+ *
+ * Every operation is a single call to a standard library algorithm
+ * with the std::execution::par_unseq policy. Operations on one or two
+ * arrays use the data pointers as iterators, operations on more
+ * arrays iterate over the vector indices. The fused operations
+ * update or read all of their vectors in a single pass.
+ * -----------------------------------------------------------------*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <execution>
+#include <iterator>
+#include <numeric>
+
+#include <nvector/nvector_stdpar.h>
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_core.h>
+#include <sundials/sundials_errors.h>
+
+#include "sundials_macros.h"
+
+#define ZERO   SUN_RCONST(0.0)
+#define HALF   SUN_RCONST(0.5)
+#define ONE    SUN_RCONST(1.0)
+#define ONEPT5 SUN_RCONST(1.5)
+
+namespace {
+
+// Execution policy used by all operations
+constexpr auto& policy = std::execution::par_unseq;
+
+// Random access iterator over the indices [0, N) of a vector
+class IndexIterator
+{
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type        = sunindextype;
+  using difference_type   = sunindextype;
+  using pointer           = const sunindextype*;
+  using reference         = sunindextype;
+
+  IndexIterator() = default;
+
+  explicit IndexIterator(sunindextype i) : i_(i) {}
+
+  reference operator*() const { return i_; }
+
+  reference operator[](difference_type n) const { return i_ + n; }
+
+  IndexIterator& operator++()
+  {
+    ++i_;
+    return *this;
+  }
+
+  IndexIterator operator++(int)
+  {
+    IndexIterator tmp(*this);
+    ++i_;
+    return tmp;
+  }
+
+  IndexIterator& operator--()
+  {
+    --i_;
+    return *this;
+  }
+
+  IndexIterator operator--(int)
+  {
+    IndexIterator tmp(*this);
+    --i_;
+    return tmp;
+  }
+
+  IndexIterator& operator+=(difference_type n)
+  {
+    i_ += n;
+    return *this;
+  }
+
+  IndexIterator& operator-=(difference_type n)
+  {
+    i_ -= n;
+    return *this;
+  }
+
+  friend IndexIterator operator+(IndexIterator it, difference_type n)
+  {
+    return it += n;
+  }
+
+  friend IndexIterator operator+(difference_type n, IndexIterator it)
+  {
+    return it += n;
+  }
+
+  friend IndexIterator operator-(IndexIterator it, difference_type n)
+  {
+    return it -= n;
+  }
+
+  friend difference_type operator-(IndexIterator a, IndexIterator b)
+  {
+    return a.i_ - b.i_;
+  }
+
+  friend bool operator==(IndexIterator a, IndexIterator b)
+  {
+    return a.i_ == b.i_;
+  }
+
+  friend bool operator!=(IndexIterator a, IndexIterator b)
+  {
+    return a.i_ != b.i_;
+  }
+
+  friend bool operator<(IndexIterator a, IndexIterator b)
+  {
+    return a.i_ < b.i_;
+  }
+
+  friend bool operator>(IndexIterator a, IndexIterator b)
+  {
+    return a.i_ > b.i_;
+  }
+
+  friend bool operator<=(IndexIterator a, IndexIterator b)
+  {
+    return a.i_ <= b.i_;
+  }
+
+  friend bool operator>=(IndexIterator a, IndexIterator b)
+  {
+    return a.i_ >= b.i_;
+  }
+
+private:
+  sunindextype i_{0};
+};
+
+// Calls f(i) for every index i of a vector of length N
+template<class F>
+void forEachIndex(sunindextype N, F f)
+{
+  std::for_each(policy, IndexIterator(0), IndexIterator(N), f);
+}
+
+// Reduces f(i) over every index i of a vector of length N with op
+template<class Op, class F>
+sunrealtype reduceIndex(sunindextype N, sunrealtype init, Op op, F f)
+{
+  return std::transform_reduce(policy, IndexIterator(0), IndexIterator(N),
+                               init, op, f);
+}
+
+// Reduction operators
+const auto plusOp = [](sunrealtype a, sunrealtype b) { return a + b; };
+const auto maxOp  = [](sunrealtype a, sunrealtype b) { return SUNMAX(a, b); };
+const auto minOp  = [](sunrealtype a, sunrealtype b) { return SUNMIN(a, b); };
+
+/*
+ * -----------------------------------------------------------------
+ * kernels shared by the standard, fused, and vector array operations
+ * -----------------------------------------------------------------
+ */
+
+// z = a x + b y
+void linearSum(sunindextype N, sunrealtype a, const sunrealtype* xd,
+               sunrealtype b, const sunrealtype* yd, sunrealtype* zd)
+{
+  std::transform(policy, xd, xd + N, yd, zd,
+                 [=](sunrealtype x, sunrealtype y) { return a * x + b * y; });
+}
+
+// z = c x
+void scale(sunindextype N, sunrealtype c, const sunrealtype* xd,
+           sunrealtype* zd)
+{
+  std::transform(policy, xd, xd + N, zd, [=](sunrealtype x) { return c * x; });
+}
+
+// sum (x_i w_i)^2
+sunrealtype wSqrSum(sunindextype N, const sunrealtype* xd,
+                    const sunrealtype* wd)
+{
+  return std::transform_reduce(policy, xd, xd + N, wd, ZERO, plusOp,
+                               [](sunrealtype x, sunrealtype w)
+                               { return SUNSQR(x * w); });
+}
+
+// sum (x_i w_i)^2 over the components with id_i > 0
+sunrealtype wSqrSumMask(sunindextype N, const sunrealtype* xd,
+                        const sunrealtype* wd, const sunrealtype* idd)
+{
+  return reduceIndex(N, ZERO, plusOp,
+                     [=](sunindextype i)
+                     {
+                       return (idd[i] > ZERO) ? SUNSQR(xd[i] * wd[i]) : ZERO;
+                     });
+}
+
+// z = sum_i c_i x_i, z may be one of the x_i
+void linearCombination(sunindextype N, int nvec, const sunrealtype* c,
+                       sunrealtype* const* xd, sunrealtype* zd)
+{
+  forEachIndex(N,
+               [=](sunindextype j)
+               {
+                 sunrealtype sum = c[0] * xd[0][j];
+                 for (int i = 1; i < nvec; i++) { sum += c[i] * xd[i][j]; }
+                 zd[j] = sum;
+               });
+}
+
+// z_i = a_i x + y_i, z_i may be y_i
+void scaleAddMulti(sunindextype N, int nvec, const sunrealtype* a,
+                   const sunrealtype* xd, sunrealtype* const* yd,
+                   sunrealtype* const* zd)
+{
+  forEachIndex(N,
+               [=](sunindextype j)
+               {
+                 const sunrealtype x = xd[j];
+                 for (int i = 0; i < nvec; i++)
+                 {
+                   zd[i][j] = a[i] * x + yd[i][j];
+                 }
+               });
+}
+
+} // namespace
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new empty stdpar vector
+ */
+
+N_Vector N_VNewEmpty_Stdpar(sunindextype length, SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  N_Vector v;
+  N_VectorContent_Stdpar content;
+
+  SUNAssertNull(length >= 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* Create an empty vector object */
+  v = NULL;
+  v = N_VNewEmpty(sunctx);
+  SUNCheckLastErrNull();
+
+  /* Attach operations */
+
+  /* constructors, destructors, and utility operations */
+  v->ops->nvgetvectorid     = N_VGetVectorID_Stdpar;
+  v->ops->nvclone           = N_VClone_Stdpar;
+  v->ops->nvcloneempty      = N_VCloneEmpty_Stdpar;
+  v->ops->nvdestroy         = N_VDestroy_Stdpar;
+  v->ops->nvgetarraypointer = N_VGetArrayPointer_Stdpar;
+  v->ops->nvsetarraypointer = N_VSetArrayPointer_Stdpar;
+  v->ops->nvgetlength       = N_VGetLength_Stdpar;
+  v->ops->nvgetlocallength  = N_VGetLength_Stdpar;
+
+  /* standard vector operations */
+  v->ops->nvlinearsum    = N_VLinearSum_Stdpar;
+  v->ops->nvconst        = N_VConst_Stdpar;
+  v->ops->nvprod         = N_VProd_Stdpar;
+  v->ops->nvdiv          = N_VDiv_Stdpar;
+  v->ops->nvscale        = N_VScale_Stdpar;
+  v->ops->nvabs          = N_VAbs_Stdpar;
+  v->ops->nvinv          = N_VInv_Stdpar;
+  v->ops->nvaddconst     = N_VAddConst_Stdpar;
+  v->ops->nvdotprod      = N_VDotProd_Stdpar;
+  v->ops->nvmaxnorm      = N_VMaxNorm_Stdpar;
+  v->ops->nvwrmsnormmask = N_VWrmsNormMask_Stdpar;
+  v->ops->nvwrmsnorm     = N_VWrmsNorm_Stdpar;
+  v->ops->nvmin          = N_VMin_Stdpar;
+  v->ops->nvwl2norm      = N_VWL2Norm_Stdpar;
+  v->ops->nvl1norm       = N_VL1Norm_Stdpar;
+  v->ops->nvcompare      = N_VCompare_Stdpar;
+  v->ops->nvinvtest      = N_VInvTest_Stdpar;
+  v->ops->nvconstrmask   = N_VConstrMask_Stdpar;
+  v->ops->nvminquotient  = N_VMinQuotient_Stdpar;
+
+  /* local reduction operations */
+  v->ops->nvdotprodlocal     = N_VDotProd_Stdpar;
+  v->ops->nvmaxnormlocal     = N_VMaxNorm_Stdpar;
+  v->ops->nvminlocal         = N_VMin_Stdpar;
+  v->ops->nvl1normlocal      = N_VL1Norm_Stdpar;
+  v->ops->nvinvtestlocal     = N_VInvTest_Stdpar;
+  v->ops->nvconstrmasklocal  = N_VConstrMask_Stdpar;
+  v->ops->nvminquotientlocal = N_VMinQuotient_Stdpar;
+  v->ops->nvwsqrsumlocal     = N_VWSqrSumLocal_Stdpar;
+  v->ops->nvwsqrsummasklocal = N_VWSqrSumMaskLocal_Stdpar;
+
+  /* XBraid interface operations */
+  v->ops->nvbufsize   = N_VBufSize_Stdpar;
+  v->ops->nvbufpack   = N_VBufPack_Stdpar;
+  v->ops->nvbufunpack = N_VBufUnpack_Stdpar;
+
+  /* debugging functions */
+  v->ops->nvprint     = N_VPrint_Stdpar;
+  v->ops->nvprintfile = N_VPrintFile_Stdpar;
+
+  /* fused, vector array, and single buffer reduction operations are enabled
+     by default since they read and write all vectors in one pass */
+  SUNCheckCallNull(N_VEnableFusedOps_Stdpar(v, SUNTRUE));
+
+  /* Create content */
+  content = NULL;
+  content = (N_VectorContent_Stdpar)malloc(sizeof *content);
+  SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
+
+  /* Attach content */
+  v->content = content;
+
+  /* Initialize content */
+  content->length   = length;
+  content->own_data = SUNFALSE;
+  content->data     = NULL;
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new stdpar vector
+ */
+
+N_Vector N_VNew_Stdpar(sunindextype length, SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  N_Vector v;
+  sunrealtype* data;
+
+  SUNAssertNull(length >= 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  v = NULL;
+  v = N_VNewEmpty_Stdpar(length, sunctx);
+  SUNCheckLastErrNull();
+
+  /* Create data */
+  data = NULL;
+  if (length > 0)
+  {
+    data = (sunrealtype*)malloc(length * sizeof(sunrealtype));
+    SUNAssertNull(data, SUN_ERR_MALLOC_FAIL);
+  }
+
+  /* Attach data */
+  NV_OWN_DATA_SP(v) = SUNTRUE;
+  NV_DATA_SP(v)     = data;
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a stdpar N_Vector with user data component
+ */
+
+N_Vector N_VMake_Stdpar(sunindextype length, sunrealtype* v_data,
+                        SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  N_Vector v;
+
+  SUNAssertNull(length >= 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  v = NULL;
+  v = N_VNewEmpty_Stdpar(length, sunctx);
+  SUNCheckLastErrNull();
+
+  if (length > 0)
+  {
+    /* Attach data */
+    NV_OWN_DATA_SP(v) = SUNFALSE;
+    NV_DATA_SP(v)     = v_data;
+  }
+
+  return (v);
+}
+
+/* ----------------------------------------------------------------
+ * Returns vector type ID. Used to identify vector implementation
+ * from abstract N_Vector interface.
+ */
+
+N_Vector_ID N_VGetVectorID_Stdpar(SUNDIALS_MAYBE_UNUSED N_Vector v)
+{
+  return SUNDIALS_NVEC_STDPAR;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to return number of vector elements
+ */
+
+sunindextype N_VGetLength_Stdpar(N_Vector v) { return NV_LENGTH_SP(v); }
+
+/* ----------------------------------------------------------------------------
+ * Function to print a stdpar vector to stdout
+ */
+
+void N_VPrint_Stdpar(N_Vector x)
+{
+  SUNFunctionBegin(x->sunctx);
+  N_VPrintFile_Stdpar(x, stdout);
+  SUNCheckLastErrVoid();
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to print a stdpar vector to outfile
+ */
+
+void N_VPrintFile_Stdpar(N_Vector x, FILE* outfile)
+{
+  sunindextype i, N;
+  sunrealtype* xd;
+
+  N  = NV_LENGTH_SP(x);
+  xd = NV_DATA_SP(x);
+
+  for (i = 0; i < N; i++) { fprintf(outfile, SUN_FORMAT_E "\n", xd[i]); }
+
+  return;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * implementation of vector operations
+ * -----------------------------------------------------------------
+ */
+
+N_Vector N_VCloneEmpty_Stdpar(N_Vector w)
+{
+  SUNFunctionBegin(w->sunctx);
+  N_Vector v;
+  N_VectorContent_Stdpar content;
+
+  /* Create vector */
+  v = NULL;
+  v = N_VNewEmpty(w->sunctx);
+  SUNCheckLastErrNull();
+
+  /* Attach operations */
+  SUNCheckCallNull(N_VCopyOps(w, v));
+
+  /* Create content */
+  content = NULL;
+  content = (N_VectorContent_Stdpar)malloc(sizeof *content);
+  SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
+
+  /* Attach content */
+  v->content = content;
+
+  /* Initialize content */
+  content->length   = NV_LENGTH_SP(w);
+  content->own_data = SUNFALSE;
+  content->data     = NULL;
+
+  return (v);
+}
+
+N_Vector N_VClone_Stdpar(N_Vector w)
+{
+  SUNFunctionBegin(w->sunctx);
+  N_Vector v;
+  sunrealtype* data;
+  sunindextype length;
+
+  v = NULL;
+  v = N_VCloneEmpty_Stdpar(w);
+  SUNCheckLastErrNull();
+
+  length = NV_LENGTH_SP(w);
+
+  /* Create data */
+  data = NULL;
+  if (length > 0)
+  {
+    data = (sunrealtype*)malloc(length * sizeof(sunrealtype));
+    SUNAssertNull(data, SUN_ERR_MALLOC_FAIL);
+
+    /* Attach data */
+    NV_OWN_DATA_SP(v) = SUNTRUE;
+    NV_DATA_SP(v)     = data;
+  }
+
+  return (v);
+}
+
+void N_VDestroy_Stdpar(N_Vector v)
+{
+  if (v == NULL) { return; }
+
+  /* free content */
+  if (v->content != NULL)
+  {
+    /* free data array if it's owned by the vector */
+    if (NV_OWN_DATA_SP(v) && NV_DATA_SP(v) != NULL)
+    {
+      free(NV_DATA_SP(v));
+      NV_DATA_SP(v) = NULL;
+    }
+    free(v->content);
+    v->content = NULL;
+  }
+
+  /* free ops and vector */
+  if (v->ops != NULL)
+  {
+    free(v->ops);
+    v->ops = NULL;
+  }
+  free(v);
+  v = NULL;
+
+  return;
+}
+
+sunrealtype* N_VGetArrayPointer_Stdpar(N_Vector v)
+{
+  return ((sunrealtype*)NV_DATA_SP(v));
+}
+
+void N_VSetArrayPointer_Stdpar(sunrealtype* v_data, N_Vector v)
+{
+  if (NV_LENGTH_SP(v) > 0) { NV_DATA_SP(v) = v_data; }
+
+  return;
+}
+
+void N_VLinearSum_Stdpar(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
+                         N_Vector z)
+{
+  linearSum(NV_LENGTH_SP(x), a, NV_DATA_SP(x), b, NV_DATA_SP(y), NV_DATA_SP(z));
+  return;
+}
+
+void N_VConst_Stdpar(sunrealtype c, N_Vector z)
+{
+  sunrealtype* zd = NV_DATA_SP(z);
+
+  std::fill(policy, zd, zd + NV_LENGTH_SP(z), c);
+
+  return;
+}
+
+void N_VProd_Stdpar(N_Vector x, N_Vector y, N_Vector z)
+{
+  sunrealtype* xd = NV_DATA_SP(x);
+
+  std::transform(policy, xd, xd + NV_LENGTH_SP(x), NV_DATA_SP(y), NV_DATA_SP(z),
+                 [](sunrealtype xi, sunrealtype yi) { return xi * yi; });
+
+  return;
+}
+
+void N_VDiv_Stdpar(N_Vector x, N_Vector y, N_Vector z)
+{
+  sunrealtype* xd = NV_DATA_SP(x);
+
+  std::transform(policy, xd, xd + NV_LENGTH_SP(x), NV_DATA_SP(y), NV_DATA_SP(z),
+                 [](sunrealtype xi, sunrealtype yi) { return xi / yi; });
+
+  return;
+}
+
+void N_VScale_Stdpar(sunrealtype c, N_Vector x, N_Vector z)
+{
+  scale(NV_LENGTH_SP(x), c, NV_DATA_SP(x), NV_DATA_SP(z));
+  return;
+}
+
+void N_VAbs_Stdpar(N_Vector x, N_Vector z)
+{
+  sunrealtype* xd = NV_DATA_SP(x);
+
+  std::transform(policy, xd, xd + NV_LENGTH_SP(x), NV_DATA_SP(z),
+                 [](sunrealtype xi) { return SUNRabs(xi); });
+
+  return;
+}
+
+void N_VInv_Stdpar(N_Vector x, N_Vector z)
+{
+  sunrealtype* xd = NV_DATA_SP(x);
+
+  std::transform(policy, xd, xd + NV_LENGTH_SP(x), NV_DATA_SP(z),
+                 [](sunrealtype xi) { return ONE / xi; });
+
+  return;
+}
+
+void N_VAddConst_Stdpar(N_Vector x, sunrealtype b, N_Vector z)
+{
+  sunrealtype* xd = NV_DATA_SP(x);
+
+  std::transform(policy, xd, xd + NV_LENGTH_SP(x), NV_DATA_SP(z),
+                 [=](sunrealtype xi) { return xi + b; });
+
+  return;
+}
+
+sunrealtype N_VDotProd_Stdpar(N_Vector x, N_Vector y)
+{
+  sunrealtype* xd = NV_DATA_SP(x);
+
+  return std::transform_reduce(policy, xd, xd + NV_LENGTH_SP(x), NV_DATA_SP(y),
+                               ZERO);
+}
+
+sunrealtype N_VMaxNorm_Stdpar(N_Vector x)
+{
+  sunrealtype* xd = NV_DATA_SP(x);
+
+  return std::transform_reduce(policy, xd, xd + NV_LENGTH_SP(x), ZERO, maxOp,
+                               [](sunrealtype xi) { return SUNRabs(xi); });
+}
+
+sunrealtype N_VWrmsNorm_Stdpar(N_Vector x, N_Vector w)
+{
+  return SUNRsqrt(N_VWSqrSumLocal_Stdpar(x, w) / NV_LENGTH_SP(x));
+}
+
+sunrealtype N_VWSqrSumLocal_Stdpar(N_Vector x, N_Vector w)
+{
+  return wSqrSum(NV_LENGTH_SP(x), NV_DATA_SP(x), NV_DATA_SP(w));
+}
+
+sunrealtype N_VWrmsNormMask_Stdpar(N_Vector x, N_Vector w, N_Vector id)
+{
+  return SUNRsqrt(N_VWSqrSumMaskLocal_Stdpar(x, w, id) / NV_LENGTH_SP(x));
+}
+
+sunrealtype N_VWSqrSumMaskLocal_Stdpar(N_Vector x, N_Vector w, N_Vector id)
+{
+  return wSqrSumMask(NV_LENGTH_SP(x), NV_DATA_SP(x), NV_DATA_SP(w),
+                     NV_DATA_SP(id));
+}
+
+sunrealtype N_VMin_Stdpar(N_Vector x)
+{
+  sunindextype N  = NV_LENGTH_SP(x);
+  sunrealtype* xd = NV_DATA_SP(x);
+
+  if (N == 0) { return SUN_BIG_REAL; }
+
+  return std::reduce(policy, xd, xd + N, xd[0], minOp);
+}
+
+sunrealtype N_VWL2Norm_Stdpar(N_Vector x, N_Vector w)
+{
+  return SUNRsqrt(N_VWSqrSumLocal_Stdpar(x, w));
+}
+
+sunrealtype N_VL1Norm_Stdpar(N_Vector x)
+{
+  sunrealtype* xd = NV_DATA_SP(x);
+
+  return std::transform_reduce(policy, xd, xd + NV_LENGTH_SP(x), ZERO, plusOp,
+                               [](sunrealtype xi) { return SUNRabs(xi); });
+}
+
+void N_VCompare_Stdpar(sunrealtype c, N_Vector x, N_Vector z)
+{
+  sunrealtype* xd = NV_DATA_SP(x);
+
+  std::transform(policy, xd, xd + NV_LENGTH_SP(x), NV_DATA_SP(z),
+                 [=](sunrealtype xi)
+                 { return (SUNRabs(xi) >= c) ? ONE : ZERO; });
+
+  return;
+}
+
+sunbooleantype N_VInvTest_Stdpar(N_Vector x, N_Vector z)
+{
+  sunrealtype* xd = NV_DATA_SP(x);
+  sunrealtype* zd = NV_DATA_SP(z);
+  sunrealtype zero_found;
+
+  /* one if a zero component is found, z is only set where x is nonzero */
+  zero_found = reduceIndex(NV_LENGTH_SP(x), ZERO, maxOp,
+                           [=](sunindextype i)
+                           {
+                             if (xd[i] == ZERO) { return ONE; }
+                             zd[i] = ONE / xd[i];
+                             return ZERO;
+                           });
+
+  return (zero_found == ONE) ? SUNFALSE : SUNTRUE;
+}
+
+sunbooleantype N_VConstrMask_Stdpar(N_Vector c, N_Vector x, N_Vector m)
+{
+  sunrealtype* cd = NV_DATA_SP(c);
+  sunrealtype* xd = NV_DATA_SP(x);
+  sunrealtype* md = NV_DATA_SP(m);
+  sunrealtype temp;
+
+  temp = reduceIndex(NV_LENGTH_SP(x), ZERO, maxOp,
+                     [=](sunindextype i)
+                     {
+                       md[i] = ZERO;
+
+                       /* Continue if no constraints were set */
+                       if (cd[i] == ZERO) { return ZERO; }
+
+                       /* Check if a set constraint has been violated */
+                       if ((SUNRabs(cd[i]) > ONEPT5 && xd[i] * cd[i] <= ZERO) ||
+                           (SUNRabs(cd[i]) > HALF && xd[i] * cd[i] < ZERO))
+                       {
+                         md[i] = ONE;
+                       }
+                       return md[i];
+                     });
+
+  /* Return false if any constraint was violated */
+  return (temp == ONE) ? SUNFALSE : SUNTRUE;
+}
+
+sunrealtype N_VMinQuotient_Stdpar(N_Vector num, N_Vector denom)
+{
+  sunrealtype* nd = NV_DATA_SP(num);
+  sunrealtype* dd = NV_DATA_SP(denom);
+
+  return reduceIndex(NV_LENGTH_SP(num), SUN_BIG_REAL, minOp,
+                     [=](sunindextype i)
+                     {
+                       return (dd[i] == ZERO) ? SUN_BIG_REAL : nd[i] / dd[i];
+                     });
+}
+
+/*
+ * -----------------------------------------------------------------
+ * fused vector operations
+ * -----------------------------------------------------------------
+ */
+
+SUNErrCode N_VLinearCombination_Stdpar(int nvec, sunrealtype* c, N_Vector* X,
+                                       N_Vector z)
+{
+  SUNFunctionBegin(X[0]->sunctx);
+  int i;
+  sunrealtype** xd;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* should have called N_VScale */
+  if (nvec == 1)
+  {
+    N_VScale_Stdpar(c[0], X[0], z);
+    return SUN_SUCCESS;
+  }
+
+  /* should have called N_VLinearSum */
+  if (nvec == 2)
+  {
+    N_VLinearSum_Stdpar(c[0], X[0], c[1], X[1], z);
+    return SUN_SUCCESS;
+  }
+
+  /* data arrays of the vectors */
+  xd = (sunrealtype**)malloc(nvec * sizeof(sunrealtype*));
+  SUNAssert(xd, SUN_ERR_MALLOC_FAIL);
+  for (i = 0; i < nvec; i++) { xd[i] = NV_DATA_SP(X[i]); }
+
+  /* z = sum{ c[i] * X[i] }, i = 0,...,nvec-1 */
+  linearCombination(NV_LENGTH_SP(z), nvec, c, xd, NV_DATA_SP(z));
+
+  free(xd);
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VScaleAddMulti_Stdpar(int nvec, sunrealtype* a, N_Vector x,
+                                   N_Vector* Y, N_Vector* Z)
+{
+  SUNFunctionBegin(x->sunctx);
+  int i;
+  sunrealtype** yd;
+  sunrealtype** zd;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* should have called N_VLinearSum */
+  if (nvec == 1)
+  {
+    N_VLinearSum_Stdpar(a[0], x, ONE, Y[0], Z[0]);
+    return SUN_SUCCESS;
+  }
+
+  /* data arrays of the vectors */
+  yd = (sunrealtype**)malloc(2 * nvec * sizeof(sunrealtype*));
+  SUNAssert(yd, SUN_ERR_MALLOC_FAIL);
+  zd = yd + nvec;
+  for (i = 0; i < nvec; i++)
+  {
+    yd[i] = NV_DATA_SP(Y[i]);
+    zd[i] = NV_DATA_SP(Z[i]);
+  }
+
+  /* Z[i][j] = Y[i][j] + a[i] * x[j] */
+  scaleAddMulti(NV_LENGTH_SP(x), nvec, a, NV_DATA_SP(x), yd, zd);
+
+  free(yd);
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VDotProdMulti_Stdpar(int nvec, N_Vector x, N_Vector* Y,
+                                  sunrealtype* dotprods)
+{
+  SUNFunctionBegin(x->sunctx);
+  int i;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* compute multiple dot products */
+  for (i = 0; i < nvec; i++) { dotprods[i] = N_VDotProd_Stdpar(x, Y[i]); }
+
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * vector array operations
+ * -----------------------------------------------------------------
+ */
+
+SUNErrCode N_VLinearSumVectorArray_Stdpar(int nvec, sunrealtype a, N_Vector* X,
+                                          sunrealtype b, N_Vector* Y, N_Vector* Z)
+{
+  SUNFunctionBegin(X[0]->sunctx);
+  int i;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* Z[i] = a X[i] + b Y[i] */
+  for (i = 0; i < nvec; i++) { N_VLinearSum_Stdpar(a, X[i], b, Y[i], Z[i]); }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VScaleVectorArray_Stdpar(int nvec, sunrealtype* c, N_Vector* X,
+                                      N_Vector* Z)
+{
+  SUNFunctionBegin(X[0]->sunctx);
+  int i;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* Z[i] = c[i] X[i] */
+  for (i = 0; i < nvec; i++) { N_VScale_Stdpar(c[i], X[i], Z[i]); }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VConstVectorArray_Stdpar(int nvec, sunrealtype c, N_Vector* Z)
+{
+  SUNFunctionBegin(Z[0]->sunctx);
+  int i;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* Z[i] = c */
+  for (i = 0; i < nvec; i++) { N_VConst_Stdpar(c, Z[i]); }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VWrmsNormVectorArray_Stdpar(int nvec, N_Vector* X, N_Vector* W,
+                                         sunrealtype* nrm)
+{
+  SUNFunctionBegin(X[0]->sunctx);
+  int i;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* compute the WRMS norm of each vector */
+  for (i = 0; i < nvec; i++) { nrm[i] = N_VWrmsNorm_Stdpar(X[i], W[i]); }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VWrmsNormMaskVectorArray_Stdpar(int nvec, N_Vector* X, N_Vector* W,
+                                             N_Vector id, sunrealtype* nrm)
+{
+  SUNFunctionBegin(X[0]->sunctx);
+  int i;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* compute the masked WRMS norm of each vector */
+  for (i = 0; i < nvec; i++)
+  {
+    nrm[i] = N_VWrmsNormMask_Stdpar(X[i], W[i], id);
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VScaleAddMultiVectorArray_Stdpar(int nvec, int nsum,
+                                              sunrealtype* a, N_Vector* X,
+                                              N_Vector** Y, N_Vector** Z)
+{
+  SUNFunctionBegin(X[0]->sunctx);
+  int i, j;
+  sunrealtype** yd;
+  sunrealtype** zd;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssert(nsum >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* data arrays of the vectors */
+  yd = (sunrealtype**)malloc(2 * nsum * sizeof(sunrealtype*));
+  SUNAssert(yd, SUN_ERR_MALLOC_FAIL);
+  zd = yd + nsum;
+
+  /* Z[j][i] = Y[j][i] + a[j] * X[i], one pass over each X[i] */
+  for (i = 0; i < nvec; i++)
+  {
+    for (j = 0; j < nsum; j++)
+    {
+      yd[j] = NV_DATA_SP(Y[j][i]);
+      zd[j] = NV_DATA_SP(Z[j][i]);
+    }
+    scaleAddMulti(NV_LENGTH_SP(X[i]), nsum, a, NV_DATA_SP(X[i]), yd, zd);
+  }
+
+  free(yd);
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VLinearCombinationVectorArray_Stdpar(int nvec, int nsum,
+                                                  sunrealtype* c, N_Vector** X,
+                                                  N_Vector* Z)
+{
+  SUNFunctionBegin(Z[0]->sunctx);
+  int i, j;
+  sunrealtype** xd;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssert(nsum >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* data arrays of the vectors */
+  xd = (sunrealtype**)malloc(nsum * sizeof(sunrealtype*));
+  SUNAssert(xd, SUN_ERR_MALLOC_FAIL);
+
+  /* Z[i] = sum{ c[j] * X[j][i] }, j = 0,...,nsum-1, one pass over each Z[i] */
+  for (i = 0; i < nvec; i++)
+  {
+    for (j = 0; j < nsum; j++) { xd[j] = NV_DATA_SP(X[j][i]); }
+    linearCombination(NV_LENGTH_SP(Z[i]), nsum, c, xd, NV_DATA_SP(Z[i]));
+  }
+
+  free(xd);
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * OPTIONAL XBraid interface operations
+ * -----------------------------------------------------------------
+ */
+
+SUNErrCode N_VBufSize_Stdpar(N_Vector x, sunindextype* size)
+{
+  *size = NV_LENGTH_SP(x) * ((sunindextype)sizeof(sunrealtype));
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VBufPack_Stdpar(N_Vector x, void* buf)
+{
+  SUNFunctionBegin(x->sunctx);
+  sunrealtype* xd = NV_DATA_SP(x);
+
+  SUNAssert(buf, SUN_ERR_ARG_CORRUPT);
+
+  std::copy(policy, xd, xd + NV_LENGTH_SP(x), (sunrealtype*)buf);
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VBufUnpack_Stdpar(N_Vector x, void* buf)
+{
+  SUNFunctionBegin(x->sunctx);
+  sunrealtype* bd = (sunrealtype*)buf;
+
+  SUNAssert(buf, SUN_ERR_ARG_CORRUPT);
+
+  std::copy(policy, bd, bd + NV_LENGTH_SP(x), NV_DATA_SP(x));
+
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Enable / Disable fused and vector array operations
+ * -----------------------------------------------------------------
+ */
+
+SUNErrCode N_VEnableFusedOps_Stdpar(N_Vector v, sunbooleantype tf)
+{
+  if (tf)
+  {
+    /* enable all fused vector operations */
+    v->ops->nvlinearcombination = N_VLinearCombination_Stdpar;
+    v->ops->nvscaleaddmulti     = N_VScaleAddMulti_Stdpar;
+    v->ops->nvdotprodmulti      = N_VDotProdMulti_Stdpar;
+    /* enable all vector array operations */
+    v->ops->nvlinearsumvectorarray     = N_VLinearSumVectorArray_Stdpar;
+    v->ops->nvscalevectorarray         = N_VScaleVectorArray_Stdpar;
+    v->ops->nvconstvectorarray         = N_VConstVectorArray_Stdpar;
+    v->ops->nvwrmsnormvectorarray      = N_VWrmsNormVectorArray_Stdpar;
+    v->ops->nvwrmsnormmaskvectorarray  = N_VWrmsNormMaskVectorArray_Stdpar;
+    v->ops->nvscaleaddmultivectorarray = N_VScaleAddMultiVectorArray_Stdpar;
+    v->ops->nvlinearcombinationvectorarray =
+      N_VLinearCombinationVectorArray_Stdpar;
+    /* enable single buffer reduction operations */
+    v->ops->nvdotprodmultilocal = N_VDotProdMulti_Stdpar;
+  }
+  else
+  {
+    /* disable all fused vector operations */
+    v->ops->nvlinearcombination = NULL;
+    v->ops->nvscaleaddmulti     = NULL;
+    v->ops->nvdotprodmulti      = NULL;
+    /* disable all vector array operations */
+    v->ops->nvlinearsumvectorarray         = NULL;
+    v->ops->nvscalevectorarray             = NULL;
+    v->ops->nvconstvectorarray             = NULL;
+    v->ops->nvwrmsnormvectorarray          = NULL;
+    v->ops->nvwrmsnormmaskvectorarray      = NULL;
+    v->ops->nvscaleaddmultivectorarray     = NULL;
+    v->ops->nvlinearcombinationvectorarray = NULL;
+    /* disable single buffer reduction operations */
+    v->ops->nvdotprodmultilocal = NULL;
+  }
+
+  /* return success */
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnableLinearCombination_Stdpar(N_Vector v, sunbooleantype tf)
+{
+  v->ops->nvlinearcombination = tf ? N_VLinearCombination_Stdpar : NULL;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnableScaleAddMulti_Stdpar(N_Vector v, sunbooleantype tf)
+{
+  v->ops->nvscaleaddmulti = tf ? N_VScaleAddMulti_Stdpar : NULL;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnableDotProdMulti_Stdpar(N_Vector v, sunbooleantype tf)
+{
+  v->ops->nvdotprodmulti      = tf ? N_VDotProdMulti_Stdpar : NULL;
+  v->ops->nvdotprodmultilocal = tf ? N_VDotProdMulti_Stdpar : NULL;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnableLinearSumVectorArray_Stdpar(N_Vector v, sunbooleantype tf)
+{
+  v->ops->nvlinearsumvectorarray = tf ? N_VLinearSumVectorArray_Stdpar : NULL;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnableScaleVectorArray_Stdpar(N_Vector v, sunbooleantype tf)
+{
+  v->ops->nvscalevectorarray = tf ? N_VScaleVectorArray_Stdpar : NULL;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnableConstVectorArray_Stdpar(N_Vector v, sunbooleantype tf)
+{
+  v->ops->nvconstvectorarray = tf ? N_VConstVectorArray_Stdpar : NULL;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnableWrmsNormVectorArray_Stdpar(N_Vector v, sunbooleantype tf)
+{
+  v->ops->nvwrmsnormvectorarray = tf ? N_VWrmsNormVectorArray_Stdpar : NULL;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnableWrmsNormMaskVectorArray_Stdpar(N_Vector v, sunbooleantype tf)
+{
+  v->ops->nvwrmsnormmaskvectorarray = tf ? N_VWrmsNormMaskVectorArray_Stdpar
+                                         : NULL;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnableScaleAddMultiVectorArray_Stdpar(N_Vector v,
+                                                    sunbooleantype tf)
+{
+  v->ops->nvscaleaddmultivectorarray = tf ? N_VScaleAddMultiVectorArray_Stdpar
+                                          : NULL;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VEnableLinearCombinationVectorArray_Stdpar(N_Vector v,
+                                                        sunbooleantype tf)
+{
+  v->ops->nvlinearcombinationvectorarray =
+    tf ? N_VLinearCombinationVectorArray_Stdpar : NULL;
+  return SUN_SUCCESS;
+}
@@ -1911,6 +1911,30 @@ SWIGEXPORT int _wrap_FSUNClassicalGS(void *farg1, void *farg2, int const *farg3,
 }
 
 
+SWIGEXPORT int _wrap_FSUNClassicalGSEstNorm(void *farg1, void *farg2, int const *farg3, int const *farg4, double *farg5, double *farg6, void *farg7) {
+  int fresult ;
+  N_Vector *arg1 = (N_Vector *) 0 ;
+  sunrealtype **arg2 = (sunrealtype **) 0 ;
+  int arg3 ;
+  int arg4 ;
+  sunrealtype *arg5 = (sunrealtype *) 0 ;
+  sunrealtype *arg6 = (sunrealtype *) 0 ;
+  N_Vector *arg7 = (N_Vector *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (N_Vector *)(farg1);
+  arg2 = (sunrealtype **)(farg2);
+  arg3 = (int)(*farg3);
+  arg4 = (int)(*farg4);
+  arg5 = (sunrealtype *)(farg5);
+  arg6 = (sunrealtype *)(farg6);
+  arg7 = (N_Vector *)(farg7);
+  result = (SUNErrCode)SUNClassicalGSEstNorm(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FSUNQRfact(int const *farg1, void *farg2, double *farg3, int const *farg4) {
   int fresult ;
   int arg1 ;
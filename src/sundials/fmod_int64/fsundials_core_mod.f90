@@ -373,6 +373,7 @@ module fsundials_core_mod
  public :: SUN_MODIFIED_GS, SUN_CLASSICAL_GS
  public :: FSUNModifiedGS
  public :: FSUNClassicalGS
+ public :: FSUNClassicalGSEstNorm
  public :: FSUNQRfact
  public :: FSUNQRsol
  public :: FSUNQRAdd_MGS
@@ -1690,6 +1691,20 @@ type(C_PTR), value :: farg7
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNClassicalGSEstNorm(farg1, farg2, farg3, farg4, farg5, farg6, farg7) &
+bind(C, name="_wrap_FSUNClassicalGSEstNorm") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT), intent(in) :: farg3
+integer(C_INT), intent(in) :: farg4
+type(C_PTR), value :: farg5
+type(C_PTR), value :: farg6
+type(C_PTR), value :: farg7
+integer(C_INT) :: fresult
+end function
+
 function swigc_FSUNQRfact(farg1, farg2, farg3, farg4) &
 bind(C, name="_wrap_FSUNQRfact") &
 result(fresult)
@@ -4709,6 +4724,37 @@ fresult = swigc_FSUNClassicalGS(farg1, farg2, farg3, farg4, farg5, farg6, farg7)
 swig_result = fresult
 end function
 
+function FSUNClassicalGSEstNorm(v, h, k, p, new_vk_norm, stemp, vtemp) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: v
+type(C_PTR), target, intent(inout) :: h
+integer(C_INT), intent(in) :: k
+integer(C_INT), intent(in) :: p
+real(C_DOUBLE), dimension(*), target, intent(inout) :: new_vk_norm
+real(C_DOUBLE), dimension(*), target, intent(inout) :: stemp
+type(C_PTR) :: vtemp
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+integer(C_INT) :: farg3 
+integer(C_INT) :: farg4 
+type(C_PTR) :: farg5 
+type(C_PTR) :: farg6 
+type(C_PTR) :: farg7 
+
+farg1 = v
+farg2 = c_loc(h)
+farg3 = k
+farg4 = p
+farg5 = c_loc(new_vk_norm(1))
+farg6 = c_loc(stemp(1))
+farg7 = vtemp
+fresult = swigc_FSUNClassicalGSEstNorm(farg1, farg2, farg3, farg4, farg5, farg6, farg7)
+swig_result = fresult
+end function
+
 function FSUNQRfact(n, h, q, job) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -23,6 +23,9 @@
 #include <sundials/sundials_dense.h>
 #include <sundials/sundials_math.h>
 
+#include "sundials_dense_impl.h"
+#include "sundials_macros.h"
+
 #define ZERO SUN_RCONST(0.0)
 #define ONE  SUN_RCONST(1.0)
 #define TWO  SUN_RCONST(2.0)
@@ -82,76 +85,15 @@ void SUNDlsMat_DenseMatvec(SUNDlsMat A, sunrealtype* x, sunrealtype* y)
 sunindextype SUNDlsMat_denseGETRF(sunrealtype** a, sunindextype m,
                                   sunindextype n, sunindextype* p)
 {
-  sunindextype i, j, k, l;
-  sunrealtype *col_j, *col_k;
-  sunrealtype temp, mult, a_kj;
-
-  /* k-th elimination step number */
-  for (k = 0; k < n; k++)
-  {
-    col_k = a[k];
-
-    /* find l = pivot row number */
-    l = k;
-    for (i = k + 1; i < m; i++)
-    {
-      if (SUNRabs(col_k[i]) > SUNRabs(col_k[l])) { l = i; }
-    }
-    p[k] = l;
-
-    /* check for zero pivot element */
-    if (col_k[l] == ZERO) { return (k + 1); }
-
-    /* swap a(k,1:n) and a(l,1:n) if necessary */
-    if (l != k)
-    {
-      for (i = 0; i < n; i++)
-      {
-        temp    = a[i][l];
-        a[i][l] = a[i][k];
-        a[i][k] = temp;
-      }
-    }
-
-    /* Scale the elements below the diagonal in
-     * column k by 1.0/a(k,k). After the above swap
-     * a(k,k) holds the pivot element. This scaling
-     * stores the pivot row multipliers a(i,k)/a(k,k)
-     * in a(i,k), i=k+1, ..., m-1.
-     */
-    mult = ONE / col_k[k];
-    for (i = k + 1; i < m; i++) { col_k[i] *= mult; }
-
-    /* row_i = row_i - [a(i,k)/a(k,k)] row_k, i=k+1, ..., m-1 */
-    /* row k is the pivot row after swapping with row l.      */
-    /* The computation is done one column at a time,          */
-    /* column j=k+1, ..., n-1.                                */
-
-    for (j = k + 1; j < n; j++)
-    {
-      col_j = a[j];
-      a_kj  = col_j[k];
-
-      /* a(i,j) = a(i,j) - [a(i,k)/a(k,k)]*a(k,j)  */
-      /* a_kj = a(k,j), col_k[i] = - a(i,k)/a(k,k) */
-
-      if (a_kj != ZERO)
-      {
-        for (i = k + 1; i < m; i++) { col_j[i] -= a_kj * col_k[i]; }
-      }
-    }
-  }
-
-  /* return 0 to indicate success */
-
-  return (0);
+  return (sunDenseGETRF(a, m, n, p, 1));
 }
 
 void SUNDlsMat_denseGETRS(sunrealtype** a, sunindextype n, sunindextype* p,
                           sunrealtype* b)
 {
   sunindextype i, k, pk;
-  sunrealtype *col_k, tmp;
+  sunrealtype *col_k, *c0, *c1, *c2, *c3;
+  sunrealtype tmp, b0, b1, b2, b3;
 
   /* Permute b, based on pivot information in p */
   for (k = 0; k < n; k++)
@@ -165,21 +107,81 @@ void SUNDlsMat_denseGETRS(sunrealtype** a, sunindextype n, sunindextype* p,
     }
   }
 
-  /* Solve Ly = b, store solution y in b */
-  for (k = 0; k < n - 1; k++)
+  /* Solve Ly = b, store solution y in b. The columns of L are applied four at
+     a time so b is only loaded and stored once for every four columns. */
+  for (k = 0; k + 4 <= n; k += 4)
+  {
+    c0 = a[k];
+    c1 = a[k + 1];
+    c2 = a[k + 2];
+    c3 = a[k + 3];
+
+    b[k + 1] -= c0[k + 1] * b[k];
+    b[k + 2] -= c0[k + 2] * b[k];
+    b[k + 2] -= c1[k + 2] * b[k + 1];
+    b[k + 3] -= c0[k + 3] * b[k];
+    b[k + 3] -= c1[k + 3] * b[k + 1];
+    b[k + 3] -= c2[k + 3] * b[k + 2];
+
+    b0 = b[k];
+    b1 = b[k + 1];
+    b2 = b[k + 2];
+    b3 = b[k + 3];
+    for (i = k + 4; i < n; i++)
+    {
+      tmp = b[i];
+      tmp -= c0[i] * b0;
+      tmp -= c1[i] * b1;
+      tmp -= c2[i] * b2;
+      tmp -= c3[i] * b3;
+      b[i] = tmp;
+    }
+  }
+  for (; k < n - 1; k++)
   {
     col_k = a[k];
     for (i = k + 1; i < n; i++) { b[i] -= col_k[i] * b[k]; }
   }
 
-  /* Solve Ux = y, store solution x in b */
-  for (k = n - 1; k > 0; k--)
+  /* Solve Ux = y, store solution x in b, again four columns at a time */
+  for (k = n - 1; k >= 3; k -= 4)
+  {
+    c0 = a[k];
+    c1 = a[k - 1];
+    c2 = a[k - 2];
+    c3 = a[k - 3];
+
+    b[k] /= c0[k];
+    b[k - 1] -= c0[k - 1] * b[k];
+    b[k - 1] /= c1[k - 1];
+    b[k - 2] -= c0[k - 2] * b[k];
+    b[k - 2] -= c1[k - 2] * b[k - 1];
+    b[k - 2] /= c2[k - 2];
+    b[k - 3] -= c0[k - 3] * b[k];
+    b[k - 3] -= c1[k - 3] * b[k - 1];
+    b[k - 3] -= c2[k - 3] * b[k - 2];
+    b[k - 3] /= c3[k - 3];
+
+    b0 = b[k];
+    b1 = b[k - 1];
+    b2 = b[k - 2];
+    b3 = b[k - 3];
+    for (i = 0; i < k - 3; i++)
+    {
+      tmp = b[i];
+      tmp -= c0[i] * b0;
+      tmp -= c1[i] * b1;
+      tmp -= c2[i] * b2;
+      tmp -= c3[i] * b3;
+      b[i] = tmp;
+    }
+  }
+  for (; k >= 0; k--)
   {
     col_k = a[k];
     b[k] /= col_k[k];
     for (i = 0; i < k; i++) { b[i] -= col_k[i] * b[k]; }
   }
-  b[0] /= a[0][0];
 }
 
 /*
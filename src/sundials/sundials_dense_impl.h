@@ -0,0 +1,268 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * This is the implementation header file for the blocked dense LU
+ * factorization shared by SUNDlsMat_denseGETRF and the SUNLINSOL_DENSE module.
+ * The threaded update of the remaining matrix is only compiled into files
+ * built with OpenMP, so sundials_core does not depend on the OpenMP runtime.
+ * ---------------------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_DENSE_IMPL_H
+#define _SUNDIALS_DENSE_IMPL_H
+
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+
+#include "sundials_macros.h"
+
+/*
+ * The LU factorization is computed in panels of DENSE_GETRF_NB columns. Each
+ * panel is factored with the column-oriented elimination, then its row swaps
+ * and multipliers are applied to the columns to the right of the panel in one
+ * pass (a triangular solve followed by a rank-NB update). The trailing update
+ * works on four columns and DENSE_GETRF_MB rows at a time so the updated
+ * entries stay in cache while the panel columns are streamed. Every entry
+ * receives the same updates in the same order as in the unblocked algorithm,
+ * so the factors do not depend on the blocking or the number of threads.
+ */
+
+#define DENSE_ZERO SUN_RCONST(0.0)
+#define DENSE_ONE  SUN_RCONST(1.0)
+
+#define DENSE_GETRF_NB 64
+#define DENSE_GETRF_MB 256
+
+/* Minimum number of trailing matrix entries per thread when threading */
+#define DENSE_GETRF_MIN_WORK 16384
+
+/* Factors the panel of columns k0, ..., k0+kb-1 */
+static inline sunindextype denseFactorPanel(sunrealtype** a, sunindextype m,
+                                            sunindextype k0, sunindextype kb,
+                                            sunindextype* p)
+{
+  sunindextype i, j, k, l;
+  sunrealtype *col_j, *col_k;
+  sunrealtype temp, mult, a_kj;
+
+  for (k = k0; k < k0 + kb; k++)
+  {
+    col_k = a[k];
+
+    /* find l = pivot row number */
+    l = k;
+    for (i = k + 1; i < m; i++)
+    {
+      if (SUNRabs(col_k[i]) > SUNRabs(col_k[l])) { l = i; }
+    }
+    p[k] = l;
+
+    /* check for zero pivot element */
+    if (col_k[l] == DENSE_ZERO) { return (k + 1); }
+
+    /* swap rows k and l in the panel if necessary */
+    if (l != k)
+    {
+      for (j = k0; j < k0 + kb; j++)
+      {
+        temp    = a[j][l];
+        a[j][l] = a[j][k];
+        a[j][k] = temp;
+      }
+    }
+
+    /* store the multipliers a(i,k)/a(k,k), i=k+1, ..., m-1 */
+    mult = DENSE_ONE / col_k[k];
+    for (i = k + 1; i < m; i++) { col_k[i] *= mult; }
+
+    /* update the remaining columns of the panel */
+    for (j = k + 1; j < k0 + kb; j++)
+    {
+      col_j = a[j];
+      a_kj  = col_j[k];
+      if (a_kj != DENSE_ZERO)
+      {
+        for (i = k + 1; i < m; i++) { col_j[i] -= a_kj * col_k[i]; }
+      }
+    }
+  }
+
+  return (0);
+}
+
+/* Applies the row swaps of the panel k0, ..., k0+kb-1 to columns j0, ...,
+   j1-1 */
+static inline void denseSwapRows(sunrealtype** a, sunindextype k0,
+                                 sunindextype kb, sunindextype* p,
+                                 sunindextype j0, sunindextype j1)
+{
+  sunindextype j, k, l;
+  sunrealtype *col_j, temp;
+
+  for (j = j0; j < j1; j++)
+  {
+    col_j = a[j];
+    for (k = k0; k < k0 + kb; k++)
+    {
+      l = p[k];
+      if (l != k)
+      {
+        temp     = col_j[l];
+        col_j[l] = col_j[k];
+        col_j[k] = temp;
+      }
+    }
+  }
+}
+
+/* Applies the factored panel k0, ..., k0+kb-1 to columns j0, ..., j1-1 */
+static inline void denseUpdateColumns(sunrealtype** a, sunindextype m,
+                                      sunindextype k0, sunindextype kb,
+                                      sunindextype j0, sunindextype j1)
+{
+  sunindextype i, i0, i1, j, k;
+  sunindextype kend = k0 + kb;
+  sunrealtype *col_j, *col_k, *c0, *c1, *c2, *c3, *c[4];
+  sunrealtype a_kj, u0, u1, u2, u3, l_ik, u[4];
+  int jj;
+
+  /* solve with the unit lower triangle of the panel for the rows of U */
+  for (j = j0; j < j1; j++)
+  {
+    col_j = a[j];
+    for (k = k0; k < kend; k++)
+    {
+      col_k = a[k];
+      a_kj  = col_j[k];
+      if (a_kj != DENSE_ZERO)
+      {
+        for (i = k + 1; i < kend; i++) { col_j[i] -= a_kj * col_k[i]; }
+      }
+    }
+  }
+
+  /* update the trailing rows with the panel multipliers */
+  for (i0 = kend; i0 < m; i0 += DENSE_GETRF_MB)
+  {
+    i1 = SUNMIN(i0 + DENSE_GETRF_MB, m);
+
+    for (j = j0; j + 3 < j1; j += 4)
+    {
+      c0 = a[j];
+      c1 = a[j + 1];
+      c2 = a[j + 2];
+      c3 = a[j + 3];
+      for (k = k0; k < kend; k++)
+      {
+        u0    = c0[k];
+        u1    = c1[k];
+        u2    = c2[k];
+        u3    = c3[k];
+        col_k = a[k];
+        if (u0 != DENSE_ZERO && u1 != DENSE_ZERO && u2 != DENSE_ZERO &&
+            u3 != DENSE_ZERO)
+        {
+          for (i = i0; i < i1; i++)
+          {
+            l_ik = col_k[i];
+            c0[i] -= u0 * l_ik;
+            c1[i] -= u1 * l_ik;
+            c2[i] -= u2 * l_ik;
+            c3[i] -= u3 * l_ik;
+          }
+          continue;
+        }
+
+        /* skip the columns with a zero multiplier, as the column-by-column
+           update does, so that 0 * Inf does not introduce a NaN */
+        c[0] = c0;
+        c[1] = c1;
+        c[2] = c2;
+        c[3] = c3;
+        u[0] = u0;
+        u[1] = u1;
+        u[2] = u2;
+        u[3] = u3;
+        for (jj = 0; jj < 4; jj++)
+        {
+          if (u[jj] == DENSE_ZERO) { continue; }
+          for (i = i0; i < i1; i++) { c[jj][i] -= u[jj] * col_k[i]; }
+        }
+      }
+    }
+
+    for (; j < j1; j++)
+    {
+      col_j = a[j];
+      for (k = k0; k < kend; k++)
+      {
+        a_kj = col_j[k];
+        if (a_kj != DENSE_ZERO)
+        {
+          col_k = a[k];
+          for (i = i0; i < i1; i++) { col_j[i] -= a_kj * col_k[i]; }
+        }
+      }
+    }
+  }
+}
+
+/* Computes the LU factorization of the m by n matrix a, updating the columns
+   right of each panel with up to nthreads OpenMP threads when the including
+   file is compiled with OpenMP */
+static inline sunindextype sunDenseGETRF(sunrealtype** a, sunindextype m,
+                                         sunindextype n, sunindextype* p,
+                                         SUNDIALS_MAYBE_UNUSED int nthreads)
+{
+  sunindextype k0, kb, ier;
+#if defined(_OPENMP)
+  sunindextype jg, ngroups;
+#endif
+
+  for (k0 = 0; k0 < n; k0 += DENSE_GETRF_NB)
+  {
+    kb = SUNMIN(DENSE_GETRF_NB, n - k0);
+
+    ier = denseFactorPanel(a, m, k0, kb, p);
+    if (ier != 0) { return (ier); }
+
+    /* apply the row swaps to the columns left of the panel */
+    denseSwapRows(a, k0, kb, p, 0, k0);
+
+    if (k0 + kb == n) { break; }
+
+#if defined(_OPENMP)
+    /* distribute groups of four columns right of the panel over the threads */
+    if (nthreads > 1 &&
+        (m - k0) * (n - k0 - kb) >= DENSE_GETRF_MIN_WORK * nthreads)
+    {
+      ngroups = (n - k0 - kb + 3) / 4;
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+      for (jg = 0; jg < ngroups; jg++)
+      {
+        sunindextype j0 = k0 + kb + 4 * jg;
+        sunindextype j1 = SUNMIN(j0 + 4, n);
+        denseSwapRows(a, k0, kb, p, j0, j1);
+        denseUpdateColumns(a, m, k0, kb, j0, j1);
+      }
+      continue;
+    }
+#endif
+
+    denseSwapRows(a, k0, kb, p, k0 + kb, n);
+    denseUpdateColumns(a, m, k0, kb, k0 + kb, n);
+  }
+
+  /* return 0 to indicate success */
+
+  return (0);
+}
+
+#endif
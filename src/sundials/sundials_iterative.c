@@ -110,13 +110,13 @@ SUNErrCode SUNModifiedGS(N_Vector* v, sunrealtype** h, int k, int p,
  * -----------------------------------------------------------------
  */
 
-SUNErrCode SUNClassicalGS(N_Vector* v, sunrealtype** h, int k, int p,
-                          sunrealtype* new_vk_norm, sunrealtype* stemp,
-                          N_Vector* vtemp)
+static SUNErrCode sunClassicalGS(N_Vector* v, sunrealtype** h, int k, int p,
+                                 sunrealtype* new_vk_norm, sunrealtype* stemp,
+                                 N_Vector* vtemp, sunbooleantype est_norm)
 {
   SUNFunctionBegin(v[0]->sunctx);
   int i, i0, k_minus_1;
-  sunrealtype vk_norm;
+  sunrealtype vk_norm, est_sqr;
 
   k_minus_1 = k - 1;
   i0        = SUNMAX(k - p, 0);
@@ -126,8 +126,10 @@ SUNErrCode SUNClassicalGS(N_Vector* v, sunrealtype** h, int k, int p,
   SUNCheckCall(N_VDotProdMulti(k - i0 + 1, v[k], v + i0, stemp));
 
   vk_norm = SUNRsqrt(stemp[k - i0]);
+  est_sqr = stemp[k - i0];
   for (i = k - i0 - 1; i >= 0; i--)
   {
+    est_sqr -= stemp[i] * stemp[i];
     h[i][k_minus_1] = stemp[i];
     stemp[i + 1]    = -stemp[i];
     vtemp[i + 1]    = v[i];
@@ -137,7 +139,17 @@ SUNErrCode SUNClassicalGS(N_Vector* v, sunrealtype** h, int k, int p,
 
   SUNCheckCall(N_VLinearCombination(k - i0 + 1, stemp, vtemp, v[k]));
 
-  /* Compute the norm of the new vector at v[k] */
+  /* Compute the norm of the new vector at v[k]. If requested, the norm is
+     estimated from the projections, ||v_k||^2 - sum_i h_ik^2, to save a
+     reduction. The estimate is only kept when it is not small relative to the
+     old norm (i.e., no reorthogonalization is needed), as otherwise it is
+     inaccurate due to cancellation. */
+
+  if (est_norm && est_sqr > ZERO && (FACTOR * SUNRsqrt(est_sqr)) >= vk_norm)
+  {
+    *new_vk_norm = SUNRsqrt(est_sqr);
+    return SUN_SUCCESS;
+  }
 
   *new_vk_norm = SUNRsqrt(N_VDotProd(v[k], v[k]));
   SUNCheckLastErr();
@@ -166,6 +178,20 @@ SUNErrCode SUNClassicalGS(N_Vector* v, sunrealtype** h, int k, int p,
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNClassicalGS(N_Vector* v, sunrealtype** h, int k, int p,
+                          sunrealtype* new_vk_norm, sunrealtype* stemp,
+                          N_Vector* vtemp)
+{
+  return sunClassicalGS(v, h, k, p, new_vk_norm, stemp, vtemp, SUNFALSE);
+}
+
+SUNErrCode SUNClassicalGSEstNorm(N_Vector* v, sunrealtype** h, int k, int p,
+                                 sunrealtype* new_vk_norm, sunrealtype* stemp,
+                                 N_Vector* vtemp)
+{
+  return sunClassicalGS(v, h, k, p, new_vk_norm, stemp, vtemp, SUNTRUE);
+}
+
 /*
  * -----------------------------------------------------------------
  * Function : SUNQRfact
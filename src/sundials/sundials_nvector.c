@@ -33,8 +33,27 @@ static inline SUNProfiler getSUNProfiler(N_Vector v)
 {
   return (v->sunctx->profiler);
 }
+
+static inline double getLocalLength(N_Vector v)
+{
+  if (v->ops->nvgetlocallength)
+  {
+    return ((double)v->ops->nvgetlocallength(v));
+  }
+  return ((double)v->ops->nvgetlength(v));
+}
 #endif
 
+/* Records the estimated memory traffic and flops of an operation on vectors
+   with the local length of v given the number of vector values read or
+   written and the number of flops per element. The profiler uses these with
+   the time of the operation to report the achieved GB/s and GFLOP/s. */
+#define NV_MARK_COUNTS(v, nvals, nflops)                              \
+  SUNDIALS_MARK_FUNCTION_COUNTS(getSUNProfiler(v),                    \
+                                (double)(nvals) * getLocalLength(v) * \
+                                  (double)sizeof(sunrealtype),        \
+                                (double)(nflops) * getLocalLength(v))
+
 /* -----------------------------------------------------------------
  * Methods that are not ops (i.e., non-virtual and not overridable).
  * -----------------------------------------------------------------*/
@@ -106,9 +125,11 @@ N_Vector N_VNewEmpty(SUNContext sunctx)
    */
 
   /* fused vector operations (optional) */
-  ops->nvlinearcombination = NULL;
-  ops->nvscaleaddmulti     = NULL;
-  ops->nvdotprodmulti      = NULL;
+  ops->nvlinearcombination         = NULL;
+  ops->nvscaleaddmulti             = NULL;
+  ops->nvdotprodmulti              = NULL;
+  ops->nvlinearsumwrmsnorm         = NULL;
+  ops->nvlinearcombinationwrmsnorm = NULL;
 
   /* vector array operations (optional) */
   ops->nvlinearsumvectorarray         = NULL;
@@ -137,8 +158,13 @@ N_Vector N_VNewEmpty(SUNContext sunctx)
   ops->nvwsqrsummasklocal = NULL;
 
   /* single buffer reduction operations */
-  ops->nvdotprodmultilocal     = NULL;
-  ops->nvdotprodmultiallreduce = NULL;
+  ops->nvdotprodmultilocal          = NULL;
+  ops->nvdotprodmultiallreduce      = NULL;
+  ops->nvdotprodmultiallreducebegin = NULL;
+  ops->nvdotprodmultiallreduceend   = NULL;
+
+  /* contiguous vector array constructor */
+  ops->nvclonevectorarraycontiguous = NULL;
 
   /* XBraid interface operations */
   ops->nvbufsize   = NULL;
@@ -230,9 +256,11 @@ SUNErrCode N_VCopyOps(N_Vector w, N_Vector v)
    */
 
   /* fused vector operations */
-  v->ops->nvlinearcombination = w->ops->nvlinearcombination;
-  v->ops->nvscaleaddmulti     = w->ops->nvscaleaddmulti;
-  v->ops->nvdotprodmulti      = w->ops->nvdotprodmulti;
+  v->ops->nvlinearcombination         = w->ops->nvlinearcombination;
+  v->ops->nvscaleaddmulti             = w->ops->nvscaleaddmulti;
+  v->ops->nvdotprodmulti              = w->ops->nvdotprodmulti;
+  v->ops->nvlinearsumwrmsnorm         = w->ops->nvlinearsumwrmsnorm;
+  v->ops->nvlinearcombinationwrmsnorm = w->ops->nvlinearcombinationwrmsnorm;
 
   /* vector array operations */
   v->ops->nvlinearsumvectorarray     = w->ops->nvlinearsumvectorarray;
@@ -259,8 +287,13 @@ SUNErrCode N_VCopyOps(N_Vector w, N_Vector v)
   v->ops->nvwsqrsummasklocal = w->ops->nvwsqrsummasklocal;
 
   /* single buffer reduction operations */
-  v->ops->nvdotprodmultilocal     = w->ops->nvdotprodmultilocal;
-  v->ops->nvdotprodmultiallreduce = w->ops->nvdotprodmultiallreduce;
+  v->ops->nvdotprodmultilocal          = w->ops->nvdotprodmultilocal;
+  v->ops->nvdotprodmultiallreduce      = w->ops->nvdotprodmultiallreduce;
+  v->ops->nvdotprodmultiallreducebegin = w->ops->nvdotprodmultiallreducebegin;
+  v->ops->nvdotprodmultiallreduceend   = w->ops->nvdotprodmultiallreduceend;
+
+  /* contiguous vector array constructor */
+  v->ops->nvclonevectorarraycontiguous = w->ops->nvclonevectorarraycontiguous;
 
   /* XBraid interface operations */
   v->ops->nvbufsize   = w->ops->nvbufsize;
@@ -382,6 +415,7 @@ void N_VLinearSum(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y, N_Vector
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   z->ops->nvlinearsum(a, x, b, y, z);
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 3, 3);
   return;
 }
 
@@ -390,6 +424,7 @@ void N_VConst(sunrealtype c, N_Vector z)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(z));
   z->ops->nvconst(c, z);
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(z));
+  NV_MARK_COUNTS(z, 1, 0);
   return;
 }
 
@@ -398,6 +433,7 @@ void N_VProd(N_Vector x, N_Vector y, N_Vector z)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   z->ops->nvprod(x, y, z);
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 3, 1);
   return;
 }
 
@@ -406,6 +442,7 @@ void N_VDiv(N_Vector x, N_Vector y, N_Vector z)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   z->ops->nvdiv(x, y, z);
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 3, 1);
   return;
 }
 
@@ -414,6 +451,7 @@ void N_VScale(sunrealtype c, N_Vector x, N_Vector z)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   z->ops->nvscale(c, x, z);
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 2, 1);
   return;
 }
 
@@ -422,6 +460,7 @@ void N_VAbs(N_Vector x, N_Vector z)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   z->ops->nvabs(x, z);
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 2, 0);
   return;
 }
 
@@ -430,6 +469,7 @@ void N_VInv(N_Vector x, N_Vector z)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   z->ops->nvinv(x, z);
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 2, 1);
   return;
 }
 
@@ -438,6 +478,7 @@ void N_VAddConst(N_Vector x, sunrealtype b, N_Vector z)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   z->ops->nvaddconst(x, b, z);
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 2, 1);
   return;
 }
 
@@ -447,6 +488,7 @@ sunrealtype N_VDotProd(N_Vector x, N_Vector y)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   result = ((sunrealtype)y->ops->nvdotprod(x, y));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 2, 2);
   return (result);
 }
 
@@ -456,6 +498,7 @@ sunrealtype N_VMaxNorm(N_Vector x)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   result = ((sunrealtype)x->ops->nvmaxnorm(x));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 1, 0);
   return (result);
 }
 
@@ -465,6 +508,7 @@ sunrealtype N_VWrmsNorm(N_Vector x, N_Vector w)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   result = ((sunrealtype)x->ops->nvwrmsnorm(x, w));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 2, 3);
   return (result);
 }
 
@@ -474,6 +518,7 @@ sunrealtype N_VWrmsNormMask(N_Vector x, N_Vector w, N_Vector id)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   result = ((sunrealtype)x->ops->nvwrmsnormmask(x, w, id));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 3, 3);
   return (result);
 }
 
@@ -483,6 +528,7 @@ sunrealtype N_VMin(N_Vector x)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   result = ((sunrealtype)x->ops->nvmin(x));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 1, 0);
   return (result);
 }
 
@@ -492,6 +538,7 @@ sunrealtype N_VWL2Norm(N_Vector x, N_Vector w)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   result = ((sunrealtype)x->ops->nvwl2norm(x, w));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 2, 3);
   return (result);
 }
 
@@ -501,6 +548,7 @@ sunrealtype N_VL1Norm(N_Vector x)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   result = ((sunrealtype)x->ops->nvl1norm(x));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 1, 1);
   return (result);
 }
 
@@ -509,6 +557,7 @@ void N_VCompare(sunrealtype c, N_Vector x, N_Vector z)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   z->ops->nvcompare(c, x, z);
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 2, 0);
   return;
 }
 
@@ -518,6 +567,7 @@ sunbooleantype N_VInvTest(N_Vector x, N_Vector z)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   result = ((sunbooleantype)z->ops->nvinvtest(x, z));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 2, 1);
   return (result);
 }
 
@@ -527,6 +577,7 @@ sunbooleantype N_VConstrMask(N_Vector c, N_Vector x, N_Vector m)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(c));
   result = ((sunbooleantype)x->ops->nvconstrmask(c, x, m));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(c));
+  NV_MARK_COUNTS(c, 3, 0);
   return (result);
 }
 
@@ -536,6 +587,7 @@ sunrealtype N_VMinQuotient(N_Vector num, N_Vector denom)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(num));
   result = ((sunrealtype)num->ops->nvminquotient(num, denom));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(num));
+  NV_MARK_COUNTS(num, 2, 1);
   return (result);
 }
 
@@ -565,6 +617,7 @@ SUNErrCode N_VLinearCombination(int nvec, sunrealtype* c, N_Vector* X, N_Vector
   }
 
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(X[0]));
+  NV_MARK_COUNTS(X[0], nvec + 1, 2 * nvec - 1);
   return (ier);
 }
 
@@ -590,6 +643,7 @@ SUNErrCode N_VScaleAddMulti(int nvec, sunrealtype* a, N_Vector x, N_Vector* Y,
   }
 
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 2 * nvec + 1, 2 * nvec);
   return (ier);
 }
 
@@ -612,6 +666,54 @@ SUNErrCode N_VDotProdMulti(int nvec, N_Vector x, N_Vector* Y,
   }
 
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, nvec + 1, 2 * nvec);
+  return (ier);
+}
+
+/* Computes z = a x + b y and returns the WRMS norm of z. Implementations
+   compute the norm while writing z rather than reading z back. */
+sunrealtype N_VLinearSumWrmsNorm(sunrealtype a, N_Vector x, sunrealtype b,
+                                 N_Vector y, N_Vector z, N_Vector w)
+{
+  sunrealtype result;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
+
+  if (z->ops->nvlinearsumwrmsnorm != NULL)
+  {
+    result = z->ops->nvlinearsumwrmsnorm(a, x, b, y, z, w);
+  }
+  else
+  {
+    z->ops->nvlinearsum(a, x, b, y, z);
+    result = z->ops->nvwrmsnorm(z, w);
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 4, 6);
+  return (result);
+}
+
+/* Computes z = sum{ c[i] * X[i] } and the WRMS norm of z */
+SUNErrCode N_VLinearCombinationWrmsNorm(int nvec, sunrealtype* c, N_Vector* X,
+                                        N_Vector z, N_Vector w, sunrealtype* nrm)
+{
+  SUNErrCode ier;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(X[0]));
+
+  if (z->ops->nvlinearcombinationwrmsnorm != NULL)
+  {
+    ier = z->ops->nvlinearcombinationwrmsnorm(nvec, c, X, z, w, nrm);
+  }
+  else
+  {
+    ier = N_VLinearCombination(nvec, c, X, z);
+    if (ier == SUN_SUCCESS) { *nrm = z->ops->nvwrmsnorm(z, w); }
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(X[0]));
+  NV_MARK_COUNTS(X[0], nvec + 2, 2 * nvec + 2);
   return (ier);
 }
 
@@ -641,6 +743,7 @@ SUNErrCode N_VLinearSumVectorArray(int nvec, sunrealtype a, N_Vector* X,
   }
 
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(X[0]));
+  NV_MARK_COUNTS(X[0], 3 * nvec, 3 * nvec);
   return (ier);
 }
 
@@ -662,6 +765,7 @@ SUNErrCode N_VScaleVectorArray(int nvec, sunrealtype* c, N_Vector* X, N_Vector*
   }
 
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(X[0]));
+  NV_MARK_COUNTS(X[0], 2 * nvec, nvec);
   return (ier);
 }
 
@@ -683,6 +787,7 @@ SUNErrCode N_VConstVectorArray(int nvec, sunrealtype c, N_Vector* Z)
   }
 
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(Z[0]));
+  NV_MARK_COUNTS(Z[0], nvec, 0);
   return (ier);
 }
 
@@ -705,6 +810,7 @@ SUNErrCode N_VWrmsNormVectorArray(int nvec, N_Vector* X, N_Vector* W,
   }
 
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(X[0]));
+  NV_MARK_COUNTS(X[0], 2 * nvec, 3 * nvec);
   return (ier);
 }
 
@@ -730,6 +836,7 @@ SUNErrCode N_VWrmsNormMaskVectorArray(int nvec, N_Vector* X, N_Vector* W,
   }
 
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(X[0]));
+  NV_MARK_COUNTS(X[0], 2 * nvec + 1, 3 * nvec);
   return (ier);
 }
 
@@ -780,6 +887,7 @@ SUNErrCode N_VScaleAddMultiVectorArray(int nvec, int nsum, sunrealtype* a,
   }
 
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(X[0]));
+  NV_MARK_COUNTS(X[0], nvec * (2 * nsum + 1), 2 * nvec * nsum);
   return (ier);
 }
 
@@ -824,6 +932,7 @@ SUNErrCode N_VLinearCombinationVectorArray(int nvec, int nsum, sunrealtype* c,
   }
 
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(X[0][0]));
+  NV_MARK_COUNTS(X[0][0], nvec * (nsum + 1), nvec * (2 * nsum - 1));
   return (ier);
 }
 
@@ -837,6 +946,7 @@ sunrealtype N_VDotProdLocal(N_Vector x, N_Vector y)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   result = ((sunrealtype)y->ops->nvdotprodlocal(x, y));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 2, 2);
   return (result);
 }
 
@@ -846,6 +956,7 @@ sunrealtype N_VMaxNormLocal(N_Vector x)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   result = ((sunrealtype)x->ops->nvmaxnormlocal(x));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 1, 0);
   return (result);
 }
 
@@ -855,6 +966,7 @@ sunrealtype N_VMinLocal(N_Vector x)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   result = ((sunrealtype)x->ops->nvminlocal(x));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 1, 0);
   return (result);
 }
 
@@ -864,6 +976,7 @@ sunrealtype N_VL1NormLocal(N_Vector x)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   result = ((sunrealtype)x->ops->nvl1normlocal(x));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 1, 1);
   return (result);
 }
 
@@ -873,6 +986,7 @@ sunrealtype N_VWSqrSumLocal(N_Vector x, N_Vector w)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   result = ((sunrealtype)x->ops->nvwsqrsumlocal(x, w));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 2, 3);
   return (result);
 }
 
@@ -882,6 +996,7 @@ sunrealtype N_VWSqrSumMaskLocal(N_Vector x, N_Vector w, N_Vector id)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   result = ((sunrealtype)x->ops->nvwsqrsummasklocal(x, w, id));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 3, 3);
   return (result);
 }
 
@@ -891,6 +1006,7 @@ sunbooleantype N_VInvTestLocal(N_Vector x, N_Vector z)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   result = ((sunbooleantype)z->ops->nvinvtestlocal(x, z));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 2, 1);
   return (result);
 }
 
@@ -900,6 +1016,7 @@ sunbooleantype N_VConstrMaskLocal(N_Vector c, N_Vector x, N_Vector m)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
   result = ((sunbooleantype)x->ops->nvconstrmasklocal(c, x, m));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, 3, 0);
   return (result);
 }
 
@@ -909,6 +1026,7 @@ sunrealtype N_VMinQuotientLocal(N_Vector num, N_Vector denom)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(num));
   result = ((sunrealtype)num->ops->nvminquotientlocal(num, denom));
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(num));
+  NV_MARK_COUNTS(num, 2, 1);
   return (result);
 }
 
@@ -942,6 +1060,7 @@ SUNErrCode N_VDotProdMultiLocal(int nvec, N_Vector x, N_Vector* Y,
   }
 
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  NV_MARK_COUNTS(x, nvec + 1, 2 * nvec);
 
   return ier;
 }
@@ -957,6 +1076,39 @@ SUNErrCode N_VDotProdMultiAllReduce(int nvec, N_Vector x, sunrealtype* sum)
   return ier;
 }
 
+/* Starts the reduction of the local sums in the buffer. If the vector does
+   not provide a non-blocking reduction, the blocking reduction is performed
+   and the matching N_VDotProdMultiAllReduceEnd call returns immediately. */
+SUNErrCode N_VDotProdMultiAllReduceBegin(int nvec, N_Vector x, sunrealtype* sum)
+{
+  SUNFunctionBegin(x->sunctx);
+  SUNErrCode ier = SUN_SUCCESS;
+  SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
+  SUNAssert(x->ops->nvdotprodmultiallreducebegin ||
+              x->ops->nvdotprodmultiallreduce,
+            SUN_ERR_NOT_IMPLEMENTED);
+  if (x->ops->nvdotprodmultiallreducebegin)
+  {
+    ier = x->ops->nvdotprodmultiallreducebegin(nvec, x, sum);
+  }
+  else { ier = x->ops->nvdotprodmultiallreduce(nvec, x, sum); }
+  SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  return ier;
+}
+
+SUNErrCode N_VDotProdMultiAllReduceEnd(N_Vector x)
+{
+  SUNFunctionBegin(x->sunctx);
+  SUNErrCode ier = SUN_SUCCESS;
+  SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
+  if (x->ops->nvdotprodmultiallreduceend)
+  {
+    ier = x->ops->nvdotprodmultiallreduceend(x);
+  }
+  SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  return ier;
+}
+
 /* ------------------------------------
  * OPTIONAL XBraid interface operations
  * ------------------------------------*/
@@ -999,6 +1151,7 @@ SUNErrCode N_VBufUnpack(N_Vector x, void* buf)
  *   N_VNewVectorArray
  *   N_VCloneEmptyVectorArray
  *   N_VCloneVectorArray
+ *   N_VCloneVectorArrayContiguous
  *   N_VDestroyVectorArray
  * -----------------------------------------------------------------*/
 
@@ -1061,6 +1214,29 @@ N_Vector* N_VCloneVectorArray(int count, N_Vector w)
   return (vs);
 }
 
+/* Clones an array of vectors whose data are stored in a single contiguous
+   block when supported by the vector, otherwise the vectors are cloned
+   individually as in N_VCloneVectorArray. */
+N_Vector* N_VCloneVectorArrayContiguous(int count, N_Vector w)
+{
+  SUNFunctionBegin(w->sunctx);
+  N_Vector* vs = NULL;
+
+  SUNAssertNull(count > 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  if (w->ops->nvclonevectorarraycontiguous == NULL)
+  {
+    vs = N_VCloneVectorArray(count, w);
+    SUNCheckLastErrNull();
+    return (vs);
+  }
+
+  vs = w->ops->nvclonevectorarraycontiguous(count, w);
+  SUNCheckLastErrNull();
+
+  return (vs);
+}
+
 void N_VDestroyVectorArray(N_Vector* vs, int count)
 {
   int j;
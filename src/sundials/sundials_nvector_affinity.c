@@ -0,0 +1,146 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This file implements the thread pinning used by the threaded CPU
+ * NVECTOR implementations (OpenMP and Pthreads).
+ * -----------------------------------------------------------------*/
+
+/* needed for sched_getaffinity and sched_setaffinity on Linux */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include <stdlib.h>
+
+#include "sundials_nvector_affinity.h"
+
+#if defined(__linux__)
+#include <sched.h>
+#define SUN_AFFINITY_PINNING
+#endif
+
+#ifdef SUN_AFFINITY_PINNING
+
+struct sunAffinityMask_
+{
+  cpu_set_t mask;
+};
+
+/* CPUs available to the process, recorded by the first call to
+   sunAffinityInit before any thread has been pinned */
+static int sun_affinity_ncpus = 0;
+static int sun_affinity_cpus[CPU_SETSIZE];
+
+/* 0 if the CPUs have not been recorded, 1 while they are being recorded, and
+   2 once they have been recorded */
+static int sun_affinity_state = 0;
+
+#endif
+
+void sunAffinityInit(void)
+{
+#ifdef SUN_AFFINITY_PINNING
+  int cpu, n, expected;
+  cpu_set_t mask;
+
+  if (__atomic_load_n(&sun_affinity_state, __ATOMIC_ACQUIRE) == 2) { return; }
+
+  expected = 0;
+  if (!__atomic_compare_exchange_n(&sun_affinity_state, &expected, 1, 0,
+                                   __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+  {
+    /* another thread is recording the CPUs */
+    while (__atomic_load_n(&sun_affinity_state, __ATOMIC_ACQUIRE) != 2)
+    {
+      sched_yield();
+    }
+    return;
+  }
+
+  n = 0;
+  if (sched_getaffinity(0, sizeof(mask), &mask) == 0)
+  {
+    for (cpu = 0; cpu < CPU_SETSIZE; cpu++)
+    {
+      if (CPU_ISSET(cpu, &mask)) { sun_affinity_cpus[n++] = cpu; }
+    }
+  }
+  sun_affinity_ncpus = n;
+
+  __atomic_store_n(&sun_affinity_state, 2, __ATOMIC_RELEASE);
+#endif
+}
+
+int sunAffinityPin(SUNAffinity affinity, int id, int nthreads,
+                   sunAffinityMask* saved)
+{
+#ifdef SUN_AFFINITY_PINNING
+  int n, k;
+  cpu_set_t mask;
+
+  if (saved) { *saved = NULL; }
+
+  if (affinity == SUN_AFFINITY_NONE || nthreads < 1) { return 0; }
+  if (__atomic_load_n(&sun_affinity_state, __ATOMIC_ACQUIRE) != 2)
+  {
+    return 0;
+  }
+
+  n = sun_affinity_ncpus;
+  if (n < 1) { return 0; }
+
+  if (affinity == SUN_AFFINITY_SPREAD && nthreads < n)
+  {
+    k = (int)(((long)id * n) / nthreads);
+  }
+  else { k = id % n; }
+
+  if (saved)
+  {
+    *saved = (sunAffinityMask)malloc(sizeof(**saved));
+    if (*saved == NULL) { return -1; }
+    if (sched_getaffinity(0, sizeof((*saved)->mask), &(*saved)->mask))
+    {
+      free(*saved);
+      *saved = NULL;
+      return -1;
+    }
+  }
+
+  CPU_ZERO(&mask);
+  CPU_SET(sun_affinity_cpus[k], &mask);
+  if (sched_setaffinity(0, sizeof(mask), &mask))
+  {
+    if (saved)
+    {
+      free(*saved);
+      *saved = NULL;
+    }
+    return -1;
+  }
+#else
+  (void)affinity;
+  (void)id;
+  (void)nthreads;
+  if (saved) { *saved = NULL; }
+#endif
+  return 0;
+}
+
+void sunAffinityRestore(sunAffinityMask* saved)
+{
+  if (saved == NULL || *saved == NULL) { return; }
+#ifdef SUN_AFFINITY_PINNING
+  sched_setaffinity(0, sizeof((*saved)->mask), &(*saved)->mask);
+#endif
+  free(*saved);
+  *saved = NULL;
+}
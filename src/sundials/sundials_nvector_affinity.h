@@ -0,0 +1,61 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This header file contains the thread pinning used by the threaded
+ * CPU NVECTOR implementations (OpenMP and Pthreads) to implement the
+ * SUNAffinity policies.
+ *
+ * Pinning is only supported on Linux. Otherwise the policies are
+ * accepted but threads are not pinned.
+ *
+ * The functions are compiled into each vector library that uses them
+ * and are not exported.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_NVECTOR_AFFINITY_H
+#define _SUNDIALS_NVECTOR_AFFINITY_H
+
+#include <sundials/sundials_nvector.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* CPU mask of a thread saved by sunAffinityPin */
+typedef struct sunAffinityMask_* sunAffinityMask;
+
+/* Records the CPUs available to the process. Must be called before a team of
+   threads is pinned with sunAffinityPin. Only the first call records the CPUs
+   and concurrent calls wait until they are recorded. */
+SUNDIALS_NO_EXPORT
+void sunAffinityInit(void);
+
+/* Pins the calling thread, thread id in a team of nthreads, to a single
+   available CPU. With SUN_AFFINITY_CLOSE thread id uses the id-th CPU and
+   with SUN_AFFINITY_SPREAD the threads are spaced evenly over the CPUs. In
+   both cases CPUs are reused cyclically if there are more threads than
+   CPUs. If saved is not NULL, the previous CPU mask of the thread is stored
+   in *saved (NULL if the thread was not pinned) and must be passed to
+   sunAffinityRestore. Returns 0 on success or if pinning is not requested or
+   supported and -1 if the affinity could not be set. */
+SUNDIALS_NO_EXPORT
+int sunAffinityPin(SUNAffinity affinity, int id, int nthreads,
+                   sunAffinityMask* saved);
+
+/* Restores the CPU mask saved by sunAffinityPin and frees it */
+SUNDIALS_NO_EXPORT
+void sunAffinityRestore(sunAffinityMask* saved);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,201 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This header file contains the recorder used by the CPU NVECTOR
+ * implementations (serial and OpenMP) to defer element-wise vector
+ * operations.
+ *
+ * A recorder is shared by a vector and its clones and holds at most
+ * one chain of pending operations, all writing the same target
+ * vector. Operands of a pending operation are either the target or
+ * vectors that share the recorder, so any other operation on one of
+ * these vectors must first execute the chain. The chain is executed
+ * in blocks small enough to remain in cache, applying every
+ * recorded operation to a block before moving to the next one, so
+ * the target is streamed through memory once.
+ *
+ * Views of a vector share its recorder. Since a view and its parent
+ * (or two views) may alias the same elements at different indices,
+ * a vector overlapping the target must execute the chain before it
+ * is read, and an operation reading such a vector is not deferred.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_NVECTOR_DEFERRED_H
+#define _SUNDIALS_NVECTOR_DEFERRED_H
+
+#include <stdlib.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_types.h>
+
+/* maximum number of pending operations */
+#define SUN_DEFERRED_MAX_OPS 16
+
+/* number of elements processed per block when executing a chain */
+#define SUN_DEFERRED_BLOCK 1024
+
+typedef enum
+{
+  SUN_DEFERRED_CONST,     /* z = a                        */
+  SUN_DEFERRED_ABS,       /* z = |x|                      */
+  SUN_DEFERRED_INV,       /* z = 1/x                      */
+  SUN_DEFERRED_SCALE,     /* z = a x                      */
+  SUN_DEFERRED_ADDCONST,  /* z = x + b                    */
+  SUN_DEFERRED_PROD,      /* z = x y                      */
+  SUN_DEFERRED_DIV,       /* z = x / y                    */
+  SUN_DEFERRED_LINEARSUM, /* z = a x + b y                */
+  SUN_DEFERRED_SCALESUM,  /* z = a (x + y)                */
+  SUN_DEFERRED_SCALEDIFF, /* z = a (x - y)                */
+  SUN_DEFERRED_COMPARE    /* z = 1 if |x| >= a, 0 if not  */
+} SUNDeferredOpType;
+
+typedef struct
+{
+  SUNDeferredOpType type; /* operation                  */
+  sunrealtype a;          /* first scalar argument      */
+  sunrealtype b;          /* second scalar argument     */
+  const sunrealtype* x;   /* first vector argument      */
+  const sunrealtype* y;   /* second vector argument     */
+} SUNDeferredOp;
+
+struct _SUNDeferredOps
+{
+  int refcount;    /* number of vectors sharing the recorder    */
+  N_Vector target; /* vector written by the pending operations  */
+  int nops;        /* number of pending operations              */
+  SUNDeferredOp ops[SUN_DEFERRED_MAX_OPS];
+};
+
+typedef struct _SUNDeferredOps* SUNDeferredOps;
+
+static inline SUNDeferredOps sunDeferredCreate(void)
+{
+  SUNDeferredOps d = (SUNDeferredOps)malloc(sizeof(*d));
+  if (d == NULL) { return NULL; }
+  d->refcount = 1;
+  d->target   = NULL;
+  d->nops     = 0;
+  return d;
+}
+
+static inline SUNDeferredOps sunDeferredRetain(SUNDeferredOps d)
+{
+  if (d) { d->refcount++; }
+  return d;
+}
+
+static inline void sunDeferredRelease(SUNDeferredOps d)
+{
+  if (d && --d->refcount == 0) { free(d); }
+}
+
+/* Appends an operation writing the target. The caller is responsible for
+   executing the chain first if it writes a different vector or is full. */
+static inline void sunDeferredRecord(SUNDeferredOps d, N_Vector target,
+                                     SUNDeferredOpType type, sunrealtype a,
+                                     sunrealtype b, const sunrealtype* x,
+                                     const sunrealtype* y)
+{
+  SUNDeferredOp* op = &d->ops[d->nops++];
+  d->target         = target;
+  op->type          = type;
+  op->a             = a;
+  op->b             = b;
+  op->x             = x;
+  op->y             = y;
+}
+
+/* Returns SUNTRUE if the arrays [u, u + nu) and [v, v + nv) share elements */
+static inline sunbooleantype sunDeferredOverlap(const sunrealtype* u,
+                                                sunindextype nu,
+                                                const sunrealtype* v,
+                                                sunindextype nv)
+{
+  if (u == NULL || v == NULL || nu <= 0 || nv <= 0) { return SUNFALSE; }
+  return (u < v + nv && v < u + nu);
+}
+
+/* Discards the pending operations after they have been executed */
+static inline void sunDeferredClear(SUNDeferredOps d)
+{
+  d->target = NULL;
+  d->nops   = 0;
+}
+
+/* Maps z = a x + b y to the operation matching the special cases taken by
+   N_VLinearSum so deferred and immediate execution give the same result */
+static inline SUNDeferredOpType sunDeferredLinearSumType(sunrealtype a,
+                                                         sunrealtype b)
+{
+  if (a == b) { return SUN_DEFERRED_SCALESUM; }
+  if (a == -b) { return SUN_DEFERRED_SCALEDIFF; }
+  return SUN_DEFERRED_LINEARSUM;
+}
+
+/* Applies the pending operations to the elements [start, end) of zd */
+static inline void sunDeferredRunBlock(SUNDeferredOps d, sunrealtype* zd,
+                                       sunindextype start, sunindextype end)
+{
+  int k;
+  sunindextype i;
+  sunrealtype a, b;
+  const sunrealtype *xd, *yd;
+
+  for (k = 0; k < d->nops; k++)
+  {
+    a  = d->ops[k].a;
+    b  = d->ops[k].b;
+    xd = d->ops[k].x;
+    yd = d->ops[k].y;
+
+    switch (d->ops[k].type)
+    {
+    case SUN_DEFERRED_CONST:
+      for (i = start; i < end; i++) { zd[i] = a; }
+      break;
+    case SUN_DEFERRED_ABS:
+      for (i = start; i < end; i++) { zd[i] = SUNRabs(xd[i]); }
+      break;
+    case SUN_DEFERRED_INV:
+      for (i = start; i < end; i++) { zd[i] = SUN_RCONST(1.0) / xd[i]; }
+      break;
+    case SUN_DEFERRED_SCALE:
+      for (i = start; i < end; i++) { zd[i] = a * xd[i]; }
+      break;
+    case SUN_DEFERRED_ADDCONST:
+      for (i = start; i < end; i++) { zd[i] = xd[i] + b; }
+      break;
+    case SUN_DEFERRED_PROD:
+      for (i = start; i < end; i++) { zd[i] = xd[i] * yd[i]; }
+      break;
+    case SUN_DEFERRED_DIV:
+      for (i = start; i < end; i++) { zd[i] = xd[i] / yd[i]; }
+      break;
+    case SUN_DEFERRED_LINEARSUM:
+      for (i = start; i < end; i++) { zd[i] = (a * xd[i]) + (b * yd[i]); }
+      break;
+    case SUN_DEFERRED_SCALESUM:
+      for (i = start; i < end; i++) { zd[i] = a * (xd[i] + yd[i]); }
+      break;
+    case SUN_DEFERRED_SCALEDIFF:
+      for (i = start; i < end; i++) { zd[i] = a * (xd[i] - yd[i]); }
+      break;
+    case SUN_DEFERRED_COMPARE:
+      for (i = start; i < end; i++)
+      {
+        zd[i] = (SUNRabs(xd[i]) >= a) ? SUN_RCONST(1.0) : SUN_RCONST(0.0);
+      }
+      break;
+    }
+  }
+}
+
+#endif
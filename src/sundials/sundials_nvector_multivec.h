@@ -0,0 +1,170 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This header file contains the kernels used by the CPU NVECTOR
+ * implementations for the fused operations on vector arrays whose
+ * data are the columns of a single column-major block, e.g., the
+ * arrays created by N_VCloneVectorArrayContiguous.
+ *
+ * A block of n vectors of local length m is an m x n matrix A with
+ * leading dimension lda and the fused operations become GEMV-like
+ * kernels. The rows are processed in blocks of SUN_MULTIVEC_NB so
+ * the block of the single vector operand (x or z) stays in cache
+ * while the columns are streamed, and the columns are processed four
+ * at a time so each element of that operand is loaded once per four
+ * columns. The kernels only operate on rows [0, m), threaded
+ * implementations call them on disjoint row ranges.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_NVECTOR_MULTIVEC_H
+#define _SUNDIALS_NVECTOR_MULTIVEC_H
+
+#include <stdint.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+
+/* number of rows in a row block */
+#define SUN_MULTIVEC_NB 1024
+
+/* returns true if the arrays x[0, m) and A[0, len) overlap */
+static inline sunbooleantype sunMultiVecOverlaps(const sunrealtype* x,
+                                                 sunindextype m,
+                                                 const sunrealtype* A,
+                                                 sunindextype len)
+{
+  uintptr_t xb = (uintptr_t)x;
+  uintptr_t xe = (uintptr_t)(x + m);
+  uintptr_t ab = (uintptr_t)A;
+  uintptr_t ae = (uintptr_t)(A + len);
+  return (xb < ae && ab < xe);
+}
+
+/* y = A^T x, where A is m x n with leading dimension lda */
+static inline void sunMultiVecGemvT(sunindextype m, int n, const sunrealtype* A,
+                                    sunindextype lda, const sunrealtype* x,
+                                    sunrealtype* y)
+{
+  int j;
+  sunindextype i, ib, mb;
+  const sunrealtype *a0, *a1, *a2, *a3, *xb;
+  sunrealtype s0, s1, s2, s3;
+
+  for (j = 0; j < n; j++) { y[j] = SUN_RCONST(0.0); }
+
+  for (ib = 0; ib < m; ib += SUN_MULTIVEC_NB)
+  {
+    mb = SUNMIN(SUN_MULTIVEC_NB, m - ib);
+    xb = x + ib;
+
+    for (j = 0; j + 4 <= n; j += 4)
+    {
+      a0 = A + j * lda + ib;
+      a1 = a0 + lda;
+      a2 = a1 + lda;
+      a3 = a2 + lda;
+      s0 = s1 = s2 = s3 = SUN_RCONST(0.0);
+      for (i = 0; i < mb; i++)
+      {
+        s0 += a0[i] * xb[i];
+        s1 += a1[i] * xb[i];
+        s2 += a2[i] * xb[i];
+        s3 += a3[i] * xb[i];
+      }
+      y[j] += s0;
+      y[j + 1] += s1;
+      y[j + 2] += s2;
+      y[j + 3] += s3;
+    }
+
+    for (; j < n; j++)
+    {
+      a0 = A + j * lda + ib;
+      s0 = SUN_RCONST(0.0);
+      for (i = 0; i < mb; i++) { s0 += a0[i] * xb[i]; }
+      y[j] += s0;
+    }
+  }
+}
+
+/* z = beta z + A c, where A is m x n with leading dimension lda and z
+   does not overlap A. The input z is not read when beta is zero. */
+static inline void sunMultiVecGemvN(sunindextype m, int n, const sunrealtype* A,
+                                    sunindextype lda, const sunrealtype* c,
+                                    sunrealtype beta, sunrealtype* z)
+{
+  int j;
+  sunindextype i, ib, mb;
+  const sunrealtype *a0, *a1, *a2, *a3;
+  sunrealtype* zb;
+
+  for (ib = 0; ib < m; ib += SUN_MULTIVEC_NB)
+  {
+    mb = SUNMIN(SUN_MULTIVEC_NB, m - ib);
+    zb = z + ib;
+
+    if (beta == SUN_RCONST(0.0))
+    {
+      for (i = 0; i < mb; i++) { zb[i] = SUN_RCONST(0.0); }
+    }
+    else if (beta != SUN_RCONST(1.0))
+    {
+      for (i = 0; i < mb; i++) { zb[i] *= beta; }
+    }
+
+    for (j = 0; j + 4 <= n; j += 4)
+    {
+      a0 = A + j * lda + ib;
+      a1 = a0 + lda;
+      a2 = a1 + lda;
+      a3 = a2 + lda;
+      for (i = 0; i < mb; i++)
+      {
+        zb[i] += (c[j] * a0[i] + c[j + 1] * a1[i]) +
+                 (c[j + 2] * a2[i] + c[j + 3] * a3[i]);
+      }
+    }
+
+    for (; j < n; j++)
+    {
+      a0 = A + j * lda + ib;
+      for (i = 0; i < mb; i++) { zb[i] += c[j] * a0[i]; }
+    }
+  }
+}
+
+/* Z_j = Y_j + a_j x, j = 0,...,n-1, where Y and Z are m x n with leading
+   dimensions ldy and ldz. Y and Z may be the same block. */
+static inline void sunMultiVecScaleAdd(sunindextype m, int n,
+                                       const sunrealtype* a,
+                                       const sunrealtype* x,
+                                       const sunrealtype* Y, sunindextype ldy,
+                                       sunrealtype* Z, sunindextype ldz)
+{
+  int j;
+  sunindextype i, ib, mb;
+  const sunrealtype *xb, *yb;
+  sunrealtype* zb;
+
+  for (ib = 0; ib < m; ib += SUN_MULTIVEC_NB)
+  {
+    mb = SUNMIN(SUN_MULTIVEC_NB, m - ib);
+    xb = x + ib;
+
+    for (j = 0; j < n; j++)
+    {
+      yb = Y + j * ldy + ib;
+      zb = Z + j * ldz + ib;
+      for (i = 0; i < mb; i++) { zb[i] = a[j] * xb[i] + yb[i]; }
+    }
+  }
+}
+
+#endif
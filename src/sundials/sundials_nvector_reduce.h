@@ -0,0 +1,176 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This header file contains the reduction batch used by the
+ * integrators and iterative solvers to combine several global
+ * reductions into a single collective and to overlap that
+ * collective with local work.
+ *
+ * Reductions are added to a batch with sunReduceAdd*, which compute
+ * the local contributions into the batch buffer, sunReduceBegin
+ * starts the global reduction of the whole buffer, and sunReduceEnd
+ * completes it. The results are then read with sunReduceValue. Work
+ * that does not modify the vectors in the batch may be done between
+ * sunReduceBegin and sunReduceEnd.
+ *
+ * When the vectors are not distributed or do not provide the local
+ * and single buffer reduction operations, each reduction is
+ * computed with the standard vector operation when it is added, so
+ * the results are identical to calling that operation directly.
+ * Norms of linear sums and combinations then use the fused
+ * operations that compute the norm while writing the result.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_NVECTOR_REDUCE_H
+#define _SUNDIALS_NVECTOR_REDUCE_H
+
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_types.h>
+
+/* maximum number of reductions in a batch */
+#define SUN_REDUCE_MAX 4
+
+typedef struct
+{
+  N_Vector x;                         /* vector used for the reduction */
+  sunbooleantype combine;             /* combine local contributions   */
+  int nred;                           /* number of reductions added    */
+  sunrealtype length[SUN_REDUCE_MAX]; /* WRMS norm length (0 for sums) */
+  sunrealtype val[SUN_REDUCE_MAX];    /* contributions or results      */
+} SUNReduceBatch;
+
+/* returns true if the reductions on x can be combined */
+static inline sunbooleantype sunReduceCanCombine(N_Vector x)
+{
+  return (x->ops->nvwsqrsumlocal != NULL && x->ops->nvdotprodlocal != NULL &&
+          x->ops->nvdotprodmultiallreduce != NULL &&
+          N_VGetCommunicator(x) != SUN_COMM_NULL);
+}
+
+static inline void sunReduceInit(SUNReduceBatch* b, N_Vector x)
+{
+  b->x       = x;
+  b->combine = sunReduceCanCombine(x);
+  b->nred    = 0;
+}
+
+/* adds the WRMS norm of x with weights w, returns its index */
+static inline int sunReduceAddWrmsNorm(SUNReduceBatch* b, N_Vector x,
+                                       N_Vector w)
+{
+  int i = b->nred++;
+  if (b->combine)
+  {
+    b->val[i]    = N_VWSqrSumLocal(x, w);
+    b->length[i] = (sunrealtype)N_VGetLength(x);
+  }
+  else
+  {
+    b->val[i]    = N_VWrmsNorm(x, w);
+    b->length[i] = SUN_RCONST(0.0);
+  }
+  return i;
+}
+
+/* computes z = c1 x + c2 y and adds the WRMS norm of z with weights w,
+   returns its index */
+static inline int sunReduceAddLinearSumWrmsNorm(SUNReduceBatch* b,
+                                                sunrealtype c1, N_Vector x,
+                                                sunrealtype c2, N_Vector y,
+                                                N_Vector z, N_Vector w)
+{
+  int i = b->nred++;
+  if (b->combine)
+  {
+    N_VLinearSum(c1, x, c2, y, z);
+    b->val[i]    = N_VWSqrSumLocal(z, w);
+    b->length[i] = (sunrealtype)N_VGetLength(z);
+  }
+  else
+  {
+    b->val[i]    = N_VLinearSumWrmsNorm(c1, x, c2, y, z, w);
+    b->length[i] = SUN_RCONST(0.0);
+  }
+  return i;
+}
+
+/* computes z = sum{ c[j] * X[j] } and adds the WRMS norm of z with weights
+   w, returns its index or -1 if the linear combination failed */
+static inline int sunReduceAddLinearCombinationWrmsNorm(SUNReduceBatch* b,
+                                                        int nvec,
+                                                        sunrealtype* c,
+                                                        N_Vector* X, N_Vector z,
+                                                        N_Vector w)
+{
+  int i = b->nred;
+  SUNErrCode err;
+  if (b->combine)
+  {
+    err = N_VLinearCombination(nvec, c, X, z);
+    if (err != SUN_SUCCESS) { return -1; }
+    b->val[i]    = N_VWSqrSumLocal(z, w);
+    b->length[i] = (sunrealtype)N_VGetLength(z);
+  }
+  else
+  {
+    err = N_VLinearCombinationWrmsNorm(nvec, c, X, z, w, &(b->val[i]));
+    if (err != SUN_SUCCESS) { return -1; }
+    b->length[i] = SUN_RCONST(0.0);
+  }
+  b->nred++;
+  return i;
+}
+
+/* adds the dot product of x and y, returns its index */
+static inline int sunReduceAddDotProd(SUNReduceBatch* b, N_Vector x, N_Vector y)
+{
+  int i        = b->nred++;
+  b->val[i]    = b->combine ? N_VDotProdLocal(x, y) : N_VDotProd(x, y);
+  b->length[i] = SUN_RCONST(0.0);
+  return i;
+}
+
+/* starts the global reduction of all reductions in the batch */
+static inline SUNErrCode sunReduceBegin(SUNReduceBatch* b)
+{
+  if (!b->combine || b->nred == 0) { return SUN_SUCCESS; }
+  return N_VDotProdMultiAllReduceBegin(b->nred, b->x, b->val);
+}
+
+/* completes the global reduction and finalizes the results */
+static inline SUNErrCode sunReduceEnd(SUNReduceBatch* b)
+{
+  int i;
+  SUNErrCode err;
+
+  if (!b->combine || b->nred == 0) { return SUN_SUCCESS; }
+
+  err = N_VDotProdMultiAllReduceEnd(b->x);
+  if (err != SUN_SUCCESS) { return err; }
+
+  for (i = 0; i < b->nred; i++)
+  {
+    if (b->length[i] > SUN_RCONST(0.0))
+    {
+      b->val[i] = SUNRsqrt(b->val[i] / b->length[i]);
+    }
+  }
+
+  return SUN_SUCCESS;
+}
+
+static inline sunrealtype sunReduceValue(SUNReduceBatch* b, int i)
+{
+  return b->val[i];
+}
+
+#endif
@@ -0,0 +1,99 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This header file contains the kernels used by the threaded CPU
+ * NVECTOR implementations (OpenMP and Pthreads) to compute sums
+ * that do not depend on the number of threads.
+ *
+ * The vector is split into SUN_REPRO_NCHUNKS chunks whose bounds
+ * only depend on the vector length. Each chunk is summed in index
+ * order by a single thread and the chunk sums are then combined
+ * with a fixed pairwise tree, so the order of all floating point
+ * operations is the same for any number of threads.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_NVECTOR_REPRODUCIBLE_H
+#define _SUNDIALS_NVECTOR_REPRODUCIBLE_H
+
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+
+/* number of chunks, must be a power of two */
+#define SUN_REPRO_NCHUNKS 256
+
+typedef enum
+{
+  SUN_REPRO_DOTPROD,     /* sum x_i y_i                    */
+  SUN_REPRO_WSQRSUM,     /* sum (x_i w_i)^2                */
+  SUN_REPRO_WSQRSUMMASK, /* sum (x_i w_i)^2 where id_i > 0 */
+  SUN_REPRO_L1NORM       /* sum |x_i|                      */
+} SUNReproSumType;
+
+/* index range [start, end) of chunk k of a vector of length N */
+static inline void sunReproChunk(sunindextype N, int k, sunindextype* start,
+                                 sunindextype* end)
+{
+  sunindextype size = (N + SUN_REPRO_NCHUNKS - 1) / SUN_REPRO_NCHUNKS;
+
+  *start = SUNMIN(k * size, N);
+  *end   = SUNMIN(*start + size, N);
+}
+
+/* sum of chunk k, y holds the weights for the weighted sums */
+static inline sunrealtype sunReproChunkSum(SUNReproSumType type, sunindextype N,
+                                           int k, const sunrealtype* x,
+                                           const sunrealtype* y,
+                                           const sunrealtype* id)
+{
+  sunindextype i, start, end;
+  sunrealtype sum = SUN_RCONST(0.0);
+
+  sunReproChunk(N, k, &start, &end);
+
+  switch (type)
+  {
+  case SUN_REPRO_DOTPROD:
+    for (i = start; i < end; i++) { sum += x[i] * y[i]; }
+    break;
+  case SUN_REPRO_WSQRSUM:
+    for (i = start; i < end; i++) { sum += SUNSQR(x[i] * y[i]); }
+    break;
+  case SUN_REPRO_WSQRSUMMASK:
+    for (i = start; i < end; i++)
+    {
+      if (id[i] > SUN_RCONST(0.0)) { sum += SUNSQR(x[i] * y[i]); }
+    }
+    break;
+  case SUN_REPRO_L1NORM:
+    for (i = start; i < end; i++) { sum += SUNRabs(x[i]); }
+    break;
+  }
+
+  return sum;
+}
+
+/* combines the chunk sums with a pairwise tree, overwrites partial */
+static inline sunrealtype sunReproCombine(sunrealtype* partial)
+{
+  int n, k;
+
+  for (n = SUN_REPRO_NCHUNKS / 2; n > 0; n /= 2)
+  {
+    for (k = 0; k < n; k++)
+    {
+      partial[k] = partial[2 * k] + partial[2 * k + 1];
+    }
+  }
+
+  return partial[0];
+}
+
+#endif
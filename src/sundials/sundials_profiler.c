@@ -74,6 +74,10 @@ struct _sunTimerStruct
   double average;
   double maximum;
   double elapsed;
+  double bytes;
+  double flops;
+  double total_bytes;
+  double total_flops;
   long count;
 };
 
@@ -89,6 +93,10 @@ static sunTimerStruct* sunTimerStructNew(void)
   ts->elapsed        = 0.0;
   ts->average        = 0.0;
   ts->maximum        = 0.0;
+  ts->bytes          = 0.0;
+  ts->flops          = 0.0;
+  ts->total_bytes    = 0.0;
+  ts->total_flops    = 0.0;
   ts->count          = 0;
   return ts;
 }
@@ -147,6 +155,10 @@ static void sunResetTiming(sunTimerStruct* entry)
   entry->elapsed      = 0.0;
   entry->average      = 0.0;
   entry->maximum      = 0.0;
+  entry->bytes        = 0.0;
+  entry->flops        = 0.0;
+  entry->total_bytes  = 0.0;
+  entry->total_flops  = 0.0;
   entry->count        = 0;
 }
 
@@ -303,6 +315,40 @@ SUNErrCode SUNProfiler_End(SUNProfiler p, const char* name)
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNProfiler_AddCounts(SUNProfiler p, const char* name, double bytes,
+                                 double flops)
+{
+  int64_t ier;
+  sunTimerStruct* timer = NULL;
+
+  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+
+  sunStartTiming(p->overhead);
+
+  /* The counts are normally added inside a timed region, but create the
+     entry if it does not exist yet so counts can be recorded on their own */
+  if (SUNHashMap_GetValue(p->map, name, (void**)&timer))
+  {
+    timer = sunTimerStructNew();
+    ier   = SUNHashMap_Insert(p->map, name, (void*)timer);
+    if (ier)
+    {
+      sunTimerStructFree(timer);
+      sunStopTiming(p->overhead);
+      if (ier == SUNHASHMAP_ERROR) { return SUN_ERR_PROFILER_MAPINSERT; }
+      if (ier == SUNHASHMAP_DUPLICATE) { return SUN_ERR_PROFILER_MAPFULL; }
+    }
+  }
+
+  timer->bytes += bytes;
+  timer->flops += flops;
+  timer->total_bytes = timer->bytes;
+  timer->total_flops = timer->flops;
+
+  sunStopTiming(p->overhead);
+  return SUN_SUCCESS;
+}
+
 SUNErrCode SUNProfiler_GetTimerResolution(SUNProfiler p, double* resolution)
 {
   if (!p) { return SUN_ERR_ARG_CORRUPT; }
@@ -344,6 +390,21 @@ SUNErrCode SUNProfiler_GetElapsedTime(SUNProfiler p, const char* name,
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNProfiler_GetCounts(SUNProfiler p, const char* name,
+                                 double* bytes, double* flops)
+{
+  sunTimerStruct* timer;
+
+  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+
+  if (SUNHashMap_GetValue(p->map, name, (void**)&timer)) { return (-1); }
+
+  *bytes = timer->bytes;
+  *flops = timer->flops;
+
+  return SUN_SUCCESS;
+}
+
 SUNErrCode SUNProfiler_Reset(SUNProfiler p)
 {
   if (!p) { return SUN_ERR_ARG_CORRUPT; }
@@ -415,7 +476,9 @@ SUNErrCode SUNProfiler_Print(SUNProfiler p, FILE* fp)
     fprintf(fp, "SUNDIALS GIT VERSION: %s\n", SUNDIALS_GIT_VERSION);
     fprintf(fp, "SUNDIALS PROFILER: %s\n", p->title);
     fprintf(fp, "TIMER RESOLUTION: %gs\n", resolution);
-    fprintf(fp, "%-40s\t %% time (inclusive) \t max/rank \t average/rank \t count \n",
+    fprintf(fp,
+            "%-40s\t %% time (inclusive) \t max/rank \t average/rank \t count "
+            "\t GB/s \t GFLOP/s \n",
             "RESULTS:");
     fprintf(fp, "=============================================================="
                 "==================================================\n");
@@ -461,8 +524,10 @@ static void sunTimerStructReduceMaxAndSum(void* a, void* b, int* len,
   int i;
   for (i = 0; i < *len; ++i)
   {
-    b_ts[i].average += a_ts[i].elapsed;
+    b_ts[i].average += a_ts[i].average;
     b_ts[i].maximum = SUNMAX(a_ts[i].maximum, b_ts[i].maximum);
+    b_ts[i].total_bytes += a_ts[i].total_bytes;
+    b_ts[i].total_flops += a_ts[i].total_flops;
   }
 }
 
@@ -484,18 +549,38 @@ SUNErrCode sunCollectTimers(SUNProfiler p)
   {
     return SUN_ERR_PROFILER_MAPFULL;
   }
-  int map_size = (int)SUNHashMap_Capacity(p->map);
+  int capacity = (int)SUNHashMap_Capacity(p->map);
+
+  /* Extract the timers from the hash map, only the occupied buckets hold a
+     timer so map_size may be less than the capacity */
+  values = (sunTimerStruct**)malloc(capacity * sizeof(sunTimerStruct*));
+  if (!values) { return SUN_ERR_MALLOC_FAIL; }
+  int map_size = 0;
+  for (int i = 0; i < capacity; ++i)
+  {
+    SUNHashMapKeyValue* kvp =
+      SUNStlVector_SUNHashMapKeyValue_At(p->map->buckets, i);
+    if (kvp && *kvp) { values[map_size++] = (sunTimerStruct*)(*kvp)->value; }
+  }
 
-  /* Extract the elapsed times from the hash map */
-  SUNHashMap_Values(p->map, (void***)&values, sizeof(sunTimerStruct));
   sunTimerStruct* reduced =
     (sunTimerStruct*)malloc(map_size * sizeof(sunTimerStruct));
-  if (!reduced) { return SUN_ERR_MALLOC_FAIL; }
-  for (int i = 0; i < map_size; ++i) { reduced[i] = *values[i]; }
+  if (!reduced)
+  {
+    free(values);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+  for (int i = 0; i < map_size; ++i)
+  {
+    reduced[i]             = *values[i];
+    reduced[i].average     = reduced[i].elapsed;
+    reduced[i].total_bytes = reduced[i].bytes;
+    reduced[i].total_flops = reduced[i].flops;
+  }
 
   /* Register MPI datatype for sunTimerStruct */
   MPI_Datatype tmp_type, MPI_sunTimerStruct;
-  const int block_lens[2]     = {5, 1};
+  const int block_lens[2]     = {9, 1};
   const MPI_Datatype types[2] = {MPI_DOUBLE, MPI_LONG};
   const MPI_Aint displ[2]     = {offsetof(sunTimerStruct, tic),
                                  offsetof(sunTimerStruct, count)};
@@ -531,8 +616,10 @@ SUNErrCode sunCollectTimers(SUNProfiler p)
   /* Update the values that are in this rank's hash map. */
   for (int i = 0; i < map_size; ++i)
   {
-    values[i]->average = reduced[i].average / (double)nranks;
-    values[i]->maximum = reduced[i].maximum;
+    values[i]->average     = reduced[i].average / (double)nranks;
+    values[i]->maximum     = reduced[i].maximum;
+    values[i]->total_bytes = reduced[i].total_bytes;
+    values[i]->total_flops = reduced[i].total_flops;
   }
 
   free(reduced);
@@ -543,7 +630,8 @@ SUNErrCode sunCollectTimers(SUNProfiler p)
 #endif
 
 /* Print out the: timer name, percentage of exec time (based on the max),
-   max across ranks, average across ranks, and the timer counter. */
+   max across ranks, average across ranks, the timer counter, and, if counts
+   were recorded, the rates achieved over all ranks (based on the max). */
 void sunPrintTimer(SUNHashMapKeyValue kv, FILE* fp, void* pvoid)
 {
   SUNProfiler p      = (SUNProfiler)pvoid;
@@ -553,8 +641,19 @@ void sunPrintTimer(SUNHashMapKeyValue kv, FILE* fp, void* pvoid)
   double percent = strcmp((const char*)kv->key, (const char*)SUNDIALS_ROOT_TIMER)
                      ? maximum / p->sundials_time * 100
                      : 100;
-  fprintf(fp, "%-40s\t %6.2f%% \t         %.6fs \t %.6fs \t %ld\n", kv->key,
+  fprintf(fp, "%-40s\t %6.2f%% \t         %.6fs \t %.6fs \t %ld", kv->key,
           percent, maximum, average, ts->count);
+  if (ts->total_bytes > 0.0 && maximum > 0.0)
+  {
+    fprintf(fp, " \t %.3f", ts->total_bytes / maximum * 1e-9);
+  }
+  else { fprintf(fp, " \t --"); }
+  if (ts->total_flops > 0.0 && maximum > 0.0)
+  {
+    fprintf(fp, " \t %.3f", ts->total_flops / maximum * 1e-9);
+  }
+  else { fprintf(fp, " \t --"); }
+  fprintf(fp, "\n");
 }
 
 /* Comparator for qsort that compares key-value pairs
@@ -0,0 +1,433 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * This is the implementation header file for the sparse Jacobian utilities
+ * shared by the linear solver interfaces of CVODE, ARKODE, IDA, and KINSOL:
+ * detection of a sparsity pattern and the colored difference quotient
+ * approximation of a Jacobian on a given pattern. The package specific
+ * function evaluation is passed as a callback so the routines are independent
+ * of the package memory structures.
+ * ---------------------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_SPARSEDQ_IMPL_H
+#define _SUNDIALS_SPARSEDQ_IMPL_H
+
+#include <math.h>
+#include <stdlib.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_nvector.h>
+#include <sunmatrix/sunmatrix_sparse.h>
+
+/* Maximum number of vectors perturbed together (yy and yp in IDA) */
+#define SUN_JACPROBE_MAX_NY 2
+
+/* Evaluates the function whose Jacobian is probed at the ny vectors y */
+typedef int (*sunJacProbeFn)(sunrealtype t, N_Vector* y, N_Vector fy,
+                             void* data);
+
+/* -----------------------------------------------------------------------------
+ * sunComputeJacSparsity
+ *
+ * Detects the sparsity pattern of the Jacobian of fn at (t, y) by probing fn
+ * one column at a time. Component j of every y[k] is set to NaN and the rows
+ * of the result that change are the nonzeros of column j. If fn returns a
+ * nonzero value for a NaN input, component j of each y[k] is incremented in
+ * turn by srur * max(|y[k][j]|, 1) instead. This takes N + 1 evaluations of
+ * fn (more when NaN is rejected) and O(N^2) comparisons.
+ *
+ * The vectors must provide array access to their full data, so distributed
+ * vectors (a non-null communicator) are rejected with SUN_ERR_ARG_INCOMPATIBLE.
+ * SUN_ERR_USER_FCN_FAIL is returned if fn fails or is not finite at y.
+ *
+ * On success *S is a new sparse matrix of type sparsetype holding exactly the
+ * detected nonzeros, all set to one.
+ * ---------------------------------------------------------------------------*/
+
+static inline SUNErrCode sunComputeJacSparsity(sunJacProbeFn fn, void* data,
+                                               sunrealtype t, int ny,
+                                               N_Vector* y, sunrealtype srur,
+                                               int sparsetype, SUNMatrix* S)
+{
+  N_Vector ytemp[SUN_JACPROBE_MAX_NY], f0, ftemp;
+  SUNMatrix A, B;
+  SUNErrCode ier;
+  sunrealtype *y_data[SUN_JACPROBE_MAX_NY], *ytemp_data[SUN_JACPROBE_MAX_NY];
+  sunrealtype *f0_data, *ftemp_data, *A_data;
+  sunbooleantype* changed;
+  sunindextype *colptrs, *rowvals;
+  sunindextype i, j, N, nnz;
+  int k, fret;
+
+  *S = NULL;
+
+  /* The pattern pairs the global length with the local data */
+  for (k = 0; k < ny; k++)
+  {
+    if ((y[k]->ops->nvgetarraypointer == NULL) ||
+        (N_VGetCommunicator(y[k]) != SUN_COMM_NULL))
+    {
+      return SUN_ERR_ARG_INCOMPATIBLE;
+    }
+  }
+
+  /* Create work vectors and a CSC matrix to hold the pattern */
+  N = N_VGetLength(y[0]);
+
+  ier = SUN_SUCCESS;
+  for (k = 0; k < ny; k++)
+  {
+    ytemp[k] = N_VClone(y[0]);
+    if (ytemp[k] == NULL) { ier = SUN_ERR_MEM_FAIL; }
+  }
+  f0      = N_VClone(y[0]);
+  ftemp   = N_VClone(y[0]);
+  changed = (sunbooleantype*)malloc(SUNMAX(N, 1) * sizeof(sunbooleantype));
+  A       = SUNSparseMatrix(N, N, SUNMAX(N, 1), CSC_MAT, y[0]->sunctx);
+  if ((f0 == NULL) || (ftemp == NULL) || (changed == NULL) || (A == NULL))
+  {
+    ier = SUN_ERR_MEM_FAIL;
+  }
+
+  if (ier == SUN_SUCCESS)
+  {
+    for (k = 0; k < ny; k++)
+    {
+      N_VScale(SUN_RCONST(1.0), y[k], ytemp[k]);
+      y_data[k]     = N_VGetArrayPointer(y[k]);
+      ytemp_data[k] = N_VGetArrayPointer(ytemp[k]);
+    }
+    f0_data    = N_VGetArrayPointer(f0);
+    ftemp_data = N_VGetArrayPointer(ftemp);
+
+    colptrs = SUNSparseMatrix_IndexPointers(A);
+    rowvals = SUNSparseMatrix_IndexValues(A);
+    A_data  = SUNSparseMatrix_Data(A);
+
+    /* Evaluate fn at the base point, the result must be finite */
+    fret = fn(t, y, f0, data);
+    for (i = 0; (i < N) && (fret == 0); i++)
+    {
+      if (!(f0_data[i] - f0_data[i] == SUN_RCONST(0.0))) { fret = -1; }
+    }
+    if (fret != 0) { ier = SUN_ERR_USER_FCN_FAIL; }
+
+    /* Probe each column */
+    nnz = 0;
+    for (j = 0; (j < N) && (ier == SUN_SUCCESS); j++)
+    {
+      colptrs[j] = nnz;
+      for (i = 0; i < N; i++) { changed[i] = SUNFALSE; }
+
+      /* Set component j to NaN, or increment it one vector at a time if fn
+         rejects NaN */
+      fret = -1;
+#ifdef NAN
+      for (k = 0; k < ny; k++) { ytemp_data[k][j] = (sunrealtype)NAN; }
+      fret = fn(t, ytemp, ftemp, data);
+      for (k = 0; k < ny; k++) { ytemp_data[k][j] = y_data[k][j]; }
+      for (i = 0; (i < N) && (fret == 0); i++)
+      {
+        if (ftemp_data[i] != f0_data[i]) { changed[i] = SUNTRUE; }
+      }
+#endif
+      if (fret != 0)
+      {
+        for (k = 0; k < ny; k++)
+        {
+          ytemp_data[k][j] = y_data[k][j] + srur * SUNMAX(SUNRabs(y_data[k][j]),
+                                                          SUN_RCONST(1.0));
+          fret             = fn(t, ytemp, ftemp, data);
+          ytemp_data[k][j] = y_data[k][j];
+          if (fret != 0) { break; }
+          for (i = 0; i < N; i++)
+          {
+            if (ftemp_data[i] != f0_data[i]) { changed[i] = SUNTRUE; }
+          }
+        }
+      }
+      if (fret != 0)
+      {
+        ier = SUN_ERR_USER_FCN_FAIL;
+        break;
+      }
+
+      /* Rows whose value changed depend on component j */
+      for (i = 0; i < N; i++)
+      {
+        if (!changed[i]) { continue; }
+        if (nnz == SUNSparseMatrix_NNZ(A))
+        {
+          ier = SUNSparseMatrix_Reallocate(A, 2 * nnz);
+          if (ier != SUN_SUCCESS) { break; }
+          rowvals = SUNSparseMatrix_IndexValues(A);
+          A_data  = SUNSparseMatrix_Data(A);
+        }
+        rowvals[nnz] = i;
+        A_data[nnz]  = SUN_RCONST(1.0);
+        nnz++;
+      }
+    }
+    colptrs[N] = nnz;
+
+    /* Trim the storage and convert to the requested type */
+    if ((ier == SUN_SUCCESS) && (nnz > 0)) { ier = SUNSparseMatrix_Realloc(A); }
+    if ((ier == SUN_SUCCESS) && (sparsetype == CSR_MAT))
+    {
+      ier = SUNSparseMatrix_ToCSR(A, &B);
+      if (ier == SUN_SUCCESS)
+      {
+        SUNMatDestroy(A);
+        A = B;
+      }
+    }
+  }
+
+  for (k = 0; k < ny; k++) { N_VDestroy(ytemp[k]); }
+  N_VDestroy(f0);
+  N_VDestroy(ftemp);
+  free(changed);
+
+  if (ier != SUN_SUCCESS)
+  {
+    SUNMatDestroy(A);
+    return ier;
+  }
+
+  *S = A;
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------------------
+ * sunSparseDQMem
+ *
+ * Data for the colored difference quotient approximation of a sparse Jacobian:
+ * the pattern in CSC format, the columns of each color, and the increment of
+ * each column. When the Jacobian is a CSR matrix a CSR copy of the pattern and
+ * the position in it of each entry of the CSC pattern are kept as well, so the
+ * entries are formed in place. A zero initialized structure holds no pattern.
+ * ---------------------------------------------------------------------------*/
+
+typedef struct
+{
+  SUNMatrix pattern;        /* pattern in CSC format                        */
+  SUNMatrix pattern_csr;    /* CSR copy of the pattern or NULL              */
+  sunindextype* csrmap;     /* position in pattern_csr of each CSC entry    */
+  sunindextype ncolors;     /* number of column colors                      */
+  sunindextype* color_ptrs; /* the columns of color c are color_cols[k] for */
+  sunindextype* color_cols; /* color_ptrs[c] <= k < color_ptrs[c + 1]       */
+  sunrealtype* inc;         /* increment of each column, set by the caller  */
+} sunSparseDQMem;
+
+/* Frees the pattern and coloring, leaving dq empty */
+static inline void sunSparseDQ_Free(sunSparseDQMem* dq)
+{
+  SUNMatDestroy(dq->pattern);
+  SUNMatDestroy(dq->pattern_csr);
+  free(dq->csrmap);
+  free(dq->color_ptrs);
+  free(dq->color_cols);
+  free(dq->inc);
+  dq->pattern     = NULL;
+  dq->pattern_csr = NULL;
+  dq->csrmap      = NULL;
+  dq->ncolors     = 0;
+  dq->color_ptrs  = NULL;
+  dq->color_cols  = NULL;
+  dq->inc         = NULL;
+}
+
+/* -----------------------------------------------------------------------------
+ * sunSparseDQ_SetPattern
+ *
+ * Replaces the pattern in dq with a copy of the square sparse matrix S and
+ * colors its columns so that columns of the same color have no rows in common.
+ * The columns are grouped by color with a counting sort. If sparsetype is
+ * CSR_MAT the CSR copy of the pattern and the entry map are built as well.
+ *
+ * Returns SUN_ERR_MEM_FAIL if an allocation fails, otherwise the error code of
+ * the sparse matrix routines. On failure dq is left empty.
+ * ---------------------------------------------------------------------------*/
+
+static inline SUNErrCode sunSparseDQ_SetPattern(sunSparseDQMem* dq,
+                                                SUNMatrix S, int sparsetype)
+{
+  SUNErrCode ier;
+  sunindextype *colptrs, *rowvals, *rowptrs, *colvals, *colors;
+  sunindextype c, j, k, q, N;
+
+  sunSparseDQ_Free(dq);
+  N = SUNSparseMatrix_Columns(S);
+
+  /* store the pattern in CSC format */
+  if (SUNSparseMatrix_SparseType(S) == CSC_MAT)
+  {
+    dq->pattern = SUNMatClone(S);
+    ier = (dq->pattern == NULL) ? SUN_ERR_MEM_FAIL : SUNMatCopy(S, dq->pattern);
+  }
+  else { ier = SUNSparseMatrix_ToCSC(S, &(dq->pattern)); }
+  if (ier != SUN_SUCCESS)
+  {
+    sunSparseDQ_Free(dq);
+    return ier;
+  }
+  colptrs = SUNSparseMatrix_IndexPointers(dq->pattern);
+  rowvals = SUNSparseMatrix_IndexValues(dq->pattern);
+
+  /* for a CSR Jacobian, find the position in the CSR copy of each entry */
+  if (sparsetype == CSR_MAT)
+  {
+    ier = SUNSparseMatrix_ToCSR(dq->pattern, &(dq->pattern_csr));
+    if (ier == SUN_SUCCESS)
+    {
+      dq->csrmap = (sunindextype*)malloc(SUNMAX(colptrs[N], 1) *
+                                         sizeof(sunindextype));
+      if (dq->csrmap == NULL) { ier = SUN_ERR_MEM_FAIL; }
+    }
+    if (ier != SUN_SUCCESS)
+    {
+      sunSparseDQ_Free(dq);
+      return ier;
+    }
+
+    rowptrs = SUNSparseMatrix_IndexPointers(dq->pattern_csr);
+    colvals = SUNSparseMatrix_IndexValues(dq->pattern_csr);
+    for (j = 0; j < N; j++)
+    {
+      for (k = colptrs[j]; k < colptrs[j + 1]; k++)
+      {
+        for (q = rowptrs[rowvals[k]]; q < rowptrs[rowvals[k] + 1]; q++)
+        {
+          if (colvals[q] == j) { break; }
+        }
+        dq->csrmap[k] = q;
+      }
+    }
+  }
+
+  /* color the columns and group them by color */
+  colors         = (sunindextype*)malloc(SUNMAX(N, 1) * sizeof(sunindextype));
+  dq->color_cols = (sunindextype*)malloc(SUNMAX(N, 1) * sizeof(sunindextype));
+  dq->inc        = (sunrealtype*)malloc(SUNMAX(N, 1) * sizeof(sunrealtype));
+  if ((colors == NULL) || (dq->color_cols == NULL) || (dq->inc == NULL))
+  {
+    ier = SUN_ERR_MEM_FAIL;
+  }
+  if (ier == SUN_SUCCESS)
+  {
+    ier = SUNSparseMatrix_ColumnColoring(dq->pattern, colors, &(dq->ncolors));
+  }
+  if (ier == SUN_SUCCESS)
+  {
+    dq->color_ptrs =
+      (sunindextype*)calloc(dq->ncolors + 1, sizeof(sunindextype));
+    if (dq->color_ptrs == NULL) { ier = SUN_ERR_MEM_FAIL; }
+  }
+  if (ier != SUN_SUCCESS)
+  {
+    free(colors);
+    sunSparseDQ_Free(dq);
+    return ier;
+  }
+
+  for (j = 0; j < N; j++) { dq->color_ptrs[colors[j] + 1]++; }
+  for (c = 0; c < dq->ncolors; c++)
+  {
+    dq->color_ptrs[c + 1] += dq->color_ptrs[c];
+  }
+  for (j = 0; j < N; j++) { dq->color_cols[dq->color_ptrs[colors[j]]++] = j; }
+  for (c = dq->ncolors; c > 0; c--)
+  {
+    dq->color_ptrs[c] = dq->color_ptrs[c - 1];
+  }
+  dq->color_ptrs[0] = 0;
+
+  free(colors);
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------------------
+ * sunSparseDQ_Jac
+ *
+ * Forms the difference quotient approximation of the Jacobian of fn at (t, y)
+ * on the pattern in dq and copies it into Jac. The caller sets the increment
+ * dq->inc[j] of each column j beforehand; component j of y[k] is incremented
+ * by scale[k] * dq->inc[j]. Columns of the same color have no rows in common,
+ * so they are incremented together and fn is called once per color.
+ *
+ * fy holds fn at (t, y) and ftemp and the ny vectors ytemp are work vectors.
+ * Each evaluation of fn increments *nfe. Returns the nonzero value returned by
+ * fn, -1 if copying into Jac fails, and 0 otherwise.
+ * ---------------------------------------------------------------------------*/
+
+static inline int sunSparseDQ_Jac(sunSparseDQMem* dq, sunJacProbeFn fn,
+                                  void* data, sunrealtype t, int ny,
+                                  N_Vector* y, N_Vector* ytemp,
+                                  const sunrealtype* scale, N_Vector fy,
+                                  N_Vector ftemp, SUNMatrix Jac, long int* nfe)
+{
+  SUNMatrix JS;
+  sunrealtype *y_data[SUN_JACPROBE_MAX_NY], *ytemp_data[SUN_JACPROBE_MAX_NY];
+  sunrealtype *fy_data, *ftemp_data, *S_data, inc_inv;
+  sunindextype *colptrs, *rowvals, *csrmap;
+  sunindextype c, i, j, p;
+  int k, retval;
+
+  colptrs = SUNSparseMatrix_IndexPointers(dq->pattern);
+  rowvals = SUNSparseMatrix_IndexValues(dq->pattern);
+
+  /* entries are stored in the copy of the pattern in the format of Jac */
+  JS     = (dq->pattern_csr) ? dq->pattern_csr : dq->pattern;
+  S_data = SUNSparseMatrix_Data(JS);
+  csrmap = dq->csrmap;
+
+  for (k = 0; k < ny; k++)
+  {
+    N_VScale(SUN_RCONST(1.0), y[k], ytemp[k]);
+    y_data[k]     = N_VGetArrayPointer(y[k]);
+    ytemp_data[k] = N_VGetArrayPointer(ytemp[k]);
+  }
+  fy_data    = N_VGetArrayPointer(fy);
+  ftemp_data = N_VGetArrayPointer(ftemp);
+
+  for (c = 0; c < dq->ncolors; c++)
+  {
+    /* Increment all columns with this color */
+    for (p = dq->color_ptrs[c]; p < dq->color_ptrs[c + 1]; p++)
+    {
+      j = dq->color_cols[p];
+      for (k = 0; k < ny; k++) { ytemp_data[k][j] += scale[k] * dq->inc[j]; }
+    }
+
+    retval = fn(t, ytemp, ftemp, data);
+    (*nfe)++;
+    if (retval != 0) { return retval; }
+
+    /* Restore the columns, then form and load difference quotients */
+    for (p = dq->color_ptrs[c]; p < dq->color_ptrs[c + 1]; p++)
+    {
+      j = dq->color_cols[p];
+      for (k = 0; k < ny; k++) { ytemp_data[k][j] = y_data[k][j]; }
+      inc_inv = SUN_RCONST(1.0) / dq->inc[j];
+      for (i = colptrs[j]; i < colptrs[j + 1]; i++)
+      {
+        S_data[csrmap ? csrmap[i] : i] =
+          inc_inv * (ftemp_data[rowvals[i]] - fy_data[rowvals[i]]);
+      }
+    }
+  }
+
+  /* Copy the entries into Jac */
+  if (SUNMatCopy(JS, Jac)) { return -1; }
+
+  return 0;
+}
+
+#endif
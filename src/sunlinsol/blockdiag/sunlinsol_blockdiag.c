@@ -0,0 +1,557 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for the batched block-diagonal
+ * implementation of the SUNLINSOL package.
+ *
+ * The blocks are processed in batches of W = SUNLINSOL_BLOCKDIAG_BATCH
+ * blocks. The entries of the blocks in a batch are interleaved, i.e.
+ * entry (i,j) of block l in the batch is stored at
+ *
+ *    factors[(j*n + i)*W + l],
+ *
+ * so each step of the LU factorization and of the triangular solves
+ * is applied to all W blocks with a unit-stride inner loop over the
+ * blocks that the compiler can vectorize. Each block is factored with
+ * the same operations, in the same order, as SUNDlsMat_denseGETRF.
+ * Different batches are independent and are distributed over OpenMP
+ * threads when more than one thread is requested.
+ * -----------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_math.h>
+#include <sunlinsol/sunlinsol_blockdiag.h>
+
+#include "sundials_macros.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define W SUNLINSOL_BLOCKDIAG_BATCH
+
+/*
+ * -----------------------------------------------------------------
+ * Block-diagonal solver structure accessibility macros:
+ * -----------------------------------------------------------------
+ */
+
+#define BD_CONTENT(S) ((SUNLinearSolverContent_BlockDiag)(S->content))
+#define NBLOCKS(S)    (BD_CONTENT(S)->nblocks)
+#define BLOCKSIZE(S)  (BD_CONTENT(S)->block_size)
+#define NBATCHES(S)   (BD_CONTENT(S)->nbatches)
+#define FACTORS(S)    (BD_CONTENT(S)->factors)
+#define PIVOTS(S)     (BD_CONTENT(S)->pivots)
+#define WORK(S)       (BD_CONTENT(S)->work)
+#define LASTFLAG(S)   (BD_CONTENT(S)->last_flag)
+#define NTHREADS(S)   (BD_CONTENT(S)->nthreads)
+
+/* Private function prototypes */
+static void packBatch(sunrealtype** blocks, sunindextype nblocks,
+                      sunindextype n, sunindextype batch, sunrealtype* a);
+static sunindextype factorBatch(sunrealtype* a, sunindextype n,
+                                sunindextype* p);
+static void solveBatch(sunrealtype* a, sunindextype n, sunindextype* p,
+                       sunrealtype* b);
+static void batchAxpy(sunrealtype* restrict y, const sunrealtype* restrict x,
+                      const sunrealtype* restrict s, sunindextype i0,
+                      sunindextype i1);
+
+/*
+ * -----------------------------------------------------------------
+ * exported functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new block-diagonal linear solver
+ */
+
+SUNLinearSolver SUNLinSol_BlockDiag(SUNDIALS_MAYBE_UNUSED N_Vector y,
+                                    SUNMatrix A, SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  SUNLinearSolver S;
+  SUNLinearSolverContent_BlockDiag content;
+  sunindextype nblocks, bsize, nbatches;
+
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssertNull(y->ops->nvgetarraypointer, SUN_ERR_ARG_INCOMPATIBLE);
+  SUNAssertNull(SUNBlockDiagMatrix_Rows(A) == N_VGetLength(y),
+                SUN_ERR_ARG_DIMSMISMATCH);
+
+  nblocks  = SUNBlockDiagMatrix_NumBlocks(A);
+  bsize    = SUNBlockDiagMatrix_BlockSize(A);
+  nbatches = (nblocks + W - 1) / W;
+
+  /* Create an empty linear solver */
+  S = NULL;
+  S = SUNLinSolNewEmpty(sunctx);
+  SUNCheckLastErrNull();
+
+  /* Attach operations */
+  S->ops->gettype    = SUNLinSolGetType_BlockDiag;
+  S->ops->getid      = SUNLinSolGetID_BlockDiag;
+  S->ops->initialize = SUNLinSolInitialize_BlockDiag;
+  S->ops->setup      = SUNLinSolSetup_BlockDiag;
+  S->ops->solve      = SUNLinSolSolve_BlockDiag;
+  S->ops->lastflag   = SUNLinSolLastFlag_BlockDiag;
+  S->ops->space      = SUNLinSolSpace_BlockDiag;
+  S->ops->free       = SUNLinSolFree_BlockDiag;
+
+  /* Create content */
+  content = NULL;
+  content = (SUNLinearSolverContent_BlockDiag)malloc(sizeof *content);
+  SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
+
+  /* Attach content */
+  S->content = content;
+
+  /* Fill content */
+  content->nblocks    = nblocks;
+  content->block_size = bsize;
+  content->nbatches   = nbatches;
+  content->factors    = NULL;
+  content->pivots     = NULL;
+  content->work       = NULL;
+  content->last_flag  = 0;
+  content->nthreads   = 1;
+
+  /* Allocate content */
+  content->factors =
+    (sunrealtype*)malloc(nbatches * bsize * bsize * W * sizeof(sunrealtype));
+  SUNAssertNull(content->factors, SUN_ERR_MALLOC_FAIL);
+
+  content->pivots =
+    (sunindextype*)malloc(nbatches * bsize * W * sizeof(sunindextype));
+  SUNAssertNull(content->pivots, SUN_ERR_MALLOC_FAIL);
+
+  content->work = (sunrealtype*)malloc(nbatches * bsize * W *
+                                       sizeof(sunrealtype));
+  SUNAssertNull(content->work, SUN_ERR_MALLOC_FAIL);
+
+  return (S);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to set the number of OpenMP threads used across batches
+ */
+
+SUNErrCode SUNLinSol_BlockDiagSetNumThreads(SUNLinearSolver S, int nthreads)
+{
+  if (S == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  SUNFunctionBegin(S->sunctx);
+  SUNAssert(S->content, SUN_ERR_ARG_CORRUPT);
+
+  /* Illegal nthreads implies use of default value */
+  if (nthreads < 1) { nthreads = 1; }
+
+  NTHREADS(S) = nthreads;
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * implementation of linear solver operations
+ * -----------------------------------------------------------------
+ */
+
+SUNLinearSolver_Type SUNLinSolGetType_BlockDiag(
+  SUNDIALS_MAYBE_UNUSED SUNLinearSolver S)
+{
+  return (SUNLINEARSOLVER_DIRECT);
+}
+
+SUNLinearSolver_ID SUNLinSolGetID_BlockDiag(
+  SUNDIALS_MAYBE_UNUSED SUNLinearSolver S)
+{
+  return (SUNLINEARSOLVER_BLOCKDIAG);
+}
+
+SUNErrCode SUNLinSolInitialize_BlockDiag(SUNLinearSolver S)
+{
+  /* all solver-specific memory has already been allocated */
+  LASTFLAG(S) = SUN_SUCCESS;
+  return SUN_SUCCESS;
+}
+
+int SUNLinSolSetup_BlockDiag(SUNLinearSolver S, SUNMatrix A)
+{
+  SUNFunctionBegin(S->sunctx);
+  sunrealtype **blocks, *factors;
+  sunindextype *pivots, nblocks, bsize, nbatches, batch, flag;
+
+  SUNAssert(A, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(SUNBlockDiagMatrix_NumBlocks(A) == NBLOCKS(S) &&
+              SUNBlockDiagMatrix_BlockSize(A) == BLOCKSIZE(S),
+            SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* access data pointers (return with failure on NULL) */
+  blocks  = SUNBlockDiagMatrix_Blocks(A);
+  factors = FACTORS(S);
+  pivots  = PIVOTS(S);
+  SUNAssert(blocks, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(factors, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(pivots, SUN_ERR_ARG_CORRUPT);
+
+  nblocks  = NBLOCKS(S);
+  bsize    = BLOCKSIZE(S);
+  nbatches = NBATCHES(S);
+
+  /* copy each batch of blocks into interleaved storage and factor it, keeping
+     the smallest (1-based) global row index of a zero pivot */
+  flag = nblocks * bsize + 1;
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) num_threads(NTHREADS(S)) \
+  reduction(min : flag) if (NTHREADS(S) > 1)
+#endif
+  for (batch = 0; batch < nbatches; batch++)
+  {
+    sunrealtype* a  = factors + batch * bsize * bsize * W;
+    sunindextype* p = pivots + batch * bsize * W;
+    sunindextype ier;
+
+    packBatch(blocks, nblocks, bsize, batch, a);
+    ier = factorBatch(a, bsize, p);
+    if (ier > 0) { flag = SUNMIN(flag, batch * W * bsize + ier); }
+  }
+
+  /* store error flag (if nonzero, this row encountered zero-valued pivot) */
+  LASTFLAG(S) = (flag > nblocks * bsize) ? 0 : flag;
+  if (LASTFLAG(S) > 0) { return (SUNLS_LUFACT_FAIL); }
+  return SUN_SUCCESS;
+}
+
+int SUNLinSolSolve_BlockDiag(SUNLinearSolver S,
+                             SUNDIALS_MAYBE_UNUSED SUNMatrix A, N_Vector x,
+                             N_Vector b, SUNDIALS_MAYBE_UNUSED sunrealtype tol)
+{
+  SUNFunctionBegin(S->sunctx);
+  sunrealtype *xdata, *bdata, *factors, *work;
+  sunindextype *pivots, nblocks, bsize, nbatches, batch;
+
+  /* access data pointers (return with failure on NULL) */
+  xdata = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  bdata = N_VGetArrayPointer(b);
+  SUNCheckLastErr();
+  factors = FACTORS(S);
+  pivots  = PIVOTS(S);
+  work    = WORK(S);
+
+  SUNAssert(xdata, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(bdata, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(factors, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(pivots, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(work, SUN_ERR_ARG_CORRUPT);
+
+  nblocks  = NBLOCKS(S);
+  bsize    = BLOCKSIZE(S);
+  nbatches = NBATCHES(S);
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) num_threads(NTHREADS(S)) \
+  if (NTHREADS(S) > 1)
+#endif
+  for (batch = 0; batch < nbatches; batch++)
+  {
+    sunrealtype* a  = factors + batch * bsize * bsize * W;
+    sunindextype* p = pivots + batch * bsize * W;
+    sunrealtype* wb = work + batch * bsize * W;
+    sunindextype i, l, blk;
+
+    /* gather the right-hand sides of the batch into interleaved storage */
+    for (l = 0; l < W; l++)
+    {
+      blk = batch * W + l;
+      for (i = 0; i < bsize; i++)
+      {
+        wb[i * W + l] = (blk < nblocks) ? bdata[blk * bsize + i] : ZERO;
+      }
+    }
+
+    solveBatch(a, bsize, p, wb);
+
+    /* scatter the solutions */
+    for (l = 0; l < W && batch * W + l < nblocks; l++)
+    {
+      blk = batch * W + l;
+      for (i = 0; i < bsize; i++) { xdata[blk * bsize + i] = wb[i * W + l]; }
+    }
+  }
+
+  LASTFLAG(S) = SUN_SUCCESS;
+  return SUN_SUCCESS;
+}
+
+sunindextype SUNLinSolLastFlag_BlockDiag(SUNLinearSolver S)
+{
+  /* return the stored 'last_flag' value */
+  return (LASTFLAG(S));
+}
+
+SUNErrCode SUNLinSolSpace_BlockDiag(SUNLinearSolver S, long int* lenrwLS,
+                                    long int* leniwLS)
+{
+  SUNFunctionBegin(S->sunctx);
+  SUNAssert(SUNLinSolGetID(S) == SUNLINEARSOLVER_BLOCKDIAG,
+            SUN_ERR_ARG_WRONGTYPE);
+  *leniwLS = 4 + NBATCHES(S) * BLOCKSIZE(S) * W;
+  *lenrwLS = NBATCHES(S) * BLOCKSIZE(S) * (BLOCKSIZE(S) + 1) * W;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNLinSolFree_BlockDiag(SUNLinearSolver S)
+{
+  /* return if S is already free */
+  if (S == NULL) { return SUN_SUCCESS; }
+
+  /* delete items from contents, then delete generic structure */
+  if (S->content)
+  {
+    if (FACTORS(S))
+    {
+      free(FACTORS(S));
+      FACTORS(S) = NULL;
+    }
+    if (PIVOTS(S))
+    {
+      free(PIVOTS(S));
+      PIVOTS(S) = NULL;
+    }
+    if (WORK(S))
+    {
+      free(WORK(S));
+      WORK(S) = NULL;
+    }
+    free(S->content);
+    S->content = NULL;
+  }
+  if (S->ops)
+  {
+    free(S->ops);
+    S->ops = NULL;
+  }
+  free(S);
+  S = NULL;
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * private functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Copy the blocks of a batch into interleaved storage. Unused slots in the
+ * last batch are filled with identity blocks so they factor without failure.
+ */
+
+static void packBatch(sunrealtype** blocks, sunindextype nblocks,
+                      sunindextype n, sunindextype batch, sunrealtype* a)
+{
+  sunindextype i, l, blk;
+
+  for (l = 0; l < W; l++)
+  {
+    blk = batch * W + l;
+    if (blk < nblocks)
+    {
+      sunrealtype* block = blocks[blk];
+      for (i = 0; i < n * n; i++) { a[i * W + l] = block[i]; }
+    }
+    else
+    {
+      for (i = 0; i < n * n; i++) { a[i * W + l] = ZERO; }
+      for (i = 0; i < n; i++) { a[(i * n + i) * W + l] = ONE; }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------------
+ * LU factorization with partial pivoting of the W interleaved n by n blocks in
+ * a. On return p[k*W + l] holds the pivot row of step k for block l. Returns
+ * 0 on success or l*n + k + 1 for the first block l (and the step k in that
+ * block) with a zero pivot. A block with a zero pivot does not affect the
+ * factorization of the other blocks in the batch.
+ */
+
+static sunindextype factorBatch(sunrealtype* a, sunindextype n, sunindextype* p)
+{
+  sunindextype i, j, k, l, fail[W];
+  sunrealtype pmax[W], mult[W], akj[W], tmp, *col_k, *col_j;
+
+  for (l = 0; l < W; l++) { fail[l] = 0; }
+
+  for (k = 0; k < n; k++)
+  {
+    col_k = a + k * n * W;
+
+    /* find the pivot row of each block */
+    for (l = 0; l < W; l++)
+    {
+      pmax[l]      = SUNRabs(col_k[k * W + l]);
+      p[k * W + l] = k;
+    }
+    for (i = k + 1; i < n; i++)
+    {
+      for (l = 0; l < W; l++)
+      {
+        tmp = SUNRabs(col_k[i * W + l]);
+        if (tmp > pmax[l])
+        {
+          pmax[l]      = tmp;
+          p[k * W + l] = i;
+        }
+      }
+    }
+
+    /* record zero pivots */
+    for (l = 0; l < W; l++)
+    {
+      if (pmax[l] == ZERO && fail[l] == 0) { fail[l] = k + 1; }
+    }
+
+    /* swap rows k and p[k] in every column */
+    for (l = 0; l < W; l++)
+    {
+      i = p[k * W + l];
+      if (i == k) { continue; }
+      for (j = 0; j < n; j++)
+      {
+        col_j            = a + j * n * W;
+        tmp              = col_j[i * W + l];
+        col_j[i * W + l] = col_j[k * W + l];
+        col_j[k * W + l] = tmp;
+      }
+    }
+
+    /* scale the elements below the diagonal in column k */
+    for (l = 0; l < W; l++)
+    {
+      mult[l] = (fail[l] == 0) ? ONE / col_k[k * W + l] : ZERO;
+    }
+    for (i = k + 1; i < n; i++)
+    {
+      for (l = 0; l < W; l++) { col_k[i * W + l] *= mult[l]; }
+    }
+
+    /* update the remaining columns */
+    for (j = k + 1; j < n; j++)
+    {
+      col_j = a + j * n * W;
+      for (l = 0; l < W; l++) { akj[l] = col_j[k * W + l]; }
+      batchAxpy(col_j, col_k, akj, k + 1, n);
+    }
+  }
+
+  for (l = 0; l < W; l++)
+  {
+    if (fail[l] > 0) { return (l * n + fail[l]); }
+  }
+  return (0);
+}
+
+/* ----------------------------------------------------------------------------
+ * Solve A_l x_l = b_l for the W interleaved blocks in a using the factors and
+ * pivots from factorBatch. The right-hand sides are interleaved in b, i.e.
+ * entry i of b_l is b[i*W + l], and are overwritten with the solutions. As in
+ * SUNDlsMat_denseGETRS, zero entries of b are not skipped.
+ */
+
+static void solveBatch(sunrealtype* a, sunindextype n, sunindextype* p,
+                       sunrealtype* b)
+{
+  sunindextype i, k, l, pk;
+  sunrealtype bk[W], tmp, *col_k;
+
+  /* permute b based on the pivot information */
+  for (k = 0; k < n; k++)
+  {
+    for (l = 0; l < W; l++)
+    {
+      pk = p[k * W + l];
+      if (pk != k)
+      {
+        tmp           = b[k * W + l];
+        b[k * W + l]  = b[pk * W + l];
+        b[pk * W + l] = tmp;
+      }
+    }
+  }
+
+  /* solve Ly = b, store solution y in b */
+  for (k = 0; k < n - 1; k++)
+  {
+    col_k = a + k * n * W;
+    for (l = 0; l < W; l++) { bk[l] = b[k * W + l]; }
+    for (i = k + 1; i < n; i++)
+    {
+      for (l = 0; l < W; l++) { b[i * W + l] -= col_k[i * W + l] * bk[l]; }
+    }
+  }
+
+  /* solve Ux = y, store solution x in b */
+  for (k = n - 1; k >= 0; k--)
+  {
+    col_k = a + k * n * W;
+    for (l = 0; l < W; l++)
+    {
+      b[k * W + l] /= col_k[k * W + l];
+      bk[l] = b[k * W + l];
+    }
+    for (i = 0; i < k; i++)
+    {
+      for (l = 0; l < W; l++) { b[i * W + l] -= col_k[i * W + l] * bk[l]; }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute y[i*W + l] -= x[i*W + l] * s[l] for i0 <= i < i1 and all W blocks,
+ * the column update of the factorization. Blocks with a zero multiplier are
+ * skipped, as in the dense factorization, so that 0 * Inf does not introduce
+ * a NaN into the factors.
+ */
+
+static void batchAxpy(sunrealtype* restrict y, const sunrealtype* restrict x,
+                      const sunrealtype* restrict s, sunindextype i0,
+                      sunindextype i1)
+{
+  sunindextype i, l;
+  sunbooleantype has_zero = SUNFALSE;
+
+  for (l = 0; l < W; l++)
+  {
+    if (s[l] == ZERO) { has_zero = SUNTRUE; }
+  }
+
+  if (!has_zero)
+  {
+    for (i = i0; i < i1; i++)
+    {
+      for (l = 0; l < W; l++) { y[i * W + l] -= x[i * W + l] * s[l]; }
+    }
+    return;
+  }
+
+  for (l = 0; l < W; l++)
+  {
+    if (s[l] == ZERO) { continue; }
+    for (i = i0; i < i1; i++) { y[i * W + l] -= x[i * W + l] * s[l]; }
+  }
+}
@@ -23,6 +23,7 @@
 #include <sundials/sundials_math.h>
 #include <sunlinsol/sunlinsol_dense.h>
 
+#include "sundials_dense_impl.h"
 #include "sundials_logger_impl.h"
 #include "sundials_macros.h"
 
@@ -37,6 +38,7 @@
 #define DENSE_CONTENT(S) ((SUNLinearSolverContent_Dense)(S->content))
 #define PIVOTS(S)        (DENSE_CONTENT(S)->pivots)
 #define LASTFLAG(S)      (DENSE_CONTENT(S)->last_flag)
+#define NTHREADS(S)      (DENSE_CONTENT(S)->nthreads)
 
 /*
  * -----------------------------------------------------------------
@@ -91,6 +93,7 @@ SUNLinearSolver SUNLinSol_Dense(SUNDIALS_MAYBE_UNUSED N_Vector y, SUNMatrix A,
   content->N         = MatrixRows;
   content->last_flag = 0;
   content->pivots    = NULL;
+  content->nthreads  = 1;
 
   /* Allocate content */
   content->pivots = (sunindextype*)malloc(MatrixRows * sizeof(sunindextype));
@@ -99,6 +102,25 @@ SUNLinearSolver SUNLinSol_Dense(SUNDIALS_MAYBE_UNUSED N_Vector y, SUNMatrix A,
   return (S);
 }
 
+/* ----------------------------------------------------------------------------
+ * Function to set the number of OpenMP threads used in the factorization
+ */
+
+SUNErrCode SUNLinSol_DenseSetNumThreads(SUNLinearSolver S, int nthreads)
+{
+  /* Check for non-NULL SUNLinearSolver */
+  if (S == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  SUNFunctionBegin(S->sunctx);
+  SUNAssert(S->content, SUN_ERR_ARG_CORRUPT);
+
+  /* Illegal nthreads implies use of default value */
+  if (nthreads < 1) { nthreads = 1; }
+
+  NTHREADS(S) = nthreads;
+  return SUN_SUCCESS;
+}
+
 /*
  * -----------------------------------------------------------------
  * implementation of linear solver operations
@@ -140,8 +162,8 @@ int SUNLinSolSetup_Dense(SUNLinearSolver S, SUNMatrix A)
   SUNAssert(A_cols, SUN_ERR_ARG_CORRUPT);
 
   /* perform LU factorization of input matrix */
-  LASTFLAG(S) = SUNDlsMat_denseGETRF(A_cols, SUNDenseMatrix_Rows(A),
-                                     SUNDenseMatrix_Columns(A), pivots);
+  LASTFLAG(S) = sunDenseGETRF(A_cols, SUNDenseMatrix_Rows(A),
+                              SUNDenseMatrix_Columns(A), pivots, NTHREADS(S));
 
   /* store error flag (if nonzero, this row encountered zero-valued pivod) */
   if (LASTFLAG(S) > 0) { return (SUNLS_LUFACT_FAIL); }
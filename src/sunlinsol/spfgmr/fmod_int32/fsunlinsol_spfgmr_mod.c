@@ -254,6 +254,20 @@ SWIGEXPORT int _wrap_FSUNLinSol_SPFGMRSetGSType(SUNLinearSolver farg1, int const
 }
 
 
+SWIGEXPORT int _wrap_FSUNLinSol_SPFGMRSetGSNormEstimate(SUNLinearSolver farg1, int const *farg2) {
+  int fresult ;
+  SUNLinearSolver arg1 = (SUNLinearSolver) 0 ;
+  int arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNLinearSolver)(farg1);
+  arg2 = (int)(*farg2);
+  result = (SUNErrCode)SUNLinSol_SPFGMRSetGSNormEstimate(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FSUNLinSol_SPFGMRSetMaxRestarts(SUNLinearSolver farg1, int const *farg2) {
   int fresult ;
   SUNLinearSolver arg1 = (SUNLinearSolver) 0 ;
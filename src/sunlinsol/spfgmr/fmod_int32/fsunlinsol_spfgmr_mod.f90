@@ -30,6 +30,7 @@ module fsunlinsol_spfgmr_mod
  public :: FSUNLinSol_SPFGMR
  public :: FSUNLinSol_SPFGMRSetPrecType
  public :: FSUNLinSol_SPFGMRSetGSType
+ public :: FSUNLinSol_SPFGMRSetGSNormEstimate
  public :: FSUNLinSol_SPFGMRSetMaxRestarts
  public :: FSUNLinSolGetType_SPFGMR
  public :: FSUNLinSolGetID_SPFGMR
@@ -78,6 +79,15 @@ integer(C_INT), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNLinSol_SPFGMRSetGSNormEstimate(farg1, farg2) &
+bind(C, name="_wrap_FSUNLinSol_SPFGMRSetGSNormEstimate") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FSUNLinSol_SPFGMRSetMaxRestarts(farg1, farg2) &
 bind(C, name="_wrap_FSUNLinSol_SPFGMRSetMaxRestarts") &
 result(fresult)
@@ -281,6 +291,22 @@ fresult = swigc_FSUNLinSol_SPFGMRSetGSType(farg1, farg2)
 swig_result = fresult
 end function
 
+function FSUNLinSol_SPFGMRSetGSNormEstimate(s, onoff) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(SUNLinearSolver), target, intent(inout) :: s
+integer(C_INT), intent(in) :: onoff
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = c_loc(s)
+farg2 = onoff
+fresult = swigc_FSUNLinSol_SPFGMRSetGSNormEstimate(farg1, farg2)
+swig_result = fresult
+end function
+
 function FSUNLinSol_SPFGMRSetMaxRestarts(s, maxrs) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
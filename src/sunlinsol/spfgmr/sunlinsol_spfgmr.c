@@ -107,6 +107,7 @@ SUNLinearSolver SUNLinSol_SPFGMR(N_Vector y, int pretype, int maxl,
   content->maxl         = maxl;
   content->pretype      = pretype;
   content->gstype       = SUNSPFGMR_GSTYPE_DEFAULT;
+  content->gs_est_norm  = SUNFALSE;
   content->max_restarts = SUNSPFGMR_MAXRS_DEFAULT;
   content->zeroguess    = SUNFALSE;
   content->numiters     = 0;
@@ -172,6 +173,18 @@ SUNErrCode SUNLinSol_SPFGMRSetGSType(SUNLinearSolver S, int gstype)
   return SUN_SUCCESS;
 }
 
+/* ----------------------------------------------------------------------------
+ * Function to toggle estimating the norm of the new basis vector in classical
+ * Gram-Schmidt orthogonalization
+ */
+
+SUNErrCode SUNLinSol_SPFGMRSetGSNormEstimate(SUNLinearSolver S,
+                                             sunbooleantype onoff)
+{
+  SPFGMR_CONTENT(S)->gs_est_norm = onoff;
+  return SUN_SUCCESS;
+}
+
 /* ----------------------------------------------------------------------------
  * Function to set the maximum number of FGMRES restarts to allow
  */
@@ -234,14 +247,16 @@ SUNErrCode SUNLinSolInitialize_SPFGMR(SUNLinearSolver S)
   /*   Krylov subspace vectors */
   if (content->V == NULL)
   {
-    content->V = N_VCloneVectorArray(content->maxl + 1, content->vtemp);
+    content->V = N_VCloneVectorArrayContiguous(content->maxl + 1,
+                                               content->vtemp);
     SUNCheckLastErr();
   }
 
   /*   Preconditioned basis vectors */
   if (content->Z == NULL)
   {
-    content->Z = N_VCloneVectorArray(content->maxl + 1, content->vtemp);
+    content->Z = N_VCloneVectorArrayContiguous(content->maxl + 1,
+                                               content->vtemp);
     SUNCheckLastErr();
   }
 
@@ -373,6 +388,7 @@ int SUNLinSolSolve_SPFGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
   sunbooleantype preOnRight, scale1, scale2, converged;
   sunbooleantype* zeroguess;
   int i, j, k, l, l_max, krydim, ntries, max_restarts, gstype;
+  sunbooleantype gs_est_norm;
   int* nli;
   void *A_data, *P_data;
   SUNATimesFn atimes;
@@ -390,6 +406,7 @@ int SUNLinSolSolve_SPFGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
   l_max        = SPFGMR_CONTENT(S)->maxl;
   max_restarts = SPFGMR_CONTENT(S)->max_restarts;
   gstype       = SPFGMR_CONTENT(S)->gstype;
+  gs_est_norm  = SPFGMR_CONTENT(S)->gs_est_norm;
   V            = SPFGMR_CONTENT(S)->V;
   Z            = SPFGMR_CONTENT(S)->Z;
   Hes          = SPFGMR_CONTENT(S)->Hes;
@@ -575,8 +592,16 @@ int SUNLinSolSolve_SPFGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
       /* Orthogonalize V[l+1] against previous V[i]: V[l+1] = w_tilde. */
       if (gstype == SUN_CLASSICAL_GS)
       {
-        SUNCheckCall(
-          SUNClassicalGS(V, Hes, l + 1, l_max, &(Hes[l + 1][l]), cv, Xv));
+        if (gs_est_norm)
+        {
+          SUNCheckCall(SUNClassicalGSEstNorm(V, Hes, l + 1, l_max,
+                                             &(Hes[l + 1][l]), cv, Xv));
+        }
+        else
+        {
+          SUNCheckCall(
+            SUNClassicalGS(V, Hes, l + 1, l_max, &(Hes[l + 1][l]), cv, Xv));
+        }
       }
       else
       {
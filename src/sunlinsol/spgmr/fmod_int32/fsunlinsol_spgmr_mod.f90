@@ -30,6 +30,7 @@ module fsunlinsol_spgmr_mod
  public :: FSUNLinSol_SPGMR
  public :: FSUNLinSol_SPGMRSetPrecType
  public :: FSUNLinSol_SPGMRSetGSType
+ public :: FSUNLinSol_SPGMRSetGSNormEstimate
  public :: FSUNLinSol_SPGMRSetMaxRestarts
  public :: FSUNLinSolGetType_SPGMR
  public :: FSUNLinSolGetID_SPGMR
@@ -78,6 +79,15 @@ integer(C_INT), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNLinSol_SPGMRSetGSNormEstimate(farg1, farg2) &
+bind(C, name="_wrap_FSUNLinSol_SPGMRSetGSNormEstimate") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FSUNLinSol_SPGMRSetMaxRestarts(farg1, farg2) &
 bind(C, name="_wrap_FSUNLinSol_SPGMRSetMaxRestarts") &
 result(fresult)
@@ -281,6 +291,22 @@ fresult = swigc_FSUNLinSol_SPGMRSetGSType(farg1, farg2)
 swig_result = fresult
 end function
 
+function FSUNLinSol_SPGMRSetGSNormEstimate(s, onoff) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(SUNLinearSolver), target, intent(inout) :: s
+integer(C_INT), intent(in) :: onoff
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = c_loc(s)
+farg2 = onoff
+fresult = swigc_FSUNLinSol_SPGMRSetGSNormEstimate(farg1, farg2)
+swig_result = fresult
+end function
+
 function FSUNLinSol_SPGMRSetMaxRestarts(s, maxrs) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -105,6 +105,7 @@ SUNLinearSolver SUNLinSol_SPGMR(N_Vector y, int pretype, int maxl,
   content->maxl         = maxl;
   content->pretype      = pretype;
   content->gstype       = SUNSPGMR_GSTYPE_DEFAULT;
+  content->gs_est_norm  = SUNFALSE;
   content->max_restarts = SUNSPGMR_MAXRS_DEFAULT;
   content->zeroguess    = SUNFALSE;
   content->numiters     = 0;
@@ -167,6 +168,18 @@ SUNErrCode SUNLinSol_SPGMRSetGSType(SUNLinearSolver S, int gstype)
   return SUN_SUCCESS;
 }
 
+/* ----------------------------------------------------------------------------
+ * Function to toggle estimating the norm of the new basis vector in classical
+ * Gram-Schmidt orthogonalization
+ */
+
+SUNErrCode SUNLinSol_SPGMRSetGSNormEstimate(SUNLinearSolver S,
+                                            sunbooleantype onoff)
+{
+  SPGMR_CONTENT(S)->gs_est_norm = onoff;
+  return SUN_SUCCESS;
+}
+
 /* ----------------------------------------------------------------------------
  * Function to set the maximum number of GMRES restarts to allow
  */
@@ -229,7 +242,8 @@ SUNErrCode SUNLinSolInitialize_SPGMR(SUNLinearSolver S)
   /*   Krylov subspace vectors */
   if (content->V == NULL)
   {
-    content->V = N_VCloneVectorArray(content->maxl + 1, content->vtemp);
+    content->V = N_VCloneVectorArrayContiguous(content->maxl + 1,
+                                               content->vtemp);
     SUNCheckLastErr();
   }
 
@@ -358,6 +372,7 @@ int SUNLinSolSolve_SPGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
   sunbooleantype preOnLeft, preOnRight, scale2, scale1, converged;
   sunbooleantype* zeroguess;
   int i, j, k, l, l_plus_1, l_max, krydim, ntries, max_restarts, gstype;
+  sunbooleantype gs_est_norm;
   int* nli;
   void *A_data, *P_data;
   SUNATimesFn atimes;
@@ -374,6 +389,7 @@ int SUNLinSolSolve_SPGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
   l_max        = SPGMR_CONTENT(S)->maxl;
   max_restarts = SPGMR_CONTENT(S)->max_restarts;
   gstype       = SPGMR_CONTENT(S)->gstype;
+  gs_est_norm  = SPGMR_CONTENT(S)->gs_est_norm;
   V            = SPGMR_CONTENT(S)->V;
   Hes          = SPGMR_CONTENT(S)->Hes;
   givens       = SPGMR_CONTENT(S)->givens;
@@ -608,8 +624,16 @@ int SUNLinSolSolve_SPGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
       /*  Orthogonalize V[l+1] against previous V[i]: V[l+1] = w_tilde */
       if (gstype == SUN_CLASSICAL_GS)
       {
-        SUNCheckCall(
-          SUNClassicalGS(V, Hes, l_plus_1, l_max, &(Hes[l_plus_1][l]), cv, Xv));
+        if (gs_est_norm)
+        {
+          SUNCheckCall(SUNClassicalGSEstNorm(V, Hes, l_plus_1, l_max,
+                                             &(Hes[l_plus_1][l]), cv, Xv));
+        }
+        else
+        {
+          SUNCheckCall(SUNClassicalGS(V, Hes, l_plus_1, l_max,
+                                      &(Hes[l_plus_1][l]), cv, Xv));
+        }
       }
       else
       {
@@ -0,0 +1,440 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for the block-diagonal
+ * implementation of the SUNMATRIX package.
+ * -----------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_errors.h>
+#include <sunmatrix/sunmatrix_blockdiag.h>
+
+#include "sundials_macros.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* Private function prototypes */
+static sunbooleantype compatibleMatrices(SUNMatrix A, SUNMatrix B);
+static sunbooleantype compatibleMatrixAndVectors(SUNMatrix A, N_Vector x,
+                                                 N_Vector y);
+
+/*
+ * -----------------------------------------------------------------
+ * exported functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new block-diagonal matrix
+ */
+
+SUNMatrix SUNBlockDiagMatrix(sunindextype nblocks, sunindextype block_size,
+                             SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  SUNMatrix A;
+  SUNMatrixContent_BlockDiag content;
+  sunindextype k, bsize2;
+
+  /* return with NULL matrix on illegal dimension input */
+  SUNAssertNull(nblocks > 0 && block_size > 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* Create an empty matrix object */
+  A = NULL;
+  A = SUNMatNewEmpty(sunctx);
+  SUNCheckLastErrNull();
+
+  /* Attach operations */
+  A->ops->getid                    = SUNMatGetID_BlockDiag;
+  A->ops->clone                    = SUNMatClone_BlockDiag;
+  A->ops->destroy                  = SUNMatDestroy_BlockDiag;
+  A->ops->zero                     = SUNMatZero_BlockDiag;
+  A->ops->copy                     = SUNMatCopy_BlockDiag;
+  A->ops->scaleadd                 = SUNMatScaleAdd_BlockDiag;
+  A->ops->scaleaddi                = SUNMatScaleAddI_BlockDiag;
+  A->ops->matvec                   = SUNMatMatvec_BlockDiag;
+  A->ops->mathermitiantransposevec = SUNMatHermitianTransposeVec_BlockDiag;
+  A->ops->space                    = SUNMatSpace_BlockDiag;
+
+  /* Create content */
+  content = NULL;
+  content = (SUNMatrixContent_BlockDiag)malloc(sizeof *content);
+  SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
+
+  /* Attach content */
+  A->content = content;
+
+  /* Fill content */
+  bsize2              = block_size * block_size;
+  content->nblocks    = nblocks;
+  content->block_size = block_size;
+  content->M          = nblocks * block_size;
+  content->ldata      = nblocks * bsize2;
+  content->data       = NULL;
+  content->blocks     = NULL;
+
+  /* Allocate content */
+  content->data = (sunrealtype*)calloc(content->ldata, sizeof(sunrealtype));
+  SUNAssertNull(content->data, SUN_ERR_MALLOC_FAIL);
+
+  content->blocks = (sunrealtype**)malloc(nblocks * sizeof(sunrealtype*));
+  SUNAssertNull(content->blocks, SUN_ERR_MALLOC_FAIL);
+  for (k = 0; k < nblocks; k++)
+  {
+    content->blocks[k] = content->data + k * bsize2;
+  }
+
+  return (A);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to print the block-diagonal matrix
+ */
+
+void SUNBlockDiagMatrix_Print(SUNMatrix A, FILE* outfile)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, j, k;
+
+  SUNAssertVoid(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+
+  /* perform operation */
+  fprintf(outfile, "\n");
+  for (k = 0; k < SM_NBLOCKS_BD(A); k++)
+  {
+    fprintf(outfile, "block %ld =\n", (long int)k);
+    for (i = 0; i < SM_BLOCKSIZE_BD(A); i++)
+    {
+      for (j = 0; j < SM_BLOCKSIZE_BD(A); j++)
+      {
+        fprintf(outfile, SUN_FORMAT_E "  ", SM_ELEMENT_BD(A, k, i, j));
+      }
+      fprintf(outfile, "\n");
+    }
+    fprintf(outfile, "\n");
+  }
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Functions to access the contents of the block-diagonal matrix structure
+ */
+
+sunindextype SUNBlockDiagMatrix_NumBlocks(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  return SM_NBLOCKS_BD(A);
+}
+
+sunindextype SUNBlockDiagMatrix_BlockSize(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  return SM_BLOCKSIZE_BD(A);
+}
+
+sunindextype SUNBlockDiagMatrix_Rows(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  return SM_ROWS_BD(A);
+}
+
+sunindextype SUNBlockDiagMatrix_Columns(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  return SM_COLUMNS_BD(A);
+}
+
+sunindextype SUNBlockDiagMatrix_LData(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  return SM_LDATA_BD(A);
+}
+
+sunrealtype* SUNBlockDiagMatrix_Data(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  return SM_DATA_BD(A);
+}
+
+sunrealtype** SUNBlockDiagMatrix_Blocks(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  return SM_BLOCKS_BD(A);
+}
+
+sunrealtype* SUNBlockDiagMatrix_Block(SUNMatrix A, sunindextype k)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  return SM_BLOCK_BD(A, k);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * implementation of matrix operations
+ * -----------------------------------------------------------------
+ */
+
+SUNMatrix_ID SUNMatGetID_BlockDiag(SUNDIALS_MAYBE_UNUSED SUNMatrix A)
+{
+  return SUNMATRIX_BLOCKDIAG;
+}
+
+SUNMatrix SUNMatClone_BlockDiag(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNMatrix B = SUNBlockDiagMatrix(SM_NBLOCKS_BD(A), SM_BLOCKSIZE_BD(A),
+                                   A->sunctx);
+  SUNCheckLastErrNull();
+  return (B);
+}
+
+void SUNMatDestroy_BlockDiag(SUNMatrix A)
+{
+  if (A == NULL) { return; }
+
+  /* free content */
+  if (A->content != NULL)
+  {
+    /* free data array */
+    if (SM_DATA_BD(A) != NULL)
+    {
+      free(SM_DATA_BD(A));
+      SM_DATA_BD(A) = NULL;
+    }
+    /* free block pointers */
+    if (SM_BLOCKS_BD(A) != NULL)
+    {
+      free(SM_BLOCKS_BD(A));
+      SM_BLOCKS_BD(A) = NULL;
+    }
+    /* free content struct */
+    free(A->content);
+    A->content = NULL;
+  }
+
+  /* free ops and matrix */
+  if (A->ops)
+  {
+    free(A->ops);
+    A->ops = NULL;
+  }
+  free(A);
+  A = NULL;
+
+  return;
+}
+
+SUNErrCode SUNMatZero_BlockDiag(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i;
+  sunrealtype* Adata;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+
+  /* Perform operation A_ij = 0 */
+  Adata = SM_DATA_BD(A);
+  for (i = 0; i < SM_LDATA_BD(A); i++) { Adata[i] = ZERO; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatCopy_BlockDiag(SUNMatrix A, SUNMatrix B)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i;
+  sunrealtype *Adata, *Bdata;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(SUNMatGetID(B) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrices(A, B), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* Perform operation B_ij = A_ij */
+  Adata = SM_DATA_BD(A);
+  Bdata = SM_DATA_BD(B);
+  for (i = 0; i < SM_LDATA_BD(A); i++) { Bdata[i] = Adata[i]; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatScaleAddI_BlockDiag(sunrealtype c, SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, k, bsize;
+  sunrealtype* Adata;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+
+  /* Perform operation A = c*A + I */
+  Adata = SM_DATA_BD(A);
+  for (i = 0; i < SM_LDATA_BD(A); i++) { Adata[i] *= c; }
+
+  bsize = SM_BLOCKSIZE_BD(A);
+  for (k = 0; k < SM_NBLOCKS_BD(A); k++)
+  {
+    for (i = 0; i < bsize; i++) { SM_ELEMENT_BD(A, k, i, i) += ONE; }
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatScaleAdd_BlockDiag(sunrealtype c, SUNMatrix A, SUNMatrix B)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i;
+  sunrealtype *Adata, *Bdata;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(SUNMatGetID(B) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrices(A, B), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* Perform operation A = c*A + B */
+  Adata = SM_DATA_BD(A);
+  Bdata = SM_DATA_BD(B);
+  for (i = 0; i < SM_LDATA_BD(A); i++) { Adata[i] = c * Adata[i] + Bdata[i]; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatMatvec_BlockDiag(SUNMatrix A, N_Vector x, N_Vector y)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunrealtype *xd, *yd;
+  sunindextype bsize;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrixAndVectors(A, x, y), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* access vector data (return if NULL data pointers) */
+  xd = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  yd = N_VGetArrayPointer(y);
+  SUNCheckLastErr();
+
+  SUNAssert(xd, SUN_ERR_MEM_FAIL);
+  SUNAssert(yd, SUN_ERR_MEM_FAIL);
+  SUNAssert(xd != yd, SUN_ERR_MEM_FAIL);
+
+  /* Perform operation y_k = A_k x_k for each block */
+  bsize = SM_BLOCKSIZE_BD(A);
+  for (sunindextype k = 0; k < SM_NBLOCKS_BD(A); k++)
+  {
+    sunrealtype* Ak = SM_BLOCK_BD(A, k);
+    sunrealtype* xk = xd + k * bsize;
+    sunrealtype* yk = yd + k * bsize;
+    for (sunindextype i = 0; i < bsize; i++) { yk[i] = ZERO; }
+    for (sunindextype j = 0; j < bsize; j++)
+    {
+      sunrealtype* col_j = Ak + j * bsize;
+      for (sunindextype i = 0; i < bsize; i++) { yk[i] += col_j[i] * xk[j]; }
+    }
+  }
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatHermitianTransposeVec_BlockDiag(SUNMatrix A, N_Vector x,
+                                                 N_Vector y)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunrealtype *xd, *yd;
+  sunindextype bsize;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrixAndVectors(A, y, x), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* access vector data (return if NULL data pointers) */
+  xd = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  yd = N_VGetArrayPointer(y);
+  SUNCheckLastErr();
+
+  SUNAssert(xd, SUN_ERR_MEM_FAIL);
+  SUNAssert(yd, SUN_ERR_MEM_FAIL);
+  SUNAssert(xd != yd, SUN_ERR_MEM_FAIL);
+
+  /* Perform operation y_k = A_k^T x_k for each block */
+  bsize = SM_BLOCKSIZE_BD(A);
+  for (sunindextype k = 0; k < SM_NBLOCKS_BD(A); k++)
+  {
+    sunrealtype* Ak = SM_BLOCK_BD(A, k);
+    sunrealtype* xk = xd + k * bsize;
+    sunrealtype* yk = yd + k * bsize;
+    for (sunindextype i = 0; i < bsize; i++)
+    {
+      sunrealtype* row_i = Ak + i * bsize;
+      yk[i]              = ZERO;
+      for (sunindextype j = 0; j < bsize; j++) { yk[i] += row_i[j] * xk[j]; }
+    }
+  }
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatSpace_BlockDiag(SUNMatrix A, long int* lenrw, long int* leniw)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDIAG, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(lenrw, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(leniw, SUN_ERR_ARG_CORRUPT);
+  *lenrw = SM_LDATA_BD(A);
+  *leniw = 4 + SM_NBLOCKS_BD(A);
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * private functions
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_MAYBE_UNUSED
+static sunbooleantype compatibleMatrices(SUNMatrix A, SUNMatrix B)
+{
+  /* both matrices must have the same number and size of blocks */
+  if ((SM_NBLOCKS_BD(A) != SM_NBLOCKS_BD(B)) ||
+      (SM_BLOCKSIZE_BD(A) != SM_BLOCKSIZE_BD(B)))
+  {
+    return SUNFALSE;
+  }
+
+  return SUNTRUE;
+}
+
+SUNDIALS_MAYBE_UNUSED
+static sunbooleantype compatibleMatrixAndVectors(SUNMatrix A, N_Vector x,
+                                                 N_Vector y)
+{
+  /* Vectors must provide nvgetarraypointer and cannot be a parallel vector */
+  if (!x->ops->nvgetarraypointer || !y->ops->nvgetarraypointer)
+  {
+    return SUNFALSE;
+  }
+
+  /* Check that the dimensions agree */
+  if ((N_VGetLength(x) != SM_COLUMNS_BD(A)) ||
+      (N_VGetLength(y) != SM_ROWS_BD(A)))
+  {
+    return SUNFALSE;
+  }
+
+  return SUNTRUE;
+}
@@ -0,0 +1,1165 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for the block sparse row (BSR)
+ * implementation of the SUNMATRIX package.
+ * -----------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_math.h>
+#include <sunmatrix/sunmatrix_bsr.h>
+#include <sunmatrix/sunmatrix_sparse.h>
+
+#include "sundials_macros.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* Largest block size with a fixed-size matvec kernel. Larger blocks use a
+   generic kernel that accumulates directly into the output vector. */
+#define BSR_MAX_KERNEL 8
+
+/* Private function prototypes */
+static sunbooleantype compatibleMatrices(SUNMatrix A, SUNMatrix B);
+static sunbooleantype compatibleMatrixAndVectors(SUNMatrix A, N_Vector x,
+                                                 N_Vector y);
+static sunbooleantype samePattern(SUNMatrix A, SUNMatrix B);
+static int compareIndex(const void* a, const void* b);
+static void replaceStructure(SUNMatrix A, sunindextype nnzb,
+                             sunindextype* rowptrs, sunindextype* colidx,
+                             sunrealtype* data);
+static void blockRowsMatvec1(sunindextype MB, const sunindextype* rowptrs,
+                             const sunindextype* colidx, const sunrealtype* Ad,
+                             const sunrealtype* xd, sunrealtype* yd);
+static void blockRowsMatvec2(sunindextype MB, const sunindextype* rowptrs,
+                             const sunindextype* colidx, const sunrealtype* Ad,
+                             const sunrealtype* xd, sunrealtype* yd);
+static void blockRowsMatvec3(sunindextype MB, const sunindextype* rowptrs,
+                             const sunindextype* colidx, const sunrealtype* Ad,
+                             const sunrealtype* xd, sunrealtype* yd);
+static void blockRowsMatvec4(sunindextype MB, const sunindextype* rowptrs,
+                             const sunindextype* colidx, const sunrealtype* Ad,
+                             const sunrealtype* xd, sunrealtype* yd);
+static void blockRowsMatvec5(sunindextype MB, const sunindextype* rowptrs,
+                             const sunindextype* colidx, const sunrealtype* Ad,
+                             const sunrealtype* xd, sunrealtype* yd);
+static void blockRowsMatvecGeneric(sunindextype bs, sunindextype MB,
+                                   const sunindextype* rowptrs,
+                                   const sunindextype* colidx,
+                                   const sunrealtype* Ad, const sunrealtype* xd,
+                                   sunrealtype* yd);
+
+/*
+ * -----------------------------------------------------------------
+ * exported functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new BSR matrix
+ */
+
+SUNMatrix SUNBSRMatrix(sunindextype MB, sunindextype NB,
+                       sunindextype block_size, sunindextype NNZB,
+                       SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  SUNMatrix A;
+  SUNMatrixContent_BSR content;
+  sunindextype ldata;
+
+  /* return with NULL matrix on illegal input */
+  SUNAssertNull(MB > 0 && NB > 0 && block_size > 0 && NNZB >= 0,
+                SUN_ERR_ARG_OUTOFRANGE);
+
+  /* Create an empty matrix object */
+  A = NULL;
+  A = SUNMatNewEmpty(sunctx);
+  SUNCheckLastErrNull();
+
+  /* Attach operations */
+  A->ops->getid                    = SUNMatGetID_BSR;
+  A->ops->clone                    = SUNMatClone_BSR;
+  A->ops->destroy                  = SUNMatDestroy_BSR;
+  A->ops->zero                     = SUNMatZero_BSR;
+  A->ops->copy                     = SUNMatCopy_BSR;
+  A->ops->scaleadd                 = SUNMatScaleAdd_BSR;
+  A->ops->scaleaddi                = SUNMatScaleAddI_BSR;
+  A->ops->matvec                   = SUNMatMatvec_BSR;
+  A->ops->mathermitiantransposevec = SUNMatHermitianTransposeVec_BSR;
+  A->ops->space                    = SUNMatSpace_BSR;
+
+  /* Create content */
+  content = NULL;
+  content = (SUNMatrixContent_BSR)malloc(sizeof *content);
+  SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
+
+  /* Attach content */
+  A->content = content;
+
+  /* Fill content */
+  content->MB         = MB;
+  content->NB         = NB;
+  content->block_size = block_size;
+  content->NNZB       = NNZB;
+  content->M          = MB * block_size;
+  content->N          = NB * block_size;
+  content->data       = NULL;
+  content->colidx     = NULL;
+  content->rowptrs    = NULL;
+
+  /* Allocate content */
+  ldata         = SUNMAX(NNZB * block_size * block_size, 1);
+  content->data = (sunrealtype*)calloc(ldata, sizeof(sunrealtype));
+  SUNAssertNull(content->data, SUN_ERR_MALLOC_FAIL);
+
+  content->colidx = (sunindextype*)calloc(SUNMAX(NNZB, 1),
+                                          sizeof(sunindextype));
+  SUNAssertNull(content->colidx, SUN_ERR_MALLOC_FAIL);
+
+  content->rowptrs = (sunindextype*)calloc(MB + 1, sizeof(sunindextype));
+  SUNAssertNull(content->rowptrs, SUN_ERR_MALLOC_FAIL);
+
+  return (A);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new BSR matrix from an existing CSR or CSC sparse
+ * matrix. Every block that contains at least one stored entry of the sparse
+ * matrix is kept, entries of a kept block that are not stored in the sparse
+ * matrix are set to zero, and repeated entries are summed. The block column
+ * indices of each block row are sorted. Returns NULL if the dimensions of the
+ * sparse matrix are not multiples of the block size or if the request for
+ * matrix storage cannot be satisfied.
+ */
+
+SUNMatrix SUNBSRFromSparseMatrix(SUNMatrix As, sunindextype block_size)
+{
+  SUNFunctionBegin(As->sunctx);
+  sunindextype MB, NB, bs, bs2, ib, jb, i, p, q, nnzb, rstart, rlen;
+  sunindextype *Ap, *Ai, *marker, *position;
+  sunrealtype *Ax, *Bx;
+  SUNMatrix Acsr, B;
+
+  SUNAssertNull(SUNMatGetID(As) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssertNull(block_size > 0, SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssertNull(SM_ROWS_S(As) % block_size == 0 &&
+                  SM_COLUMNS_S(As) % block_size == 0,
+                SUN_ERR_ARG_DIMSMISMATCH);
+
+  bs  = block_size;
+  bs2 = bs * bs;
+  MB  = SM_ROWS_S(As) / bs;
+  NB  = SM_COLUMNS_S(As) / bs;
+
+  /* work with the rows of the sparse matrix */
+  Acsr = As;
+  if (SM_SPARSETYPE_S(As) == CSC_MAT)
+  {
+    SUNCheckCallNull(SUNSparseMatrix_ToCSR(As, &Acsr));
+  }
+  Ap = SM_INDEXPTRS_S(Acsr);
+  Ai = SM_INDEXVALS_S(Acsr);
+  Ax = SM_DATA_S(Acsr);
+
+  /* marker[jb] holds the last block row in which block column jb was seen and
+     position[jb] the index of that block in the BSR arrays */
+  marker   = (sunindextype*)malloc(NB * sizeof(sunindextype));
+  position = (sunindextype*)malloc(NB * sizeof(sunindextype));
+  SUNAssertNull(marker && position, SUN_ERR_MALLOC_FAIL);
+  for (jb = 0; jb < NB; jb++) { marker[jb] = -1; }
+
+  /* count the nonzero blocks */
+  nnzb = 0;
+  for (ib = 0; ib < MB; ib++)
+  {
+    for (p = Ap[ib * bs]; p < Ap[(ib + 1) * bs]; p++)
+    {
+      jb = Ai[p] / bs;
+      if (marker[jb] != ib)
+      {
+        marker[jb] = ib;
+        nnzb++;
+      }
+    }
+  }
+
+  B = SUNBSRMatrix(MB, NB, bs, nnzb, As->sunctx);
+  SUNCheckLastErrNull();
+  Bx = SM_DATA_BSR(B);
+
+  /* fill the block pattern, sorting the block columns of each block row, then
+     scatter the entries of each row into their blocks */
+  for (jb = 0; jb < NB; jb++) { marker[jb] = -1; }
+  nnzb = 0;
+  for (ib = 0; ib < MB; ib++)
+  {
+    rstart                = nnzb;
+    SM_ROWPTRS_BSR(B)[ib] = rstart;
+    for (p = Ap[ib * bs]; p < Ap[(ib + 1) * bs]; p++)
+    {
+      jb = Ai[p] / bs;
+      if (marker[jb] != ib)
+      {
+        marker[jb]               = ib;
+        SM_COLIDX_BSR(B)[nnzb++] = jb;
+      }
+    }
+    rlen = nnzb - rstart;
+    if (rlen > 1)
+    {
+      qsort(SM_COLIDX_BSR(B) + rstart, rlen, sizeof(sunindextype),
+            compareIndex);
+    }
+    for (q = rstart; q < nnzb; q++) { position[SM_COLIDX_BSR(B)[q]] = q; }
+
+    for (i = 0; i < bs; i++)
+    {
+      for (p = Ap[ib * bs + i]; p < Ap[ib * bs + i + 1]; p++)
+      {
+        q = position[Ai[p] / bs];
+        Bx[q * bs2 + (Ai[p] % bs) * bs + i] += Ax[p];
+      }
+    }
+  }
+  SM_ROWPTRS_BSR(B)[MB] = nnzb;
+
+  free(marker);
+  free(position);
+  if (Acsr != As) { SUNMatDestroy(Acsr); }
+
+  return (B);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new CSR or CSC sparse matrix from an existing BSR
+ * matrix by copying all block entries with magnitude larger than droptol into
+ * the sparse matrix structure. Returns NULL if the request for matrix storage
+ * cannot be satisfied.
+ */
+
+SUNMatrix SUNSparseFromBSRMatrix(SUNMatrix A, sunrealtype droptol,
+                                 int sparsetype)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype ib, i, j, p, bs, bs2, nnz;
+  sunindextype *Ap, *Aj;
+  sunrealtype *Ax, *Bx, val;
+  sunindextype *Bp, *Bj;
+  SUNMatrix Bcsr, B;
+
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssertNull(sparsetype == CSC_MAT || sparsetype == CSR_MAT,
+                SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssertNull(droptol >= ZERO, SUN_ERR_ARG_OUTOFRANGE);
+
+  bs  = SM_BLOCKSIZE_BSR(A);
+  bs2 = bs * bs;
+  Ap  = SM_ROWPTRS_BSR(A);
+  Aj  = SM_COLIDX_BSR(A);
+  Ax  = SM_DATA_BSR(A);
+
+  /* determine total number of nonzeros */
+  nnz = 0;
+  for (p = 0; p < Ap[SM_BLOCKROWS_BSR(A)] * bs2; p++)
+  {
+    nnz += (SUNRabs(Ax[p]) > droptol);
+  }
+
+  /* allocate a CSR matrix and copy the nonzeros row by row */
+  Bcsr = SUNSparseMatrix(SM_ROWS_BSR(A), SM_COLUMNS_BSR(A), nnz, CSR_MAT,
+                         A->sunctx);
+  SUNCheckLastErrNull();
+  Bp = SM_INDEXPTRS_S(Bcsr);
+  Bj = SM_INDEXVALS_S(Bcsr);
+  Bx = SM_DATA_S(Bcsr);
+
+  nnz = 0;
+  for (ib = 0; ib < SM_BLOCKROWS_BSR(A); ib++)
+  {
+    for (i = 0; i < bs; i++)
+    {
+      Bp[ib * bs + i] = nnz;
+      for (p = Ap[ib]; p < Ap[ib + 1]; p++)
+      {
+        for (j = 0; j < bs; j++)
+        {
+          val = Ax[p * bs2 + j * bs + i];
+          if (SUNRabs(val) > droptol)
+          {
+            Bj[nnz]   = Aj[p] * bs + j;
+            Bx[nnz++] = val;
+          }
+        }
+      }
+    }
+  }
+  Bp[SM_ROWS_BSR(A)] = nnz;
+
+  if (sparsetype == CSR_MAT) { return (Bcsr); }
+
+  B = NULL;
+  SUNCheckCallNull(SUNSparseMatrix_ToCSC(Bcsr, &B));
+  SUNMatDestroy(Bcsr);
+  return (B);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to reallocate internal storage arrays in a BSR matrix so that the
+ * resulting matrix can hold NNZB nonzero blocks.
+ */
+
+SUNErrCode SUNBSRMatrix_Reallocate(SUNMatrix A, sunindextype NNZB)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype bs2;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(NNZB >= 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  bs2 = SM_BLOCKSIZE_BSR(A) * SM_BLOCKSIZE_BSR(A);
+
+  /* perform reallocation */
+  SM_COLIDX_BSR(A) = (sunindextype*)realloc(SM_COLIDX_BSR(A),
+                                            SUNMAX(NNZB, 1) *
+                                              sizeof(sunindextype));
+  SUNAssert(SM_COLIDX_BSR(A), SUN_ERR_MALLOC_FAIL);
+  SM_DATA_BSR(A) = (sunrealtype*)realloc(SM_DATA_BSR(A), SUNMAX(NNZB * bs2, 1) *
+                                                           sizeof(sunrealtype));
+  SUNAssert(SM_DATA_BSR(A), SUN_ERR_MALLOC_FAIL);
+  SM_NNZB_BSR(A) = NNZB;
+
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to print the BSR matrix
+ */
+
+void SUNBSRMatrix_Print(SUNMatrix A, FILE* outfile)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype ib, i, j, p, bs;
+
+  SUNAssertVoid(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+
+  /* perform operation */
+  bs = SM_BLOCKSIZE_BSR(A);
+  fprintf(outfile, "\n");
+  fprintf(outfile, "%ld by %ld BSR matrix with %ld by %ld blocks, NNZB: %ld \n",
+          (long int)SM_ROWS_BSR(A), (long int)SM_COLUMNS_BSR(A), (long int)bs,
+          (long int)bs, (long int)SM_NNZB_BSR(A));
+  for (ib = 0; ib < SM_BLOCKROWS_BSR(A); ib++)
+  {
+    for (p = SM_ROWPTRS_BSR(A)[ib]; p < SM_ROWPTRS_BSR(A)[ib + 1]; p++)
+    {
+      fprintf(outfile, "block (%ld, %ld) =\n", (long int)ib,
+              (long int)SM_COLIDX_BSR(A)[p]);
+      for (i = 0; i < bs; i++)
+      {
+        for (j = 0; j < bs; j++)
+        {
+          fprintf(outfile, SUN_FORMAT_E "  ", SM_ELEMENT_BSR(A, p, i, j));
+        }
+        fprintf(outfile, "\n");
+      }
+    }
+  }
+  fprintf(outfile, "\n");
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Functions to access the contents of the BSR matrix structure
+ */
+
+sunindextype SUNBSRMatrix_Rows(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  return SM_ROWS_BSR(A);
+}
+
+sunindextype SUNBSRMatrix_Columns(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  return SM_COLUMNS_BSR(A);
+}
+
+sunindextype SUNBSRMatrix_BlockRows(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  return SM_BLOCKROWS_BSR(A);
+}
+
+sunindextype SUNBSRMatrix_BlockColumns(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  return SM_BLOCKCOLUMNS_BSR(A);
+}
+
+sunindextype SUNBSRMatrix_BlockSize(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  return SM_BLOCKSIZE_BSR(A);
+}
+
+sunindextype SUNBSRMatrix_NNZB(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  return SM_NNZB_BSR(A);
+}
+
+sunrealtype* SUNBSRMatrix_Data(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  return SM_DATA_BSR(A);
+}
+
+sunindextype* SUNBSRMatrix_BlockColumnIndices(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  return SM_COLIDX_BSR(A);
+}
+
+sunindextype* SUNBSRMatrix_BlockRowPointers(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  return SM_ROWPTRS_BSR(A);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * implementation of matrix operations
+ * -----------------------------------------------------------------
+ */
+
+SUNMatrix_ID SUNMatGetID_BSR(SUNDIALS_MAYBE_UNUSED SUNMatrix A)
+{
+  return SUNMATRIX_BSR;
+}
+
+SUNMatrix SUNMatClone_BSR(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNMatrix B = SUNBSRMatrix(SM_BLOCKROWS_BSR(A), SM_BLOCKCOLUMNS_BSR(A),
+                             SM_BLOCKSIZE_BSR(A), SM_NNZB_BSR(A), A->sunctx);
+  SUNCheckLastErrNull();
+  return (B);
+}
+
+void SUNMatDestroy_BSR(SUNMatrix A)
+{
+  if (A == NULL) { return; }
+
+  /* free content */
+  if (A->content != NULL)
+  {
+    /* free data array */
+    if (SM_DATA_BSR(A) != NULL)
+    {
+      free(SM_DATA_BSR(A));
+      SM_DATA_BSR(A) = NULL;
+    }
+    /* free block column indices */
+    if (SM_COLIDX_BSR(A) != NULL)
+    {
+      free(SM_COLIDX_BSR(A));
+      SM_COLIDX_BSR(A) = NULL;
+    }
+    /* free block row pointers */
+    if (SM_ROWPTRS_BSR(A) != NULL)
+    {
+      free(SM_ROWPTRS_BSR(A));
+      SM_ROWPTRS_BSR(A) = NULL;
+    }
+    /* free content struct */
+    free(A->content);
+    A->content = NULL;
+  }
+
+  /* free ops and matrix */
+  if (A->ops)
+  {
+    free(A->ops);
+    A->ops = NULL;
+  }
+  free(A);
+  A = NULL;
+
+  return;
+}
+
+SUNErrCode SUNMatZero_BSR(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, ldata;
+  sunrealtype* Ax;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+
+  /* Perform operation A_ij = 0 and clear the block pattern */
+  Ax    = SM_DATA_BSR(A);
+  ldata = SM_NNZB_BSR(A) * SM_BLOCKSIZE_BSR(A) * SM_BLOCKSIZE_BSR(A);
+  for (i = 0; i < ldata; i++) { Ax[i] = ZERO; }
+  for (i = 0; i < SM_NNZB_BSR(A); i++) { SM_COLIDX_BSR(A)[i] = 0; }
+  for (i = 0; i <= SM_BLOCKROWS_BSR(A); i++) { SM_ROWPTRS_BSR(A)[i] = 0; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatCopy_BSR(SUNMatrix A, SUNMatrix B)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, nnzb, ldata;
+  sunrealtype *Ax, *Bx;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(SUNMatGetID(B) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrices(A, B), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* ensure that B is allocated with at least as much memory as we need */
+  nnzb = SM_ROWPTRS_BSR(A)[SM_BLOCKROWS_BSR(A)];
+  if (SM_NNZB_BSR(B) < nnzb) { SUNCheckCall(SUNBSRMatrix_Reallocate(B, nnzb)); }
+
+  /* Perform operation B = A, copying the block pattern as well */
+  for (i = 0; i <= SM_BLOCKROWS_BSR(A); i++)
+  {
+    SM_ROWPTRS_BSR(B)[i] = SM_ROWPTRS_BSR(A)[i];
+  }
+  for (i = 0; i < nnzb; i++) { SM_COLIDX_BSR(B)[i] = SM_COLIDX_BSR(A)[i]; }
+
+  Ax    = SM_DATA_BSR(A);
+  Bx    = SM_DATA_BSR(B);
+  ldata = nnzb * SM_BLOCKSIZE_BSR(A) * SM_BLOCKSIZE_BSR(A);
+  for (i = 0; i < ldata; i++) { Bx[i] = Ax[i]; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatScaleAddI_BSR(sunrealtype c, SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype ib, i, p, q, bs, bs2, MB, nnzb, ldata, missing;
+  sunindextype *Ap, *Aj, *Cp, *Cj;
+  sunrealtype *Ax, *Cx;
+  sunbooleantype found;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(SM_BLOCKROWS_BSR(A) == SM_BLOCKCOLUMNS_BSR(A),
+            SUN_ERR_ARG_DIMSMISMATCH);
+
+  bs   = SM_BLOCKSIZE_BSR(A);
+  bs2  = bs * bs;
+  MB   = SM_BLOCKROWS_BSR(A);
+  Ap   = SM_ROWPTRS_BSR(A);
+  Aj   = SM_COLIDX_BSR(A);
+  Ax   = SM_DATA_BSR(A);
+  nnzb = Ap[MB];
+
+  /* count the block rows without a diagonal block */
+  missing = 0;
+  for (ib = 0; ib < MB; ib++)
+  {
+    found = SUNFALSE;
+    for (p = Ap[ib]; p < Ap[ib + 1]; p++)
+    {
+      if (Aj[p] == ib)
+      {
+        found = SUNTRUE;
+        break;
+      }
+    }
+    if (!found) { missing++; }
+  }
+
+  /* Case 1: every diagonal block is present, A = c*A + I in place */
+  if (missing == 0)
+  {
+    ldata = nnzb * bs2;
+    for (p = 0; p < ldata; p++) { Ax[p] *= c; }
+    for (ib = 0; ib < MB; ib++)
+    {
+      for (p = Ap[ib]; p < Ap[ib + 1]; p++)
+      {
+        if (Aj[p] == ib)
+        {
+          for (i = 0; i < bs; i++) { Ax[p * bs2 + i * bs + i] += ONE; }
+          break;
+        }
+      }
+    }
+    return SUN_SUCCESS;
+  }
+
+  /* Case 2: insert each missing diagonal block ahead of the first block with a
+     larger block column, so sorted block rows stay sorted, or at the end of
+     the block row if there is none */
+  Cp = (sunindextype*)malloc((MB + 1) * sizeof(sunindextype));
+  Cj = (sunindextype*)malloc((nnzb + missing) * sizeof(sunindextype));
+  Cx = (sunrealtype*)malloc((nnzb + missing) * bs2 * sizeof(sunrealtype));
+  SUNAssert(Cp && Cj && Cx, SUN_ERR_MALLOC_FAIL);
+
+  q = 0;
+  for (ib = 0; ib < MB; ib++)
+  {
+    Cp[ib] = q;
+
+    /* the block row may be unsorted, so search all of it for the diagonal */
+    found = SUNFALSE;
+    for (p = Ap[ib]; p < Ap[ib + 1]; p++)
+    {
+      if (Aj[p] == ib)
+      {
+        found = SUNTRUE;
+        break;
+      }
+    }
+
+    for (p = Ap[ib]; p < Ap[ib + 1]; p++)
+    {
+      if (!found && Aj[p] > ib)
+      {
+        Cj[q] = ib;
+        for (i = 0; i < bs2; i++) { Cx[q * bs2 + i] = ZERO; }
+        for (i = 0; i < bs; i++) { Cx[q * bs2 + i * bs + i] = ONE; }
+        q++;
+        found = SUNTRUE;
+      }
+      Cj[q] = Aj[p];
+      for (i = 0; i < bs2; i++) { Cx[q * bs2 + i] = c * Ax[p * bs2 + i]; }
+      if (Aj[p] == ib)
+      {
+        for (i = 0; i < bs; i++) { Cx[q * bs2 + i * bs + i] += ONE; }
+      }
+      q++;
+    }
+    if (!found)
+    {
+      Cj[q] = ib;
+      for (i = 0; i < bs2; i++) { Cx[q * bs2 + i] = ZERO; }
+      for (i = 0; i < bs; i++) { Cx[q * bs2 + i * bs + i] = ONE; }
+      q++;
+    }
+  }
+  Cp[MB] = q;
+
+  replaceStructure(A, q, Cp, Cj, Cx);
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatScaleAdd_BSR(sunrealtype c, SUNMatrix A, SUNMatrix B)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype ib, jb, i, p, q, bs, bs2, MB, NB, nnzb, ldata, rstart;
+  sunindextype *Ap, *Aj, *Bp, *Bj, *Cp, *Cj, *marker, *position;
+  sunrealtype *Ax, *Bx, *Cx;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(SUNMatGetID(B) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrices(A, B), SUN_ERR_ARG_DIMSMISMATCH);
+
+  bs  = SM_BLOCKSIZE_BSR(A);
+  bs2 = bs * bs;
+  MB  = SM_BLOCKROWS_BSR(A);
+  NB  = SM_BLOCKCOLUMNS_BSR(A);
+  Ap  = SM_ROWPTRS_BSR(A);
+  Aj  = SM_COLIDX_BSR(A);
+  Ax  = SM_DATA_BSR(A);
+  Bp  = SM_ROWPTRS_BSR(B);
+  Bj  = SM_COLIDX_BSR(B);
+  Bx  = SM_DATA_BSR(B);
+
+  /* Case 1: same block pattern, A = c*A + B over the block data */
+  if (samePattern(A, B))
+  {
+    ldata = Ap[MB] * bs2;
+    for (p = 0; p < ldata; p++) { Ax[p] = c * Ax[p] + Bx[p]; }
+    return SUN_SUCCESS;
+  }
+
+  /* Case 2: different block patterns, form the union of the two patterns with
+     sorted block columns in each block row */
+  marker   = (sunindextype*)malloc(NB * sizeof(sunindextype));
+  position = (sunindextype*)malloc(NB * sizeof(sunindextype));
+  Cp       = (sunindextype*)malloc((MB + 1) * sizeof(sunindextype));
+  SUNAssert(marker && position && Cp, SUN_ERR_MALLOC_FAIL);
+  for (jb = 0; jb < NB; jb++) { marker[jb] = -1; }
+
+  nnzb = 0;
+  for (ib = 0; ib < MB; ib++)
+  {
+    for (p = Ap[ib]; p < Ap[ib + 1]; p++)
+    {
+      if (marker[Aj[p]] != ib)
+      {
+        marker[Aj[p]] = ib;
+        nnzb++;
+      }
+    }
+    for (p = Bp[ib]; p < Bp[ib + 1]; p++)
+    {
+      if (marker[Bj[p]] != ib)
+      {
+        marker[Bj[p]] = ib;
+        nnzb++;
+      }
+    }
+  }
+
+  Cj = (sunindextype*)malloc(SUNMAX(nnzb, 1) * sizeof(sunindextype));
+  Cx = (sunrealtype*)malloc(SUNMAX(nnzb * bs2, 1) * sizeof(sunrealtype));
+  SUNAssert(Cj && Cx, SUN_ERR_MALLOC_FAIL);
+
+  for (jb = 0; jb < NB; jb++) { marker[jb] = -1; }
+  q = 0;
+  for (ib = 0; ib < MB; ib++)
+  {
+    rstart = q;
+    Cp[ib] = rstart;
+    for (p = Ap[ib]; p < Ap[ib + 1]; p++)
+    {
+      if (marker[Aj[p]] != ib)
+      {
+        marker[Aj[p]] = ib;
+        Cj[q++]       = Aj[p];
+      }
+    }
+    for (p = Bp[ib]; p < Bp[ib + 1]; p++)
+    {
+      if (marker[Bj[p]] != ib)
+      {
+        marker[Bj[p]] = ib;
+        Cj[q++]       = Bj[p];
+      }
+    }
+    if (q - rstart > 1)
+    {
+      qsort(Cj + rstart, q - rstart, sizeof(sunindextype), compareIndex);
+    }
+    for (p = rstart; p < q; p++)
+    {
+      position[Cj[p]] = p;
+      for (i = 0; i < bs2; i++) { Cx[p * bs2 + i] = ZERO; }
+    }
+
+    /* accumulate c*A then B into the merged blocks */
+    for (p = Ap[ib]; p < Ap[ib + 1]; p++)
+    {
+      sunrealtype* Cblk = Cx + position[Aj[p]] * bs2;
+      sunrealtype* Ablk = Ax + p * bs2;
+      for (i = 0; i < bs2; i++) { Cblk[i] += c * Ablk[i]; }
+    }
+    for (p = Bp[ib]; p < Bp[ib + 1]; p++)
+    {
+      sunrealtype* Cblk = Cx + position[Bj[p]] * bs2;
+      sunrealtype* Bblk = Bx + p * bs2;
+      for (i = 0; i < bs2; i++) { Cblk[i] += Bblk[i]; }
+    }
+  }
+  Cp[MB] = q;
+
+  free(marker);
+  free(position);
+
+  replaceStructure(A, q, Cp, Cj, Cx);
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Product of the block rows of a BSR matrix with a vector. Called with a
+ * constant block size bs <= BSR_MAX_KERNEL, the inlined copy has fixed trip
+ * counts so the column updates inside a block are vectorized. Block sizes up
+ * to 5 use the fully unrolled kernels below instead, since compilers do not
+ * unroll the nested block loops at the default optimization level.
+ */
+
+static inline void blockRowsMatvec(sunindextype bs, sunindextype MB,
+                                   const sunindextype* rowptrs,
+                                   const sunindextype* colidx,
+                                   const sunrealtype* Ad, const sunrealtype* xd,
+                                   sunrealtype* yd)
+{
+  const sunindextype bs2 = bs * bs;
+
+  for (sunindextype ib = 0; ib < MB; ib++)
+  {
+    sunrealtype acc[BSR_MAX_KERNEL];
+    for (sunindextype i = 0; i < bs; i++) { acc[i] = ZERO; }
+    for (sunindextype p = rowptrs[ib]; p < rowptrs[ib + 1]; p++)
+    {
+      const sunrealtype* blk = Ad + p * bs2;
+      const sunrealtype* xj  = xd + colidx[p] * bs;
+      for (sunindextype j = 0; j < bs; j++)
+      {
+        for (sunindextype i = 0; i < bs; i++)
+        {
+          acc[i] += blk[j * bs + i] * xj[j];
+        }
+      }
+    }
+    for (sunindextype i = 0; i < bs; i++) { yd[ib * bs + i] = acc[i]; }
+  }
+}
+
+SUNErrCode SUNMatMatvec_BSR(SUNMatrix A, N_Vector x, N_Vector y)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunrealtype *xd, *yd, *Ad;
+  sunindextype *Ap, *Aj, MB;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrixAndVectors(A, x, y), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* access vector data (return if NULL data pointers) */
+  xd = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  yd = N_VGetArrayPointer(y);
+  SUNCheckLastErr();
+
+  SUNAssert(xd, SUN_ERR_MEM_FAIL);
+  SUNAssert(yd, SUN_ERR_MEM_FAIL);
+  SUNAssert(xd != yd, SUN_ERR_MEM_FAIL);
+
+  MB = SM_BLOCKROWS_BSR(A);
+  Ap = SM_ROWPTRS_BSR(A);
+  Aj = SM_COLIDX_BSR(A);
+  Ad = SM_DATA_BSR(A);
+
+  /* Perform operation y_i = sum_j A_ij x_j for each block row i */
+  switch (SM_BLOCKSIZE_BSR(A))
+  {
+  case 1: blockRowsMatvec1(MB, Ap, Aj, Ad, xd, yd); break;
+  case 2: blockRowsMatvec2(MB, Ap, Aj, Ad, xd, yd); break;
+  case 3: blockRowsMatvec3(MB, Ap, Aj, Ad, xd, yd); break;
+  case 4: blockRowsMatvec4(MB, Ap, Aj, Ad, xd, yd); break;
+  case 5: blockRowsMatvec5(MB, Ap, Aj, Ad, xd, yd); break;
+  case 6: blockRowsMatvec(6, MB, Ap, Aj, Ad, xd, yd); break;
+  case 7: blockRowsMatvec(7, MB, Ap, Aj, Ad, xd, yd); break;
+  case 8: blockRowsMatvec(8, MB, Ap, Aj, Ad, xd, yd); break;
+  default:
+    blockRowsMatvecGeneric(SM_BLOCKSIZE_BSR(A), MB, Ap, Aj, Ad, xd, yd);
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatHermitianTransposeVec_BSR(SUNMatrix A, N_Vector x, N_Vector y)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunrealtype *xd, *yd, *Ad;
+  sunindextype *Ap, *Aj, bs, bs2, i, j, ib, p;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrixAndVectors(A, y, x), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* access vector data (return if NULL data pointers) */
+  xd = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  yd = N_VGetArrayPointer(y);
+  SUNCheckLastErr();
+
+  SUNAssert(xd, SUN_ERR_MEM_FAIL);
+  SUNAssert(yd, SUN_ERR_MEM_FAIL);
+  SUNAssert(xd != yd, SUN_ERR_MEM_FAIL);
+
+  bs  = SM_BLOCKSIZE_BSR(A);
+  bs2 = bs * bs;
+  Ap  = SM_ROWPTRS_BSR(A);
+  Aj  = SM_COLIDX_BSR(A);
+  Ad  = SM_DATA_BSR(A);
+
+  /* Perform operation y_j += A_ij^T x_i for each block, with each entry of
+     y_j a dot product of a block column and x_i */
+  for (i = 0; i < SM_COLUMNS_BSR(A); i++) { yd[i] = ZERO; }
+  for (ib = 0; ib < SM_BLOCKROWS_BSR(A); ib++)
+  {
+    sunrealtype* xi = xd + ib * bs;
+    for (p = Ap[ib]; p < Ap[ib + 1]; p++)
+    {
+      sunrealtype* blk = Ad + p * bs2;
+      sunrealtype* yj  = yd + Aj[p] * bs;
+      for (j = 0; j < bs; j++)
+      {
+        for (i = 0; i < bs; i++) { yj[j] += blk[j * bs + i] * xi[i]; }
+      }
+    }
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatSpace_BSR(SUNMatrix A, long int* lenrw, long int* leniw)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BSR, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(lenrw, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(leniw, SUN_ERR_ARG_CORRUPT);
+  *lenrw = SM_NNZB_BSR(A) * SM_BLOCKSIZE_BSR(A) * SM_BLOCKSIZE_BSR(A);
+  *leniw = 7 + SM_BLOCKROWS_BSR(A) + SM_NNZB_BSR(A);
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * private functions
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_MAYBE_UNUSED
+static sunbooleantype compatibleMatrices(SUNMatrix A, SUNMatrix B)
+{
+  /* both matrices must have the same block grid and block size */
+  if ((SM_BLOCKROWS_BSR(A) != SM_BLOCKROWS_BSR(B)) ||
+      (SM_BLOCKCOLUMNS_BSR(A) != SM_BLOCKCOLUMNS_BSR(B)) ||
+      (SM_BLOCKSIZE_BSR(A) != SM_BLOCKSIZE_BSR(B)))
+  {
+    return SUNFALSE;
+  }
+
+  return SUNTRUE;
+}
+
+SUNDIALS_MAYBE_UNUSED
+static sunbooleantype compatibleMatrixAndVectors(SUNMatrix A, N_Vector x,
+                                                 N_Vector y)
+{
+  /* Vectors must provide nvgetarraypointer and cannot be a parallel vector */
+  if (!x->ops->nvgetarraypointer || !y->ops->nvgetarraypointer)
+  {
+    return SUNFALSE;
+  }
+
+  /* Check that the dimensions agree */
+  if ((N_VGetLength(x) != SM_COLUMNS_BSR(A)) ||
+      (N_VGetLength(y) != SM_ROWS_BSR(A)))
+  {
+    return SUNFALSE;
+  }
+
+  return SUNTRUE;
+}
+
+/* -----------------------------------------------------------------
+ * Function to check if two matrices have identical block patterns
+ */
+
+sunbooleantype samePattern(SUNMatrix A, SUNMatrix B)
+{
+  sunindextype i, MB, nnzb;
+
+  MB = SM_BLOCKROWS_BSR(A);
+  for (i = 0; i <= MB; i++)
+  {
+    if (SM_ROWPTRS_BSR(A)[i] != SM_ROWPTRS_BSR(B)[i]) { return SUNFALSE; }
+  }
+
+  nnzb = SM_ROWPTRS_BSR(A)[MB];
+  for (i = 0; i < nnzb; i++)
+  {
+    if (SM_COLIDX_BSR(A)[i] != SM_COLIDX_BSR(B)[i]) { return SUNFALSE; }
+  }
+
+  return SUNTRUE;
+}
+
+/* -----------------------------------------------------------------
+ * Comparison function for sorting block column indices with qsort
+ */
+
+int compareIndex(const void* a, const void* b)
+{
+  sunindextype ia = *(const sunindextype*)a;
+  sunindextype ib = *(const sunindextype*)b;
+  return (ia > ib) - (ia < ib);
+}
+
+/* -----------------------------------------------------------------
+ * Function to replace the block pattern and data of a BSR matrix with
+ * newly allocated arrays holding nnzb blocks. The matrix takes
+ * ownership of colidx and data; rowptrs is copied and freed.
+ */
+
+void replaceStructure(SUNMatrix A, sunindextype nnzb, sunindextype* rowptrs,
+                      sunindextype* colidx, sunrealtype* data)
+{
+  sunindextype i;
+
+  for (i = 0; i <= SM_BLOCKROWS_BSR(A); i++)
+  {
+    SM_ROWPTRS_BSR(A)[i] = rowptrs[i];
+  }
+  free(rowptrs);
+
+  free(SM_COLIDX_BSR(A));
+  free(SM_DATA_BSR(A));
+  SM_COLIDX_BSR(A) = colidx;
+  SM_DATA_BSR(A)   = data;
+  SM_NNZB_BSR(A)   = nnzb;
+}
+
+/* -----------------------------------------------------------------
+ * Fully unrolled products of the block rows of a BSR matrix with a
+ * vector for block sizes 1 to 5. The entries of each block row result
+ * are accumulated in scalars, b points to the current (column-major)
+ * block and xj to the matching block of x.
+ */
+
+void blockRowsMatvec1(sunindextype MB, const sunindextype* rowptrs,
+                      const sunindextype* colidx, const sunrealtype* Ad,
+                      const sunrealtype* xd, sunrealtype* yd)
+{
+  for (sunindextype ib = 0; ib < MB; ib++)
+  {
+    sunrealtype y0 = ZERO;
+    for (sunindextype p = rowptrs[ib]; p < rowptrs[ib + 1]; p++)
+    {
+      y0 += Ad[p] * xd[colidx[p]];
+    }
+    yd[ib] = y0;
+  }
+}
+
+void blockRowsMatvec2(sunindextype MB, const sunindextype* rowptrs,
+                      const sunindextype* colidx, const sunrealtype* Ad,
+                      const sunrealtype* xd, sunrealtype* yd)
+{
+  for (sunindextype ib = 0; ib < MB; ib++)
+  {
+    sunrealtype y0 = ZERO, y1 = ZERO;
+    for (sunindextype p = rowptrs[ib]; p < rowptrs[ib + 1]; p++)
+    {
+      const sunrealtype* b  = Ad + 4 * p;
+      const sunrealtype* xj = xd + 2 * colidx[p];
+      y0 += b[0] * xj[0] + b[2] * xj[1];
+      y1 += b[1] * xj[0] + b[3] * xj[1];
+    }
+    yd[2 * ib]     = y0;
+    yd[2 * ib + 1] = y1;
+  }
+}
+
+void blockRowsMatvec3(sunindextype MB, const sunindextype* rowptrs,
+                      const sunindextype* colidx, const sunrealtype* Ad,
+                      const sunrealtype* xd, sunrealtype* yd)
+{
+  for (sunindextype ib = 0; ib < MB; ib++)
+  {
+    sunrealtype y0 = ZERO, y1 = ZERO, y2 = ZERO;
+    for (sunindextype p = rowptrs[ib]; p < rowptrs[ib + 1]; p++)
+    {
+      const sunrealtype* b  = Ad + 9 * p;
+      const sunrealtype* xj = xd + 3 * colidx[p];
+      y0 += b[0] * xj[0] + b[3] * xj[1] + b[6] * xj[2];
+      y1 += b[1] * xj[0] + b[4] * xj[1] + b[7] * xj[2];
+      y2 += b[2] * xj[0] + b[5] * xj[1] + b[8] * xj[2];
+    }
+    yd[3 * ib]     = y0;
+    yd[3 * ib + 1] = y1;
+    yd[3 * ib + 2] = y2;
+  }
+}
+
+void blockRowsMatvec4(sunindextype MB, const sunindextype* rowptrs,
+                      const sunindextype* colidx, const sunrealtype* Ad,
+                      const sunrealtype* xd, sunrealtype* yd)
+{
+  for (sunindextype ib = 0; ib < MB; ib++)
+  {
+    sunrealtype y0 = ZERO, y1 = ZERO, y2 = ZERO, y3 = ZERO;
+    for (sunindextype p = rowptrs[ib]; p < rowptrs[ib + 1]; p++)
+    {
+      const sunrealtype* b  = Ad + 16 * p;
+      const sunrealtype* xj = xd + 4 * colidx[p];
+      y0 += b[0] * xj[0] + b[4] * xj[1] + b[8] * xj[2] + b[12] * xj[3];
+      y1 += b[1] * xj[0] + b[5] * xj[1] + b[9] * xj[2] + b[13] * xj[3];
+      y2 += b[2] * xj[0] + b[6] * xj[1] + b[10] * xj[2] + b[14] * xj[3];
+      y3 += b[3] * xj[0] + b[7] * xj[1] + b[11] * xj[2] + b[15] * xj[3];
+    }
+    yd[4 * ib]     = y0;
+    yd[4 * ib + 1] = y1;
+    yd[4 * ib + 2] = y2;
+    yd[4 * ib + 3] = y3;
+  }
+}
+
+void blockRowsMatvec5(sunindextype MB, const sunindextype* rowptrs,
+                      const sunindextype* colidx, const sunrealtype* Ad,
+                      const sunrealtype* xd, sunrealtype* yd)
+{
+  for (sunindextype ib = 0; ib < MB; ib++)
+  {
+    sunrealtype y0 = ZERO, y1 = ZERO, y2 = ZERO, y3 = ZERO, y4 = ZERO;
+    for (sunindextype p = rowptrs[ib]; p < rowptrs[ib + 1]; p++)
+    {
+      const sunrealtype* b  = Ad + 25 * p;
+      const sunrealtype* xj = xd + 5 * colidx[p];
+      y0 += b[0] * xj[0] + b[5] * xj[1] + b[10] * xj[2] + b[15] * xj[3] +
+            b[20] * xj[4];
+      y1 += b[1] * xj[0] + b[6] * xj[1] + b[11] * xj[2] + b[16] * xj[3] +
+            b[21] * xj[4];
+      y2 += b[2] * xj[0] + b[7] * xj[1] + b[12] * xj[2] + b[17] * xj[3] +
+            b[22] * xj[4];
+      y3 += b[3] * xj[0] + b[8] * xj[1] + b[13] * xj[2] + b[18] * xj[3] +
+            b[23] * xj[4];
+      y4 += b[4] * xj[0] + b[9] * xj[1] + b[14] * xj[2] + b[19] * xj[3] +
+            b[24] * xj[4];
+    }
+    yd[5 * ib]     = y0;
+    yd[5 * ib + 1] = y1;
+    yd[5 * ib + 2] = y2;
+    yd[5 * ib + 3] = y3;
+    yd[5 * ib + 4] = y4;
+  }
+}
+
+/* -----------------------------------------------------------------
+ * Product of the block rows of a BSR matrix with a vector for block
+ * sizes without a fixed-size kernel
+ */
+
+void blockRowsMatvecGeneric(sunindextype bs, sunindextype MB,
+                            const sunindextype* rowptrs,
+                            const sunindextype* colidx, const sunrealtype* Ad,
+                            const sunrealtype* xd, sunrealtype* yd)
+{
+  const sunindextype bs2 = bs * bs;
+
+  for (sunindextype ib = 0; ib < MB; ib++)
+  {
+    sunrealtype* yi = yd + ib * bs;
+    for (sunindextype i = 0; i < bs; i++) { yi[i] = ZERO; }
+    for (sunindextype p = rowptrs[ib]; p < rowptrs[ib + 1]; p++)
+    {
+      const sunrealtype* blk = Ad + p * bs2;
+      const sunrealtype* xj  = xd + colidx[p] * bs;
+      for (sunindextype j = 0; j < bs; j++)
+      {
+        for (sunindextype i = 0; i < bs; i++)
+        {
+          yi[i] += blk[j * bs + i] * xj[j];
+        }
+      }
+    }
+  }
+}
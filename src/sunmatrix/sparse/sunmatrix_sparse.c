@@ -31,20 +31,132 @@
 #include <sunmatrix/sunmatrix_dense.h>
 #include <sunmatrix/sunmatrix_sparse.h>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 #include "sundials_macros.h"
 
 #define ZERO SUN_RCONST(0.0)
 #define ONE  SUN_RCONST(1.0)
 
+/* Minimum number of entries each OpenMP thread should work on; operations on
+   smaller matrices use fewer threads */
+#define SPARSE_MIN_WORK 1000
+
+/* Number of rows in each chunk of the SELL-C-sigma format used by
+   SUNMatMatvec: the number of values that fit in a SIMD register of the target,
+   but at least four so that each chunk has enough independent sums to hide
+   the latency of the loads */
+#if defined(__AVX512F__)
+#define SPARSE_SIMD_BYTES 64
+#elif defined(__AVX__)
+#define SPARSE_SIMD_BYTES 32
+#else
+#define SPARSE_SIMD_BYTES 16
+#endif
+
+#define SPARSE_SELL_CHUNK \
+  SUNMAX(4, (int)(SPARSE_SIMD_BYTES / sizeof(sunrealtype)))
+
+/* Default SELL-C-sigma sorting window, in chunks */
+#define SPARSE_SELL_SIGMA 32
+
+/* Cached merge of the sparsity pattern of A with that of B (SUNMatScaleAdd) or
+   with the diagonal (SUNMatScaleAddI). The merged pattern and the positions of
+   the entries of A and B in it depend only on the input patterns, so they are
+   recorded on the first call and reused while the input patterns match. */
+struct _SUNSparseMergeMap
+{
+  sunbooleantype valid; /* the map may be used                             */
+  sunbooleantype same;  /* the merged pattern is the input pattern of A     */
+  sunindextype nnz_a;   /* number of entries in the input pattern of A      */
+  sunindextype nnz_b;   /* number of entries of B (or of the diagonal)      */
+  sunindextype nnz_c;   /* number of entries in the merged pattern          */
+  sunindextype* a_ptrs; /* input pattern of A                               */
+  sunindextype* a_vals;
+  sunindextype* b_ptrs; /* pattern of B (NULL for the diagonal)             */
+  sunindextype* b_vals;
+  sunindextype* c_ptrs; /* merged pattern (NULL when same)                  */
+  sunindextype* c_vals;
+  sunindextype* a_map;  /* entry of A stored at each merged entry, or -1    */
+  sunindextype* b_map;  /* merged entry holding each entry of B (diagonal)  */
+};
+
+typedef struct _SUNSparseMergeMap* SUNSparseMergeMap;
+
+/* SELL-C-sigma copy of the matrix. The rows are sorted by decreasing length
+   within windows of sigma rows and grouped into chunks of SPARSE_SELL_CHUNK
+   rows. Each chunk is padded to its longest row and stored column by column,
+   so the products for the rows of a chunk are formed together. */
+struct _SUNSparseSELL
+{
+  sunbooleantype valid;    /* the copy matches the entries of the matrix */
+  sunindextype sigma;      /* sorting window (a multiple of the chunk size) */
+  sunindextype nchunks;    /* number of chunks                             */
+  sunindextype* chunkptrs; /* start of each chunk in colidx and data       */
+  sunindextype* perm;      /* row stored in each chunk slot, or -1         */
+  sunindextype* colidx;    /* column index of each padded entry            */
+  sunrealtype* data;       /* value of each padded entry                   */
+};
+
+typedef struct _SUNSparseSELL* SUNSparseSELL;
+
+/* Compressed pattern of a list of (row, column) triplets. Repeated pairs share
+   one entry, and the triplets summed into entry p of the pattern are
+   trip[tptrs[p]] to trip[tptrs[p+1]-1], in the order they were given. Each
+   entry gathers its own values, so the entries can be filled in parallel
+   without two threads updating the same value. */
+struct _SUNSparseTripletMap
+{
+  sunindextype ntrip;  /* number of triplets                              */
+  sunindextype nnz;    /* number of entries in the compressed pattern     */
+  sunindextype* ptrs;  /* index pointers of the compressed pattern        */
+  sunindextype* vals;  /* index values of the compressed pattern          */
+  sunindextype* tptrs; /* start of the triplets of each entry in trip     */
+  sunindextype* trip;  /* triplets grouped by the entry they are summed in */
+};
+
+typedef struct _SUNSparseTripletMap* SUNSparseTripletMap;
+
 /* Private function prototypes */
 static sunbooleantype compatibleMatrices(SUNMatrix A, SUNMatrix B);
 static sunbooleantype compatibleMatrixAndVectors(SUNMatrix A, N_Vector x,
                                                  N_Vector y);
 static SUNErrCode Matvec_SparseCSC(SUNMatrix A, N_Vector x, N_Vector y);
 static SUNErrCode Matvec_SparseCSR(SUNMatrix A, N_Vector x, N_Vector y);
+static SUNErrCode Matvec_SparseSELL(SUNMatrix A, N_Vector x, N_Vector y);
 static SUNErrCode MatTransposeVec_SparseCSC(SUNMatrix A, N_Vector x, N_Vector y);
 static SUNErrCode MatTransposeVec_SparseCSR(SUNMatrix A, N_Vector x, N_Vector y);
 static SUNErrCode format_convert(const SUNMatrix A, SUNMatrix B);
+static int opThreads(int nthreads, sunindextype nwork);
+static int threadId(void);
+static SUNErrCode scaleAddIMerge(sunrealtype c, SUNMatrix A);
+static SUNErrCode scaleAddMerge(sunrealtype c, SUNMatrix A, SUNMatrix B);
+static void mergeMapFree(SUNSparseMergeMap* map);
+static long int mergeMapSpace(SUNSparseMergeMap map, sunindextype np);
+static sunbooleantype mergeMapMatches(SUNSparseMergeMap map, SUNMatrix A,
+                                      SUNMatrix B);
+static SUNErrCode mergeMapSaveInput(SUNMatrix A, SUNMatrix B,
+                                    SUNSparseMergeMap* map);
+static SUNErrCode mergeMapBuild(SUNMatrix A, SUNMatrix B,
+                                SUNSparseMergeMap map);
+static SUNErrCode scaleAddMapped(sunrealtype c, SUNMatrix A, SUNMatrix B,
+                                 SUNSparseMergeMap map);
+static void sellFree(SUNSparseSELL* sell);
+static void sellInvalidate(SUNMatrix A);
+static SUNErrCode sellBuild(SUNMatrix A);
+static int compareRowLength(const void* a, const void* b);
+static SUNErrCode transposePattern(SUNMatrix A, sunindextype** tptrs,
+                                   sunindextype** tvals);
+static void tripletMapFree(SUNSparseTripletMap* map);
+#if defined(_OPENMP)
+static SUNErrCode scatterProductThreads(SUNMatrix A, const sunrealtype* xd,
+                                        sunrealtype* yd, sunindextype nout,
+                                        int nthreads);
+static SUNErrCode formatConvertThreads(const SUNMatrix A, SUNMatrix B,
+                                       int nthreads);
+#endif
 
 /*
  * -----------------------------------------------------------------
@@ -88,6 +200,7 @@ SUNMatrix SUNSparseMatrix(sunindextype M, sunindextype N, sunindextype NNZ,
   A->ops->copy                     = SUNMatCopy_Sparse;
   A->ops->scaleadd                 = SUNMatScaleAdd_Sparse;
   A->ops->scaleaddi                = SUNMatScaleAddI_Sparse;
+  A->ops->matvecsetup              = SUNMatMatvecSetup_Sparse;
   A->ops->matvec                   = SUNMatMatvec_Sparse;
   A->ops->mathermitiantransposevec = SUNMatHermitianTransposeVec_Sparse;
   A->ops->space                    = SUNMatSpace_Sparse;
@@ -126,6 +239,12 @@ SUNMatrix SUNSparseMatrix(sunindextype M, sunindextype N, sunindextype NNZ,
   content->data      = NULL;
   content->indexvals = NULL;
   content->indexptrs = NULL;
+  content->nthreads  = 1;
+
+  content->scaleadd_map  = NULL;
+  content->scaleaddi_map = NULL;
+  content->sell          = NULL;
+  content->triplet_map   = NULL;
 
   /* Allocate content */
   content->data = (sunrealtype*)calloc(NNZ, sizeof(sunrealtype));
@@ -308,6 +427,7 @@ SUNErrCode SUNSparseMatrix_ToCSR(const SUNMatrix A, SUNMatrix* Bout)
   *Bout = SUNSparseMatrix(SM_ROWS_S(A), SM_COLUMNS_S(A), SM_NNZ_S(A), CSR_MAT,
                           A->sunctx);
   SUNCheckLastErr();
+  SUNCheckCall(SUNSparseMatrix_SetNumThreads(*Bout, SM_NTHREADS_S(A)));
   SUNCheckCall(format_convert(A, *Bout));
   return SUN_SUCCESS;
 }
@@ -324,6 +444,7 @@ SUNErrCode SUNSparseMatrix_ToCSC(const SUNMatrix A, SUNMatrix* Bout)
   *Bout = SUNSparseMatrix(SM_ROWS_S(A), SM_COLUMNS_S(A), SM_NNZ_S(A), CSC_MAT,
                           A->sunctx);
   SUNCheckLastErr();
+  SUNCheckCall(SUNSparseMatrix_SetNumThreads(*Bout, SM_NTHREADS_S(A)));
 
   SUNCheckCall(format_convert(A, *Bout));
   return SUN_SUCCESS;
@@ -355,6 +476,7 @@ SUNErrCode SUNSparseMatrix_Realloc(SUNMatrix A)
   SUNAssert(SM_DATA_S(A), SUN_ERR_MALLOC_FAIL);
 
   SM_NNZ_S(A) = nzmax;
+  sellInvalidate(A);
 
   return SUN_SUCCESS;
 }
@@ -381,6 +503,336 @@ SUNErrCode SUNSparseMatrix_Reallocate(SUNMatrix A, sunindextype NNZ)
   SUNAssert(SM_DATA_S(A), SUN_ERR_MALLOC_FAIL);
 
   SM_NNZ_S(A) = NNZ;
+  sellInvalidate(A);
+
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to set the number of OpenMP threads used by the matrix operations
+ */
+
+SUNErrCode SUNSparseMatrix_SetNumThreads(SUNMatrix A, int nthreads)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+
+  /* Illegal nthreads implies use of default value */
+  if (nthreads < 1) { nthreads = 1; }
+
+  SM_NTHREADS_S(A) = nthreads;
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to enable or disable the SELL-C-sigma copy of the matrix used by
+ * SUNMatMatvec
+ */
+
+SUNErrCode SUNSparseMatrix_SetMatvecSELL(SUNMatrix A, sunbooleantype onoff,
+                                         sunindextype sigma)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+
+  if (!onoff)
+  {
+    sellFree(&(SM_CONTENT_S(A)->sell));
+    return SUN_SUCCESS;
+  }
+
+  /* Illegal sigma implies use of default value, otherwise round up to a
+     multiple of the chunk size */
+  if (sigma < 1) { sigma = SPARSE_SELL_SIGMA * SPARSE_SELL_CHUNK; }
+  sigma = ((sigma + SPARSE_SELL_CHUNK - 1) / SPARSE_SELL_CHUNK) *
+          SPARSE_SELL_CHUNK;
+
+  if (SM_CONTENT_S(A)->sell == NULL)
+  {
+    SUNSparseSELL sell = (SUNSparseSELL)calloc(1, sizeof *sell);
+    SUNAssert(sell, SUN_ERR_MALLOC_FAIL);
+    SM_CONTENT_S(A)->sell = sell;
+  }
+
+  SM_CONTENT_S(A)->sell->sigma = sigma;
+  SM_CONTENT_S(A)->sell->valid = SUNFALSE;
+
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to color the columns of the sparse matrix so that no two columns of
+ * the same color have an entry in the same row. Columns are colored greedily
+ * in order with the smallest color not used by a column sharing a row with
+ * them (a distance-2 coloring of the column-row graph).
+ */
+
+SUNErrCode SUNSparseMatrix_ColumnColoring(SUNMatrix A, sunindextype* colors,
+                                          sunindextype* ncolors)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, j, k, p, q, color;
+  sunindextype *tptrs, *tvals, *forbidden;
+  const sunindextype *cptrs, *cvals, *rptrs, *rvals;
+  const sunindextype N = SM_COLUMNS_S(A);
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(colors, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(ncolors, SUN_ERR_ARG_CORRUPT);
+
+  /* access the rows of each column and the columns of each row */
+  SUNCheckCall(transposePattern(A, &tptrs, &tvals));
+  if (SM_SPARSETYPE_S(A) == CSC_MAT)
+  {
+    cptrs = SM_INDEXPTRS_S(A);
+    cvals = SM_INDEXVALS_S(A);
+    rptrs = tptrs;
+    rvals = tvals;
+  }
+  else
+  {
+    cptrs = tptrs;
+    cvals = tvals;
+    rptrs = SM_INDEXPTRS_S(A);
+    rvals = SM_INDEXVALS_S(A);
+  }
+
+  /* forbidden[c] == j marks color c as used by a neighbor of column j */
+  forbidden = (sunindextype*)malloc(N * sizeof(sunindextype));
+  SUNAssert(forbidden, SUN_ERR_MALLOC_FAIL);
+
+  for (j = 0; j < N; j++)
+  {
+    colors[j]    = -1;
+    forbidden[j] = -1;
+  }
+
+  *ncolors = 0;
+  for (j = 0; j < N; j++)
+  {
+    for (p = cptrs[j]; p < cptrs[j + 1]; p++)
+    {
+      i = cvals[p];
+      for (q = rptrs[i]; q < rptrs[i + 1]; q++)
+      {
+        k = rvals[q];
+        if (colors[k] >= 0) { forbidden[colors[k]] = j; }
+      }
+    }
+
+    color = 0;
+    while (forbidden[color] == j) { color++; }
+    colors[j] = color;
+    *ncolors  = SUNMAX(*ncolors, color + 1);
+  }
+
+  free(forbidden);
+  free(tptrs);
+  free(tvals);
+
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to set the sparsity pattern of the matrix from a list of (row,
+ * column) triplets. The triplets are sorted into the compressed pattern with
+ * two stable counting sorts, by the minor and then by the major index, and
+ * repeated pairs are merged into one entry. The grouping of the triplets by
+ * entry is kept so that SUNSparseMatrix_AssembleTriplets fills the matrix in a
+ * single pass. The entries of the matrix are set to zero. The new map is only
+ * attached to the matrix once it is complete, so after a failure the matrix
+ * has no map.
+ */
+
+SUNErrCode SUNSparseMatrix_SetTripletPattern(SUNMatrix A, sunindextype ntrip,
+                                             const sunindextype* rows,
+                                             const sunindextype* cols)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype k, p, q, last, nnz;
+  sunindextype *ptrs, *vals, *tptrs, *trip, *count, *order, *tmp;
+  const sunindextype *major, *minor;
+  SUNSparseTripletMap map;
+  SUNErrCode err;
+  const sunindextype np     = SM_NP_S(A);
+  const sunindextype nminor = (SM_SPARSETYPE_S(A) == CSC_MAT) ? SM_ROWS_S(A)
+                                                              : SM_COLUMNS_S(A);
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(ntrip >= 0, SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssert(ntrip == 0 || (rows && cols), SUN_ERR_ARG_CORRUPT);
+
+  /* the major index is the column of a CSC matrix and the row of a CSR one */
+  if (SM_SPARSETYPE_S(A) == CSC_MAT)
+  {
+    major = cols;
+    minor = rows;
+  }
+  else
+  {
+    major = rows;
+    minor = cols;
+  }
+
+  for (k = 0; k < ntrip; k++)
+  {
+    SUNAssert(major[k] >= 0 && major[k] < np && minor[k] >= 0 &&
+                minor[k] < nminor,
+              SUN_ERR_ARG_OUTOFRANGE);
+  }
+
+  /* discard any previous map */
+  tripletMapFree(&(SM_CONTENT_S(A)->triplet_map));
+
+  /* the new map is built in local arrays */
+  map   = (SUNSparseTripletMap)calloc(1, sizeof *map);
+  ptrs  = (sunindextype*)malloc((np + 1) * sizeof(sunindextype));
+  vals  = (sunindextype*)malloc(SUNMAX(ntrip, 1) * sizeof(sunindextype));
+  tptrs = (sunindextype*)malloc((ntrip + 1) * sizeof(sunindextype));
+  trip  = (sunindextype*)malloc(SUNMAX(ntrip, 1) * sizeof(sunindextype));
+  count = (sunindextype*)calloc(SUNMAX(np, nminor) + 1, sizeof(sunindextype));
+  order = (sunindextype*)malloc(SUNMAX(ntrip, 1) * sizeof(sunindextype));
+
+  if (!map || !ptrs || !vals || !tptrs || !trip || !count || !order)
+  {
+    free(map);
+    free(ptrs);
+    free(vals);
+    free(tptrs);
+    free(trip);
+    free(count);
+    free(order);
+    SUNHandleErrWithMsg(__LINE__, __func__, __FILE__, NULL,
+                        SUN_ERR_MALLOC_FAIL, SUNCTX_);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  /* order the triplets by minor index */
+  for (k = 0; k < ntrip; k++) { count[minor[k] + 1]++; }
+  for (q = 0; q < nminor; q++) { count[q + 1] += count[q]; }
+  for (k = 0; k < ntrip; k++) { order[count[minor[k]]++] = k; }
+
+  /* stable order by major index, so the triplets of each major index are
+     sorted by minor index and repeated pairs keep the order given */
+  for (q = 0; q <= np; q++) { count[q] = 0; }
+  for (k = 0; k < ntrip; k++) { count[major[k] + 1]++; }
+  for (q = 0; q < np; q++) { count[q + 1] += count[q]; }
+  for (q = 0; q < ntrip; q++)
+  {
+    k                       = order[q];
+    trip[count[major[k]]++] = k;
+  }
+
+  /* merge repeated pairs, count[p] is now the end of major index p */
+  nnz = 0;
+  q   = 0;
+  for (p = 0; p < np; p++)
+  {
+    ptrs[p] = nnz;
+    last    = -1;
+    for (; q < count[p]; q++)
+    {
+      k = trip[q];
+      if (minor[k] == last) { continue; }
+      tptrs[nnz] = q;
+      vals[nnz]  = minor[k];
+      last       = minor[k];
+      nnz++;
+    }
+  }
+  ptrs[np]   = nnz;
+  tptrs[nnz] = ntrip;
+
+  free(count);
+  free(order);
+
+  /* release the storage of the merged pairs, the arrays are kept if the
+     smaller blocks cannot be allocated */
+  tmp = (sunindextype*)realloc(vals, SUNMAX(nnz, 1) * sizeof(sunindextype));
+  if (tmp) { vals = tmp; }
+  tmp = (sunindextype*)realloc(tptrs, (nnz + 1) * sizeof(sunindextype));
+  if (tmp) { tptrs = tmp; }
+
+  map->ntrip = ntrip;
+  map->nnz   = nnz;
+  map->ptrs  = ptrs;
+  map->vals  = vals;
+  map->tptrs = tptrs;
+  map->trip  = trip;
+
+  /* set the pattern of the matrix */
+  if (SM_NNZ_S(A) < nnz)
+  {
+    err = SUNSparseMatrix_Reallocate(A, nnz);
+    if (err != SUN_SUCCESS)
+    {
+      tripletMapFree(&map);
+      return err;
+    }
+  }
+  for (p = 0; p <= np; p++) { SM_INDEXPTRS_S(A)[p] = ptrs[p]; }
+  for (k = 0; k < nnz; k++)
+  {
+    SM_INDEXVALS_S(A)[k] = vals[k];
+    SM_DATA_S(A)[k]      = ZERO;
+  }
+  sellInvalidate(A);
+
+  /* attach the complete map */
+  SM_CONTENT_S(A)->triplet_map = map;
+
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to fill the matrix from the values of the triplets given to
+ * SUNSparseMatrix_SetTripletPattern, summing the values of repeated pairs. The
+ * pattern is restored as well, e.g., after SUNMatZero.
+ */
+
+SUNErrCode SUNSparseMatrix_AssembleTriplets(SUNMatrix A,
+                                            const sunrealtype* vals)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype k, q;
+  sunindextype *Ap, *Ai;
+  sunrealtype* Ax;
+  SUNSparseTripletMap map;
+  SUNDIALS_MAYBE_UNUSED int nthreads;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+  map = SM_CONTENT_S(A)->triplet_map;
+  SUNAssert(map, SUN_ERR_ARG_INCOMPATIBLE);
+  SUNAssert(map->ntrip == 0 || vals, SUN_ERR_ARG_CORRUPT);
+
+  if (SM_NNZ_S(A) < map->nnz)
+  {
+    SUNCheckCall(SUNSparseMatrix_Reallocate(A, map->nnz));
+  }
+
+  Ap = SM_INDEXPTRS_S(A);
+  Ai = SM_INDEXVALS_S(A);
+  Ax = SM_DATA_S(A);
+
+  for (k = 0; k <= SM_NP_S(A); k++) { Ap[k] = map->ptrs[k]; }
+
+  nthreads = opThreads(SM_NTHREADS_S(A), map->ntrip);
+
+#if defined(_OPENMP)
+#pragma omp parallel for private(q) schedule(static) num_threads(nthreads) \
+  if (nthreads > 1)
+#endif
+  for (k = 0; k < map->nnz; k++)
+  {
+    sunrealtype sum = ZERO;
+    for (q = map->tptrs[k]; q < map->tptrs[k + 1]; q++)
+    {
+      sum += vals[map->trip[q]];
+    }
+    Ax[k] = sum;
+    Ai[k] = map->vals[k];
+  }
+  sellInvalidate(A);
 
   return SUN_SUCCESS;
 }
@@ -505,6 +957,12 @@ SUNMatrix SUNMatClone_Sparse(SUNMatrix A)
   SUNMatrix B = SUNSparseMatrix(SM_ROWS_S(A), SM_COLUMNS_S(A), SM_NNZ_S(A),
                                 SM_SPARSETYPE_S(A), A->sunctx);
   SUNCheckLastErrNull();
+  SM_NTHREADS_S(B) = SM_NTHREADS_S(A);
+  if (SM_CONTENT_S(A)->sell)
+  {
+    const sunindextype sigma = SM_CONTENT_S(A)->sell->sigma;
+    SUNCheckCallNull(SUNSparseMatrix_SetMatvecSELL(B, SUNTRUE, sigma));
+  }
   return (B);
 }
 
@@ -537,6 +995,13 @@ void SUNMatDestroy_Sparse(SUNMatrix A)
       SM_CONTENT_S(A)->colptrs = NULL;
       SM_CONTENT_S(A)->rowptrs = NULL;
     }
+    /* free cached pattern merges */
+    mergeMapFree(&(SM_CONTENT_S(A)->scaleadd_map));
+    mergeMapFree(&(SM_CONTENT_S(A)->scaleaddi_map));
+    /* free SELL-C-sigma copy */
+    sellFree(&(SM_CONTENT_S(A)->sell));
+    /* free triplet map */
+    tripletMapFree(&(SM_CONTENT_S(A)->triplet_map));
     /* free content struct */
     free(A->content);
     A->content = NULL;
@@ -557,8 +1022,14 @@ void SUNMatDestroy_Sparse(SUNMatrix A)
 SUNErrCode SUNMatZero_Sparse(SUNMatrix A)
 {
   sunindextype i;
+  SUNDIALS_MAYBE_UNUSED const int nthreads = opThreads(SM_NTHREADS_S(A),
+                                                       SM_NNZ_S(A));
 
   /* Perform operation */
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) num_threads(nthreads) \
+  if (nthreads > 1)
+#endif
   for (i = 0; i < SM_NNZ_S(A); i++)
   {
     (SM_DATA_S(A))[i]      = ZERO;
@@ -566,12 +1037,14 @@ SUNErrCode SUNMatZero_Sparse(SUNMatrix A)
   }
   for (i = 0; i < SM_NP_S(A); i++) { (SM_INDEXPTRS_S(A))[i] = 0; }
   (SM_INDEXPTRS_S(A))[SM_NP_S(A)] = 0;
+  sellInvalidate(A);
   return SUN_SUCCESS;
 }
 
 SUNErrCode SUNMatCopy_Sparse(SUNMatrix A, SUNMatrix B)
 {
   sunindextype i, A_nz;
+  SUNDIALS_MAYBE_UNUSED int nthreads;
   SUNFunctionBegin(A->sunctx);
 
   SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
@@ -596,27 +1069,156 @@ SUNErrCode SUNMatCopy_Sparse(SUNMatrix A, SUNMatrix B)
     SM_NNZ_S(B) = A_nz;
   }
 
-  /* zero out B so that copy works correctly */
-  SUNCheckCall(SUNMatZero_Sparse(B));
-
   /* copy the data and row indices over */
+  nthreads = opThreads(SM_NTHREADS_S(A), A_nz);
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) num_threads(nthreads) \
+  if (nthreads > 1)
+#endif
   for (i = 0; i < A_nz; i++)
   {
     (SM_DATA_S(B))[i]      = (SM_DATA_S(A))[i];
     (SM_INDEXVALS_S(B))[i] = (SM_INDEXVALS_S(A))[i];
   }
 
+  /* zero out any remaining storage in B */
+  for (i = A_nz; i < SM_NNZ_S(B); i++)
+  {
+    (SM_DATA_S(B))[i]      = ZERO;
+    (SM_INDEXVALS_S(B))[i] = 0;
+  }
+
   /* copy the column pointers over */
   for (i = 0; i < SM_NP_S(A); i++)
   {
     (SM_INDEXPTRS_S(B))[i] = (SM_INDEXPTRS_S(A))[i];
   }
   (SM_INDEXPTRS_S(B))[SM_NP_S(A)] = A_nz;
+  sellInvalidate(B);
 
   return SUN_SUCCESS;
 }
 
 SUNErrCode SUNMatScaleAddI_Sparse(sunrealtype c, SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+
+  sellInvalidate(A);
+
+  /* if the pattern of A matches an earlier call, only update the values */
+  if (mergeMapMatches(SM_CONTENT_S(A)->scaleaddi_map, A, NULL))
+  {
+    SUNCheckCall(scaleAddMapped(c, A, NULL, SM_CONTENT_S(A)->scaleaddi_map));
+    return SUN_SUCCESS;
+  }
+
+  /* otherwise merge the patterns and record the merge for later calls */
+  SUNCheckCall(mergeMapSaveInput(A, NULL, &(SM_CONTENT_S(A)->scaleaddi_map)));
+  SUNCheckCall(scaleAddIMerge(c, A));
+  SUNCheckCall(mergeMapBuild(A, NULL, SM_CONTENT_S(A)->scaleaddi_map));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatScaleAdd_Sparse(sunrealtype c, SUNMatrix A, SUNMatrix B)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(SUNMatGetID(B) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrices(A, B), SUN_ERR_ARG_DIMSMISMATCH);
+
+  sellInvalidate(A);
+
+  /* if the patterns of A and B match an earlier call, only update the
+     values */
+  if (mergeMapMatches(SM_CONTENT_S(A)->scaleadd_map, A, B))
+  {
+    SUNCheckCall(scaleAddMapped(c, A, B, SM_CONTENT_S(A)->scaleadd_map));
+    return SUN_SUCCESS;
+  }
+
+  /* otherwise merge the patterns and record the merge for later calls */
+  SUNCheckCall(mergeMapSaveInput(A, B, &(SM_CONTENT_S(A)->scaleadd_map)));
+  SUNCheckCall(scaleAddMerge(c, A, B));
+  SUNCheckCall(mergeMapBuild(A, B, SM_CONTENT_S(A)->scaleadd_map));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatMatvecSetup_Sparse(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+
+  /* refresh the SELL-C-sigma copy (if enabled) from the current entries */
+  if (SM_CONTENT_S(A)->sell) { SUNCheckCall(sellBuild(A)); }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatMatvec_Sparse(SUNMatrix A, N_Vector x, N_Vector y)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrixAndVectors(A, x, y), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* Perform operation, building the SELL-C-sigma copy if it is enabled and
+     the matrix was changed by another operation since it was built */
+  if (SM_CONTENT_S(A)->sell)
+  {
+    if (!SM_CONTENT_S(A)->sell->valid) { SUNCheckCall(sellBuild(A)); }
+    SUNCheckCall(Matvec_SparseSELL(A, x, y));
+  }
+  else if (SM_SPARSETYPE_S(A) == CSC_MAT)
+  {
+    SUNCheckCall(Matvec_SparseCSC(A, x, y));
+  }
+  else { SUNCheckCall(Matvec_SparseCSR(A, x, y)); }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatHermitianTransposeVec_Sparse(SUNMatrix A, N_Vector x, N_Vector y)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrixAndVectors(A, y, x), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* Perform operation */
+  if (SM_SPARSETYPE_S(A) == CSC_MAT)
+  {
+    SUNCheckCall(MatTransposeVec_SparseCSC(A, x, y));
+  }
+  else { SUNCheckCall(MatTransposeVec_SparseCSR(A, x, y)); }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatSpace_Sparse(SUNMatrix A, long int* lenrw, long int* leniw)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(lenrw, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(leniw, SUN_ERR_ARG_CORRUPT);
+  *lenrw = SM_NNZ_S(A);
+  *leniw = 10 + SM_NP_S(A) + SM_NNZ_S(A) +
+           mergeMapSpace(SM_CONTENT_S(A)->scaleadd_map, SM_NP_S(A)) +
+           mergeMapSpace(SM_CONTENT_S(A)->scaleaddi_map, SM_NP_S(A));
+  return SUN_SUCCESS;
+}
+
+/*
+ * =================================================================
+ * private functions
+ * =================================================================
+ */
+
+/* -----------------------------------------------------------------
+ * Computes A = c*A + I by merging the diagonal into the pattern of A
+ */
+
+SUNErrCode scaleAddIMerge(sunrealtype c, SUNMatrix A)
 {
   SUNFunctionBegin(A->sunctx);
   const sunindextype N = SM_SPARSETYPE_S(A) == CSC_MAT ? SM_COLUMNS_S(A)
@@ -631,7 +1233,14 @@ SUNErrCode SUNMatScaleAddI_Sparse(sunrealtype c, SUNMatrix A)
   sunrealtype* Ax = SM_DATA_S(A);
   SUNAssert(Ax, SUN_ERR_ARG_CORRUPT);
 
+  SUNDIALS_MAYBE_UNUSED const int nthreads = opThreads(SM_NTHREADS_S(A),
+                                                       Ap[N]);
+
   sunindextype newvals = 0;
+#if defined(_OPENMP)
+#pragma omp parallel for reduction(+ : newvals) schedule(static) \
+  num_threads(nthreads) if (nthreads > 1)
+#endif
   for (sunindextype j = 0; j < N; j++)
   {
     /* scan column (row if CSR) of A, searching for diagonal value */
@@ -687,10 +1296,15 @@ SUNErrCode SUNMatScaleAddI_Sparse(sunrealtype c, SUNMatrix A)
   return SUN_SUCCESS;
 }
 
-SUNErrCode SUNMatScaleAdd_Sparse(sunrealtype c, SUNMatrix A, SUNMatrix B)
+/* -----------------------------------------------------------------
+ * Computes A = c*A + B by merging the pattern of B into that of A
+ */
+
+SUNErrCode scaleAddMerge(sunrealtype c, SUNMatrix A, SUNMatrix B)
 {
   sunindextype j, i, p, nz, newvals, M, N, cend;
   sunbooleantype newmat;
+  int nthreads;
   sunindextype *w, *Ap, *Ai, *Bp, *Bi, *Cp, *Ci;
   sunrealtype *x, *Ax, *Bx, *Cx;
   SUNMatrix C;
@@ -728,30 +1342,41 @@ SUNErrCode SUNMatScaleAdd_Sparse(sunrealtype c, SUNMatrix A, SUNMatrix B)
   Bx = SM_DATA_S(B);
   SUNAssert(Bx, SUN_ERR_ARG_CORRUPT);
 
+  /* the columns (rows) are independent except when merging into existing
+     storage, so each thread gets its own work arrays; the work is proportional
+     to the number of nonzeros, and M * N could overflow for large matrices */
+  nthreads = opThreads(SM_NTHREADS_S(A), SM_NNZ_S(A) + SM_NNZ_S(B));
+
   /* create work arrays for row indices and nonzero column values */
-  w = (sunindextype*)malloc(M * sizeof(sunindextype));
+  w = (sunindextype*)malloc(nthreads * M * sizeof(sunindextype));
   SUNAssert(w, SUN_ERR_MALLOC_FAIL);
-  x = (sunrealtype*)malloc(M * sizeof(sunrealtype));
+  x = (sunrealtype*)malloc(nthreads * M * sizeof(sunrealtype));
   SUNAssert(x, SUN_ERR_MALLOC_FAIL);
 
   /* determine if A already contains the sparsity pattern of B */
   newvals = 0;
+#if defined(_OPENMP)
+#pragma omp parallel for private(i) reduction(+ : newvals) schedule(static) \
+  num_threads(nthreads) if (nthreads > 1)
+#endif
   for (j = 0; j < N; j++)
   {
+    sunindextype* wt = w + threadId() * M;
+
     /* clear work array */
-    for (i = 0; i < M; i++) { w[i] = 0; }
+    for (i = 0; i < M; i++) { wt[i] = 0; }
 
     /* scan column of A, incrementing w by one */
-    for (i = Ap[j]; i < Ap[j + 1]; i++) { w[Ai[i]] += 1; }
+    for (i = Ap[j]; i < Ap[j + 1]; i++) { wt[Ai[i]] += 1; }
 
     /* scan column of B, decrementing w by one */
-    for (i = Bp[j]; i < Bp[j + 1]; i++) { w[Bi[i]] -= 1; }
+    for (i = Bp[j]; i < Bp[j + 1]; i++) { wt[Bi[i]] -= 1; }
 
     /* if any entry of w is negative, A doesn't contain B's sparsity,
        so increment necessary storage counter */
     for (i = 0; i < M; i++)
     {
-      if (w[i] < 0) { newvals += 1; }
+      if (wt[i] < 0) { newvals += 1; }
     }
   }
 
@@ -766,16 +1391,22 @@ SUNErrCode SUNMatScaleAdd_Sparse(sunrealtype c, SUNMatrix A, SUNMatrix B)
   if (newvals == 0)
   {
     /* iterate through columns, adding matrices */
+#if defined(_OPENMP)
+#pragma omp parallel for private(i) schedule(static) num_threads(nthreads) \
+  if (nthreads > 1)
+#endif
     for (j = 0; j < N; j++)
     {
+      sunrealtype* xt = x + threadId() * M;
+
       /* clear work array */
-      for (i = 0; i < M; i++) { x[i] = ZERO; }
+      for (i = 0; i < M; i++) { xt[i] = ZERO; }
 
       /* scan column of B, updating work array */
-      for (i = Bp[j]; i < Bp[j + 1]; i++) { x[Bi[i]] = Bx[i]; }
+      for (i = Bp[j]; i < Bp[j + 1]; i++) { xt[Bi[i]] = Bx[i]; }
 
       /* scan column of A, updating array entries appropriately */
-      for (i = Ap[j]; i < Ap[j + 1]; i++) { Ax[i] = c * Ax[i] + x[Ai[i]]; }
+      for (i = Ap[j]; i < Ap[j + 1]; i++) { Ax[i] = c * Ax[i] + xt[Ai[i]]; }
     }
 
     /*   case 2: A has sufficient storage, but does not already contain B's
@@ -850,50 +1481,76 @@ SUNErrCode SUNMatScaleAdd_Sparse(sunrealtype c, SUNMatrix A, SUNMatrix B)
     Cx = SM_DATA_S(C);
     SUNAssert(Cx, SUN_ERR_ARG_CORRUPT);
 
-    /* initialize total nonzero count */
-    nz = 0;
+    /* count the nonzeros in each column (row) of C, storing the count for
+       column (row) j in Cp[j + 1] */
+    Cp[0] = 0;
+#if defined(_OPENMP)
+#pragma omp parallel for private(i, p) schedule(static) num_threads(nthreads) \
+  if (nthreads > 1)
+#endif
+    for (j = 0; j < N; j++)
+    {
+      sunindextype* wt = w + threadId() * M;
+
+      /* clear out temporary array for this column (row) */
+      for (i = 0; i < M; i++) { wt[i] = 0; }
+
+      /* mark the rows (columns) filled by A or B */
+      for (p = Ap[j]; p < Ap[j + 1]; p++) { wt[Ai[p]] = 1; }
+      for (p = Bp[j]; p < Bp[j + 1]; p++) { wt[Bi[p]] = 1; }
+
+      Cp[j + 1] = 0;
+      for (i = 0; i < M; i++) { Cp[j + 1] += wt[i]; }
+    }
+
+    /* cumulative sum the counts to get the column (row) pointers */
+    for (j = 0; j < N; j++) { Cp[j + 1] += Cp[j]; }
 
     /* iterate through columns (rows) */
+#if defined(_OPENMP)
+#pragma omp parallel for private(i, p, nz) schedule(static) \
+  num_threads(nthreads) if (nthreads > 1)
+#endif
     for (j = 0; j < N; j++)
     {
-      /* set current column (row) pointer to current # nonzeros */
-      Cp[j] = nz;
+      sunindextype* wt = w + threadId() * M;
+      sunrealtype* xt  = x + threadId() * M;
+
+      /* start of this column (row) in C */
+      nz = Cp[j];
 
       /* clear out temporary arrays for this column (row) */
       for (i = 0; i < M; i++)
       {
-        w[i] = 0;
-        x[i] = SUN_RCONST(0.0);
+        wt[i] = 0;
+        xt[i] = SUN_RCONST(0.0);
       }
 
       /* iterate down column of A, collecting nonzeros */
       for (p = Ap[j]; p < Ap[j + 1]; p++)
       {
-        w[Ai[p]] += 1;        /* indicate that row is filled */
-        x[Ai[p]] = c * Ax[p]; /* collect/scale value */
+        wt[Ai[p]] += 1;        /* indicate that row is filled */
+        xt[Ai[p]] = c * Ax[p]; /* collect/scale value */
       }
 
       /* iterate down column of B, collecting nonzeros */
       for (p = Bp[j]; p < Bp[j + 1]; p++)
       {
-        w[Bi[p]] += 1;     /* indicate that row is filled */
-        x[Bi[p]] += Bx[p]; /* collect value */
+        wt[Bi[p]] += 1;     /* indicate that row is filled */
+        xt[Bi[p]] += Bx[p]; /* collect value */
       }
 
       /* fill entries of C with this column's data */
       for (i = 0; i < M; i++)
       {
-        if (w[i] > 0)
+        if (wt[i] > 0)
         {
           Ci[nz]   = i;
-          Cx[nz++] = x[i];
+          Cx[nz++] = xt[i];
         }
       }
     }
 
-    /* indicate end of data */
-    Cp[N] = nz;
-
     /* update A's structure with C's values; nullify C's pointers */
     SM_NNZ_S(A) = SM_NNZ_S(C);
 
@@ -921,55 +1578,6 @@ SUNErrCode SUNMatScaleAdd_Sparse(sunrealtype c, SUNMatrix A, SUNMatrix B)
   return SUN_SUCCESS;
 }
 
-SUNErrCode SUNMatMatvec_Sparse(SUNMatrix A, N_Vector x, N_Vector y)
-{
-  SUNFunctionBegin(A->sunctx);
-  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
-  SUNCheck(compatibleMatrixAndVectors(A, x, y), SUN_ERR_ARG_DIMSMISMATCH);
-
-  /* Perform operation */
-  if (SM_SPARSETYPE_S(A) == CSC_MAT)
-  {
-    SUNCheckCall(Matvec_SparseCSC(A, x, y));
-  }
-  else { SUNCheckCall(Matvec_SparseCSR(A, x, y)); }
-
-  return SUN_SUCCESS;
-}
-
-SUNErrCode SUNMatHermitianTransposeVec_Sparse(SUNMatrix A, N_Vector x, N_Vector y)
-{
-  SUNFunctionBegin(A->sunctx);
-  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
-  SUNCheck(compatibleMatrixAndVectors(A, y, x), SUN_ERR_ARG_DIMSMISMATCH);
-
-  /* Perform operation */
-  if (SM_SPARSETYPE_S(A) == CSC_MAT)
-  {
-    SUNCheckCall(MatTransposeVec_SparseCSC(A, x, y));
-  }
-  else { SUNCheckCall(MatTransposeVec_SparseCSR(A, x, y)); }
-
-  return SUN_SUCCESS;
-}
-
-SUNErrCode SUNMatSpace_Sparse(SUNMatrix A, long int* lenrw, long int* leniw)
-{
-  SUNFunctionBegin(A->sunctx);
-  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
-  SUNAssert(lenrw, SUN_ERR_ARG_CORRUPT);
-  SUNAssert(leniw, SUN_ERR_ARG_CORRUPT);
-  *lenrw = SM_NNZ_S(A);
-  *leniw = 10 + SM_NP_S(A) + SM_NNZ_S(A);
-  return SUN_SUCCESS;
-}
-
-/*
- * =================================================================
- * private functions
- * =================================================================
- */
-
 /* -----------------------------------------------------------------
  * Function to check compatibility of two sparse SUNMatrix objects
  */
@@ -1026,6 +1634,9 @@ SUNErrCode Matvec_SparseCSC(SUNMatrix A, N_Vector x, N_Vector y)
   sunindextype i, j;
   sunindextype *Ap, *Ai;
   sunrealtype *Ax, *xd, *yd;
+#if defined(_OPENMP)
+  int nthreads;
+#endif
   SUNFunctionBegin(A->sunctx);
 
   /* access data from CSC structure (return if failure) */
@@ -1042,6 +1653,16 @@ SUNErrCode Matvec_SparseCSC(SUNMatrix A, N_Vector x, N_Vector y)
   yd = N_VGetArrayPointer(y);
   SUNCheckLastErr();
 
+#if defined(_OPENMP)
+  /* columns scatter into overlapping rows, so use per-thread partial sums */
+  nthreads = opThreads(SM_NTHREADS_S(A), SM_INDEXPTRS_S(A)[SM_NP_S(A)]);
+  if (nthreads > 1)
+  {
+    SUNCheckCall(scatterProductThreads(A, xd, yd, SM_ROWS_S(A), nthreads));
+    return SUN_SUCCESS;
+  }
+#endif
+
   /* initialize result */
   for (i = 0; i < SM_ROWS_S(A); i++) { yd[i] = ZERO; }
 
@@ -1060,6 +1681,7 @@ SUNErrCode MatTransposeVec_SparseCSC(SUNMatrix A, N_Vector x, N_Vector y)
   sunindextype i, j;
   sunindextype *Ap, *Ai;
   sunrealtype *Ax, *xd, *yd;
+  SUNDIALS_MAYBE_UNUSED int nthreads;
   SUNFunctionBegin(A->sunctx);
 
   /* access data from CSC structure (return if failure) */
@@ -1076,14 +1698,18 @@ SUNErrCode MatTransposeVec_SparseCSC(SUNMatrix A, N_Vector x, N_Vector y)
   yd = N_VGetArrayPointer(y);
   SUNCheckLastErr();
 
-  /* initialize result vector */
-  for (i = 0; i < SM_COLUMNS_S(A); i++) { yd[i] = ZERO; }
-
   /* iterate through matrix columns (rows of the transposed matrix) */
+  nthreads = opThreads(SM_NTHREADS_S(A), SM_INDEXPTRS_S(A)[SM_NP_S(A)]);
+#if defined(_OPENMP)
+#pragma omp parallel for private(i) schedule(static) num_threads(nthreads) \
+  if (nthreads > 1)
+#endif
   for (j = 0; j < SM_COLUMNS_S(A); j++)
   {
     /* iterate through non-zero elements in the current column */
-    for (i = Ap[j]; i < Ap[j + 1]; i++) { yd[j] += Ax[i] * xd[Ai[i]]; }
+    sunrealtype sum = ZERO;
+    for (i = Ap[j]; i < Ap[j + 1]; i++) { sum += Ax[i] * xd[Ai[i]]; }
+    yd[j] = sum;
   }
 
   return SUN_SUCCESS;
@@ -1101,6 +1727,7 @@ SUNErrCode Matvec_SparseCSR(SUNMatrix A, N_Vector x, N_Vector y)
   sunindextype i, j;
   sunindextype *Ap, *Aj;
   sunrealtype *Ax, *xd, *yd;
+  SUNDIALS_MAYBE_UNUSED int nthreads;
   SUNFunctionBegin(A->sunctx);
 
   /* access data from CSR structure (return if failure) */
@@ -1120,14 +1747,81 @@ SUNErrCode Matvec_SparseCSR(SUNMatrix A, N_Vector x, N_Vector y)
   SUNAssert(yd, SUN_ERR_ARG_CORRUPT);
   SUNAssert(xd != yd, SUN_ERR_ARG_CORRUPT);
 
-  /* initialize result */
-  for (i = 0; i < SM_ROWS_S(A); i++) { yd[i] = ZERO; }
-
   /* iterate through matrix rows */
+  nthreads = opThreads(SM_NTHREADS_S(A), SM_INDEXPTRS_S(A)[SM_NP_S(A)]);
+#if defined(_OPENMP)
+#pragma omp parallel for private(j) schedule(static) num_threads(nthreads) \
+  if (nthreads > 1)
+#endif
   for (i = 0; i < SM_ROWS_S(A); i++)
   {
     /* iterate along row of A, performing product */
-    for (j = Ap[i]; j < Ap[i + 1]; j++) { yd[i] += Ax[j] * xd[Aj[j]]; }
+    sunrealtype sum = ZERO;
+    for (j = Ap[i]; j < Ap[i + 1]; j++) { sum += Ax[j] * xd[Aj[j]]; }
+    yd[i] = sum;
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------
+ * Computes y=A*x using the SELL-C-sigma copy of A. The sums for the
+ * rows of a chunk are accumulated together, one padded column of the
+ * chunk at a time, so the inner loop has a fixed length and no
+ * dependence between its iterations.
+ */
+SUNErrCode Matvec_SparseSELL(SUNMatrix A, N_Vector x, N_Vector y)
+{
+  sunindextype c;
+  sunrealtype *xd, *yd;
+  SUNDIALS_MAYBE_UNUSED int nthreads;
+  SUNFunctionBegin(A->sunctx);
+
+  const SUNSparseSELL sell      = SM_CONTENT_S(A)->sell;
+  const sunindextype* chunkptrs = sell->chunkptrs;
+  const sunindextype* perm      = sell->perm;
+  const sunindextype* Sj        = sell->colidx;
+  const sunrealtype* Sx         = sell->data;
+
+  /* access vector data (return if failure) */
+  xd = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  yd = N_VGetArrayPointer(y);
+  SUNCheckLastErr();
+  SUNAssert(xd, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(yd, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(xd != yd, SUN_ERR_ARG_CORRUPT);
+
+  /* iterate through the chunks */
+  nthreads = opThreads(SM_NTHREADS_S(A), SM_INDEXPTRS_S(A)[SM_NP_S(A)]);
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) num_threads(nthreads) \
+  if (nthreads > 1)
+#endif
+  for (c = 0; c < sell->nchunks; c++)
+  {
+    const sunindextype width = (chunkptrs[c + 1] - chunkptrs[c]) /
+                               SPARSE_SELL_CHUNK;
+    const sunindextype* cj   = Sj + chunkptrs[c];
+    const sunrealtype* cx    = Sx + chunkptrs[c];
+    const sunindextype* rows = perm + c * SPARSE_SELL_CHUNK;
+    sunrealtype sum[SPARSE_SELL_CHUNK];
+    sunindextype k;
+    int r;
+
+    for (r = 0; r < SPARSE_SELL_CHUNK; r++) { sum[r] = ZERO; }
+    for (k = 0; k < width; k++)
+    {
+      for (r = 0; r < SPARSE_SELL_CHUNK; r++)
+      {
+        sum[r] += cx[k * SPARSE_SELL_CHUNK + r] *
+                  xd[cj[k * SPARSE_SELL_CHUNK + r]];
+      }
+    }
+    for (r = 0; r < SPARSE_SELL_CHUNK; r++)
+    {
+      if (rows[r] >= 0) { yd[rows[r]] = sum[r]; }
+    }
   }
 
   return SUN_SUCCESS;
@@ -1138,6 +1832,9 @@ SUNErrCode MatTransposeVec_SparseCSR(SUNMatrix A, N_Vector x, N_Vector y)
   sunindextype i, j;
   sunindextype *Ap, *Aj;
   sunrealtype *Ax, *xd, *yd;
+#if defined(_OPENMP)
+  int nthreads;
+#endif
   SUNFunctionBegin(A->sunctx);
 
   /* access data from CSR structure (return if failure) */
@@ -1157,6 +1854,16 @@ SUNErrCode MatTransposeVec_SparseCSR(SUNMatrix A, N_Vector x, N_Vector y)
   SUNAssert(yd, SUN_ERR_ARG_CORRUPT);
   SUNAssert(xd != yd, SUN_ERR_ARG_CORRUPT);
 
+#if defined(_OPENMP)
+  /* rows scatter into overlapping columns, so use per-thread partial sums */
+  nthreads = opThreads(SM_NTHREADS_S(A), SM_INDEXPTRS_S(A)[SM_NP_S(A)]);
+  if (nthreads > 1)
+  {
+    SUNCheckCall(scatterProductThreads(A, xd, yd, SM_COLUMNS_S(A), nthreads));
+    return SUN_SUCCESS;
+  }
+#endif
+
   /* initialize result vector */
   for (i = 0; i < SM_COLUMNS_S(A); i++) { yd[i] = ZERO; }
 
@@ -1182,6 +1889,9 @@ SUNErrCode format_convert(const SUNMatrix A, SUNMatrix B)
   sunindextype *Bp, *Bi;
   sunindextype n_row, n_col, nnz;
   sunindextype n, col, csum, row, last;
+#if defined(_OPENMP)
+  int nthreads;
+#endif
 
   if (SM_SPARSETYPE_S(A) == SM_SPARSETYPE_S(B))
   {
@@ -1189,6 +1899,15 @@ SUNErrCode format_convert(const SUNMatrix A, SUNMatrix B)
     return SUN_SUCCESS;
   }
 
+#if defined(_OPENMP)
+  nthreads = opThreads(SM_NTHREADS_S(A), SM_INDEXPTRS_S(A)[SM_NP_S(A)]);
+  if (nthreads > 1)
+  {
+    SUNCheckCall(formatConvertThreads(A, B, nthreads));
+    return SUN_SUCCESS;
+  }
+#endif
+
   Ap = SM_INDEXPTRS_S(A);
   SUNAssert(Ap, SUN_ERR_ARG_CORRUPT);
   Aj = SM_INDEXVALS_S(A);
@@ -1244,3 +1963,750 @@ SUNErrCode format_convert(const SUNMatrix A, SUNMatrix B)
 
   return SUN_SUCCESS;
 }
+
+/* -----------------------------------------------------------------
+ * Returns the number of threads to use for an operation that works
+ * on nwork entries, so that each thread gets at least SPARSE_MIN_WORK
+ * of them.
+ */
+int opThreads(int nthreads, sunindextype nwork)
+{
+  sunindextype maxthreads;
+
+  if (nthreads < 2) { return 1; }
+
+  maxthreads = SUNMAX(nwork / SPARSE_MIN_WORK, 1);
+  return (maxthreads < nthreads) ? (int)maxthreads : nthreads;
+}
+
+/* -----------------------------------------------------------------
+ * Returns the number of the calling thread within an OpenMP team
+ */
+int threadId(void)
+{
+#if defined(_OPENMP)
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
+/* -----------------------------------------------------------------
+ * Frees a cached pattern merge
+ */
+void mergeMapFree(SUNSparseMergeMap* map)
+{
+  if (*map == NULL) { return; }
+
+  free((*map)->a_ptrs);
+  free((*map)->a_vals);
+  free((*map)->b_ptrs);
+  free((*map)->b_vals);
+  free((*map)->c_ptrs);
+  free((*map)->c_vals);
+  free((*map)->a_map);
+  free((*map)->b_map);
+  free(*map);
+  *map = NULL;
+}
+
+/* -----------------------------------------------------------------
+ * Returns the number of indices stored by a merge map for a matrix
+ * with np columns (rows)
+ */
+long int mergeMapSpace(SUNSparseMergeMap map, sunindextype np)
+{
+  long int len = 0;
+
+  if (map == NULL) { return 0; }
+
+  if (map->a_ptrs) { len += np + 1; }
+  if (map->a_vals) { len += SUNMAX(map->nnz_a, 1); }
+  if (map->b_ptrs) { len += np + 1; }
+  if (map->b_vals) { len += SUNMAX(map->nnz_b, 1); }
+  if (map->c_ptrs) { len += np + 1; }
+  if (map->c_vals) { len += SUNMAX(map->nnz_c, 1); }
+  if (map->a_map) { len += SUNMAX(map->nnz_c, 1); }
+  if (map->b_map) { len += SUNMAX(map->nnz_b, 1); }
+
+  return len;
+}
+
+/* -----------------------------------------------------------------
+ * Returns SUNTRUE if the cached merge is valid and the patterns of
+ * A and B (NULL for the identity) are the ones it was recorded for
+ */
+sunbooleantype mergeMapMatches(SUNSparseMergeMap map, SUNMatrix A, SUNMatrix B)
+{
+  sunindextype k;
+  const sunindextype np  = SM_NP_S(A);
+  const sunindextype* Ap = SM_INDEXPTRS_S(A);
+  const sunindextype* Ai = SM_INDEXVALS_S(A);
+
+  if (map == NULL || !map->valid) { return SUNFALSE; }
+
+  if (Ap[np] != map->nnz_a) { return SUNFALSE; }
+  for (k = 0; k <= np; k++)
+  {
+    if (Ap[k] != map->a_ptrs[k]) { return SUNFALSE; }
+  }
+  for (k = 0; k < map->nnz_a; k++)
+  {
+    if (Ai[k] != map->a_vals[k]) { return SUNFALSE; }
+  }
+
+  if (B == NULL) { return SUNTRUE; }
+
+  const sunindextype* Bp = SM_INDEXPTRS_S(B);
+  const sunindextype* Bi = SM_INDEXVALS_S(B);
+
+  if (Bp[np] != map->nnz_b) { return SUNFALSE; }
+  for (k = 0; k <= np; k++)
+  {
+    if (Bp[k] != map->b_ptrs[k]) { return SUNFALSE; }
+  }
+  for (k = 0; k < map->nnz_b; k++)
+  {
+    if (Bi[k] != map->b_vals[k]) { return SUNFALSE; }
+  }
+
+  return SUNTRUE;
+}
+
+/* -----------------------------------------------------------------
+ * Discards any cached merge and records the input patterns of A and
+ * B (NULL for the identity) before they are merged
+ */
+SUNErrCode mergeMapSaveInput(SUNMatrix A, SUNMatrix B, SUNSparseMergeMap* map)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype k;
+  const sunindextype np = SM_NP_S(A);
+
+  mergeMapFree(map);
+
+  *map = (SUNSparseMergeMap)calloc(1, sizeof **map);
+  SUNAssert(*map, SUN_ERR_MALLOC_FAIL);
+
+  (*map)->valid = SUNFALSE;
+  (*map)->nnz_a = SM_INDEXPTRS_S(A)[np];
+
+  (*map)->a_ptrs = (sunindextype*)malloc((np + 1) * sizeof(sunindextype));
+  SUNAssert((*map)->a_ptrs, SUN_ERR_MALLOC_FAIL);
+  (*map)->a_vals =
+    (sunindextype*)malloc(SUNMAX((*map)->nnz_a, 1) * sizeof(sunindextype));
+  SUNAssert((*map)->a_vals, SUN_ERR_MALLOC_FAIL);
+
+  for (k = 0; k <= np; k++) { (*map)->a_ptrs[k] = SM_INDEXPTRS_S(A)[k]; }
+  for (k = 0; k < (*map)->nnz_a; k++)
+  {
+    (*map)->a_vals[k] = SM_INDEXVALS_S(A)[k];
+  }
+
+  if (B == NULL) { return SUN_SUCCESS; }
+
+  (*map)->nnz_b = SM_INDEXPTRS_S(B)[np];
+
+  (*map)->b_ptrs = (sunindextype*)malloc((np + 1) * sizeof(sunindextype));
+  SUNAssert((*map)->b_ptrs, SUN_ERR_MALLOC_FAIL);
+  (*map)->b_vals =
+    (sunindextype*)malloc(SUNMAX((*map)->nnz_b, 1) * sizeof(sunindextype));
+  SUNAssert((*map)->b_vals, SUN_ERR_MALLOC_FAIL);
+
+  for (k = 0; k <= np; k++) { (*map)->b_ptrs[k] = SM_INDEXPTRS_S(B)[k]; }
+  for (k = 0; k < (*map)->nnz_b; k++)
+  {
+    (*map)->b_vals[k] = SM_INDEXVALS_S(B)[k];
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------
+ * Records where the entries of the input pattern of A and of B (the
+ * diagonal if B is NULL) were placed in the merged pattern now held
+ * by A. The map is left invalid, so later calls keep merging, if a
+ * pattern repeats an index within a column or if an entry of A moved
+ * to an earlier position (i.e., the input columns were unsorted), as
+ * the values could then not be updated in place.
+ */
+SUNErrCode mergeMapBuild(SUNMatrix A, SUNMatrix B, SUNSparseMergeMap map)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype j, k, q, M, ndiag, *w;
+  const sunindextype np  = SM_NP_S(A);
+  const sunindextype* Cp = SM_INDEXPTRS_S(A);
+  const sunindextype* Ci = SM_INDEXVALS_S(A);
+
+  M = (SM_SPARSETYPE_S(A) == CSC_MAT) ? SM_ROWS_S(A) : SM_COLUMNS_S(A);
+
+  /* check if the merged pattern is the input pattern of A */
+  map->nnz_c = Cp[np];
+  map->same  = (map->nnz_c == map->nnz_a);
+  for (k = 0; k <= np && map->same; k++)
+  {
+    if (Cp[k] != map->a_ptrs[k]) { map->same = SUNFALSE; }
+  }
+  for (k = 0; k < map->nnz_c && map->same; k++)
+  {
+    if (Ci[k] != map->a_vals[k]) { map->same = SUNFALSE; }
+  }
+
+  /* otherwise record the merged pattern */
+  if (!map->same)
+  {
+    map->c_ptrs = (sunindextype*)malloc((np + 1) * sizeof(sunindextype));
+    SUNAssert(map->c_ptrs, SUN_ERR_MALLOC_FAIL);
+    map->c_vals =
+      (sunindextype*)malloc(SUNMAX(map->nnz_c, 1) * sizeof(sunindextype));
+    SUNAssert(map->c_vals, SUN_ERR_MALLOC_FAIL);
+    map->a_map =
+      (sunindextype*)malloc(SUNMAX(map->nnz_c, 1) * sizeof(sunindextype));
+    SUNAssert(map->a_map, SUN_ERR_MALLOC_FAIL);
+
+    for (k = 0; k <= np; k++) { map->c_ptrs[k] = Cp[k]; }
+    for (k = 0; k < map->nnz_c; k++)
+    {
+      map->c_vals[k] = Ci[k];
+      map->a_map[k]  = -1;
+    }
+  }
+
+  /* the identity adds one entry to each column (row) with a diagonal */
+  ndiag = SUNMIN(np, M);
+  if (B == NULL) { map->nnz_b = ndiag; }
+
+  map->b_map =
+    (sunindextype*)malloc(SUNMAX(map->nnz_b, 1) * sizeof(sunindextype));
+  SUNAssert(map->b_map, SUN_ERR_MALLOC_FAIL);
+
+  /* w holds the merged position of each index in the current column (row),
+     -1 if it is not present, or -2 - position once B has been placed */
+  w = (sunindextype*)malloc(M * sizeof(sunindextype));
+  SUNAssert(w, SUN_ERR_MALLOC_FAIL);
+  for (k = 0; k < M; k++) { w[k] = -1; }
+
+  for (j = 0; j < np; j++)
+  {
+    /* locate the merged entries of this column (row) */
+    for (q = Cp[j]; q < Cp[j + 1]; q++)
+    {
+      if (w[Ci[q]] != -1) { break; }
+      w[Ci[q]] = q;
+    }
+    if (q < Cp[j + 1]) { break; }
+
+    /* place the entries of A */
+    for (k = map->a_ptrs[j]; k < map->a_ptrs[j + 1]; k++)
+    {
+      q = w[map->a_vals[k]];
+      if (q < k) { break; }
+      if (map->same) { continue; }
+      if (map->a_map[q] != -1) { break; }
+      map->a_map[q] = k;
+    }
+    if (k < map->a_ptrs[j + 1]) { break; }
+
+    /* place the entries of B (the diagonal) */
+    if (B != NULL)
+    {
+      for (k = map->b_ptrs[j]; k < map->b_ptrs[j + 1]; k++)
+      {
+        q = w[map->b_vals[k]];
+        if (q < 0) { break; }
+        map->b_map[k]     = q;
+        w[map->b_vals[k]] = -2 - q;
+      }
+      if (k < map->b_ptrs[j + 1]) { break; }
+    }
+    else if (j < ndiag)
+    {
+      q = w[j];
+      if (q < 0) { break; }
+      map->b_map[j] = q;
+    }
+
+    /* reset the work array */
+    for (q = Cp[j]; q < Cp[j + 1]; q++) { w[Ci[q]] = -1; }
+  }
+
+  free(w);
+
+  /* the map is valid if every column (row) was placed */
+  map->valid = (j == np);
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------
+ * Computes A = c*A + B (c*A + I if B is NULL) using a cached merge of
+ * the patterns. Each entry of the merged pattern is stored at or after
+ * the position of its source entry in A, so filling the merged entries
+ * from the end never overwrites an entry of A that is still needed.
+ */
+SUNErrCode scaleAddMapped(sunrealtype c, SUNMatrix A, SUNMatrix B,
+                          SUNSparseMergeMap map)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype k, q;
+  sunindextype *Ap, *Ai;
+  sunrealtype *Ax, *Bx;
+  SUNDIALS_MAYBE_UNUSED const int nthreads =
+    opThreads(SM_NTHREADS_S(A), map->nnz_c);
+
+  if (map->same)
+  {
+    Ax = SM_DATA_S(A);
+    SUNAssert(Ax, SUN_ERR_ARG_CORRUPT);
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) num_threads(nthreads) \
+  if (nthreads > 1)
+#endif
+    for (k = 0; k < map->nnz_c; k++) { Ax[k] *= c; }
+  }
+  else
+  {
+    /* ensure A has storage for the merged pattern */
+    if (SM_NNZ_S(A) < map->nnz_c)
+    {
+      SUNCheckCall(SUNSparseMatrix_Reallocate(A, map->nnz_c));
+    }
+
+    Ap = SM_INDEXPTRS_S(A);
+    SUNAssert(Ap, SUN_ERR_ARG_CORRUPT);
+    Ai = SM_INDEXVALS_S(A);
+    SUNAssert(Ai, SUN_ERR_ARG_CORRUPT);
+    Ax = SM_DATA_S(A);
+    SUNAssert(Ax, SUN_ERR_ARG_CORRUPT);
+
+    for (q = map->nnz_c - 1; q >= 0; q--)
+    {
+      k     = map->a_map[q];
+      Ax[q] = (k < 0) ? ZERO : c * Ax[k];
+      Ai[q] = map->c_vals[q];
+    }
+    for (k = 0; k <= SM_NP_S(A); k++) { Ap[k] = map->c_ptrs[k]; }
+  }
+
+  /* add the entries of B (the identity) */
+  if (B != NULL)
+  {
+    Bx = SM_DATA_S(B);
+    SUNAssert(Bx, SUN_ERR_ARG_CORRUPT);
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) num_threads(nthreads) \
+  if (nthreads > 1)
+#endif
+    for (k = 0; k < map->nnz_b; k++) { Ax[map->b_map[k]] += Bx[k]; }
+  }
+  else
+  {
+    for (k = 0; k < map->nnz_b; k++) { Ax[map->b_map[k]] += ONE; }
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------
+ * Frees the SELL-C-sigma copy of a matrix
+ */
+void sellFree(SUNSparseSELL* sell)
+{
+  if (*sell == NULL) { return; }
+
+  free((*sell)->chunkptrs);
+  free((*sell)->perm);
+  free((*sell)->colidx);
+  free((*sell)->data);
+  free(*sell);
+  *sell = NULL;
+}
+
+/* -----------------------------------------------------------------
+ * Marks the SELL-C-sigma copy of A (if any) as out of date after an
+ * operation that changes the entries of A
+ */
+void sellInvalidate(SUNMatrix A)
+{
+  if (SM_CONTENT_S(A)->sell) { SM_CONTENT_S(A)->sell->valid = SUNFALSE; }
+}
+
+/* -----------------------------------------------------------------
+ * Builds the SELL-C-sigma copy of A from its current entries. A CSC
+ * matrix is first converted to CSR.
+ */
+SUNErrCode sellBuild(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, i0, i1, c, nslots, nwin, *order;
+  sunindextype *Ap, *Aj;
+  sunrealtype* Ax;
+  SUNDIALS_MAYBE_UNUSED int nthreads;
+  SUNMatrix T = NULL;
+  int r;
+
+  const SUNSparseSELL sell   = SM_CONTENT_S(A)->sell;
+  const sunindextype M       = SM_ROWS_S(A);
+  const sunindextype nchunks = (M + SPARSE_SELL_CHUNK - 1) / SPARSE_SELL_CHUNK;
+  const sunindextype nrows   = nchunks * SPARSE_SELL_CHUNK;
+  const sunindextype nptrs   = nchunks + 1;
+
+  /* access the rows of A */
+  if (SM_SPARSETYPE_S(A) == CSC_MAT)
+  {
+    SUNCheckCall(SUNSparseMatrix_ToCSR(A, &T));
+    Ap = SM_INDEXPTRS_S(T);
+    Aj = SM_INDEXVALS_S(T);
+    Ax = SM_DATA_S(T);
+  }
+  else
+  {
+    Ap = SM_INDEXPTRS_S(A);
+    Aj = SM_INDEXVALS_S(A);
+    Ax = SM_DATA_S(A);
+  }
+
+  sell->perm = (sunindextype*)realloc(sell->perm, nrows * sizeof(sunindextype));
+  SUNAssert(sell->perm, SUN_ERR_MALLOC_FAIL);
+  sell->chunkptrs = (sunindextype*)realloc(sell->chunkptrs,
+                                           nptrs * sizeof(sunindextype));
+  SUNAssert(sell->chunkptrs, SUN_ERR_MALLOC_FAIL);
+
+  /* sort the rows of each window by decreasing length, keeping the original
+     order of rows with the same length. A counting sort is used unless the
+     lengths in the window span more values than there are rows in it. */
+  nwin  = SUNMIN(sell->sigma, M);
+  order = (sunindextype*)malloc(2 * nwin * sizeof(sunindextype));
+  SUNAssert(order, SUN_ERR_MALLOC_FAIL);
+
+  for (i0 = 0; i0 < M; i0 += sell->sigma)
+  {
+    sunindextype lmin, lmax, len, k, sum;
+
+    i1   = SUNMIN(i0 + sell->sigma, M);
+    lmin = Ap[i0 + 1] - Ap[i0];
+    lmax = lmin;
+    for (i = i0 + 1; i < i1; i++)
+    {
+      lmin = SUNMIN(lmin, Ap[i + 1] - Ap[i]);
+      lmax = SUNMAX(lmax, Ap[i + 1] - Ap[i]);
+    }
+
+    if (lmax - lmin < nwin)
+    {
+      /* count the rows of each length, longest first */
+      for (k = 0; k <= lmax - lmin; k++) { order[k] = 0; }
+      for (i = i0; i < i1; i++) { order[lmax - (Ap[i + 1] - Ap[i])]++; }
+      for (k = 0, sum = 0; k <= lmax - lmin; k++)
+      {
+        len      = order[k];
+        order[k] = sum;
+        sum += len;
+      }
+      for (i = i0; i < i1; i++)
+      {
+        sell->perm[i0 + order[lmax - (Ap[i + 1] - Ap[i])]++] = i;
+      }
+    }
+    else
+    {
+      for (i = i0; i < i1; i++)
+      {
+        order[2 * (i - i0)]     = Ap[i + 1] - Ap[i];
+        order[2 * (i - i0) + 1] = i;
+      }
+      qsort(order, i1 - i0, 2 * sizeof(sunindextype), compareRowLength);
+      for (i = i0; i < i1; i++) { sell->perm[i] = order[2 * (i - i0) + 1]; }
+    }
+  }
+  for (i = M; i < nrows; i++) { sell->perm[i] = -1; }
+
+  free(order);
+
+  /* pad each chunk to its longest row */
+  sell->chunkptrs[0] = 0;
+  for (c = 0; c < nchunks; c++)
+  {
+    sunindextype width = 0;
+    for (r = 0; r < SPARSE_SELL_CHUNK; r++)
+    {
+      i = sell->perm[c * SPARSE_SELL_CHUNK + r];
+      if (i >= 0) { width = SUNMAX(width, Ap[i + 1] - Ap[i]); }
+    }
+    sell->chunkptrs[c + 1] = sell->chunkptrs[c] + width * SPARSE_SELL_CHUNK;
+  }
+  nslots = sell->chunkptrs[nchunks];
+
+  sell->colidx = (sunindextype*)realloc(sell->colidx, SUNMAX(nslots, 1) *
+                                                        sizeof(sunindextype));
+  SUNAssert(sell->colidx, SUN_ERR_MALLOC_FAIL);
+  sell->data = (sunrealtype*)realloc(sell->data,
+                                     SUNMAX(nslots, 1) * sizeof(sunrealtype));
+  SUNAssert(sell->data, SUN_ERR_MALLOC_FAIL);
+
+  /* copy the rows into their chunk slots, padding with zeros in column 0 */
+  nthreads = opThreads(SM_NTHREADS_S(A), nslots);
+#if defined(_OPENMP)
+#pragma omp parallel for private(i, r) schedule(static) num_threads(nthreads) \
+  if (nthreads > 1)
+#endif
+  for (c = 0; c < nchunks; c++)
+  {
+    const sunindextype width = (sell->chunkptrs[c + 1] - sell->chunkptrs[c]) /
+                               SPARSE_SELL_CHUNK;
+    for (r = 0; r < SPARSE_SELL_CHUNK; r++)
+    {
+      const sunindextype row = sell->perm[c * SPARSE_SELL_CHUNK + r];
+      const sunindextype len = (row >= 0) ? Ap[row + 1] - Ap[row] : 0;
+      sunindextype* cj       = sell->colidx + sell->chunkptrs[c] + r;
+      sunrealtype* cx        = sell->data + sell->chunkptrs[c] + r;
+      for (i = 0; i < len; i++)
+      {
+        cj[i * SPARSE_SELL_CHUNK] = Aj[Ap[row] + i];
+        cx[i * SPARSE_SELL_CHUNK] = Ax[Ap[row] + i];
+      }
+      for (i = len; i < width; i++)
+      {
+        cj[i * SPARSE_SELL_CHUNK] = 0;
+        cx[i * SPARSE_SELL_CHUNK] = ZERO;
+      }
+    }
+  }
+
+  sell->nchunks = nchunks;
+  sell->valid   = SUNTRUE;
+
+  if (T) { SUNMatDestroy_Sparse(T); }
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------
+ * Orders (length, row) pairs by decreasing length and then by row
+ */
+int compareRowLength(const void* a, const void* b)
+{
+  const sunindextype* pa = (const sunindextype*)a;
+  const sunindextype* pb = (const sunindextype*)b;
+
+  if (pa[0] != pb[0]) { return (pa[0] > pb[0]) ? -1 : 1; }
+  return (pa[1] > pb[1]) - (pa[1] < pb[1]);
+}
+
+/* -----------------------------------------------------------------
+ * Forms the index arrays of the transpose of the sparsity pattern
+ * of A, i.e. the rows of each column of a CSR matrix or the columns
+ * of each row of a CSC matrix. The arrays are allocated here.
+ */
+SUNErrCode transposePattern(SUNMatrix A, sunindextype** tptrs,
+                            sunindextype** tvals)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, p, dest;
+  const sunindextype np  = SM_NP_S(A);
+  const sunindextype nt  = (SM_SPARSETYPE_S(A) == CSC_MAT) ? SM_ROWS_S(A)
+                                                           : SM_COLUMNS_S(A);
+  const sunindextype* Ap = SM_INDEXPTRS_S(A);
+  const sunindextype* Ai = SM_INDEXVALS_S(A);
+  const sunindextype nnz = Ap[np];
+
+  *tptrs = (sunindextype*)calloc(nt + 1, sizeof(sunindextype));
+  SUNAssert(*tptrs, SUN_ERR_MALLOC_FAIL);
+  *tvals = (sunindextype*)malloc(SUNMAX(nnz, 1) * sizeof(sunindextype));
+  SUNAssert(*tvals, SUN_ERR_MALLOC_FAIL);
+
+  /* count the entries of each transposed row, then cumulative sum */
+  for (p = 0; p < nnz; p++) { (*tptrs)[Ai[p] + 1]++; }
+  for (i = 0; i < nt; i++) { (*tptrs)[i + 1] += (*tptrs)[i]; }
+
+  /* scatter the indices, shifting the pointers up by one entry */
+  for (i = 0; i < np; i++)
+  {
+    for (p = Ap[i]; p < Ap[i + 1]; p++)
+    {
+      dest           = (*tptrs)[Ai[p]]++;
+      (*tvals)[dest] = i;
+    }
+  }
+  for (i = nt; i > 0; i--) { (*tptrs)[i] = (*tptrs)[i - 1]; }
+  (*tptrs)[0] = 0;
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------
+ * Frees a triplet map
+ */
+void tripletMapFree(SUNSparseTripletMap* map)
+{
+  if (*map == NULL) { return; }
+
+  free((*map)->ptrs);
+  free((*map)->vals);
+  free((*map)->tptrs);
+  free((*map)->trip);
+  free(*map);
+  *map = NULL;
+}
+
+#if defined(_OPENMP)
+
+/* -----------------------------------------------------------------
+ * Computes yd = sum_j xd[j] * (column j of A) for a CSC matrix, or the
+ * same with rows for a CSR matrix (i.e., y = A^T x), where nout is
+ * the length of yd. The outer index is split into contiguous ranges,
+ * each thread accumulates its range into a private copy of yd, and
+ * the copies are summed entry by entry so no two threads ever update
+ * the same entry.
+ */
+SUNErrCode scatterProductThreads(SUNMatrix A, const sunrealtype* xd,
+                                 sunrealtype* yd, sunindextype nout,
+                                 int nthreads)
+{
+  SUNFunctionBegin(A->sunctx);
+
+  const sunindextype np  = SM_NP_S(A);
+  const sunindextype* Ap = SM_INDEXPTRS_S(A);
+  const sunindextype* Ai = SM_INDEXVALS_S(A);
+  const sunrealtype* Ax  = SM_DATA_S(A);
+  sunrealtype* work;
+
+  SUNAssert(Ap, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(Ai, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(Ax, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(xd != yd, SUN_ERR_ARG_CORRUPT);
+
+  work = (sunrealtype*)malloc(nthreads * nout * sizeof(sunrealtype));
+  SUNAssert(work, SUN_ERR_MALLOC_FAIL);
+
+#pragma omp parallel num_threads(nthreads)
+  {
+    const int nt           = omp_get_num_threads();
+    const int tid          = omp_get_thread_num();
+    const sunindextype len = np / nt;
+    const sunindextype rem = np % nt;
+    const sunindextype j0  = tid * len + SUNMIN(tid, rem);
+    const sunindextype j1  = j0 + len + (tid < rem ? 1 : 0);
+    sunrealtype* yt        = work + tid * nout;
+    sunindextype i, j, p;
+
+    for (i = 0; i < nout; i++) { yt[i] = ZERO; }
+
+    for (j = j0; j < j1; j++)
+    {
+      for (p = Ap[j]; p < Ap[j + 1]; p++) { yt[Ai[p]] += Ax[p] * xd[j]; }
+    }
+
+#pragma omp barrier
+
+#pragma omp for schedule(static)
+    for (i = 0; i < nout; i++)
+    {
+      sunrealtype sum = ZERO;
+      int t;
+      for (t = 0; t < nt; t++) { sum += work[t * nout + i]; }
+      yd[i] = sum;
+    }
+  }
+
+  free(work);
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------
+ * Threaded version of format_convert. The rows (columns) of A are
+ * split into contiguous ranges and each thread counts the entries of
+ * its range in every column (row) of B. The counts give each thread
+ * a disjoint write offset in every column (row), so the threads then
+ * scatter their ranges independently. Entries keep the same order as
+ * in the serial conversion.
+ */
+SUNErrCode formatConvertThreads(const SUNMatrix A, SUNMatrix B, int nthreads)
+{
+  SUNFunctionBegin(A->sunctx);
+
+  const sunindextype* Ap = SM_INDEXPTRS_S(A);
+  const sunindextype* Aj = SM_INDEXVALS_S(A);
+  const sunrealtype* Ax  = SM_DATA_S(A);
+  sunindextype *Bp, *Bi, *count;
+  sunrealtype* Bx;
+  sunindextype n_row, n_col;
+
+  SUNAssert(Ap, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(Aj, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(Ax, SUN_ERR_ARG_CORRUPT);
+
+  n_row = (SM_SPARSETYPE_S(A) == CSR_MAT) ? SM_ROWS_S(A) : SM_COLUMNS_S(A);
+  n_col = (SM_SPARSETYPE_S(A) == CSR_MAT) ? SM_COLUMNS_S(A) : SM_ROWS_S(A);
+
+  SUNCheckCall(SUNMatZero_Sparse(B));
+
+  Bp = SM_INDEXPTRS_S(B);
+  Bi = SM_INDEXVALS_S(B);
+  Bx = SM_DATA_S(B);
+
+  /* per-thread column (row) counts, later the per-thread write offsets */
+  count = (sunindextype*)malloc(nthreads * n_col * sizeof(sunindextype));
+  SUNAssert(count, SUN_ERR_MALLOC_FAIL);
+
+#pragma omp parallel num_threads(nthreads)
+  {
+    const int nt           = omp_get_num_threads();
+    const int tid          = omp_get_thread_num();
+    const sunindextype len = n_row / nt;
+    const sunindextype rem = n_row % nt;
+    const sunindextype r0  = tid * len + SUNMIN(tid, rem);
+    const sunindextype r1  = r0 + len + (tid < rem ? 1 : 0);
+    sunindextype* ct       = count + tid * n_col;
+    sunindextype row, jj;
+
+    /* count the entries of this thread's rows in each column */
+    for (jj = 0; jj < n_col; jj++) { ct[jj] = 0; }
+    for (jj = Ap[r0]; jj < Ap[r1]; jj++) { ct[Aj[jj]]++; }
+
+#pragma omp barrier
+
+    /* turn the counts into offsets within each column, storing the number
+       of entries in column jj in Bp[jj + 1] */
+#pragma omp for schedule(static)
+    for (jj = 0; jj < n_col; jj++)
+    {
+      sunindextype csum = 0;
+      int t;
+      for (t = 0; t < nt; t++)
+      {
+        sunindextype temp     = count[t * n_col + jj];
+        count[t * n_col + jj] = csum;
+        csum += temp;
+      }
+      Bp[jj + 1] = csum;
+    }
+
+    /* cumulative sum the nnz per column to get Bp[] */
+#pragma omp single
+    {
+      for (jj = 0; jj < n_col; jj++) { Bp[jj + 1] += Bp[jj]; }
+    }
+
+    /* scatter this thread's rows */
+    for (row = r0; row < r1; row++)
+    {
+      for (jj = Ap[row]; jj < Ap[row + 1]; jj++)
+      {
+        sunindextype dest = Bp[Aj[jj]] + ct[Aj[jj]]++;
+
+        Bi[dest] = row;
+        Bx[dest] = Ax[jj];
+      }
+    }
+  }
+
+  free(count);
+
+  return SUN_SUCCESS;
+}
+
+#endif
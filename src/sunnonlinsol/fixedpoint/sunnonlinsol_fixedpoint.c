@@ -647,7 +647,7 @@ static SUNErrCode AllocateContent(SUNNonlinearSolver NLS, N_Vector y)
     FP_CONTENT(NLS)->dg = N_VCloneVectorArray(m, y);
     SUNCheckLastErr();
 
-    FP_CONTENT(NLS)->q = N_VCloneVectorArray(m, y);
+    FP_CONTENT(NLS)->q = N_VCloneVectorArrayContiguous(m, y);
     SUNCheckLastErr();
 
     FP_CONTENT(NLS)->Xvecs = (N_Vector*)malloc(2 * (m + 1) * sizeof(N_Vector));
@@ -191,6 +191,12 @@ export SUNDIALS_PTHREAD=ON
 export SUNDIALS_OPENMP=ON
 export OMP_NUM_THREADS=4
 
+# -------------
+# Fused kernels
+# -------------
+
+export SUNDIALS_FUSED_KERNELS=ON
+
 # ---
 # MPI
 # ---
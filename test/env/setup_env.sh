@@ -201,9 +201,6 @@ if [[ "${SUNDIALS_TPLS}" == "OFF" ]]; then
     export SUNDIALS_TRILINOS=OFF
     export SUNDIALS_XBRAID=OFF
 
-    # fused kernels currently require CUDA or HIP
-    export SUNDIALS_FUSED_KERNELS=OFF
-
 fi
 
 # Print relevant environment variables to the log file
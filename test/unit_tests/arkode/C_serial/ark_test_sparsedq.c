@@ -0,0 +1,116 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the sparse difference quotient Jacobian set up with
+ * ARKodeSetJacSparsity. The implicit right-hand side is fi = J y with J from
+ * the shared fixture in test_sparsedq.h, and the saved Jacobian is compared
+ * with J. Each Jacobian evaluation must call fi once per color of the pattern.
+ * ---------------------------------------------------------------------------*/
+
+#include "arkode/arkode_arkstep.h"
+
+#include "../../utilities/test_sparsedq.h"
+
+/* Implicit right-hand side fi = J y */
+static int fi(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  jac_times(y, ydot);
+  return 0;
+}
+
+/* Solve with a sparse DQ Jacobian and check the Jacobian and the number of
+   right-hand side evaluations */
+static int solve(SUNMatrix A, SUNMatrix S, SUNLinearSolver LS,
+                 sunindextype ncolors, SUNContext sunctx)
+{
+  int retval       = 0;
+  int fails        = 0;
+  N_Vector y       = NULL;
+  SUNMatrix Jac    = NULL;
+  void* arkode_mem = NULL;
+  sunrealtype tret;
+  long int nje, nfeLS;
+
+  y = N_VNew_Serial(NEQ, sunctx);
+  if (!y)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+  N_VConst(ONE, y);
+
+  arkode_mem = ARKStepCreate(NULL, fi, ZERO, y, sunctx);
+  if (!arkode_mem)
+  {
+    fprintf(stderr, "ARKStepCreate returned NULL\n");
+    fails++;
+  }
+
+  if (!fails)
+  {
+    retval = ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-6),
+                                SUN_RCONST(1.0e-10));
+    if (retval)
+    {
+      fprintf(stderr, "ARKodeSStolerances returned %i\n", retval);
+    }
+    if (!retval)
+    {
+      retval = ARKodeSetLinearSolver(arkode_mem, LS, A);
+      if (retval)
+      {
+        fprintf(stderr, "ARKodeSetLinearSolver returned %i\n", retval);
+      }
+    }
+    if (!retval)
+    {
+      retval = ARKodeSetJacSparsity(arkode_mem, S);
+      if (retval)
+      {
+        fprintf(stderr, "ARKodeSetJacSparsity returned %i\n", retval);
+      }
+    }
+    if (!retval)
+    {
+      retval = ARKodeEvolve(arkode_mem, ONE, y, &tret, ARK_NORMAL);
+      if (retval < 0)
+      {
+        fprintf(stderr, "ARKodeEvolve returned %i\n", retval);
+      }
+      else { retval = 0; }
+    }
+    if (retval) { fails++; }
+  }
+
+  if (!fails)
+  {
+    retval = ARKodeGetJac(arkode_mem, &Jac);
+    if (!retval) { retval = ARKodeGetNumJacEvals(arkode_mem, &nje); }
+    if (!retval) { retval = ARKodeGetNumLinRhsEvals(arkode_mem, &nfeLS); }
+    if (retval)
+    {
+      fprintf(stderr, "Getting the Jacobian statistics failed\n");
+      fails++;
+    }
+  }
+
+  if (!fails) { fails += check_sparsedq(Jac, ZERO, ONE, nje, nfeLS, ncolors); }
+
+  ARKodeFree(&arkode_mem);
+  N_VDestroy(y);
+
+  return fails;
+}
+
+/* Main program */
+int main(int argc, char* argv[]) { return run_sparsedq_tests(solve); }
+
+/*---- end of file ----*/
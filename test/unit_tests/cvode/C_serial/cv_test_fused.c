@@ -0,0 +1,276 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the CPU fused integrator kernels. A system of decoupled linear
+ * ODEs is solved with the diagonal linear solver and constraints, with and
+ * without fused kernels, using scalar and vector absolute tolerances. As
+ * roundoff differences may change the step sequence, the solutions must agree
+ * to within the integration tolerances. Calls to vector operations that only
+ * the unfused code paths use are counted to check that the fused kernels ran.
+ * Enabling the fused kernels must fail before CVodeInit and for a vector the
+ * kernels do not support.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "cvode/cvode_diag.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sundials/sundials_nvector.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define NEQ  100
+#define RTOL SUN_RCONST(1.0e-6)
+#define ATOL SUN_RCONST(1.0e-8)
+
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunindextype i;
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+
+  /* y_i' = -k_i y_i with rates k_i from 1 to 1000 */
+  for (i = 0; i < NEQ; i++)
+  {
+    ydot_data[i] = -SUNRpowerR(SUN_RCONST(1000.0), (sunrealtype)i / (NEQ - 1)) *
+                   y_data[i];
+  }
+
+  return 0;
+}
+
+/* Number of calls to vector operations that only the unfused kernels use */
+static long int num_unfused_ops = 0;
+
+static void count_addconst(N_Vector x, sunrealtype b, N_Vector z)
+{
+  num_unfused_ops++;
+  N_VAddConst_Serial(x, b, z);
+}
+
+static void count_compare(sunrealtype c, N_Vector x, N_Vector z)
+{
+  num_unfused_ops++;
+  N_VCompare_Serial(c, x, z);
+}
+
+/* Integrates to tf and returns the solution in y, returns nonzero on failure */
+static int solve(SUNContext sunctx, sunbooleantype usefused,
+                 sunbooleantype vector_atol, N_Vector y)
+{
+  int flag            = 0;
+  void* cvode_mem     = NULL;
+  N_Vector atol       = NULL;
+  N_Vector constraint = NULL;
+  sunrealtype tret    = ZERO;
+  sunrealtype tf      = SUN_RCONST(2.0);
+
+  N_VConst(ONE, y);
+
+  /* clones of y, including the vectors created by CVODE, count the calls */
+  y->ops->nvaddconst = count_addconst;
+  y->ops->nvcompare  = count_compare;
+  num_unfused_ops    = 0;
+
+  atol       = N_VClone(y);
+  constraint = N_VClone(y);
+  cvode_mem  = CVodeCreate(CV_BDF, sunctx);
+  if (!atol || !constraint || !cvode_mem) { flag = 1; }
+
+  if (!flag)
+  {
+    N_VConst(ATOL, atol);
+    N_VConst(ONE, constraint); /* y_i >= 0 */
+    flag = CVodeInit(cvode_mem, ode_rhs, ZERO, y);
+  }
+
+  if (!flag)
+  {
+    if (vector_atol) { flag = CVodeSVtolerances(cvode_mem, RTOL, atol); }
+    else { flag = CVodeSStolerances(cvode_mem, RTOL, ATOL); }
+  }
+
+  if (!flag) { flag = CVDiag(cvode_mem); }
+
+  if (!flag) { flag = CVodeSetConstraints(cvode_mem, constraint); }
+
+  if (!flag)
+  {
+    flag = CVodeSetUseIntegratorFusedKernels(cvode_mem, usefused);
+    if (flag)
+    {
+      printf("ERROR: CVodeSetUseIntegratorFusedKernels returned %i\n", flag);
+    }
+  }
+
+  if (!flag)
+  {
+    flag = CVode(cvode_mem, tf, y, &tret, CV_NORMAL);
+    if (flag < 0) { printf("ERROR: CVode returned %i\n", flag); }
+    else { flag = 0; }
+  }
+
+  /* the fused kernels replace every use of these operations */
+  if (!flag && usefused && num_unfused_ops > 0)
+  {
+    printf("ERROR: %li calls to unfused vector operations with fused kernels\n",
+           num_unfused_ops);
+    flag = 1;
+  }
+  if (!flag && !usefused && num_unfused_ops == 0)
+  {
+    printf("ERROR: no calls to unfused vector operations were counted\n");
+    flag = 1;
+  }
+
+  CVodeFree(&cvode_mem);
+  N_VDestroy(atol);
+  N_VDestroy(constraint);
+
+  return flag ? 1 : 0;
+}
+
+static N_Vector_ID custom_id(N_Vector v) { return SUNDIALS_NVEC_CUSTOM; }
+
+/* Checks that the fused kernels are rejected before CVodeInit and for a vector
+   with an unsupported ID, returns nonzero on failure */
+static int check_unsupported(SUNContext sunctx)
+{
+  int flag        = 0;
+  void* cvode_mem = NULL;
+  N_Vector y      = NULL;
+
+  y         = N_VNew_Serial(NEQ, sunctx);
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!y || !cvode_mem) { flag = 1; }
+
+  if (!flag)
+  {
+    flag = CVodeSetUseIntegratorFusedKernels(cvode_mem, SUNTRUE);
+    if (flag != CV_NO_MALLOC)
+    {
+      printf("ERROR: CVodeSetUseIntegratorFusedKernels before CVodeInit "
+             "returned %i\n",
+             flag);
+      flag = 1;
+    }
+    else { flag = 0; }
+  }
+
+  if (!flag)
+  {
+    /* clones of y, including the vectors created by CVODE, have the ID */
+    y->ops->nvgetvectorid = custom_id;
+    N_VConst(ONE, y);
+    flag = CVodeInit(cvode_mem, ode_rhs, ZERO, y);
+  }
+
+  if (!flag)
+  {
+    flag = CVodeSetUseIntegratorFusedKernels(cvode_mem, SUNTRUE);
+    if (flag != CV_ILL_INPUT)
+    {
+      printf("ERROR: CVodeSetUseIntegratorFusedKernels with an unsupported "
+             "vector returned %i\n",
+             flag);
+      flag = 1;
+    }
+    else { flag = 0; }
+  }
+
+  CVodeFree(&cvode_mem);
+  N_VDestroy(y);
+
+  return flag;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  N_Vector y_ref    = NULL;
+  N_Vector y_fused  = NULL;
+
+  int flag = 0;
+  int k    = 0;
+  sunindextype i;
+  sunrealtype err;
+  sunrealtype* ref_data;
+  sunrealtype* fused_data;
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", flag);
+    return 1;
+  }
+
+  y_ref   = N_VNew_Serial(NEQ, sunctx);
+  y_fused = N_VNew_Serial(NEQ, sunctx);
+  if (!y_ref || !y_fused)
+  {
+    fprintf(stderr, "N_VNew_Serial failed\n");
+    N_VDestroy(y_ref);
+    N_VDestroy(y_fused);
+    SUNContext_Free(&sunctx);
+    return 1;
+  }
+
+  flag = check_unsupported(sunctx);
+
+  /* k = 0 uses scalar and k = 1 vector absolute tolerances */
+  for (k = 0; k < 2 && !flag; k++)
+  {
+    flag = solve(sunctx, SUNFALSE, k, y_ref);
+    if (flag) { break; }
+
+    flag = solve(sunctx, SUNTRUE, k, y_fused);
+    if (flag) { break; }
+
+    ref_data   = N_VGetArrayPointer(y_ref);
+    fused_data = N_VGetArrayPointer(y_fused);
+
+    err = ZERO;
+    for (i = 0; i < NEQ; i++)
+    {
+      err = SUNMAX(err, SUNRabs(fused_data[i] - ref_data[i]) /
+                          (RTOL * SUNRabs(ref_data[i]) + ATOL));
+    }
+
+    printf("%s tolerances: max weighted difference = %" GSYM "\n",
+           k ? "vector" : "scalar", err);
+
+    if (err > ONE)
+    {
+      printf("ERROR: Fused and unfused solutions differ!\n");
+      flag = 1;
+    }
+  }
+
+  N_VDestroy(y_ref);
+  N_VDestroy(y_fused);
+  SUNContext_Free(&sunctx);
+
+  if (!flag) { printf("SUCCESS\n"); }
+
+  return flag;
+}
+
+/*---- end of file ----*/
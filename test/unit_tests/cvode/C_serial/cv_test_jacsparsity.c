@@ -0,0 +1,209 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for CVodeComputeJacSparsity. The right-hand side couples each
+ * component to its neighbors and to the mirrored component,
+ *
+ *   f_i = y_{i-1} - 2 y_i + y_{i+1} + y_i * y_{N-1-i},
+ *
+ * so the pattern of df/dy is tridiagonal plus the anti-diagonal. The pattern
+ * is detected in CSC and CSR format, once with NaN probing and once with an
+ * f that rejects NaN input so that finite increments are used. All components
+ * of y are larger than 2 so that no entry of df/dy vanishes, which finite
+ * increments could not detect.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "cvode/cvode_ls.h"
+#include "nvector/nvector_serial.h"
+#include "sunmatrix/sunmatrix_sparse.h"
+
+#define NEQ 20
+
+#define TWO SUN_RCONST(2.0)
+
+/* Right-hand side, returns a recoverable failure for NaN input when the
+   user data flag is set */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  int i;
+  int reject     = *((int*)user_data);
+  sunrealtype* u = N_VGetArrayPointer(y);
+  sunrealtype* r = N_VGetArrayPointer(ydot);
+
+  for (i = 0; i < NEQ; i++)
+  {
+    if (reject && u[i] != u[i]) { return 1; }
+  }
+
+  for (i = 0; i < NEQ; i++)
+  {
+    r[i] = -TWO * u[i] + u[i] * u[NEQ - 1 - i];
+    if (i > 0) { r[i] += u[i - 1]; }
+    if (i < NEQ - 1) { r[i] += u[i + 1]; }
+  }
+
+  return 0;
+}
+
+/* Does f_i depend on y_j */
+static int depends(sunindextype i, sunindextype j)
+{
+  return (i - j <= 1 && j - i <= 1) || (i + j == NEQ - 1);
+}
+
+/* Check that S holds exactly the expected pattern */
+static int check_pattern(SUNMatrix S, int sparsetype)
+{
+  sunindextype k, p, q, count;
+  sunindextype* ptrs = SUNSparseMatrix_IndexPointers(S);
+  sunindextype* idx  = SUNSparseMatrix_IndexValues(S);
+
+  if (SUNSparseMatrix_SparseType(S) != sparsetype)
+  {
+    fprintf(stderr, "wrong sparse type\n");
+    return 1;
+  }
+
+  count = 0;
+  for (k = 0; k < NEQ; k++)
+  {
+    for (p = ptrs[k]; p < ptrs[k + 1]; p++)
+    {
+      /* (k, idx[p]) is (column, row) for CSC and (row, column) for CSR */
+      if ((sparsetype == CSC_MAT && !depends(idx[p], k)) ||
+          (sparsetype == CSR_MAT && !depends(k, idx[p])))
+      {
+        fprintf(stderr, "unexpected entry (%ld, %ld)\n", (long int)k,
+                (long int)idx[p]);
+        return 1;
+      }
+      for (q = ptrs[k]; q < p; q++)
+      {
+        if (idx[q] == idx[p])
+        {
+          fprintf(stderr, "repeated entry (%ld, %ld)\n", (long int)k,
+                  (long int)idx[p]);
+          return 1;
+        }
+      }
+    }
+    count += ptrs[k + 1] - ptrs[k];
+  }
+
+  for (k = 0; k < NEQ * NEQ; k++)
+  {
+    if (depends(k / NEQ, k % NEQ)) { count--; }
+  }
+  if (count != 0 || SUNSparseMatrix_NNZ(S) != ptrs[NEQ])
+  {
+    fprintf(stderr, "wrong number of entries\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int retval        = 0;
+  int fails         = 0;
+  int reject        = 0;
+  int sparsetype    = 0;
+  SUNContext sunctx = NULL;
+  N_Vector y        = NULL;
+  SUNMatrix S       = NULL;
+  void* cvode_mem   = NULL;
+  sunindextype i;
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  /* Create the state vector */
+  y = N_VNew_Serial(NEQ, sunctx);
+  if (!y)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+  for (i = 0; i < NEQ; i++)
+  {
+    N_VGetArrayPointer(y)[i] = SUN_RCONST(3.0) + i / SUN_RCONST(10.0);
+  }
+
+  /* Create CVODE mem structure */
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem)
+  {
+    fprintf(stderr, "CVodeCreate returned NULL\n");
+    return 1;
+  }
+
+  retval = CVodeInit(cvode_mem, f, SUN_RCONST(0.0), y);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeInit returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSetUserData(cvode_mem, &reject);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetUserData returned %i\n", retval);
+    return 1;
+  }
+
+  /* Detect the pattern with NaN and finite probing in both formats */
+  for (reject = 0; reject < 2; reject++)
+  {
+    for (sparsetype = CSC_MAT; sparsetype <= CSR_MAT; sparsetype++)
+    {
+      retval = CVodeComputeJacSparsity(cvode_mem, SUN_RCONST(0.0), y,
+                                       sparsetype, &S);
+      if (retval)
+      {
+        fprintf(stderr, "CVodeComputeJacSparsity returned %i\n", retval);
+        fails++;
+        continue;
+      }
+      if (check_pattern(S, sparsetype))
+      {
+        fprintf(stderr, "FAILED: reject NaN %d, sparse type %d\n", reject,
+                sparsetype);
+        fails++;
+      }
+      SUNMatDestroy(S);
+      S = NULL;
+    }
+  }
+
+  /* Clean up */
+  CVodeFree(&cvode_mem);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  if (fails) { return 1; }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
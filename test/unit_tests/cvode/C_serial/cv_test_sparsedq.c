@@ -0,0 +1,119 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the sparse difference quotient Jacobian set up with
+ * CVodeSetJacSparsity. The right-hand side is f = J y with J from the shared
+ * fixture in test_sparsedq.h, and the saved Jacobian is compared with J. Each
+ * Jacobian evaluation must call f once per color of the pattern.
+ * ---------------------------------------------------------------------------*/
+
+#include "cvode/cvode.h"
+#include "cvode/cvode_ls.h"
+
+#include "../../utilities/test_sparsedq.h"
+
+/* Right-hand side f = J y */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  jac_times(y, ydot);
+  return 0;
+}
+
+/* Solve with a sparse DQ Jacobian and check the Jacobian and the number of
+   right-hand side evaluations */
+static int solve(SUNMatrix A, SUNMatrix S, SUNLinearSolver LS,
+                 sunindextype ncolors, SUNContext sunctx)
+{
+  int retval      = 0;
+  int fails       = 0;
+  N_Vector y      = NULL;
+  SUNMatrix Jac   = NULL;
+  void* cvode_mem = NULL;
+  sunrealtype tret;
+  long int nje, nfeLS;
+
+  y = N_VNew_Serial(NEQ, sunctx);
+  if (!y)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+  N_VConst(ONE, y);
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem)
+  {
+    fprintf(stderr, "CVodeCreate returned NULL\n");
+    fails++;
+  }
+
+  if (!fails)
+  {
+    retval = CVodeInit(cvode_mem, f, ZERO, y);
+    if (retval) { fprintf(stderr, "CVodeInit returned %i\n", retval); }
+    if (!retval)
+    {
+      retval = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6),
+                                 SUN_RCONST(1.0e-10));
+      if (retval)
+      {
+        fprintf(stderr, "CVodeSStolerances returned %i\n", retval);
+      }
+    }
+    if (!retval)
+    {
+      retval = CVodeSetLinearSolver(cvode_mem, LS, A);
+      if (retval)
+      {
+        fprintf(stderr, "CVodeSetLinearSolver returned %i\n", retval);
+      }
+    }
+    if (!retval)
+    {
+      retval = CVodeSetJacSparsity(cvode_mem, S);
+      if (retval)
+      {
+        fprintf(stderr, "CVodeSetJacSparsity returned %i\n", retval);
+      }
+    }
+    if (!retval)
+    {
+      retval = CVode(cvode_mem, ONE, y, &tret, CV_NORMAL);
+      if (retval < 0) { fprintf(stderr, "CVode returned %i\n", retval); }
+      else { retval = 0; }
+    }
+    if (retval) { fails++; }
+  }
+
+  if (!fails)
+  {
+    retval = CVodeGetJac(cvode_mem, &Jac);
+    if (!retval) { retval = CVodeGetNumJacEvals(cvode_mem, &nje); }
+    if (!retval) { retval = CVodeGetNumLinRhsEvals(cvode_mem, &nfeLS); }
+    if (retval)
+    {
+      fprintf(stderr, "Getting the Jacobian statistics failed\n");
+      fails++;
+    }
+  }
+
+  if (!fails) { fails += check_sparsedq(Jac, ZERO, ONE, nje, nfeLS, ncolors); }
+
+  CVodeFree(&cvode_mem);
+  N_VDestroy(y);
+
+  return fails;
+}
+
+/* Main program */
+int main(int argc, char* argv[]) { return run_sparsedq_tests(solve); }
+
+/*---- end of file ----*/
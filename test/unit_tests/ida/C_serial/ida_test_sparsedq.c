@@ -0,0 +1,129 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the sparse difference quotient Jacobian set up with
+ * IDASetJacSparsity. The residual is F = y' - J y with J from the shared
+ * fixture in test_sparsedq.h, and the system Jacobian of the last setup is
+ * compared with c_j I - J. Each Jacobian evaluation must call the residual
+ * once per color of the pattern.
+ * ---------------------------------------------------------------------------*/
+
+#include "ida/ida.h"
+#include "ida/ida_ls.h"
+
+#include "../../utilities/test_sparsedq.h"
+
+/* Residual F = y' - J y */
+static int res(sunrealtype t, N_Vector y, N_Vector yp, N_Vector rr,
+               void* user_data)
+{
+  jac_times(y, rr);
+  N_VLinearSum(ONE, yp, -ONE, rr, rr);
+  return 0;
+}
+
+/* Solve with a sparse DQ Jacobian and check the Jacobian and the number of
+   residual evaluations */
+static int solve(SUNMatrix A, SUNMatrix S, SUNLinearSolver LS,
+                 sunindextype ncolors, SUNContext sunctx)
+{
+  int retval    = 0;
+  int fails     = 0;
+  N_Vector y    = NULL;
+  N_Vector yp   = NULL;
+  SUNMatrix Jac = NULL;
+  void* ida_mem = NULL;
+  sunrealtype tret, cj;
+  long int nje, nreLS;
+
+  y  = N_VNew_Serial(NEQ, sunctx);
+  yp = N_VNew_Serial(NEQ, sunctx);
+  if (!y || !yp)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    N_VDestroy(y);
+    N_VDestroy(yp);
+    return 1;
+  }
+  N_VConst(ONE, y);
+  jac_times(y, yp);
+
+  ida_mem = IDACreate(sunctx);
+  if (!ida_mem)
+  {
+    fprintf(stderr, "IDACreate returned NULL\n");
+    fails++;
+  }
+
+  if (!fails)
+  {
+    retval = IDAInit(ida_mem, res, ZERO, y, yp);
+    if (retval) { fprintf(stderr, "IDAInit returned %i\n", retval); }
+    if (!retval)
+    {
+      retval = IDASStolerances(ida_mem, SUN_RCONST(1.0e-6),
+                               SUN_RCONST(1.0e-10));
+      if (retval)
+      {
+        fprintf(stderr, "IDASStolerances returned %i\n", retval);
+      }
+    }
+    if (!retval)
+    {
+      retval = IDASetLinearSolver(ida_mem, LS, A);
+      if (retval)
+      {
+        fprintf(stderr, "IDASetLinearSolver returned %i\n", retval);
+      }
+    }
+    if (!retval)
+    {
+      retval = IDASetJacSparsity(ida_mem, S);
+      if (retval)
+      {
+        fprintf(stderr, "IDASetJacSparsity returned %i\n", retval);
+      }
+    }
+    if (!retval)
+    {
+      retval = IDASolve(ida_mem, ONE, &tret, y, yp, IDA_NORMAL);
+      if (retval < 0) { fprintf(stderr, "IDASolve returned %i\n", retval); }
+      else { retval = 0; }
+    }
+    if (retval) { fails++; }
+  }
+
+  if (!fails)
+  {
+    retval = IDAGetJac(ida_mem, &Jac);
+    if (!retval) { retval = IDAGetJacCj(ida_mem, &cj); }
+    if (!retval) { retval = IDAGetNumJacEvals(ida_mem, &nje); }
+    if (!retval) { retval = IDAGetNumLinResEvals(ida_mem, &nreLS); }
+    if (retval)
+    {
+      fprintf(stderr, "Getting the Jacobian statistics failed\n");
+      fails++;
+    }
+  }
+
+  if (!fails) { fails += check_sparsedq(Jac, cj, -ONE, nje, nreLS, ncolors); }
+
+  IDAFree(&ida_mem);
+  N_VDestroy(y);
+  N_VDestroy(yp);
+
+  return fails;
+}
+
+/* Main program */
+int main(int argc, char* argv[]) { return run_sparsedq_tests(solve); }
+
+/*---- end of file ----*/
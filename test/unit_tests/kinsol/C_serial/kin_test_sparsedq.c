@@ -0,0 +1,132 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the sparse difference quotient Jacobian set up with
+ * KINSetJacSparsity. The system is F(u) = J u - b with J from the shared
+ * fixture in test_sparsedq.h and b = J 1, and the saved Jacobian is compared
+ * with J. The initial guess is 1/2 so that the default maximum Newton step
+ * does not limit the first step. Each Jacobian evaluation must call F once per
+ * color of the pattern.
+ * ---------------------------------------------------------------------------*/
+
+#include "kinsol/kinsol.h"
+#include "kinsol/kinsol_ls.h"
+
+#include "../../utilities/test_sparsedq.h"
+
+/* System function F = J u - b, the right-hand side b is the user data */
+static int func(N_Vector u, N_Vector fval, void* user_data)
+{
+  N_Vector b = (N_Vector)user_data;
+
+  jac_times(u, fval);
+  N_VLinearSum(ONE, fval, -ONE, b, fval);
+
+  return 0;
+}
+
+/* Solve with a sparse DQ Jacobian and check the Jacobian and the number of
+   system function evaluations */
+static int solve(SUNMatrix A, SUNMatrix S, SUNLinearSolver LS,
+                 sunindextype ncolors, SUNContext sunctx)
+{
+  int retval     = 0;
+  int fails      = 0;
+  N_Vector u     = NULL;
+  N_Vector b     = NULL;
+  N_Vector scale = NULL;
+  SUNMatrix Jac  = NULL;
+  void* kin_mem  = NULL;
+  long int nje, nfeLS;
+
+  u     = N_VNew_Serial(NEQ, sunctx);
+  b     = N_VNew_Serial(NEQ, sunctx);
+  scale = N_VNew_Serial(NEQ, sunctx);
+  if (!u || !b || !scale)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    fails++;
+  }
+
+  if (!fails)
+  {
+    N_VConst(ONE, scale);
+    jac_times(scale, b);
+    N_VConst(HALF, u);
+
+    kin_mem = KINCreate(sunctx);
+    if (!kin_mem)
+    {
+      fprintf(stderr, "KINCreate returned NULL\n");
+      fails++;
+    }
+  }
+
+  if (!fails)
+  {
+    retval = KINInit(kin_mem, func, u);
+    if (retval) { fprintf(stderr, "KINInit returned %i\n", retval); }
+    if (!retval)
+    {
+      retval = KINSetUserData(kin_mem, b);
+      if (retval) { fprintf(stderr, "KINSetUserData returned %i\n", retval); }
+    }
+    if (!retval)
+    {
+      retval = KINSetLinearSolver(kin_mem, LS, A);
+      if (retval)
+      {
+        fprintf(stderr, "KINSetLinearSolver returned %i\n", retval);
+      }
+    }
+    if (!retval)
+    {
+      retval = KINSetJacSparsity(kin_mem, S);
+      if (retval)
+      {
+        fprintf(stderr, "KINSetJacSparsity returned %i\n", retval);
+      }
+    }
+    if (!retval)
+    {
+      retval = KINSol(kin_mem, u, KIN_NONE, scale, scale);
+      if (retval < 0) { fprintf(stderr, "KINSol returned %i\n", retval); }
+      else { retval = 0; }
+    }
+    if (retval) { fails++; }
+  }
+
+  if (!fails)
+  {
+    retval = KINGetJac(kin_mem, &Jac);
+    if (!retval) { retval = KINGetNumJacEvals(kin_mem, &nje); }
+    if (!retval) { retval = KINGetNumLinFuncEvals(kin_mem, &nfeLS); }
+    if (retval)
+    {
+      fprintf(stderr, "Getting the Jacobian statistics failed\n");
+      fails++;
+    }
+  }
+
+  if (!fails) { fails += check_sparsedq(Jac, ZERO, ONE, nje, nfeLS, ncolors); }
+
+  KINFree(&kin_mem);
+  N_VDestroy(u);
+  N_VDestroy(b);
+  N_VDestroy(scale);
+
+  return fails;
+}
+
+/* Main program */
+int main(int argc, char* argv[]) { return run_sparsedq_tests(solve); }
+
+/*---- end of file ----*/
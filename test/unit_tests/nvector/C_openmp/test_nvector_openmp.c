@@ -15,6 +15,11 @@
  * implementation.
  * -----------------------------------------------------------------*/
 
+/* needed for sched_getaffinity on Linux */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include <nvector/nvector_openmp.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -23,6 +28,25 @@
 
 #include "test_nvector.h"
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+/* ----------------------------------------------------------------------
+ * Returns the number of CPUs the calling thread may run on, or -1 if
+ * unknown
+ * --------------------------------------------------------------------*/
+static int num_allowed_cpus(void)
+{
+#if defined(__linux__)
+  cpu_set_t mask;
+  if (sched_getaffinity(0, sizeof(mask), &mask)) { return -1; }
+  return CPU_COUNT(&mask);
+#else
+  return -1;
+#endif
+}
+
 /* ----------------------------------------------------------------------
  * Main NVector Testing Routine
  * --------------------------------------------------------------------*/
@@ -34,6 +58,8 @@ int main(int argc, char* argv[])
   N_Vector U, V, W, X, Y, Z; /* test vectors              */
   int print_timing;          /* turn timing on/off        */
   int nthreads;              /* number of OpenMP threads  */
+  sunindextype i;            /* loop index                */
+  int ncpus;                 /* CPUs of calling thread    */
 
   Test_Init(SUN_COMM_NULL);
 
@@ -101,6 +127,10 @@ int main(int argc, char* argv[])
   fails += Test_N_VSetArrayPointer(W, length, 0);
   fails += Test_N_VGetArrayPointer(X, length, 0);
 
+  /* Test views of a range of the data */
+  fails += Test_N_VMakeView(X, N_VMakeView_OpenMP(X, length / 4, length / 2),
+                            length / 4, length / 2, 0);
+
   /* Clone additional vectors for testing */
   Y = N_VClone(X);
   if (Y == NULL)
@@ -164,6 +194,8 @@ int main(int argc, char* argv[])
   fails += Test_N_VLinearCombination(U, length, 0);
   fails += Test_N_VScaleAddMulti(U, length, 0);
   fails += Test_N_VDotProdMulti(U, length, 0);
+  fails += Test_N_VLinearSumWrmsNorm(U, length, 0);
+  fails += Test_N_VLinearCombinationWrmsNorm(U, length, 0);
 
   /* vector array operations */
   fails += Test_N_VLinearSumVectorArray(U, length, 0);
@@ -195,6 +227,9 @@ int main(int argc, char* argv[])
   fails += Test_N_VLinearCombination(V, length, 0);
   fails += Test_N_VScaleAddMulti(V, length, 0);
   fails += Test_N_VDotProdMulti(V, length, 0);
+  fails += Test_N_VLinearSumWrmsNorm(V, length, 0);
+  fails += Test_N_VLinearCombinationWrmsNorm(V, length, 0);
+  fails += Test_N_VCloneVectorArrayContiguous(6, V, length, 0);
 
   /* vector array operations */
   fails += Test_N_VLinearSumVectorArray(V, length, 0);
@@ -237,6 +272,198 @@ int main(int argc, char* argv[])
   N_VDestroy(U);
   N_VDestroy(V);
 
+  /* Standard vector operation tests (deferred) */
+  printf("\nTesting standard vector operations (deferred):\n\n");
+
+  /* create vectors sharing a recorder for deferred operations */
+  X      = N_VNew_OpenMP(length, nthreads, sunctx);
+  retval = N_VEnableDeferredOps_OpenMP(X, SUNTRUE);
+  if (X == NULL || retval != 0)
+  {
+    printf("FAIL: Unable to create a new vector \n\n");
+    Test_Finalize();
+    return (1);
+  }
+
+  Y = N_VClone(X);
+  Z = N_VClone(X);
+  if (Y == NULL || Z == NULL)
+  {
+    N_VDestroy(X);
+    if (Y) { N_VDestroy(Y); }
+    if (Z) { N_VDestroy(Z); }
+    printf("FAIL: Unable to create a new vector \n\n");
+    Test_Finalize();
+    return (1);
+  }
+
+  fails += Test_N_VConst(X, length, 0);
+  fails += Test_N_VLinearSum(X, Y, Z, length, 0);
+  fails += Test_N_VProd(X, Y, Z, length, 0);
+  fails += Test_N_VDiv(X, Y, Z, length, 0);
+  fails += Test_N_VScale(X, Z, length, 0);
+  fails += Test_N_VAbs(X, Z, length, 0);
+  fails += Test_N_VInv(X, Z, length, 0);
+  fails += Test_N_VAddConst(X, Z, length, 0);
+  fails += Test_N_VDotProd(X, Y, length, 0);
+  fails += Test_N_VMaxNorm(X, length, 0);
+  fails += Test_N_VWrmsNorm(X, Y, length, 0);
+  fails += Test_N_VWrmsNormMask(X, Y, Z, length, 0);
+  fails += Test_N_VMin(X, length, 0);
+  fails += Test_N_VWL2Norm(X, Y, length, 0);
+  fails += Test_N_VL1Norm(X, length, 0);
+  fails += Test_N_VCompare(X, Z, length, 0);
+  fails += Test_N_VInvTest(X, Z, length, 0);
+  fails += Test_N_VConstrMask(X, Y, Z, length, 0);
+  fails += Test_N_VMinQuotient(X, Y, length, 0);
+
+  /* Test views of a vector with deferred operations */
+  fails += Test_N_VMakeViewDeferred(X, N_VMakeView_OpenMP(X, length / 4,
+                                                       length / 2),
+                                    length / 2, 0);
+
+  N_VDestroy(X);
+  N_VDestroy(Y);
+  N_VDestroy(Z);
+
+  /* Standard vector operation tests (thread affinity) */
+  printf("\nTesting standard vector operations (thread affinity):\n\n");
+
+  ncpus = num_allowed_cpus();
+
+  /* create vectors with pinned threads, clones keep the affinity policy */
+  X = N_VNewWithAffinity_OpenMP(length, nthreads, SUN_AFFINITY_SPREAD, sunctx);
+  if (X == NULL)
+  {
+    printf("FAIL: Unable to create a new vector \n\n");
+    Test_Finalize();
+    return (1);
+  }
+
+  Y = N_VClone(X);
+  Z = N_VClone(X);
+  if (Y == NULL || Z == NULL)
+  {
+    N_VDestroy(X);
+    if (Y) { N_VDestroy(Y); }
+    if (Z) { N_VDestroy(Z); }
+    printf("FAIL: Unable to create a new vector \n\n");
+    Test_Finalize();
+    return (1);
+  }
+
+  if (NV_AFFINITY_OMP(Y) != SUN_AFFINITY_SPREAD)
+  {
+    printf(">>> FAILED test -- N_VClone, affinity policy not preserved \n");
+    fails++;
+  }
+  else { printf("PASSED test -- N_VClone affinity policy \n"); }
+
+  /* the CPU mask of the calling thread is not changed */
+  if (num_allowed_cpus() != ncpus)
+  {
+    printf(">>> FAILED test -- affinity policy, calling thread pinned \n");
+    fails++;
+  }
+  else
+  {
+    printf("PASSED test -- affinity policy, calling thread not pinned \n");
+  }
+
+  fails += Test_N_VConst(X, length, 0);
+  fails += Test_N_VLinearSum(X, Y, Z, length, 0);
+  fails += Test_N_VDotProd(X, Y, length, 0);
+  fails += Test_N_VWrmsNorm(X, Y, length, 0);
+  fails += Test_N_VMin(X, length, 0);
+
+  N_VDestroy(X);
+  N_VDestroy(Y);
+  N_VDestroy(Z);
+
+  /* Standard vector operation tests (reproducible reductions) */
+  printf("\nTesting standard vector operations (reproducible reductions):\n\n");
+
+  /* create vectors with reproducible reductions, clones keep the setting */
+  X = N_VNew_OpenMP(length, nthreads, sunctx);
+  U = N_VNew_OpenMP(length, 1, sunctx);
+  if (X == NULL || U == NULL)
+  {
+    if (X) { N_VDestroy(X); }
+    if (U) { N_VDestroy(U); }
+    printf("FAIL: Unable to create a new vector \n\n");
+    Test_Finalize();
+    return (1);
+  }
+
+  retval = N_VEnableFusedOps_OpenMP(X, SUNTRUE);
+  retval += N_VEnableReproducibleReductions_OpenMP(X, SUNTRUE);
+  retval += N_VEnableReproducibleReductions_OpenMP(U, SUNTRUE);
+  if (retval != 0)
+  {
+    N_VDestroy(X);
+    N_VDestroy(U);
+    printf("FAIL: Unable to enable reproducible reductions \n\n");
+    Test_Finalize();
+    return (1);
+  }
+
+  Y = N_VClone(X);
+  Z = N_VClone(X);
+  V = N_VClone(U);
+  if (Y == NULL || Z == NULL || V == NULL)
+  {
+    N_VDestroy(X);
+    N_VDestroy(U);
+    if (Y) { N_VDestroy(Y); }
+    if (Z) { N_VDestroy(Z); }
+    if (V) { N_VDestroy(V); }
+    printf("FAIL: Unable to create a new vector \n\n");
+    Test_Finalize();
+    return (1);
+  }
+
+  if (!NV_REPRODUCIBLE_OMP(Y))
+  {
+    printf(">>> FAILED test -- N_VClone, reproducible reductions not "
+           "preserved \n");
+    fails++;
+  }
+  else { printf("PASSED test -- N_VClone reproducible reductions \n"); }
+
+  fails += Test_N_VDotProd(X, Y, length, 0);
+  fails += Test_N_VWrmsNorm(X, Y, length, 0);
+  fails += Test_N_VWrmsNormMask(X, Y, Z, length, 0);
+  fails += Test_N_VWL2Norm(X, Y, length, 0);
+  fails += Test_N_VL1Norm(X, length, 0);
+  fails += Test_N_VDotProdMulti(X, length, 0);
+  fails += Test_N_VLinearSumWrmsNorm(X, length, 0);
+  fails += Test_N_VLinearCombinationWrmsNorm(X, length, 0);
+  fails += Test_N_VWrmsNormVectorArray(X, length, 0);
+  fails += Test_N_VWrmsNormMaskVectorArray(X, length, 0);
+
+  /* sums with rounding errors must match the single thread sums exactly */
+  for (i = 0; i < length; i++)
+  {
+    NV_Ith_OMP(X, i) = SUN_RCONST(1.0) / (sunrealtype)(i % 7 + 3);
+    NV_Ith_OMP(Y, i) = (i % 2) ? SUN_RCONST(-0.1) : SUN_RCONST(0.3);
+    NV_Ith_OMP(U, i) = NV_Ith_OMP(X, i);
+    NV_Ith_OMP(V, i) = NV_Ith_OMP(Y, i);
+  }
+
+  if (N_VDotProd(X, Y) != N_VDotProd(U, V) ||
+      N_VWrmsNorm(X, Y) != N_VWrmsNorm(U, V) || N_VL1Norm(X) != N_VL1Norm(U))
+  {
+    printf(">>> FAILED test -- reductions differ from single thread \n");
+    fails++;
+  }
+  else { printf("PASSED test -- reductions match single thread \n"); }
+
+  N_VDestroy(U);
+  N_VDestroy(V);
+  N_VDestroy(X);
+  N_VDestroy(Y);
+  N_VDestroy(Z);
+
   /* Print result */
   if (fails) { printf("FAIL: NVector module failed %i tests \n\n", fails); }
   else { printf("SUCCESS: NVector module passed all tests \n\n"); }
@@ -286,7 +513,8 @@ void set_element_range(N_Vector X, sunindextype is, sunindextype ie,
 
 sunrealtype get_element(N_Vector X, sunindextype i)
 {
-  /* get i-th element of data array */
+  /* get i-th element of data array after executing pending operations */
+  N_VFlushDeferredOps_OpenMP(X);
   return NV_Ith_OMP(X, i);
 }
 
@@ -0,0 +1,352 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the testing routine to check the ensemble NVECTOR module
+ * implementation.
+ * -----------------------------------------------------------------*/
+
+#include <nvector/nvector_ensemble.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+
+#include "test_nvector.h"
+
+/* tests of the per-system reductions */
+static int Test_PerSystem_Ensemble(N_Vector X, N_Vector W, N_Vector ID);
+
+/* ----------------------------------------------------------------------
+ * Main NVector Testing Routine
+ * --------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  int fails = 0;          /* counter for test failures  */
+  sunindextype nsys, nsl; /* number and size of systems */
+  sunindextype length;    /* vector length              */
+  N_Vector W, X, Y, Z;    /* test vectors               */
+  int print_timing;       /* turn timing on/off         */
+  sunrealtype* xdata;     /* user data array            */
+
+  Test_Init(SUN_COMM_NULL);
+
+  /* check input and set vector length */
+  if (argc < 4)
+  {
+    printf("ERROR: THREE (3) Inputs required: number of systems, system "
+           "length, print timing \n");
+    Test_Abort(1);
+  }
+
+  nsys = (sunindextype)atol(argv[1]);
+  if (nsys <= 0)
+  {
+    printf("ERROR: number of systems must be a positive integer \n");
+    Test_Abort(1);
+  }
+
+  nsl = (sunindextype)atol(argv[2]);
+  if (nsl <= 0)
+  {
+    printf("ERROR: length of systems must be a positive integer \n");
+    Test_Abort(1);
+  }
+
+  print_timing = atoi(argv[3]);
+  SetTiming(print_timing, 0);
+
+  length = nsys * nsl;
+
+  printf("Testing the ensemble N_Vector \n");
+  printf("Number of systems %ld \n", (long int)nsys);
+  printf("System length %ld \n\n", (long int)nsl);
+
+  /* Create new vectors */
+  W = N_VNewEmpty_Ensemble(nsys, nsl, sunctx);
+  if (W == NULL)
+  {
+    printf("FAIL: Unable to create a new empty vector \n\n");
+    Test_Abort(1);
+  }
+
+  X = N_VNew_Ensemble(nsys, nsl, sunctx);
+  if (X == NULL)
+  {
+    N_VDestroy(W);
+    printf("FAIL: Unable to create a new vector \n\n");
+    Test_Abort(1);
+  }
+
+  /* Check vector ID */
+  fails += Test_N_VGetVectorID(X, SUNDIALS_NVEC_ENSEMBLE, 0);
+
+  /* Check vector length */
+  fails += Test_N_VGetLength(X, 0);
+
+  /* Check vector communicator */
+  fails += Test_N_VGetCommunicator(X, SUN_COMM_NULL, 0);
+
+  /* Test clone functions */
+  fails += Test_N_VCloneEmpty(X, 0);
+  fails += Test_N_VClone(X, length, 0);
+  fails += Test_N_VCloneEmptyVectorArray(5, X, 0);
+  fails += Test_N_VCloneVectorArray(5, X, length, 0);
+
+  /* Test setting/getting array data */
+  fails += Test_N_VSetArrayPointer(W, length, 0);
+  fails += Test_N_VGetArrayPointer(X, length, 0);
+
+  /* Test wrapping user data */
+  xdata = (sunrealtype*)malloc(length * sizeof(sunrealtype));
+  Y     = N_VMake_Ensemble(nsys, nsl, xdata, sunctx);
+  fails += Test_N_VMake(Y, length, 0);
+  N_VDestroy(Y);
+  free(xdata);
+
+  /* Clone additional vectors for testing */
+  Y = N_VClone(X);
+  if (Y == NULL)
+  {
+    N_VDestroy(W);
+    N_VDestroy(X);
+    printf("FAIL: Unable to create a new vector \n\n");
+    Test_Abort(1);
+  }
+
+  Z = N_VClone(X);
+  if (Z == NULL)
+  {
+    N_VDestroy(W);
+    N_VDestroy(X);
+    N_VDestroy(Y);
+    printf("FAIL: Unable to create a new vector \n\n");
+    Test_Abort(1);
+  }
+
+  /* Standard vector operation tests */
+  printf("\nTesting standard vector operations:\n\n");
+
+  fails += Test_N_VConst(X, length, 0);
+  fails += Test_N_VLinearSum(X, Y, Z, length, 0);
+  fails += Test_N_VProd(X, Y, Z, length, 0);
+  fails += Test_N_VDiv(X, Y, Z, length, 0);
+  fails += Test_N_VScale(X, Z, length, 0);
+  fails += Test_N_VAbs(X, Z, length, 0);
+  fails += Test_N_VInv(X, Z, length, 0);
+  fails += Test_N_VAddConst(X, Z, length, 0);
+  fails += Test_N_VDotProd(X, Y, length, 0);
+  fails += Test_N_VMaxNorm(X, length, 0);
+  fails += Test_N_VWrmsNorm(X, Y, length, 0);
+  fails += Test_N_VWrmsNormMask(X, Y, Z, length, 0);
+  fails += Test_N_VMin(X, length, 0);
+  fails += Test_N_VWL2Norm(X, Y, length, 0);
+  fails += Test_N_VL1Norm(X, length, 0);
+  fails += Test_N_VCompare(X, Z, length, 0);
+  fails += Test_N_VInvTest(X, Z, length, 0);
+  fails += Test_N_VConstrMask(X, Y, Z, length, 0);
+  fails += Test_N_VMinQuotient(X, Y, length, 0);
+
+  /* Fused and vector array operations tests (generic implementations) */
+  printf("\nTesting fused and vector array operations:\n\n");
+
+  /* fused operations */
+  fails += Test_N_VLinearCombination(X, length, 0);
+  fails += Test_N_VScaleAddMulti(X, length, 0);
+  fails += Test_N_VDotProdMulti(X, length, 0);
+
+  /* vector array operations */
+  fails += Test_N_VLinearSumVectorArray(X, length, 0);
+  fails += Test_N_VScaleVectorArray(X, length, 0);
+  fails += Test_N_VConstVectorArray(X, length, 0);
+  fails += Test_N_VWrmsNormVectorArray(X, length, 0);
+  fails += Test_N_VWrmsNormMaskVectorArray(X, length, 0);
+  fails += Test_N_VScaleAddMultiVectorArray(X, length, 0);
+  fails += Test_N_VLinearCombinationVectorArray(X, length, 0);
+
+  /* local reduction operations */
+  printf("\nTesting local reduction operations:\n\n");
+
+  fails += Test_N_VDotProdLocal(X, Y, length, 0);
+  fails += Test_N_VMaxNormLocal(X, length, 0);
+  fails += Test_N_VMinLocal(X, length, 0);
+  fails += Test_N_VL1NormLocal(X, length, 0);
+  fails += Test_N_VWSqrSumLocal(X, Y, length, 0);
+  fails += Test_N_VWSqrSumMaskLocal(X, Y, Z, length, 0);
+  fails += Test_N_VInvTestLocal(X, Z, length, 0);
+  fails += Test_N_VConstrMaskLocal(X, Y, Z, length, 0);
+  fails += Test_N_VMinQuotientLocal(X, Y, length, 0);
+
+  /* per-system reduction operations */
+  printf("\nTesting per-system reduction operations:\n\n");
+
+  fails += Test_PerSystem_Ensemble(X, Y, Z);
+
+  /* XBraid interface operations */
+  printf("\nTesting XBraid interface operations:\n\n");
+
+  fails += Test_N_VBufSize(X, length, 0);
+  fails += Test_N_VBufPack(X, length, 0);
+  fails += Test_N_VBufUnpack(X, length, 0);
+
+  /* Free vectors */
+  N_VDestroy(W);
+  N_VDestroy(X);
+  N_VDestroy(Y);
+  N_VDestroy(Z);
+
+  /* Print result */
+  if (fails) { printf("FAIL: NVector module failed %i tests \n\n", fails); }
+  else { printf("SUCCESS: NVector module passed all tests \n\n"); }
+
+  Test_Finalize();
+  return (fails);
+}
+
+/* ----------------------------------------------------------------------
+ * Test the per-system reductions with system s set to -(s+1) except for
+ * its last component which is set to (s+2)
+ * --------------------------------------------------------------------*/
+static int Test_PerSystem_Ensemble(N_Vector X, N_Vector W, N_Vector ID)
+{
+  int fails = 0, failure;
+  sunindextype i, s, nsys, nsl;
+  sunrealtype *vals, sum, ans;
+
+  nsys = N_VGetNumSystems_Ensemble(X);
+  nsl  = N_VGetSystemLength_Ensemble(X);
+  vals = (sunrealtype*)malloc(nsys * sizeof(sunrealtype));
+
+  N_VConst(ONE, W);
+  N_VConst(ONE, ID);
+  for (s = 0; s < nsys; s++)
+  {
+    for (i = 0; i < nsl - 1; i++) { NV_SYS_Ith_EN(X, s, i) = -(s + 1); }
+    NV_SYS_Ith_EN(X, s, nsl - 1) = s + 2;
+
+    /* mask out the last component of the odd systems */
+    if (s % 2) { NV_SYS_Ith_EN(ID, s, nsl - 1) = ZERO; }
+  }
+
+  /* dot product of each system with itself */
+  failure = N_VDotProdPerSystem_Ensemble(X, X, vals);
+  for (s = 0; s < nsys; s++)
+  {
+    ans = (nsl - 1) * SUNSQR((sunrealtype)(s + 1)) +
+          SUNSQR((sunrealtype)(s + 2));
+    failure += SUNRCompare(vals[s], ans);
+  }
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VDotProdPerSystem_Ensemble \n");
+    fails++;
+  }
+  else { printf("PASSED test -- N_VDotProdPerSystem_Ensemble \n"); }
+
+  /* max norm of each system */
+  failure = N_VMaxNormPerSystem_Ensemble(X, vals);
+  for (s = 0; s < nsys; s++) { failure += SUNRCompare(vals[s], s + 2); }
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VMaxNormPerSystem_Ensemble \n");
+    fails++;
+  }
+  else { printf("PASSED test -- N_VMaxNormPerSystem_Ensemble \n"); }
+
+  /* WRMS norm of each system */
+  failure = N_VWrmsNormPerSystem_Ensemble(X, W, vals);
+  for (s = 0; s < nsys; s++)
+  {
+    sum = (nsl - 1) * SUNSQR((sunrealtype)(s + 1)) +
+          SUNSQR((sunrealtype)(s + 2));
+    failure += SUNRCompare(vals[s], SUNRsqrt(sum / nsl));
+  }
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VWrmsNormPerSystem_Ensemble \n");
+    fails++;
+  }
+  else { printf("PASSED test -- N_VWrmsNormPerSystem_Ensemble \n"); }
+
+  /* masked WRMS norm of each system */
+  failure = N_VWrmsNormMaskPerSystem_Ensemble(X, W, ID, vals);
+  for (s = 0; s < nsys; s++)
+  {
+    sum = (nsl - 1) * SUNSQR((sunrealtype)(s + 1));
+    if (s % 2 == 0) { sum += SUNSQR((sunrealtype)(s + 2)); }
+    failure += SUNRCompare(vals[s], SUNRsqrt(sum / nsl));
+  }
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VWrmsNormMaskPerSystem_Ensemble \n");
+    fails++;
+  }
+  else { printf("PASSED test -- N_VWrmsNormMaskPerSystem_Ensemble \n"); }
+
+  free(vals);
+  return (fails);
+}
+
+/* ----------------------------------------------------------------------
+ * Implementation specific utility functions for vector tests
+ * --------------------------------------------------------------------*/
+int check_ans(sunrealtype ans, N_Vector X, sunindextype local_length)
+{
+  int failure = 0;
+  sunindextype i;
+  sunrealtype* Xdata;
+
+  Xdata = N_VGetArrayPointer(X);
+
+  /* check vector data */
+  for (i = 0; i < local_length; i++) { failure += SUNRCompare(Xdata[i], ans); }
+
+  return (failure > ZERO) ? (1) : (0);
+}
+
+sunbooleantype has_data(N_Vector X)
+{
+  /* check if data array is non-null */
+  return (N_VGetArrayPointer(X) == NULL) ? SUNFALSE : SUNTRUE;
+}
+
+void set_element(N_Vector X, sunindextype i, sunrealtype val)
+{
+  /* set i-th element of data array */
+  set_element_range(X, i, i, val);
+}
+
+void set_element_range(N_Vector X, sunindextype is, sunindextype ie,
+                       sunrealtype val)
+{
+  sunindextype i;
+
+  /* set elements [is,ie] of the data array */
+  sunrealtype* xd = N_VGetArrayPointer(X);
+  for (i = is; i <= ie; i++) { xd[i] = val; }
+}
+
+sunrealtype get_element(N_Vector X, sunindextype i)
+{
+  /* get i-th element of data array */
+  return NV_Ith_EN(X, i);
+}
+
+double max_time(N_Vector X, double time)
+{
+  /* not running in parallel, just return input time */
+  return (time);
+}
+
+void sync_device(N_Vector x)
+{
+  /* not running on GPU, just return */
+  return;
+}
@@ -36,6 +36,12 @@ int main(int argc, char* argv[])
   N_Vector Xsub[2];          /* subvector pointer array   */
   N_Vector U, V, W, X, Y, Z; /* test vectors              */
   int print_timing;          /* turn timing on/off        */
+  int nthreads;              /* subvector threads         */
+  int i;                     /* subvector index           */
+  sunindextype j;            /* element index             */
+  sunrealtype* xdata;        /* subvector data            */
+  sunrealtype* ydata;        /* subvector data            */
+  sunrealtype sums[3];       /* threaded sums             */
 
   Test_Init(SUN_COMM_NULL);
 
@@ -64,11 +70,20 @@ int main(int argc, char* argv[])
   print_timing = atoi(argv[3]);
   SetTiming(print_timing, 0);
 
+  /* optionally operate on the subvectors concurrently */
+  nthreads = (argc > 4) ? atoi(argv[4]) : 1;
+  if (nthreads <= 0)
+  {
+    printf("ERROR: number of threads must be a positive integer \n");
+    Test_Abort(1);
+  }
+
   /* overall length */
   length = len1 + len2;
 
   printf("Testing ManyVector (serial) N_Vector \n");
   printf("Vector lengths: %ld %ld \n", (long int)len1, (long int)len2);
+  printf("Number of threads: %i \n", nthreads);
 
   /* Create subvectors */
   Xsub[0] = N_VNew_Serial(len1, sunctx);
@@ -88,6 +103,14 @@ int main(int argc, char* argv[])
   /* Create a new ManyVector */
   X = N_VNew_ManyVector(2, Xsub, sunctx);
 
+  /* Set the number of threads */
+  retval = N_VSetNumThreads_ManyVector(X, nthreads);
+  if (retval || N_VGetNumThreads_ManyVector(X) != nthreads)
+  {
+    printf(">>> FAILED test -- N_VSetNumThreads_ManyVector\n");
+    fails += 1;
+  }
+
   /* Check vector ID */
   fails += Test_N_VGetVectorID(X, SUNDIALS_NVEC_MANYVECTOR, 0);
 
@@ -144,6 +167,13 @@ int main(int argc, char* argv[])
     Test_Abort(1);
   }
 
+  /* Clones operate on their subvectors with the same number of threads */
+  if (N_VGetNumThreads_ManyVector(Z) != nthreads)
+  {
+    printf(">>> FAILED test -- N_VGetNumThreads_ManyVector\n");
+    fails += 1;
+  }
+
   /* Standard vector operation tests */
   printf("\nTesting standard vector operations:\n\n");
 
@@ -167,6 +197,34 @@ int main(int argc, char* argv[])
   fails += Test_N_VConstrMask(X, Y, Z, length, 0);
   fails += Test_N_VMinQuotient(X, Y, length, 0);
 
+  /* Threaded sums add the subvector contributions in order, so they must
+     match the sums computed with one thread exactly */
+  if (nthreads > 1)
+  {
+    for (i = 0; i < 2; i++)
+    {
+      xdata = N_VGetArrayPointer(N_VGetSubvector_ManyVector(X, i));
+      ydata = N_VGetArrayPointer(N_VGetSubvector_ManyVector(Y, i));
+      for (j = 0; j < N_VGetLength(Xsub[i]); j++)
+      {
+        xdata[j] = (sunrealtype)rand() / (sunrealtype)RAND_MAX;
+        ydata[j] = (sunrealtype)rand() / (sunrealtype)RAND_MAX;
+      }
+    }
+    sums[0] = N_VDotProd(X, Y);
+    sums[1] = N_VWrmsNorm(X, Y);
+    sums[2] = N_VL1Norm(X);
+    N_VSetNumThreads_ManyVector(X, 1);
+    if (N_VDotProd(X, Y) != sums[0] || N_VWrmsNorm(X, Y) != sums[1] ||
+        N_VL1Norm(X) != sums[2])
+    {
+      printf(">>> FAILED test -- threaded sums differ from one thread\n");
+      fails += 1;
+    }
+    else { printf("PASSED test -- threaded sums match one thread\n"); }
+    N_VSetNumThreads_ManyVector(X, nthreads);
+  }
+
   /* Fused and vector array operations tests (disabled) */
   printf("\nTesting fused and vector array operations (disabled):\n\n");
 
@@ -0,0 +1,320 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the testing routine to check the mixed precision NVECTOR
+ * module implementation.
+ * -----------------------------------------------------------------*/
+
+#include <float.h>
+#include <nvector/nvector_mixed.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+
+#include "test_nvector.h"
+
+/* the buffers hold single precision data, see Test_N_VBuf_Mixed */
+static int Test_N_VBuf_Mixed(N_Vector X, sunindextype local_length);
+
+/* ----------------------------------------------------------------------
+ * Main NVector Testing Routine
+ * --------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  int fails = 0;       /* counter for test failures */
+  sunindextype length; /* vector length             */
+  N_Vector W, X, Y, Z; /* test vectors              */
+  int print_timing;    /* turn timing on/off        */
+  int nthreads;        /* number of OpenMP threads  */
+  float* xdata;        /* user data array           */
+
+  Test_Init(SUN_COMM_NULL);
+
+  /* check input and set vector length */
+  if (argc < 4)
+  {
+    printf("ERROR: THREE (3) Inputs required: vector length, number of "
+           "threads, print timing \n");
+    Test_Abort(1);
+  }
+
+  length = (sunindextype)atol(argv[1]);
+  if (length <= 0)
+  {
+    printf("ERROR: length of vector must be a positive integer \n");
+    Test_Abort(1);
+  }
+
+  nthreads = atoi(argv[2]);
+  if (nthreads < 1)
+  {
+    printf("ERROR: number of threads must be at least 1 \n");
+    Test_Abort(1);
+  }
+
+  print_timing = atoi(argv[3]);
+  SetTiming(print_timing, 0);
+
+  printf("Testing the mixed precision N_Vector \n");
+  printf("Vector length %ld \n", (long int)length);
+  printf("Number of threads %d \n\n", nthreads);
+
+  /* Create new vectors */
+  W = N_VNewEmpty_Mixed(length, nthreads, sunctx);
+  if (W == NULL)
+  {
+    printf("FAIL: Unable to create a new empty vector \n\n");
+    Test_Abort(1);
+  }
+
+  X = N_VNew_Mixed(length, nthreads, sunctx);
+  if (X == NULL)
+  {
+    N_VDestroy(W);
+    printf("FAIL: Unable to create a new vector \n\n");
+    Test_Abort(1);
+  }
+
+  /* Check vector ID */
+  fails += Test_N_VGetVectorID(X, SUNDIALS_NVEC_MIXED, 0);
+
+  /* Check vector length */
+  fails += Test_N_VGetLength(X, 0);
+
+  /* Check vector communicator */
+  fails += Test_N_VGetCommunicator(X, SUN_COMM_NULL, 0);
+
+  /* Test clone functions */
+  fails += Test_N_VCloneEmpty(X, 0);
+  fails += Test_N_VClone(X, length, 0);
+  fails += Test_N_VCloneEmptyVectorArray(5, X, 0);
+  fails += Test_N_VCloneVectorArray(5, X, length, 0);
+
+  /* Test wrapping user data, the data is single precision so the array
+     pointer tests do not apply */
+  xdata = (float*)malloc(length * sizeof(float));
+  Y     = N_VMake_Mixed(length, xdata, nthreads, sunctx);
+  if (Y == NULL || NV_DATA_MX(Y) != xdata || NV_OWN_DATA_MX(Y))
+  {
+    printf(">>> FAILED test -- N_VMake_Mixed \n");
+    fails++;
+  }
+  else { printf("PASSED test -- N_VMake_Mixed \n"); }
+  N_VDestroy(Y);
+  free(xdata);
+
+  /* Clone additional vectors for testing */
+  Y = N_VClone(X);
+  if (Y == NULL)
+  {
+    N_VDestroy(W);
+    N_VDestroy(X);
+    printf("FAIL: Unable to create a new vector \n\n");
+    Test_Abort(1);
+  }
+
+  Z = N_VClone(X);
+  if (Z == NULL)
+  {
+    N_VDestroy(W);
+    N_VDestroy(X);
+    N_VDestroy(Y);
+    printf("FAIL: Unable to create a new vector \n\n");
+    Test_Abort(1);
+  }
+
+  /* Standard vector operation tests */
+  printf("\nTesting standard vector operations:\n\n");
+
+  fails += Test_N_VConst(X, length, 0);
+  fails += Test_N_VLinearSum(X, Y, Z, length, 0);
+  fails += Test_N_VProd(X, Y, Z, length, 0);
+  fails += Test_N_VDiv(X, Y, Z, length, 0);
+  fails += Test_N_VScale(X, Z, length, 0);
+  fails += Test_N_VAbs(X, Z, length, 0);
+  fails += Test_N_VInv(X, Z, length, 0);
+  fails += Test_N_VAddConst(X, Z, length, 0);
+  fails += Test_N_VDotProd(X, Y, length, 0);
+  fails += Test_N_VMaxNorm(X, length, 0);
+  fails += Test_N_VWrmsNorm(X, Y, length, 0);
+  fails += Test_N_VWrmsNormMask(X, Y, Z, length, 0);
+  fails += Test_N_VMin(X, length, 0);
+  fails += Test_N_VWL2Norm(X, Y, length, 0);
+  fails += Test_N_VL1Norm(X, length, 0);
+  fails += Test_N_VCompare(X, Z, length, 0);
+  fails += Test_N_VInvTest(X, Z, length, 0);
+  fails += Test_N_VConstrMask(X, Y, Z, length, 0);
+  fails += Test_N_VMinQuotient(X, Y, length, 0);
+
+  /* Fused and vector array operations tests (generic implementations) */
+  printf("\nTesting fused and vector array operations:\n\n");
+
+  /* fused operations */
+  fails += Test_N_VLinearCombination(X, length, 0);
+  fails += Test_N_VScaleAddMulti(X, length, 0);
+  fails += Test_N_VDotProdMulti(X, length, 0);
+
+  /* vector array operations */
+  fails += Test_N_VLinearSumVectorArray(X, length, 0);
+  fails += Test_N_VScaleVectorArray(X, length, 0);
+  fails += Test_N_VConstVectorArray(X, length, 0);
+  fails += Test_N_VWrmsNormVectorArray(X, length, 0);
+  fails += Test_N_VWrmsNormMaskVectorArray(X, length, 0);
+  fails += Test_N_VScaleAddMultiVectorArray(X, length, 0);
+  fails += Test_N_VLinearCombinationVectorArray(X, length, 0);
+
+  /* local reduction operations */
+  printf("\nTesting local reduction operations:\n\n");
+
+  fails += Test_N_VDotProdLocal(X, Y, length, 0);
+  fails += Test_N_VMaxNormLocal(X, length, 0);
+  fails += Test_N_VMinLocal(X, length, 0);
+  fails += Test_N_VL1NormLocal(X, length, 0);
+  fails += Test_N_VWSqrSumLocal(X, Y, length, 0);
+  fails += Test_N_VWSqrSumMaskLocal(X, Y, Z, length, 0);
+  fails += Test_N_VInvTestLocal(X, Z, length, 0);
+  fails += Test_N_VConstrMaskLocal(X, Y, Z, length, 0);
+  fails += Test_N_VMinQuotientLocal(X, Y, length, 0);
+
+  /* XBraid interface operations */
+  printf("\nTesting XBraid interface operations:\n\n");
+
+  fails += Test_N_VBuf_Mixed(X, length);
+
+  /* Free vectors */
+  N_VDestroy(W);
+  N_VDestroy(X);
+  N_VDestroy(Y);
+  N_VDestroy(Z);
+
+  /* Print result */
+  if (fails) { printf("FAIL: NVector module failed %i tests \n\n", fails); }
+  else { printf("SUCCESS: NVector module passed all tests \n\n"); }
+
+  Test_Finalize();
+  return (fails);
+}
+
+/* ----------------------------------------------------------------------
+ * Test the XBraid buffer operations with a single precision buffer
+ * --------------------------------------------------------------------*/
+static int Test_N_VBuf_Mixed(N_Vector X, sunindextype local_length)
+{
+  int failure = 0;
+  sunindextype i, size;
+  float* buf;
+
+  /* check buffer size */
+  if (N_VBufSize(X, &size) ||
+      size != local_length * ((sunindextype)sizeof(float)))
+  {
+    printf(">>> FAILED test -- N_VBufSize \n");
+    return (1);
+  }
+  printf("PASSED test -- N_VBufSize\n");
+
+  buf = (float*)malloc((size_t)size);
+  if (buf == NULL)
+  {
+    printf(">>> FAILED test -- malloc failed \n");
+    return (1);
+  }
+
+  /* pack vector of +1 */
+  N_VConst(ONE, X);
+  for (i = 0; i < local_length; i++) { buf[i] = 0.0f; }
+  failure = N_VBufPack(X, (void*)buf);
+  for (i = 0; i < local_length; i++) { failure += (buf[i] != 1.0f); }
+  if (failure)
+  {
+    free(buf);
+    printf(">>> FAILED test -- N_VBufPack failed \n");
+    return (1);
+  }
+  printf("PASSED test -- N_VBufPack\n");
+
+  /* unpack buffer of -1/2 */
+  for (i = 0; i < local_length; i++) { buf[i] = -0.5f; }
+  N_VConst(ONE, X);
+  failure = N_VBufUnpack(X, (void*)buf);
+  failure += check_ans(NEG_HALF, X, local_length);
+  free(buf);
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VBufUnpack failed \n");
+    return (1);
+  }
+  printf("PASSED test -- N_VBufUnpack\n");
+
+  return (0);
+}
+
+/* ----------------------------------------------------------------------
+ * Implementation specific utility functions for vector tests
+ * --------------------------------------------------------------------*/
+int check_ans(sunrealtype ans, N_Vector X, sunindextype local_length)
+{
+  int failure = 0;
+  sunindextype i;
+  float* Xdata;
+
+  Xdata = NV_DATA_MX(X);
+
+  /* check vector data, the expected value is rounded to the storage type */
+  for (i = 0; i < local_length; i++)
+  {
+    failure += SUNRCompareTol((sunrealtype)Xdata[i], (sunrealtype)((float)ans),
+                              SUN_RCONST(10.0) * FLT_EPSILON);
+  }
+
+  return (failure > ZERO) ? (1) : (0);
+}
+
+sunbooleantype has_data(N_Vector X)
+{
+  /* check if data array is non-null */
+  return (NV_DATA_MX(X) == NULL) ? SUNFALSE : SUNTRUE;
+}
+
+void set_element(N_Vector X, sunindextype i, sunrealtype val)
+{
+  /* set i-th element of data array */
+  set_element_range(X, i, i, val);
+}
+
+void set_element_range(N_Vector X, sunindextype is, sunindextype ie,
+                       sunrealtype val)
+{
+  sunindextype i;
+
+  /* set elements [is,ie] of the data array */
+  float* xd = NV_DATA_MX(X);
+  for (i = is; i <= ie; i++) { xd[i] = (float)val; }
+}
+
+sunrealtype get_element(N_Vector X, sunindextype i)
+{
+  /* get i-th element of data array */
+  return (sunrealtype)NV_Ith_MX(X, i);
+}
+
+double max_time(N_Vector X, double time)
+{
+  /* not running in parallel, just return input time */
+  return (time);
+}
+
+void sync_device(N_Vector x)
+{
+  /* not running on GPU, just return */
+  return;
+}
@@ -182,6 +182,8 @@ int main(int argc, char* argv[])
   fails += Test_N_VLinearCombination(U, local_length, myid);
   fails += Test_N_VScaleAddMulti(U, local_length, myid);
   fails += Test_N_VDotProdMulti(U, local_length, myid);
+  fails += Test_N_VLinearSumWrmsNorm(U, local_length, myid);
+  fails += Test_N_VLinearCombinationWrmsNorm(U, local_length, myid);
 
   /* vector array operations */
   fails += Test_N_VLinearSumVectorArray(U, local_length, myid);
@@ -216,6 +218,9 @@ int main(int argc, char* argv[])
   fails += Test_N_VLinearCombination(V, local_length, myid);
   fails += Test_N_VScaleAddMulti(V, local_length, myid);
   fails += Test_N_VDotProdMulti(V, local_length, myid);
+  fails += Test_N_VLinearSumWrmsNorm(V, local_length, myid);
+  fails += Test_N_VLinearCombinationWrmsNorm(V, local_length, myid);
+  fails += Test_N_VCloneVectorArrayContiguous(6, V, local_length, myid);
 
   /* vector array operations */
   fails += Test_N_VLinearSumVectorArray(V, local_length, myid);
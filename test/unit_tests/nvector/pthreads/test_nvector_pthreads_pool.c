@@ -0,0 +1,226 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the testing routine to check the life cycle of the worker
+ * pools of the POSIX Threads (Pthreads) NVECTOR module:
+ *   - vectors of the same context and number of threads share one
+ *     pool, so creating many vectors does not create more threads,
+ *     and destroying them stops the pool threads (Linux only)
+ *   - several user threads, each with its own context, concurrently
+ *     create, clone, and destroy vectors and run vector operations,
+ *     including fused operations on vectors that share a pool
+ * -----------------------------------------------------------------*/
+
+#include <nvector/nvector_pthreads.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sundials/sundials_context.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+
+#define NVECS  40   /* number of vectors created at once     */
+#define NUSERS 4    /* number of concurrent user threads     */
+#define NITERS 50   /* iterations of each user thread        */
+#define NCLONE 8    /* number of clones made in an iteration */
+#define LENGTH 2000 /* vector length                         */
+
+#define ONE SUN_RCONST(1.0)
+#define TWO SUN_RCONST(2.0)
+
+typedef struct
+{
+  int nthreads; /* number of threads of the vectors */
+  int fails;    /* number of failures in the thread */
+} UserData;
+
+/* ----------------------------------------------------------------------
+ * Returns the number of threads of the process, or -1 if unknown
+ * --------------------------------------------------------------------*/
+static int num_process_threads(void)
+{
+  int nthreads = -1;
+#if defined(__linux__)
+  char line[256];
+  FILE* status = fopen("/proc/self/status", "r");
+  if (status == NULL) { return -1; }
+  while (fgets(line, sizeof(line), status))
+  {
+    if (strncmp(line, "Threads:", 8) == 0)
+    {
+      nthreads = atoi(line + 8);
+      break;
+    }
+  }
+  fclose(status);
+#endif
+  return nthreads;
+}
+
+/* ----------------------------------------------------------------------
+ * Creates, clones, and destroys vectors and checks vector operations
+ * --------------------------------------------------------------------*/
+static void* user_thread(void* data)
+{
+  int it, k;
+  sunrealtype ans, c[NCLONE];
+  SUNContext sunctx = NULL;
+  N_Vector x, y, clones[NCLONE];
+  UserData* udata = (UserData*)data;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    udata->fails++;
+    return NULL;
+  }
+
+  for (it = 0; it < NITERS && !udata->fails; it++)
+  {
+    /* two independent vectors sharing the pool of this context */
+    x = N_VNew_Pthreads(LENGTH, udata->nthreads, sunctx);
+    y = N_VNew_Pthreads(LENGTH, udata->nthreads, sunctx);
+    if (x == NULL || y == NULL)
+    {
+      udata->fails++;
+      N_VDestroy(x);
+      N_VDestroy(y);
+      break;
+    }
+    N_VEnableFusedOps_Pthreads(x, SUNTRUE);
+
+    N_VConst(ONE, x);
+    N_VConst(TWO, y);
+
+    for (k = 0; k < NCLONE; k++)
+    {
+      clones[k] = N_VClone((k % 2) ? x : y);
+      N_VLinearSum(ONE, x, (sunrealtype)k, y, clones[k]);
+      c[k] = ONE;
+    }
+
+    /* y = sum_k (1 + 2k), checked with a dot product with x = 1 */
+    N_VLinearCombination(NCLONE, c, clones, y);
+    ans = N_VDotProd(x, y) / LENGTH;
+    if (SUNRCompare(ans, (sunrealtype)(NCLONE * NCLONE)))
+    {
+      printf(">>> FAILED test -- dot product %g, expected %g\n", (double)ans,
+             (double)(NCLONE * NCLONE));
+      udata->fails++;
+    }
+
+    /* destroy in an order that differs from the creation order */
+    N_VDestroy(x);
+    for (k = NCLONE - 1; k >= 0; k--) { N_VDestroy(clones[k]); }
+    N_VDestroy(y);
+  }
+
+  SUNContext_Free(&sunctx);
+
+  return NULL;
+}
+
+/* ----------------------------------------------------------------------
+ * Main Testing Routine
+ * --------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  int fails = 0;
+  int nthreads, k, before, during, after;
+  SUNContext sunctx = NULL;
+  N_Vector vecs[NVECS];
+  pthread_t users[NUSERS];
+  UserData udata[NUSERS];
+
+  if (argc < 2)
+  {
+    printf("ERROR: ONE (1) Input required: number of threads \n");
+    return 1;
+  }
+
+  nthreads = atoi(argv[1]);
+  if (nthreads < 1)
+  {
+    printf("ERROR: number of threads must be at least 1 \n");
+    return 1;
+  }
+
+  printf("Testing the Pthreads N_Vector worker pools \n");
+  printf("Number of threads %d \n\n", nthreads);
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    printf("ERROR: SUNContext_Create failed \n");
+    return 1;
+  }
+
+  /* test 1: many vectors of one context use one pool */
+  before = num_process_threads();
+  for (k = 0; k < NVECS; k++)
+  {
+    vecs[k] = N_VNew_Pthreads(LENGTH, nthreads, sunctx);
+    if (vecs[k] == NULL)
+    {
+      printf(">>> FAILED test -- N_VNew_Pthreads returned NULL \n");
+      fails++;
+    }
+  }
+  during = num_process_threads();
+  for (k = 0; k < NVECS; k++) { N_VDestroy(vecs[k]); }
+  after = num_process_threads();
+
+  if (before >= 0)
+  {
+    if (during - before != nthreads - 1 || after != before)
+    {
+      printf(">>> FAILED test -- process threads %d before, %d with %d "
+             "vectors, %d after \n",
+             before, during, NVECS, after);
+      fails++;
+    }
+    else { printf("    PASSED test -- shared pool \n"); }
+  }
+  else { printf("    SKIPPED test -- shared pool \n"); }
+
+  /* test 2: concurrent use from several user threads */
+  for (k = 0; k < NUSERS; k++)
+  {
+    udata[k].nthreads = nthreads;
+    udata[k].fails    = 0;
+    if (pthread_create(&users[k], NULL, user_thread, &udata[k]))
+    {
+      printf("ERROR: pthread_create failed \n");
+      return 1;
+    }
+  }
+  for (k = 0; k < NUSERS; k++)
+  {
+    pthread_join(users[k], NULL);
+    fails += udata[k].fails;
+  }
+  if (before >= 0 && num_process_threads() != before)
+  {
+    printf(">>> FAILED test -- pool threads still running \n");
+    fails++;
+  }
+  if (!fails) { printf("    PASSED test -- concurrent use \n"); }
+
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: NVector module failed %i tests \n\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: NVector module passed all tests \n\n");
+  return 0;
+}
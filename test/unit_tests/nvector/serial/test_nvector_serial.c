@@ -95,6 +95,10 @@ int main(int argc, char* argv[])
   fails += Test_N_VSetArrayPointer(W, length, 0);
   fails += Test_N_VGetArrayPointer(X, length, 0);
 
+  /* Test views of a range of the data */
+  fails += Test_N_VMakeView(X, N_VMakeView_Serial(X, length / 4, length / 2),
+                            length / 4, length / 2, 0);
+
   /* Clone additional vectors for testing */
   Y = N_VClone(X);
   if (Y == NULL)
@@ -161,6 +165,8 @@ int main(int argc, char* argv[])
   fails += Test_N_VLinearCombination(U, length, 0);
   fails += Test_N_VScaleAddMulti(U, length, 0);
   fails += Test_N_VDotProdMulti(U, length, 0);
+  fails += Test_N_VLinearSumWrmsNorm(U, length, 0);
+  fails += Test_N_VLinearCombinationWrmsNorm(U, length, 0);
 
   /* vector array operations */
   fails += Test_N_VLinearSumVectorArray(U, length, 0);
@@ -193,6 +199,9 @@ int main(int argc, char* argv[])
   fails += Test_N_VLinearCombination(V, length, 0);
   fails += Test_N_VScaleAddMulti(V, length, 0);
   fails += Test_N_VDotProdMulti(V, length, 0);
+  fails += Test_N_VLinearSumWrmsNorm(V, length, 0);
+  fails += Test_N_VLinearCombinationWrmsNorm(V, length, 0);
+  fails += Test_N_VCloneVectorArrayContiguous(6, V, length, 0);
 
   /* vector array operations */
   fails += Test_N_VLinearSumVectorArray(V, length, 0);
@@ -235,6 +244,60 @@ int main(int argc, char* argv[])
   N_VDestroy(U);
   N_VDestroy(V);
 
+  /* Standard vector operation tests (deferred) */
+  printf("\nTesting standard vector operations (deferred):\n\n");
+
+  /* create vectors sharing a recorder for deferred operations */
+  X      = N_VNew_Serial(length, sunctx);
+  retval = N_VEnableDeferredOps_Serial(X, SUNTRUE);
+  if (X == NULL || retval != 0)
+  {
+    printf("FAIL: Unable to create a new vector \n\n");
+    Test_Finalize();
+    return (1);
+  }
+
+  Y = N_VClone(X);
+  Z = N_VClone(X);
+  if (Y == NULL || Z == NULL)
+  {
+    N_VDestroy(X);
+    if (Y) { N_VDestroy(Y); }
+    if (Z) { N_VDestroy(Z); }
+    printf("FAIL: Unable to create a new vector \n\n");
+    Test_Finalize();
+    return (1);
+  }
+
+  fails += Test_N_VConst(X, length, 0);
+  fails += Test_N_VLinearSum(X, Y, Z, length, 0);
+  fails += Test_N_VProd(X, Y, Z, length, 0);
+  fails += Test_N_VDiv(X, Y, Z, length, 0);
+  fails += Test_N_VScale(X, Z, length, 0);
+  fails += Test_N_VAbs(X, Z, length, 0);
+  fails += Test_N_VInv(X, Z, length, 0);
+  fails += Test_N_VAddConst(X, Z, length, 0);
+  fails += Test_N_VDotProd(X, Y, length, 0);
+  fails += Test_N_VMaxNorm(X, length, 0);
+  fails += Test_N_VWrmsNorm(X, Y, length, 0);
+  fails += Test_N_VWrmsNormMask(X, Y, Z, length, 0);
+  fails += Test_N_VMin(X, length, 0);
+  fails += Test_N_VWL2Norm(X, Y, length, 0);
+  fails += Test_N_VL1Norm(X, length, 0);
+  fails += Test_N_VCompare(X, Z, length, 0);
+  fails += Test_N_VInvTest(X, Z, length, 0);
+  fails += Test_N_VConstrMask(X, Y, Z, length, 0);
+  fails += Test_N_VMinQuotient(X, Y, length, 0);
+
+  /* Test views of a vector with deferred operations */
+  fails += Test_N_VMakeViewDeferred(X, N_VMakeView_Serial(X, length / 4,
+                                                       length / 2),
+                                    length / 2, 0);
+
+  N_VDestroy(X);
+  N_VDestroy(Y);
+  N_VDestroy(Z);
+
   /* Print result */
   if (fails) { printf("FAIL: NVector module failed %i tests \n\n", fails); }
   else { printf("SUCCESS: NVector module passed all tests \n\n"); }
@@ -284,7 +347,8 @@ void set_element_range(N_Vector X, sunindextype is, sunindextype ie,
 
 sunrealtype get_element(N_Vector X, sunindextype i)
 {
-  /* get i-th element of data array */
+  /* get i-th element of data array after executing pending operations */
+  N_VFlushDeferredOps_Serial(X);
   return NV_Ith_S(X, i);
 }
 
@@ -0,0 +1,177 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the testing routine to check the kernels selected by the
+ * serial NVECTOR for the instruction set requested with the
+ * SUNDIALS_NVECTOR_SERIAL_SIMD environment variable. The results of
+ * N_VLinearSum, N_VScale, N_VDotProd, and N_VWrmsNorm are compared
+ * with reference loops. With "none" the results must be bitwise
+ * identical, otherwise the reductions may differ by roundoff. The
+ * requested kernels must be selected if the host supports them,
+ * otherwise the test checks the kernels that were selected instead.
+ * -----------------------------------------------------------------*/
+
+#include <nvector/nvector_serial.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+
+#include "nvector_serial_kernels.h"
+
+#define LENGTH 1037 /* not a multiple of any SIMD width */
+
+/* Returns true if the build and host support the named kernels */
+static sunbooleantype supported(const char* name)
+{
+  if (!strcmp(name, "none")) { return SUNTRUE; }
+#if defined(SUNDIALS_DOUBLE_PRECISION) && \
+  (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+  __builtin_cpu_init();
+  if (!strcmp(name, "avx512")) { return __builtin_cpu_supports("avx512f"); }
+  if (!strcmp(name, "avx2")) { return __builtin_cpu_supports("avx2"); }
+#elif defined(SUNDIALS_DOUBLE_PRECISION) && defined(__aarch64__) && \
+  defined(__ARM_NEON)
+  if (!strcmp(name, "neon")) { return SUNTRUE; }
+#endif
+  return SUNFALSE;
+}
+
+static int check(const char* name, sunrealtype val, sunrealtype ref,
+                 sunrealtype scale, sunbooleantype exact)
+{
+  sunrealtype tol = exact ? SUN_RCONST(0.0)
+                          : LENGTH * SUN_UNIT_ROUNDOFF * scale;
+
+  if (SUNRabs(val - ref) > tol)
+  {
+    printf(">>> FAILED test -- %s: %.17g, reference %.17g \n", name,
+           (double)val, (double)ref);
+    return 1;
+  }
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  int fails = 0;
+  sunindextype i;
+  sunbooleantype exact;
+  const char* request;
+  const NVSerialKernels* kernels;
+  SUNContext sunctx = NULL;
+  N_Vector X, Y, Z;
+  sunrealtype *x, *y, *z, a, b, ref, scale, prodi;
+
+  request = getenv("SUNDIALS_NVECTOR_SERIAL_SIMD");
+  kernels = nvSerialGetKernels();
+
+  printf("Testing the serial N_Vector kernels \n");
+  printf("Requested instruction set %s, selected %s \n\n",
+         request ? request : "(default)", kernels->name);
+
+  if (request && strcmp(request, kernels->name))
+  {
+    if (supported(request))
+    {
+      printf(">>> FAILED test -- %s is supported but not selected \n",
+             request);
+      return 1;
+    }
+    printf("    NOTE: %s is not available on this host \n", request);
+  }
+
+  exact = !strcmp(kernels->name, "none");
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    printf("ERROR: SUNContext_Create failed \n");
+    return 1;
+  }
+
+  X = N_VNew_Serial(LENGTH, sunctx);
+  Y = N_VNew_Serial(LENGTH, sunctx);
+  Z = N_VNew_Serial(LENGTH, sunctx);
+  if (X == NULL || Y == NULL || Z == NULL)
+  {
+    printf("ERROR: N_VNew_Serial failed \n");
+    N_VDestroy(X);
+    N_VDestroy(Y);
+    N_VDestroy(Z);
+    SUNContext_Free(&sunctx);
+    return 1;
+  }
+
+  x = N_VGetArrayPointer(X);
+  y = N_VGetArrayPointer(Y);
+  z = N_VGetArrayPointer(Z);
+
+  srand(1);
+  for (i = 0; i < LENGTH; i++)
+  {
+    x[i] = (sunrealtype)rand() / (sunrealtype)RAND_MAX - SUN_RCONST(0.5);
+    y[i] = (sunrealtype)rand() / (sunrealtype)RAND_MAX + SUN_RCONST(0.5);
+  }
+  a = SUN_RCONST(0.7);
+  b = SUN_RCONST(-1.3);
+
+  /* linear sum */
+  N_VLinearSum(a, X, b, Y, Z);
+  for (i = 0; i < LENGTH && !fails; i++)
+  {
+    ref = (a * x[i]) + (b * y[i]);
+    scale = SUNRabs(a * x[i]) + SUNRabs(b * y[i]);
+    fails += check("N_VLinearSum", z[i], ref, scale, exact);
+  }
+
+  /* scale */
+  N_VScale(a, X, Z);
+  for (i = 0; i < LENGTH && !fails; i++)
+  {
+    ref = a * x[i];
+    fails += check("N_VScale", z[i], ref, SUNRabs(ref), exact);
+  }
+
+  /* dot product */
+  ref   = SUN_RCONST(0.0);
+  scale = SUN_RCONST(0.0);
+  for (i = 0; i < LENGTH; i++)
+  {
+    ref += x[i] * y[i];
+    scale += SUNRabs(x[i] * y[i]);
+  }
+  fails += check("N_VDotProd", N_VDotProd(X, Y), ref, scale, exact);
+
+  /* weighted root mean square norm */
+  ref = SUN_RCONST(0.0);
+  for (i = 0; i < LENGTH; i++)
+  {
+    prodi = x[i] * y[i];
+    ref += prodi * prodi;
+  }
+  ref = SUNRsqrt(ref / LENGTH);
+  fails += check("N_VWrmsNorm", N_VWrmsNorm(X, Y), ref, ref, exact);
+
+  N_VDestroy(X);
+  N_VDestroy(Y);
+  N_VDestroy(Z);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: NVector module failed %i tests \n\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS: NVector module passed all tests \n\n");
+  return 0;
+}
@@ -203,6 +203,328 @@ int Test_N_VCloneVectorArray(int count, N_Vector W, sunindextype local_length,
   return (0);
 }
 
+/* ----------------------------------------------------------------------
+ * N_VCloneVectorArrayContiguous Test
+ *
+ * Checks the layout of the vectors when the vector supports contiguous
+ * arrays and the fused operations on the array (count >= 3).
+ *
+ * NOTE: This routine depends on N_VConst, N_VClone, and N_VGetArrayPointer.
+ * --------------------------------------------------------------------*/
+int Test_N_VCloneVectorArrayContiguous(int count, N_Vector W,
+                                       sunindextype local_length, int myid)
+{
+  int i, ierr, failure;
+  double start_time, stop_time, maxt;
+  sunindextype global_length;
+  sunrealtype *c, *d, ans;
+  N_Vector X, Z;
+  N_Vector* vs;
+  N_Vector* Xv;
+
+  /* check if the required operations are implemented */
+  if (W->ops->nvconst == NULL || count < 3)
+  {
+    printf(">>> FAILED test -- N_VCloneVectorArrayContiguous, Proc %d missing "
+           "required operations\n",
+           myid);
+    return (1);
+  }
+
+  global_length = N_VGetLength(W);
+
+  /* clone array of vectors */
+  start_time = get_time();
+  vs         = N_VCloneVectorArrayContiguous(count, W);
+  stop_time  = get_time();
+
+  if (vs == NULL)
+  {
+    printf(">>> FAILED test -- N_VCloneVectorArrayContiguous, Proc %d \n", myid);
+    printf("    vs = NULL \n\n");
+    return (1);
+  }
+
+  /* check vectors in array */
+  for (i = 0; i < count; i++)
+  {
+    failure = (vs[i] == NULL);
+    if (!failure && W->ops->nvclonevectorarraycontiguous && local_length > 0)
+    {
+      failure = (N_VGetArrayPointer(vs[i]) !=
+                 N_VGetArrayPointer(vs[0]) + i * local_length);
+    }
+    if (failure)
+    {
+      printf(">>> FAILED test -- N_VCloneVectorArrayContiguous, Proc %d \n",
+             myid);
+      printf("    Vector[%d] is NULL or not contiguous \n\n", i);
+      N_VDestroyVectorArray(vs, count);
+      return (1);
+    }
+
+    N_VConst((sunrealtype)(i + 1), vs[i]);
+  }
+
+  for (i = 0; i < count; i++)
+  {
+    if (check_ans((sunrealtype)(i + 1), vs[i], local_length))
+    {
+      printf(">>> FAILED test -- N_VCloneVectorArrayContiguous, Proc %d \n",
+             myid);
+      printf("    Vector[%d] failed N_VConst check \n\n", i);
+      N_VDestroyVectorArray(vs, count);
+      return (1);
+    }
+  }
+
+  /* fused operations on the array */
+  X  = N_VClone(W);
+  Z  = N_VClone(W);
+  c  = (sunrealtype*)malloc(count * sizeof(sunrealtype));
+  d  = (sunrealtype*)malloc(count * sizeof(sunrealtype));
+  Xv = (N_Vector*)malloc(count * sizeof(N_Vector));
+
+  failure = 0;
+
+  /* d[i] = X . vs[i] = 2 (i + 1) global_length */
+  N_VConst(TWO, X);
+  ierr = N_VDotProdMulti(count, X, vs, d);
+  if (ierr) { failure++; }
+  for (i = 0; i < count && !ierr; i++)
+  {
+    failure += SUNRCompare(d[i], TWO * (i + 1) * global_length);
+  }
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VCloneVectorArrayContiguous N_VDotProdMulti, "
+           "Proc %d \n",
+           myid);
+  }
+
+  /* Z = sum vs[i] = count (count + 1) / 2 */
+  for (i = 0; i < count; i++) { c[i] = ONE; }
+  ierr = N_VLinearCombination(count, c, vs, Z);
+  ans  = (sunrealtype)(count * (count + 1) / 2);
+  if (ierr || check_ans(ans, Z, local_length))
+  {
+    printf(">>> FAILED test -- N_VCloneVectorArrayContiguous "
+           "N_VLinearCombination Case 1, Proc %d \n",
+           myid);
+    failure++;
+  }
+
+  /* Z = 2 Z + sum vs[i], i = 0,...,count-2 */
+  N_VConst(ONE, Z);
+  Xv[0] = Z;
+  c[0]  = TWO;
+  for (i = 1; i < count; i++) { Xv[i] = vs[i - 1]; }
+  ierr = N_VLinearCombination(count, c, Xv, Z);
+  ans  = (sunrealtype)(2 + (count - 1) * count / 2);
+  if (ierr || check_ans(ans, Z, local_length))
+  {
+    printf(">>> FAILED test -- N_VCloneVectorArrayContiguous "
+           "N_VLinearCombination Case 2, Proc %d \n",
+           myid);
+    failure++;
+  }
+
+  /* vs[i] = vs[i] + X = i + 3 */
+  for (i = 0; i < count; i++) { c[i] = ONE; }
+  ierr = N_VScaleAddMulti(count, c, X, vs, vs);
+  for (i = 0; i < count; i++)
+  {
+    if (ierr || check_ans((sunrealtype)(i + 3), vs[i], local_length))
+    {
+      printf(">>> FAILED test -- N_VCloneVectorArrayContiguous "
+             "N_VScaleAddMulti, Proc %d \n",
+             myid);
+      failure++;
+      break;
+    }
+  }
+
+  free(c);
+  free(d);
+  free(Xv);
+  N_VDestroy(X);
+  N_VDestroy(Z);
+  N_VDestroyVectorArray(vs, count);
+
+  if (failure) { return (1); }
+
+  if (myid == 0) { printf("PASSED test -- N_VCloneVectorArrayContiguous \n"); }
+
+  /* find max time across all processes */
+  maxt = max_time(W, stop_time - start_time);
+  PRINT_TIME("N_VCloneVectorArrayContiguous", maxt);
+
+  return (0);
+}
+
+/* ----------------------------------------------------------------------
+ * N_VMakeView Test
+ *
+ * Checks a view V of the elements [offset, offset + length) of X: the
+ * view aliases the data of X, writes to the view only change that range
+ * of X, and clones of the view are independent vectors of the view length.
+ * The view is destroyed by the test.
+ *
+ * NOTE: This routine depends on N_VConst, N_VScale, N_VClone, and
+ * N_VGetArrayPointer.
+ * --------------------------------------------------------------------*/
+
+int Test_N_VMakeView(N_Vector X, N_Vector V, sunindextype offset,
+                     sunindextype length, int myid)
+{
+  int failure;
+  sunindextype i;
+  N_Vector C;
+
+  if (V == NULL)
+  {
+    printf(">>> FAILED test -- N_VMakeView, Proc %d \n", myid);
+    printf("    view = NULL \n\n");
+    return (1);
+  }
+
+  /* the view aliases the data of X */
+  failure = (N_VGetLength(V) != length);
+  if (!failure && length > 0)
+  {
+    failure = (N_VGetArrayPointer(V) != N_VGetArrayPointer(X) + offset);
+  }
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VMakeView, Proc %d \n", myid);
+    printf("    view length or data pointer is wrong \n\n");
+    N_VDestroy(V);
+    return (1);
+  }
+
+  /* writing the view only changes its range of X */
+  N_VConst(ONE, X);
+  N_VConst(TWO, V);
+  sync_device(X);
+  for (i = 0; i < N_VGetLength(X); i++)
+  {
+    if (SUNRCompare(get_element(X, i),
+                    (i >= offset && i < offset + length) ? TWO : ONE))
+    {
+      failure = 1;
+    }
+  }
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VMakeView, Proc %d \n", myid);
+    printf("    writing the view changed the wrong elements \n\n");
+    N_VDestroy(V);
+    return (1);
+  }
+
+  /* a clone of the view has its own data */
+  C = N_VClone(V);
+  failure = (C == NULL || N_VGetLength(C) != length);
+  if (!failure)
+  {
+    N_VScale(ONE, V, C);
+    failure = check_ans(TWO, C, length);
+    N_VConst(ZERO, C);
+    failure += check_ans(TWO, V, length);
+    N_VDestroy(C);
+  }
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VMakeView, Proc %d \n", myid);
+    printf("    clone of the view is wrong \n\n");
+    N_VDestroy(V);
+    return (1);
+  }
+
+  /* destroying the view does not free the data of X */
+  N_VDestroy(V);
+  N_VConst(ONE, X);
+  if (check_ans(ONE, X, N_VGetLength(X)))
+  {
+    printf(">>> FAILED test -- N_VMakeView, Proc %d \n", myid);
+    printf("    vector is wrong after destroying the view \n\n");
+    return (1);
+  }
+
+  if (myid == 0) { printf("PASSED test -- N_VMakeView \n"); }
+
+  return (0);
+}
+
+/* ----------------------------------------------------------------------
+ * N_VMakeView Test (deferred operations)
+ *
+ * Checks a view V of length elements of X when X records deferred
+ * operations: operations queued on X are seen when the view is read and
+ * operations queued on the view are seen when X is read. The view is
+ * destroyed by the test.
+ *
+ * NOTE: This routine depends on N_VConst, N_VScale, N_VMaxNorm, N_VMin,
+ * N_VClone, and N_VGetArrayPointer.
+ * --------------------------------------------------------------------*/
+
+int Test_N_VMakeViewDeferred(N_Vector X, N_Vector V, sunindextype length,
+                             int myid)
+{
+  int failure;
+  N_Vector C;
+
+  if (V == NULL)
+  {
+    printf(">>> FAILED test -- N_VMakeView (deferred), Proc %d \n", myid);
+    printf("    view = NULL \n\n");
+    return (1);
+  }
+
+  /* a reduction over the view executes the operations queued on X */
+  N_VConst(ONE, X);
+  N_VScale(TWO, X, X);
+  failure = SUNRCompare(N_VMaxNorm(V), TWO);
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VMakeView (deferred), Proc %d \n", myid);
+    printf("    reduction over the view missed an operation on X \n\n");
+    N_VDestroy(V);
+    return (1);
+  }
+
+  /* an operation reading the view executes the operations queued on X */
+  C = N_VClone(V);
+  N_VConst(ONE, X);
+  N_VScale(TWO, X, X);
+  N_VScale(ONE, V, C);
+  failure = check_ans(TWO, C, length);
+  N_VDestroy(C);
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VMakeView (deferred), Proc %d \n", myid);
+    printf("    operation reading the view missed an operation on X \n\n");
+    N_VDestroy(V);
+    return (1);
+  }
+
+  /* a reduction over X executes the operations queued on the view */
+  N_VConst(ONE, X);
+  N_VScale(TWO, V, V);
+  failure = SUNRCompare(N_VMaxNorm(X), TWO) || SUNRCompare(N_VMin(X), ONE);
+  N_VDestroy(V);
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VMakeView (deferred), Proc %d \n", myid);
+    printf("    reduction over X missed an operation on the view \n\n");
+    return (1);
+  }
+
+  if (myid == 0) { printf("PASSED test -- N_VMakeView (deferred) \n"); }
+
+  return (0);
+}
+
 /* ----------------------------------------------------------------------
  * N_VCloneVectorArrayEmpty Test
  * --------------------------------------------------------------------*/
@@ -2694,6 +3016,207 @@ int Test_N_VDotProdMulti(N_Vector X, sunindextype local_length, int myid)
   return (fails);
 }
 
+/* ----------------------------------------------------------------------
+ * N_VLinearSumWrmsNorm Test
+ * --------------------------------------------------------------------*/
+int Test_N_VLinearSumWrmsNorm(N_Vector X, sunindextype local_length, int myid)
+{
+  int fails = 0, failure = 0;
+  double start_time, stop_time, maxt;
+  sunrealtype ans;
+  N_Vector Y, Z, W;
+
+  /* create vectors for testing */
+  Y = N_VClone(X);
+  Z = N_VClone(X);
+  W = N_VClone(X);
+
+  /*
+   * Case 1: z = a x + b y
+   */
+
+  /* fill vector data */
+  N_VConst(HALF, X);
+  N_VConst(TWO, Y);
+  N_VConst(ZERO, Z);
+  N_VConst(HALF, W);
+
+  start_time = get_time();
+  ans        = N_VLinearSumWrmsNorm(TWO, X, HALF, Y, Z, W);
+  sync_device(X);
+  stop_time = get_time();
+
+  /* Z should be vector of +2 and ans should equal 1 */
+  failure = check_ans(TWO, Z, local_length);
+  failure += SUNRCompare(ans, ONE);
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VLinearSumWrmsNorm Case 1, Proc %d \n", myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VLinearSumWrmsNorm Case 1 \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VLinearSumWrmsNorm", maxt);
+
+  /*
+   * Case 2: y = a x + b y
+   */
+
+  /* fill vector data */
+  N_VConst(HALF, X);
+  N_VConst(TWO, Y);
+  N_VConst(HALF, W);
+
+  start_time = get_time();
+  ans        = N_VLinearSumWrmsNorm(NEG_ONE, X, ONE, Y, Y, W);
+  sync_device(X);
+  stop_time = get_time();
+
+  /* Y should be vector of +1.5 and ans should equal 0.75 */
+  failure = check_ans(SUN_RCONST(1.5), Y, local_length);
+  failure += SUNRCompare(ans, SUN_RCONST(0.75));
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VLinearSumWrmsNorm Case 2, Proc %d \n", myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VLinearSumWrmsNorm Case 2 \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VLinearSumWrmsNorm", maxt);
+
+  /* Free vectors */
+  N_VDestroy(Y);
+  N_VDestroy(Z);
+  N_VDestroy(W);
+
+  return (fails);
+}
+
+/* ----------------------------------------------------------------------
+ * N_VLinearCombinationWrmsNorm Test
+ * --------------------------------------------------------------------*/
+int Test_N_VLinearCombinationWrmsNorm(N_Vector Z, sunindextype local_length,
+                                      int myid)
+{
+  int fails = 0, failure = 0, ierr = 0;
+  double start_time, stop_time, maxt;
+  sunrealtype c[3], nrm;
+  N_Vector* X;
+  N_Vector W;
+  N_Vector V[3];
+
+  /* create vectors for testing */
+  X = N_VCloneVectorArray(3, Z);
+  W = N_VClone(Z);
+
+  /*
+   * Case 1: z = sum{ c[i] * X[i] }
+   */
+
+  /* fill vector data */
+  N_VConst(ONE, X[0]);
+  N_VConst(NEG_ONE, X[1]);
+  N_VConst(ONE, X[2]);
+  N_VConst(ZERO, Z);
+  N_VConst(HALF, W);
+
+  c[0] = ONE;
+  c[1] = ONE;
+  c[2] = TWO;
+
+  start_time = get_time();
+  ierr       = N_VLinearCombinationWrmsNorm(3, c, X, Z, W, &nrm);
+  sync_device(Z);
+  stop_time = get_time();
+
+  /* Z should be vector of +2 and nrm should equal 1 */
+  if (ierr == 0)
+  {
+    failure = check_ans(TWO, Z, local_length);
+    failure += SUNRCompare(nrm, ONE);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VLinearCombinationWrmsNorm Case 1, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VLinearCombinationWrmsNorm Case 1 \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(Z, stop_time - start_time);
+  PRINT_TIME("N_VLinearCombinationWrmsNorm", maxt);
+
+  /*
+   * Case 2: X[0] = c[0] X[0] + sum{ c[i] * X[i] }
+   */
+
+  /* fill vector data */
+  N_VConst(TWO, Z);
+  N_VConst(HALF, X[1]);
+  N_VConst(ONE, X[2]);
+  N_VConst(HALF, W);
+
+  c[0] = HALF;
+  c[1] = ONE;
+  c[2] = HALF;
+
+  V[0] = Z;
+  V[1] = X[1];
+  V[2] = X[2];
+
+  start_time = get_time();
+  ierr       = N_VLinearCombinationWrmsNorm(3, c, V, Z, W, &nrm);
+  sync_device(Z);
+  stop_time = get_time();
+
+  /* Z should be vector of +2 and nrm should equal 1 */
+  if (ierr == 0)
+  {
+    failure = check_ans(TWO, Z, local_length);
+    failure += SUNRCompare(nrm, ONE);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VLinearCombinationWrmsNorm Case 2, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VLinearCombinationWrmsNorm Case 2 \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(Z, stop_time - start_time);
+  PRINT_TIME("N_VLinearCombinationWrmsNorm", maxt);
+
+  /* Free vectors */
+  N_VDestroyVectorArray(X, 3);
+  N_VDestroy(W);
+
+  return (fails);
+}
+
 /* ----------------------------------------------------------------------
  * N_VLinearSumVectorArray Test
  * --------------------------------------------------------------------*/
@@ -5807,6 +6330,50 @@ int Test_N_VDotProdMultiAllReduce(N_Vector X, sunindextype local_length, int myi
   maxt = max_time(X, stop_time - start_time);
   PRINT_TIME("N_VDotProdMultiAllReduce", maxt);
 
+  /*
+   * Case 3: d[i] = z . V[i], non-blocking reduction
+   */
+
+  /* fill vector data */
+  N_VConst(TWO, X);
+  N_VConst(NEG_HALF, V[0]);
+  N_VConst(HALF, V[1]);
+  N_VConst(ONE, V[2]);
+
+  ierr = N_VDotProdMultiLocal(3, X, V, dotprods);
+
+  /* start the global reduction and complete it after changing X */
+  start_time = get_time();
+  if (ierr == 0) { ierr = N_VDotProdMultiAllReduceBegin(3, X, dotprods); }
+  N_VConst(ZERO, X);
+  if (ierr == 0) { ierr = N_VDotProdMultiAllReduceEnd(X); }
+  sync_device(X);
+  stop_time = get_time();
+
+  /* dotprod[i] should equal -1, +1, and 2 times the global vector length */
+  if (ierr == 0)
+  {
+    failure = SUNRCompare(dotprods[0], (sunrealtype)-1 * global_length);
+    failure += SUNRCompare(dotprods[1], (sunrealtype)global_length);
+    failure += SUNRCompare(dotprods[2], (sunrealtype)2 * global_length);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VDotProdMultiAllReduce Case 3, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VDotProdMultiAllReduce Case 3 \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VDotProdMultiAllReduceBegin/End", maxt);
+
   /* Free vectors */
   N_VDestroyVectorArray(V, 3);
 
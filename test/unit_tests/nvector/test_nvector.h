@@ -61,6 +61,12 @@ int Test_N_VMake(N_Vector X, sunindextype local_length, int myid);
 /* Vector clone tests */
 int Test_N_VCloneVectorArray(int count, N_Vector W, sunindextype local_length,
                              int myid);
+int Test_N_VCloneVectorArrayContiguous(int count, N_Vector W,
+                                       sunindextype local_length, int myid);
+int Test_N_VMakeView(N_Vector X, N_Vector V, sunindextype offset,
+                     sunindextype length, int myid);
+int Test_N_VMakeViewDeferred(N_Vector X, N_Vector V, sunindextype length,
+                             int myid);
 int Test_N_VCloneEmptyVectorArray(int count, N_Vector W, int myid);
 int Test_N_VCloneEmpty(N_Vector W, int myid);
 int Test_N_VClone(N_Vector W, sunindextype local_length, int myid);
@@ -103,6 +109,9 @@ int Test_N_VMinQuotient(N_Vector NUM, N_Vector DENOM, sunindextype local_length,
 int Test_N_VLinearCombination(N_Vector X, sunindextype local_length, int myid);
 int Test_N_VScaleAddMulti(N_Vector X, sunindextype local_length, int myid);
 int Test_N_VDotProdMulti(N_Vector X, sunindextype local_length, int myid);
+int Test_N_VLinearSumWrmsNorm(N_Vector X, sunindextype local_length, int myid);
+int Test_N_VLinearCombinationWrmsNorm(N_Vector Z, sunindextype local_length,
+                                      int myid);
 
 /* Vector array operation tests */
 int Test_N_VLinearSumVectorArray(N_Vector X, sunindextype local_length, int myid);
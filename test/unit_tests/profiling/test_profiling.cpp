@@ -223,6 +223,65 @@ int main()
 
   std::fclose(fout);
 
+  // ------
+  // Test 4
+  // ------
+
+  std::cout << "\nTest 4: reset, add counts, check counts and print rates\n";
+
+  flag = SUNProfiler_Reset(prof);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_Reset returned " << flag << "\n";
+    return 1;
+  }
+
+  flag = sleep(prof, 1, &chrono);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "sleep returned " << flag << "\n";
+    return 1;
+  }
+
+  for (int i = 0; i < 2; i++)
+  {
+    flag = SUNProfiler_AddCounts(prof, "sleep", 1.0e9, 2.0e9);
+    if (flag)
+    {
+      std::cerr << ">>> FAILURE: "
+                << "SUNProfiler_AddCounts returned " << flag << "\n";
+      return 1;
+    }
+  }
+
+  double bytes = 0;
+  double flops = 0;
+  flag         = SUNProfiler_GetCounts(prof, "sleep", &bytes, &flops);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_GetCounts returned " << flag << "\n";
+    return 1;
+  }
+
+  if (SUNRCompare(bytes, 2.0e9) || SUNRCompare(flops, 4.0e9))
+  {
+    std::cerr << ">>> FAILURE: "
+              << "counts recorded were " << bytes << " bytes and " << flops
+              << " flops, but expected 2e9 bytes and 4e9 flops\n";
+    return 1;
+  }
+
+  flag = print_timings(prof);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "print_timings returned " << flag << "\n";
+    return 1;
+  }
+
   // --------
   // Clean up
   // --------
@@ -0,0 +1,159 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Test the reduction of the profiler timers and counts over MPI ranks. Rank r
+ * records (r + 1) GB and 2 (r + 1) GFLOP in a timed region, so the rates that
+ * SUNProfiler_Print reports on rank 0 must be computed from the sums of the
+ * counts over all ranks and the maximum time of any rank.
+ * ---------------------------------------------------------------------------*/
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <mpi.h>
+#include <thread>
+
+#include "sundials/sundials_profiler.h"
+#include "sundials/sundials_types.h"
+
+// Checks that value agrees with expected up to the printed digits
+static int check(const char* name, double value, double expected, double tol)
+{
+  if (std::abs(value - expected) > tol)
+  {
+    std::cerr << ">>> FAILURE: " << name << " is " << value << ", expected "
+              << expected << "\n";
+    return 1;
+  }
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  int fails = 0;
+  int rank, nranks;
+
+  MPI_Init(&argc, &argv);
+  MPI_Comm comm = MPI_COMM_WORLD;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &nranks);
+
+  if (rank == 0)
+  {
+    std::cout << "Testing SUNProfiler with " << nranks << " MPI ranks\n";
+  }
+
+  SUNProfiler prof = nullptr;
+  int flag = SUNProfiler_Create(comm, "SUNProfiler MPI Test", &prof);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_Create returned " << flag << "\n";
+    MPI_Abort(comm, 1);
+  }
+
+  // Timed region with counts that differ on every rank
+  SUNProfiler_Begin(prof, "work");
+  std::this_thread::sleep_for(std::chrono::milliseconds(10 * (rank + 1)));
+  SUNProfiler_End(prof, "work");
+
+  flag = SUNProfiler_AddCounts(prof, "work", (rank + 1) * 1.0e9,
+                               2.0 * (rank + 1) * 1.0e9);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_AddCounts returned " << flag << "\n";
+    MPI_Abort(comm, 1);
+  }
+
+  // Maximum and average time of the region over all ranks
+  double elapsed = 0.0;
+  double maximum = 0.0;
+  double average = 0.0;
+  SUNProfiler_GetElapsedTime(prof, "work", &elapsed);
+  MPI_Reduce(&elapsed, &maximum, 1, MPI_DOUBLE, MPI_MAX, 0, comm);
+  MPI_Reduce(&elapsed, &average, 1, MPI_DOUBLE, MPI_SUM, 0, comm);
+  average /= nranks;
+
+  // Print the timers on rank 0 to a temporary file and read them back
+  FILE* fp = (rank == 0) ? std::tmpfile() : stdout;
+  if (fp == nullptr)
+  {
+    std::cerr << ">>> FAILURE: unable to open a temporary file\n";
+    MPI_Abort(comm, 1);
+  }
+
+  flag = SUNProfiler_Print(prof, fp);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_Print returned " << flag << "\n";
+    MPI_Abort(comm, 1);
+  }
+
+  if (rank == 0)
+  {
+    char line[512];
+    char name[64];
+    double percent, max_time, avg_time, gbytes, gflops;
+    long count;
+    bool found = false;
+
+    std::rewind(fp);
+    while (std::fgets(line, sizeof(line), fp))
+    {
+      if (std::sscanf(line, "%63s %lf%% %lfs %lfs %ld %lf %lf", name, &percent,
+                      &max_time, &avg_time, &count, &gbytes, &gflops) == 7 &&
+          std::strcmp(name, "work") == 0)
+      {
+        found = true;
+        break;
+      }
+    }
+    std::fclose(fp);
+
+    if (!found)
+    {
+      std::cerr << ">>> FAILURE: no rates were printed for the timer\n";
+      fails++;
+    }
+    else
+    {
+      // sum over ranks of (r + 1) GB and 2 (r + 1) GFLOP
+      double total = 0.5 * nranks * (nranks + 1);
+
+      fails += check("maximum time", max_time, maximum, 1.0e-6);
+      fails += check("average time", avg_time, average, 1.0e-6);
+      fails += check("GB/s", gbytes, total / max_time,
+                     1.0e-3 * total / max_time + 1.0e-3);
+      fails += check("GFLOP/s", gflops, 2.0 * total / max_time,
+                     2.0e-3 * total / max_time + 1.0e-3);
+    }
+  }
+
+  MPI_Bcast(&fails, 1, MPI_INT, 0, comm);
+
+  flag = SUNProfiler_Free(&prof);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_Free returned " << flag << "\n";
+    fails++;
+  }
+
+  if (rank == 0 && !fails) { std::cout << "SUCCESS - test complete\n"; }
+
+  MPI_Finalize();
+
+  return fails ? 1 : 0;
+}
@@ -0,0 +1,313 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the testing routine to check the SUNLinSol BlockDiag
+ * module implementation.
+ * -----------------------------------------------------------------
+ */
+
+#include <math.h>
+#include <nvector/nvector_serial.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sundials/sundials_dense.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+#include <sunlinsol/sunlinsol_blockdiag.h>
+#include <sunmatrix/sunmatrix_blockdiag.h>
+
+#include "test_sunlinsol.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+static int Test_NonFiniteMultipliers(SUNContext sunctx);
+
+/* ----------------------------------------------------------------------
+ * SUNLinSol_BlockDiag Testing Routine
+ * --------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  int fails = 0;               /* counter for test failures  */
+  sunindextype nblocks, bsize; /* number and size of blocks  */
+  SUNLinearSolver LS;          /* solver object              */
+  SUNMatrix A, B;              /* test matrices              */
+  N_Vector x, y, b;            /* test vectors               */
+  int print_timing;
+  int print_on_fail;
+  int nthreads;
+  sunindextype i, j, k;
+  sunrealtype *Ak, *xdata;
+  SUNContext sunctx;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    printf("ERROR: SUNContext_Create failed\n");
+    return (-1);
+  }
+
+  /* check input and set matrix dimensions */
+  if (argc < 4)
+  {
+    printf("ERROR: THREE (3) Inputs required: number of blocks, block size, "
+           "print timing \n");
+    return (-1);
+  }
+
+  nblocks = (sunindextype)atol(argv[1]);
+  if (nblocks <= 0)
+  {
+    printf("ERROR: number of blocks must be a positive integer \n");
+    return (-1);
+  }
+
+  bsize = (sunindextype)atol(argv[2]);
+  if (bsize <= 0)
+  {
+    printf("ERROR: block size must be a positive integer \n");
+    return (-1);
+  }
+
+  print_timing = atoi(argv[3]);
+  SetTiming(print_timing);
+
+  print_on_fail = 0;
+  if (argc >= 5) { print_on_fail = atoi(argv[4]); }
+
+  nthreads = 1;
+  if (argc >= 6) { nthreads = atoi(argv[5]); }
+
+  printf("\nBlock-diagonal linear solver test: %ld blocks of size %ld, "
+         "threads %d\n\n",
+         (long int)nblocks, (long int)bsize, nthreads);
+
+  /* Create matrices and vectors */
+  A = SUNBlockDiagMatrix(nblocks, bsize, sunctx);
+  B = SUNBlockDiagMatrix(nblocks, bsize, sunctx);
+  x = N_VNew_Serial(nblocks * bsize, sunctx);
+  y = N_VNew_Serial(nblocks * bsize, sunctx);
+  b = N_VNew_Serial(nblocks * bsize, sunctx);
+
+  /* Fill each block with uniform random data in [0,1/bsize] and add the
+     anti-identity to ensure the solver needs to do row-swapping */
+  for (k = 0; k < nblocks; k++)
+  {
+    Ak = SUNBlockDiagMatrix_Block(A, k);
+    for (j = 0; j < bsize; j++)
+    {
+      for (i = 0; i < bsize; i++)
+      {
+        Ak[j * bsize + i] = (sunrealtype)rand() / (sunrealtype)RAND_MAX / bsize;
+      }
+      Ak[j * bsize + (bsize - 1 - j)] += ONE;
+    }
+  }
+
+  /* Fill x vector with uniform random data in [0,1] */
+  xdata = N_VGetArrayPointer(x);
+  for (i = 0; i < nblocks * bsize; i++)
+  {
+    xdata[i] = (sunrealtype)rand() / (sunrealtype)RAND_MAX;
+  }
+
+  /* copy A and x into B and y to print in case of solver failure */
+  SUNMatCopy(A, B);
+  N_VScale(ONE, x, y);
+
+  /* create right-hand side vector for linear solve */
+  fails = SUNMatMatvec(A, x, b);
+  if (fails)
+  {
+    printf("FAIL: SUNLinSol SUNMatMatvec failure\n");
+
+    /* Free matrices and vectors */
+    SUNMatDestroy(A);
+    SUNMatDestroy(B);
+    N_VDestroy(x);
+    N_VDestroy(y);
+    N_VDestroy(b);
+
+    return (1);
+  }
+
+  /* Create block-diagonal linear solver */
+  LS = SUNLinSol_BlockDiag(x, A, sunctx);
+  fails += SUNLinSol_BlockDiagSetNumThreads(LS, nthreads);
+
+  /* Run Tests */
+  fails += Test_SUNLinSolInitialize(LS, 0);
+  fails += Test_SUNLinSolSetup(LS, A, 0);
+  fails += Test_SUNLinSolSolve(LS, A, x, b, 100 * SUN_UNIT_ROUNDOFF, SUNTRUE, 0);
+
+  fails += Test_SUNLinSolGetType(LS, SUNLINEARSOLVER_DIRECT, 0);
+  fails += Test_SUNLinSolGetID(LS, SUNLINEARSOLVER_BLOCKDIAG, 0);
+  fails += Test_SUNLinSolLastFlag(LS, 0);
+  fails += Test_SUNLinSolSpace(LS, 0);
+
+  /* A singular block must be reported as a factorization failure */
+  if (bsize > 1)
+  {
+    Ak = SUNBlockDiagMatrix_Block(B, nblocks - 1);
+    for (i = 0; i < bsize; i++) { Ak[bsize + i] = ZERO; }
+    if (SUNLinSolSetup(LS, B) != SUNLS_LUFACT_FAIL ||
+        SUNLinSolLastFlag(LS) <= (nblocks - 1) * bsize)
+    {
+      printf(">>> FAILED test -- SUNLinSolSetup singular block check \n");
+      fails++;
+    }
+    else
+    {
+      printf("    PASSED test -- SUNLinSolSetup singular block check \n");
+    }
+    SUNMatCopy(A, B);
+  }
+
+  fails += Test_NonFiniteMultipliers(sunctx);
+
+  /* Print result */
+  if (fails)
+  {
+    printf("FAIL: SUNLinSol module failed %i tests \n \n", fails);
+    if (print_on_fail)
+    {
+      printf("\nA =\n");
+      SUNBlockDiagMatrix_Print(B, stdout);
+      printf("\nx (original) =\n");
+      N_VPrint_Serial(y);
+      printf("\nx (computed) =\n");
+      N_VPrint_Serial(x);
+    }
+  }
+  else { printf("SUCCESS: SUNLinSol module passed all tests \n \n"); }
+
+  /* Free solver, matrix and vectors */
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  SUNMatDestroy(B);
+  N_VDestroy(x);
+  N_VDestroy(y);
+  N_VDestroy(b);
+  SUNContext_Free(&sunctx);
+
+  return (fails);
+}
+
+/* ----------------------------------------------------------------------
+ * Check that a block with non-finite entries is factored exactly as the
+ * dense LU factorization does, i.e., columns with a zero multiplier are not
+ * updated with the NaN produced by scaling Inf by the reciprocal pivot
+ * --------------------------------------------------------------------*/
+static int Test_NonFiniteMultipliers(SUNContext sunctx)
+{
+  int fails = 0;
+  sunindextype i, j, n = 3;
+  sunindextype p[3];
+  sunrealtype a[9], *cols[3], *Ak, lu, ref;
+  SUNMatrix A;
+  N_Vector v;
+  SUNLinearSolver LS;
+  SUNLinearSolverContent_BlockDiag content;
+
+  A  = SUNBlockDiagMatrix(2, n, sunctx);
+  v  = N_VNew_Serial(2 * n, sunctx);
+  LS = SUNLinSol_BlockDiag(v, A, sunctx);
+
+  /* block 0 is the identity, block 1 has two infinite entries in column 1 */
+  for (j = 0; j < 2; j++)
+  {
+    Ak = SUNBlockDiagMatrix_Block(A, j);
+    for (i = 0; i < n * n; i++) { Ak[i] = ZERO; }
+    for (i = 0; i < n; i++) { Ak[i * n + i] = ONE; }
+  }
+  Ak        = SUNBlockDiagMatrix_Block(A, 1);
+  Ak[n + 1] = (sunrealtype)INFINITY;
+  Ak[n + 2] = (sunrealtype)INFINITY;
+
+  /* reference factorization of block 1 */
+  for (i = 0; i < n * n; i++) { a[i] = Ak[i]; }
+  for (j = 0; j < n; j++) { cols[j] = a + j * n; }
+  SUNDlsMat_denseGETRF(cols, n, n, p);
+
+  SUNLinSolInitialize(LS);
+  SUNLinSolSetup(LS, A);
+
+  content = (SUNLinearSolverContent_BlockDiag)LS->content;
+  for (j = 0; j < n; j++)
+  {
+    for (i = 0; i < n; i++)
+    {
+      lu  = content->factors[(j * n + i) * SUNLINSOL_BLOCKDIAG_BATCH + 1];
+      ref = cols[j][i];
+      if (!(lu == ref || (isnan(lu) && isnan(ref))))
+      {
+        printf(">>> FAILED test -- SUNLinSolSetup, non-finite multipliers, "
+               "LU(%ld,%ld) = %" GSYM " (dense %" GSYM ") \n",
+               (long int)i, (long int)j, lu, ref);
+        fails++;
+      }
+    }
+  }
+  if (!isfinite(content->factors[(2 * n + 2) * SUNLINSOL_BLOCKDIAG_BATCH + 1]))
+  {
+    printf(">>> FAILED test -- SUNLinSolSetup, non-finite multipliers, "
+           "U(2,2) is not finite \n");
+    fails++;
+  }
+  if (!fails)
+  {
+    printf("    PASSED test -- SUNLinSolSetup, non-finite multipliers \n");
+  }
+
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(v);
+
+  return fails;
+}
+
+/* ----------------------------------------------------------------------
+ * Implementation-specific 'check' routines
+ * --------------------------------------------------------------------*/
+int check_vector(N_Vector X, N_Vector Y, sunrealtype tol)
+{
+  int failure = 0;
+  sunindextype i, local_length;
+  sunrealtype *Xdata, *Ydata, maxerr;
+
+  Xdata        = N_VGetArrayPointer(X);
+  Ydata        = N_VGetArrayPointer(Y);
+  local_length = N_VGetLength_Serial(X);
+
+  /* check vector data */
+  for (i = 0; i < local_length; i++)
+  {
+    failure += SUNRCompareTol(Xdata[i], Ydata[i], tol);
+  }
+
+  if (failure > ZERO)
+  {
+    maxerr = ZERO;
+    for (i = 0; i < local_length; i++)
+    {
+      maxerr = SUNMAX(SUNRabs(Xdata[i] - Ydata[i]), maxerr);
+    }
+    printf("check err failure: maxerr = %" GSYM " (tol = %" GSYM ")\n", maxerr,
+           tol);
+    return (1);
+  }
+  else { return (0); }
+}
+
+void sync_device(void) {}
@@ -17,6 +17,7 @@
  * -----------------------------------------------------------------
  */
 
+#include <math.h>
 #include <nvector/nvector_serial.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -33,6 +34,8 @@
 #define GSYM "g"
 #endif
 
+static int Test_NonFiniteMultipliers(SUNContext sunctx);
+
 /* ----------------------------------------------------------------------
  * SUNLinSol_Dense Testing Routine
  * --------------------------------------------------------------------*/
@@ -45,6 +48,7 @@ int main(int argc, char* argv[])
   N_Vector x, y, b;        /* test vectors               */
   int print_timing;
   int print_on_fail;
+  int nthreads;
   sunindextype j, k;
   sunrealtype *colj, *xdata, *colIj;
   SUNContext sunctx;
@@ -75,9 +79,13 @@ int main(int argc, char* argv[])
   SetTiming(print_timing);
 
   print_on_fail = 0;
-  if (argc == 4) { print_on_fail = atoi(argv[3]); }
+  if (argc >= 4) { print_on_fail = atoi(argv[3]); }
+
+  nthreads = 1;
+  if (argc >= 5) { nthreads = atoi(argv[4]); }
 
-  printf("\nDense linear solver test: size %ld\n\n", (long int)cols);
+  printf("\nDense linear solver test: size %ld, threads %d\n\n", (long int)cols,
+         nthreads);
 
   /* Create matrices and vectors */
   A = SUNDenseMatrix(rows, cols, sunctx);
@@ -147,6 +155,7 @@ int main(int argc, char* argv[])
 
   /* Create dense linear solver */
   LS = SUNLinSol_Dense(x, A, sunctx);
+  fails += SUNLinSol_DenseSetNumThreads(LS, nthreads);
 
   /* Run Tests */
   fails += Test_SUNLinSolInitialize(LS, 0);
@@ -157,6 +166,7 @@ int main(int argc, char* argv[])
   fails += Test_SUNLinSolGetID(LS, SUNLINEARSOLVER_DENSE, 0);
   fails += Test_SUNLinSolLastFlag(LS, 0);
   fails += Test_SUNLinSolSpace(LS, 0);
+  fails += Test_NonFiniteMultipliers(sunctx);
 
   /* Print result */
   if (fails)
@@ -189,6 +199,58 @@ int main(int argc, char* argv[])
   return (fails);
 }
 
+/* ----------------------------------------------------------------------
+ * Factor a matrix whose first column of L holds a NaN (Inf / Inf). Row 0
+ * of U is zero except in columns 0, 64, and 100, so the factorization must
+ * leave row 101 of columns 65 to 67 untouched rather than add 0 * NaN.
+ * Column 64 is the first column after the first panel of the blocked
+ * factorization and the first column of a group of four updated together.
+ * --------------------------------------------------------------------*/
+static int Test_NonFiniteMultipliers(SUNContext sunctx)
+{
+  int fails = 0;
+  sunindextype i, j, n = 102;
+  SUNMatrix A;
+  N_Vector v;
+  SUNLinearSolver LS;
+
+  A  = SUNDenseMatrix(n, n, sunctx);
+  v  = N_VNew_Serial(n, sunctx);
+  LS = SUNLinSol_Dense(v, A, sunctx);
+
+  for (j = 0; j < n; j++)
+  {
+    for (i = 0; i < n; i++) { SM_ELEMENT_D(A, i, j) = (i == j) ? ONE : ZERO; }
+  }
+  SM_ELEMENT_D(A, 100, 0)  = (sunrealtype)INFINITY;
+  SM_ELEMENT_D(A, 101, 0)  = (sunrealtype)INFINITY;
+  SM_ELEMENT_D(A, 100, 64) = ONE;
+
+  SUNLinSolInitialize(LS);
+  SUNLinSolSetup(LS, A);
+
+  for (j = 65; j < 68; j++)
+  {
+    if (SM_ELEMENT_D(A, 101, j) != ZERO)
+    {
+      printf(">>> FAILED test -- SUNLinSolSetup, non-finite multipliers, "
+             "U(101,%ld) = %" GSYM " \n",
+             (long int)j, SM_ELEMENT_D(A, 101, j));
+      fails++;
+    }
+  }
+  if (!fails)
+  {
+    printf("    PASSED test -- SUNLinSolSetup, non-finite multipliers \n");
+  }
+
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(v);
+
+  return fails;
+}
+
 /* ----------------------------------------------------------------------
  * Implementation-specific 'check' routines
  * --------------------------------------------------------------------*/
@@ -0,0 +1,291 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the testing routine to check the SUNMatrix BlockDiag
+ * module implementation.
+ * -----------------------------------------------------------------
+ */
+
+#include <nvector/nvector_serial.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+#include <sunmatrix/sunmatrix_blockdiag.h>
+
+#include "test_sunmatrix.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+/* ----------------------------------------------------------------------
+ * Main SUNMatrix Testing Routine
+ * --------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  int fails = 0;                 /* counter for test failures */
+  sunindextype nblocks, bsize;   /* number and size of blocks */
+  N_Vector x, y;                 /* test vectors              */
+  sunrealtype *xdata, *ydata;    /* pointers to vector data   */
+  SUNMatrix A, AT, I;            /* test matrices             */
+  sunrealtype *Ablock, *ATblock; /* pointers to matrix blocks */
+  int print_timing;
+  sunindextype i, j, k;
+  SUNContext sunctx;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    printf("ERROR: SUNContext_Create failed\n");
+    return (-1);
+  }
+
+  /* check input and set matrix dimensions */
+  if (argc < 4)
+  {
+    printf("ERROR: THREE (3) Input required: number of blocks, block size, "
+           "print timing \n");
+    return (-1);
+  }
+
+  nblocks = (sunindextype)atol(argv[1]);
+  if (nblocks <= 0)
+  {
+    printf("ERROR: number of blocks must be a positive integer \n");
+    return (-1);
+  }
+
+  bsize = (sunindextype)atol(argv[2]);
+  if (bsize <= 0)
+  {
+    printf("ERROR: block size must be a positive integer \n");
+    return (-1);
+  }
+
+  print_timing = atoi(argv[3]);
+  SetTiming(print_timing);
+
+  printf("\nBlock-diagonal matrix test: %ld blocks of size %ld by %ld\n\n",
+         (long int)nblocks, (long int)bsize, (long int)bsize);
+
+  /* Create vectors and matrices */
+  x  = N_VNew_Serial(nblocks * bsize, sunctx);
+  y  = N_VNew_Serial(nblocks * bsize, sunctx);
+  A  = SUNBlockDiagMatrix(nblocks, bsize, sunctx);
+  AT = SUNBlockDiagMatrix(nblocks, bsize, sunctx);
+  I  = SUNBlockDiagMatrix(nblocks, bsize, sunctx);
+
+  /* Fill matrices and vectors */
+  for (k = 0; k < nblocks; k++)
+  {
+    Ablock  = SUNBlockDiagMatrix_Block(A, k);
+    ATblock = SUNBlockDiagMatrix_Block(AT, k);
+    for (j = 0; j < bsize; j++)
+    {
+      for (i = 0; i < bsize; i++)
+      {
+        Ablock[j * bsize + i]  = (k + 1) * (j + 1) * (i + j);
+        ATblock[i * bsize + j] = (k + 1) * (j + 1) * (i + j);
+      }
+    }
+  }
+
+  SUNMatScaleAddI(ZERO, I);
+
+  xdata = N_VGetArrayPointer(x);
+  for (k = 0; k < nblocks; k++)
+  {
+    for (j = 0; j < bsize; j++) { xdata[k * bsize + j] = ONE / (j + 1); }
+  }
+
+  /* y_k = A_k x_k, where row i of A_k x_k is (k+1) * sum_j (i+j) */
+  ydata = N_VGetArrayPointer(y);
+  for (k = 0; k < nblocks; k++)
+  {
+    for (i = 0; i < bsize; i++)
+    {
+      ydata[k * bsize + i] = (k + 1) * HALF * bsize * (2 * i + bsize - 1);
+    }
+  }
+
+  /* SUNMatrix Tests */
+  fails += Test_SUNMatGetID(A, SUNMATRIX_BLOCKDIAG, 0);
+  fails += Test_SUNMatClone(A, 0);
+  fails += Test_SUNMatCopy(A, 0);
+  fails += Test_SUNMatZero(A, 0);
+  fails += Test_SUNMatScaleAdd(A, I, 0);
+  fails += Test_SUNMatScaleAddI(A, I, 0);
+  fails += Test_SUNMatMatvec(A, x, y, 0);
+  fails += Test_SUNMatHermitianTransposeVec(A, AT, x, y, 0);
+  fails += Test_SUNMatSpace(A, 0);
+
+  /* Print result */
+  if (fails)
+  {
+    printf("FAIL: SUNMatrix module failed %i tests \n \n", fails);
+    printf("\nA =\n");
+    SUNBlockDiagMatrix_Print(A, stdout);
+    printf("\nI =\n");
+    SUNBlockDiagMatrix_Print(I, stdout);
+    printf("\nx =\n");
+    N_VPrint_Serial(x);
+    printf("\ny =\n");
+    N_VPrint_Serial(y);
+  }
+  else { printf("SUCCESS: SUNMatrix module passed all tests \n \n"); }
+
+  /* Free vectors and matrices */
+  N_VDestroy(x);
+  N_VDestroy(y);
+  SUNMatDestroy(A);
+  SUNMatDestroy(AT);
+  SUNMatDestroy(I);
+  SUNContext_Free(&sunctx);
+
+  return (fails);
+}
+
+/* ----------------------------------------------------------------------
+ * Check matrix
+ * --------------------------------------------------------------------*/
+int check_matrix(SUNMatrix A, SUNMatrix B, sunrealtype tol)
+{
+  int failure = 0;
+  sunrealtype *Adata, *Bdata;
+  sunindextype Aldata, Bldata;
+  sunindextype i;
+
+  /* get data pointers */
+  Adata = SUNBlockDiagMatrix_Data(A);
+  Bdata = SUNBlockDiagMatrix_Data(B);
+
+  /* get and check data lengths */
+  Aldata = SUNBlockDiagMatrix_LData(A);
+  Bldata = SUNBlockDiagMatrix_LData(B);
+
+  if (Aldata != Bldata)
+  {
+    printf(">>> ERROR: check_matrix: Different data array lengths \n");
+    return (1);
+  }
+
+  /* compare data */
+  for (i = 0; i < Aldata; i++)
+  {
+    failure += SUNRCompareTol(Adata[i], Bdata[i], tol);
+  }
+
+  if (failure > ZERO) { return (1); }
+  else { return (0); }
+}
+
+int check_matrix_entry(SUNMatrix A, sunrealtype val, sunrealtype tol)
+{
+  int failure = 0;
+  sunrealtype* Adata;
+  sunindextype Aldata;
+  sunindextype i;
+
+  /* get data pointer */
+  Adata = SUNBlockDiagMatrix_Data(A);
+
+  /* compare data */
+  Aldata = SUNBlockDiagMatrix_LData(A);
+  for (i = 0; i < Aldata; i++)
+  {
+    failure += SUNRCompareTol(Adata[i], val, tol);
+  }
+
+  if (failure > ZERO)
+  {
+    printf("Check_matrix_entry failures:\n");
+    for (i = 0; i < Aldata; i++)
+    {
+      if (SUNRCompareTol(Adata[i], val, tol) != 0)
+      {
+        printf("  Adata[%ld] = %" GSYM " != %" GSYM " (err = %" GSYM ")\n",
+               (long int)i, Adata[i], val, SUNRabs(Adata[i] - val));
+      }
+    }
+  }
+
+  if (failure > ZERO) { return (1); }
+  else { return (0); }
+}
+
+int check_vector(N_Vector x, N_Vector y, sunrealtype tol)
+{
+  int failure = 0;
+  sunrealtype *xdata, *ydata;
+  sunindextype xldata, yldata;
+  sunindextype i;
+
+  /* get vector data */
+  xdata = N_VGetArrayPointer(x);
+  ydata = N_VGetArrayPointer(y);
+
+  /* check data lengths */
+  xldata = N_VGetLength(x);
+  yldata = N_VGetLength(y);
+
+  if (xldata != yldata)
+  {
+    printf(">>> ERROR: check_vector: Different data array lengths \n");
+    return (1);
+  }
+
+  /* check vector data */
+  for (i = 0; i < xldata; i++)
+  {
+    failure += SUNRCompareTol(xdata[i], ydata[i], tol);
+  }
+
+  if (failure > ZERO)
+  {
+    printf("Check_vector failures:\n");
+    for (i = 0; i < xldata; i++)
+    {
+      if (SUNRCompareTol(xdata[i], ydata[i], tol) != 0)
+      {
+        printf("  xdata[%ld] = %" GSYM " != %" GSYM " (err = %" GSYM ")\n",
+               (long int)i, xdata[i], ydata[i], SUNRabs(xdata[i] - ydata[i]));
+      }
+    }
+  }
+
+  if (failure > ZERO) { return (1); }
+  else { return (0); }
+}
+
+sunbooleantype has_data(SUNMatrix A)
+{
+  sunrealtype* Adata = SUNBlockDiagMatrix_Data(A);
+  if (Adata == NULL) { return SUNFALSE; }
+  else { return SUNTRUE; }
+}
+
+sunbooleantype is_square(SUNMatrix A)
+{
+  if (SUNBlockDiagMatrix_Rows(A) == SUNBlockDiagMatrix_Columns(A))
+  {
+    return SUNTRUE;
+  }
+  else { return SUNFALSE; }
+}
+
+void sync_device(SUNMatrix A)
+{
+  /* not running on GPU, just return */
+  return;
+}
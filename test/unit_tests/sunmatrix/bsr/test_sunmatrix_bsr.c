@@ -0,0 +1,443 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the testing routine to check the SUNMatrix BSR module
+ * implementation.
+ * -----------------------------------------------------------------
+ */
+
+#include <nvector/nvector_serial.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+#include <sunmatrix/sunmatrix_bsr.h>
+#include <sunmatrix/sunmatrix_sparse.h>
+
+#include "test_sunmatrix.h"
+
+#define EIGHT SUN_RCONST(8.0)
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+/* Fill a block tridiagonal BSR matrix, or its transpose, with nonzero
+   entries */
+static void fill_block_tridiagonal(SUNMatrix A, sunbooleantype transpose);
+
+/* ----------------------------------------------------------------------
+ * Main SUNMatrix Testing Routine
+ * --------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  int fails = 0;               /* counter for test failures */
+  sunindextype nbrows, bsize;  /* number and size of blocks */
+  N_Vector x, y, z, w;         /* test vectors              */
+  sunrealtype *xdata, *ydata;  /* pointers to vector data   */
+  SUNMatrix A, AT, I, B, S, C; /* test matrices             */
+  int print_timing;
+  sunindextype ib, i, j, p, nnzb;
+  SUNContext sunctx;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    printf("ERROR: SUNContext_Create failed\n");
+    return (-1);
+  }
+
+  /* check input and set matrix dimensions */
+  if (argc < 4)
+  {
+    printf("ERROR: THREE (3) Input required: number of block rows, block "
+           "size, print timing \n");
+    return (-1);
+  }
+
+  nbrows = (sunindextype)atol(argv[1]);
+  if (nbrows <= 0)
+  {
+    printf("ERROR: number of block rows must be a positive integer \n");
+    return (-1);
+  }
+
+  bsize = (sunindextype)atol(argv[2]);
+  if (bsize <= 0)
+  {
+    printf("ERROR: block size must be a positive integer \n");
+    return (-1);
+  }
+
+  print_timing = atoi(argv[3]);
+  SetTiming(print_timing);
+
+  printf("\nBSR matrix test: %ld by %ld block tridiagonal matrix with %ld by "
+         "%ld blocks\n\n",
+         (long int)nbrows, (long int)nbrows, (long int)bsize, (long int)bsize);
+
+  /* Create vectors and matrices */
+  nnzb = 3 * nbrows - 2;
+  x    = N_VNew_Serial(nbrows * bsize, sunctx);
+  y    = N_VNew_Serial(nbrows * bsize, sunctx);
+  z    = N_VNew_Serial(nbrows * bsize, sunctx);
+  w    = N_VNew_Serial(nbrows * bsize, sunctx);
+  A    = SUNBSRMatrix(nbrows, nbrows, bsize, nnzb, sunctx);
+  AT   = SUNBSRMatrix(nbrows, nbrows, bsize, nnzb, sunctx);
+  I    = SUNBSRMatrix(nbrows, nbrows, bsize, 0, sunctx);
+
+  /* Fill matrices and vectors, the identity is formed by inserting the
+     diagonal blocks into an empty matrix */
+  fill_block_tridiagonal(A, SUNFALSE);
+  fill_block_tridiagonal(AT, SUNTRUE);
+  SUNMatScaleAddI(ZERO, I);
+
+  xdata = N_VGetArrayPointer(x);
+  for (i = 0; i < nbrows * bsize; i++) { xdata[i] = ONE / (i % 7 + 1); }
+
+  /* reference product y = A x computed entry by entry */
+  ydata = N_VGetArrayPointer(y);
+  for (i = 0; i < nbrows * bsize; i++) { ydata[i] = ZERO; }
+  for (ib = 0; ib < nbrows; ib++)
+  {
+    for (p = SUNBSRMatrix_BlockRowPointers(A)[ib];
+         p < SUNBSRMatrix_BlockRowPointers(A)[ib + 1]; p++)
+    {
+      for (i = 0; i < bsize; i++)
+      {
+        for (j = 0; j < bsize; j++)
+        {
+          ydata[ib * bsize + i] +=
+            SM_ELEMENT_BSR(A, p, i, j) *
+            xdata[SUNBSRMatrix_BlockColumnIndices(A)[p] * bsize + j];
+        }
+      }
+    }
+  }
+
+  /* SUNMatrix Tests */
+  fails += Test_SUNMatGetID(A, SUNMATRIX_BSR, 0);
+  fails += Test_SUNMatClone(A, 0);
+  fails += Test_SUNMatCopy(A, 0);
+  fails += Test_SUNMatZero(A, 0);
+  fails += Test_SUNMatScaleAdd(A, I, 0);
+  fails += Test_SUNMatScaleAddI(A, I, 0);
+  fails += Test_SUNMatMatvec(A, x, y, 0);
+  fails += Test_SUNMatHermitianTransposeVec(A, AT, x, y, 0);
+  fails += Test_SUNMatSpace(A, 0);
+
+  /* Conversions to and from CSR and CSC sparse matrices */
+  S = SUNSparseFromBSRMatrix(A, ZERO, CSR_MAT);
+  if (SUNSparseMatrix_NNZ(S) != nnzb * bsize * bsize)
+  {
+    printf(">>> FAILED test -- SUNSparseFromBSRMatrix (CSR) nnz\n");
+    fails++;
+  }
+  SUNMatMatvec(S, x, z);
+  if (check_vector(y, z, 100 * SUN_UNIT_ROUNDOFF))
+  {
+    printf(">>> FAILED test -- SUNSparseFromBSRMatrix (CSR) matvec\n");
+    fails++;
+  }
+  B = SUNBSRFromSparseMatrix(S, bsize);
+  if (check_matrix(A, B, ZERO))
+  {
+    printf(">>> FAILED test -- SUNBSRFromSparseMatrix (CSR)\n");
+    fails++;
+  }
+  else { printf("    PASSED test -- BSR to and from CSR\n"); }
+  SUNMatDestroy(S);
+  SUNMatDestroy(B);
+
+  S = SUNSparseFromBSRMatrix(A, ZERO, CSC_MAT);
+  B = SUNBSRFromSparseMatrix(S, bsize);
+  if (check_matrix(A, B, ZERO))
+  {
+    printf(">>> FAILED test -- SUNBSRFromSparseMatrix (CSC)\n");
+    fails++;
+  }
+  else { printf("    PASSED test -- BSR to and from CSC\n"); }
+  SUNMatDestroy(S);
+  SUNMatDestroy(B);
+
+  /* B = 2A + A^T uses the in-place update since A and A^T have the same
+     block pattern, C = B - I merges the pattern of I into a copy of I */
+  B = SUNMatClone(A);
+  SUNMatCopy(A, B);
+  SUNMatScaleAdd(TWO, B, AT);
+  C = SUNMatClone(I);
+  SUNMatCopy(I, C);
+  SUNMatScaleAdd(-ONE, C, B);
+  SUNMatMatvec(C, x, z);
+  SUNMatMatvec(AT, x, w);
+  N_VLinearSum(TWO, y, ONE, w, w);
+  N_VLinearSum(ONE, w, -ONE, x, w);
+  if (SUNBSRMatrix_BlockRowPointers(C)[nbrows] != nnzb ||
+      check_vector(w, z, 100 * SUN_UNIT_ROUNDOFF))
+  {
+    printf(">>> FAILED test -- SUNMatScaleAdd_BSR pattern merge\n");
+    fails++;
+  }
+  else { printf("    PASSED test -- SUNMatScaleAdd_BSR pattern merge\n"); }
+  SUNMatDestroy(B);
+  SUNMatDestroy(C);
+
+  /* C = 2C + I with an unsorted first block row that holds its diagonal block
+     after an off-diagonal one and a second block row without a diagonal */
+  C = SUNBSRMatrix(2, 2, 1, 3, sunctx);
+  SUNBSRMatrix_BlockRowPointers(C)[0]   = 0;
+  SUNBSRMatrix_BlockRowPointers(C)[1]   = 2;
+  SUNBSRMatrix_BlockRowPointers(C)[2]   = 3;
+  SUNBSRMatrix_BlockColumnIndices(C)[0] = 1;
+  SUNBSRMatrix_BlockColumnIndices(C)[1] = 0;
+  SUNBSRMatrix_BlockColumnIndices(C)[2] = 0;
+  SUNBSRMatrix_Data(C)[0]               = TWO;
+  SUNBSRMatrix_Data(C)[1]               = ONE;
+  SUNBSRMatrix_Data(C)[2]               = EIGHT;
+  SUNMatScaleAddI(TWO, C);
+  if (SUNBSRMatrix_BlockRowPointers(C)[1] != 2 ||
+      SUNBSRMatrix_BlockRowPointers(C)[2] != 4 ||
+      SUNBSRMatrix_BlockColumnIndices(C)[0] != 1 ||
+      SUNBSRMatrix_BlockColumnIndices(C)[1] != 0 ||
+      SUNBSRMatrix_BlockColumnIndices(C)[2] != 0 ||
+      SUNBSRMatrix_BlockColumnIndices(C)[3] != 1 ||
+      SUNRCompare(SUNBSRMatrix_Data(C)[0], TWO * TWO) ||
+      SUNRCompare(SUNBSRMatrix_Data(C)[1], TWO + ONE) ||
+      SUNRCompare(SUNBSRMatrix_Data(C)[2], TWO * EIGHT) ||
+      SUNRCompare(SUNBSRMatrix_Data(C)[3], ONE))
+  {
+    printf(">>> FAILED test -- SUNMatScaleAddI_BSR unsorted block rows\n");
+    fails++;
+  }
+  else
+  {
+    printf("    PASSED test -- SUNMatScaleAddI_BSR unsorted block rows\n");
+  }
+  SUNMatDestroy(C);
+
+  /* Print result */
+  if (fails)
+  {
+    printf("FAIL: SUNMatrix module failed %i tests \n \n", fails);
+    printf("\nA =\n");
+    SUNBSRMatrix_Print(A, stdout);
+    printf("\nI =\n");
+    SUNBSRMatrix_Print(I, stdout);
+    printf("\nx =\n");
+    N_VPrint_Serial(x);
+    printf("\ny =\n");
+    N_VPrint_Serial(y);
+  }
+  else { printf("SUCCESS: SUNMatrix module passed all tests \n \n"); }
+
+  /* Free vectors and matrices */
+  N_VDestroy(x);
+  N_VDestroy(y);
+  N_VDestroy(z);
+  N_VDestroy(w);
+  SUNMatDestroy(A);
+  SUNMatDestroy(AT);
+  SUNMatDestroy(I);
+  SUNContext_Free(&sunctx);
+
+  return (fails);
+}
+
+/* ----------------------------------------------------------------------
+ * Fill the block tridiagonal test matrix
+ * --------------------------------------------------------------------*/
+void fill_block_tridiagonal(SUNMatrix A, sunbooleantype transpose)
+{
+  sunindextype MB, bs, ib, jb, i, j, p, row, col;
+  sunindextype *rowptrs, *colidx;
+
+  MB      = SUNBSRMatrix_BlockRows(A);
+  bs      = SUNBSRMatrix_BlockSize(A);
+  rowptrs = SUNBSRMatrix_BlockRowPointers(A);
+  colidx  = SUNBSRMatrix_BlockColumnIndices(A);
+
+  p = 0;
+  for (ib = 0; ib < MB; ib++)
+  {
+    rowptrs[ib] = p;
+    for (jb = SUNMAX(ib - 1, 0); jb <= SUNMIN(ib + 1, MB - 1); jb++)
+    {
+      colidx[p] = jb;
+      for (j = 0; j < bs; j++)
+      {
+        for (i = 0; i < bs; i++)
+        {
+          /* entry (row, col) of the untransposed matrix */
+          row = transpose ? jb * bs + j : ib * bs + i;
+          col = transpose ? ib * bs + i : jb * bs + j;
+          SM_ELEMENT_BSR(A, p, i, j) = ONE + ((row + 2 * col) % 7) / EIGHT;
+        }
+      }
+      p++;
+    }
+  }
+  rowptrs[MB] = p;
+}
+
+/* ----------------------------------------------------------------------
+ * Check matrix
+ * --------------------------------------------------------------------*/
+int check_matrix(SUNMatrix A, SUNMatrix B, sunrealtype tol)
+{
+  int failure = 0;
+  sunrealtype *Adata, *Bdata;
+  sunindextype *Aptrs, *Bptrs, *Aidx, *Bidx;
+  sunindextype i, MB, nnzb, bs2;
+
+  /* check dimensions */
+  if (SUNBSRMatrix_BlockRows(A) != SUNBSRMatrix_BlockRows(B) ||
+      SUNBSRMatrix_BlockColumns(A) != SUNBSRMatrix_BlockColumns(B) ||
+      SUNBSRMatrix_BlockSize(A) != SUNBSRMatrix_BlockSize(B))
+  {
+    printf(">>> ERROR: check_matrix: Different block dimensions \n");
+    return (1);
+  }
+
+  /* get data pointers */
+  Aptrs = SUNBSRMatrix_BlockRowPointers(A);
+  Bptrs = SUNBSRMatrix_BlockRowPointers(B);
+  Aidx  = SUNBSRMatrix_BlockColumnIndices(A);
+  Bidx  = SUNBSRMatrix_BlockColumnIndices(B);
+  Adata = SUNBSRMatrix_Data(A);
+  Bdata = SUNBSRMatrix_Data(B);
+
+  /* compare block pattern */
+  MB = SUNBSRMatrix_BlockRows(A);
+  for (i = 0; i <= MB; i++) { failure += (Aptrs[i] != Bptrs[i]); }
+  if (failure > ZERO)
+  {
+    printf(">>> ERROR: check_matrix: Different block row pointers \n");
+    return (1);
+  }
+
+  nnzb = Aptrs[MB];
+  for (i = 0; i < nnzb; i++) { failure += (Aidx[i] != Bidx[i]); }
+  if (failure > ZERO)
+  {
+    printf(">>> ERROR: check_matrix: Different block column indices \n");
+    return (1);
+  }
+
+  /* compare data */
+  bs2 = SUNBSRMatrix_BlockSize(A) * SUNBSRMatrix_BlockSize(A);
+  for (i = 0; i < nnzb * bs2; i++)
+  {
+    failure += SUNRCompareTol(Adata[i], Bdata[i], tol);
+  }
+
+  if (failure > ZERO) { return (1); }
+  else { return (0); }
+}
+
+int check_matrix_entry(SUNMatrix A, sunrealtype val, sunrealtype tol)
+{
+  int failure = 0;
+  sunrealtype* Adata;
+  sunindextype Aldata;
+  sunindextype i;
+
+  /* get data pointer */
+  Adata = SUNBSRMatrix_Data(A);
+
+  /* compare data */
+  Aldata = SUNBSRMatrix_NNZB(A) * SUNBSRMatrix_BlockSize(A) *
+           SUNBSRMatrix_BlockSize(A);
+  for (i = 0; i < Aldata; i++)
+  {
+    failure += SUNRCompareTol(Adata[i], val, tol);
+  }
+
+  if (failure > ZERO)
+  {
+    printf("Check_matrix_entry failures:\n");
+    for (i = 0; i < Aldata; i++)
+    {
+      if (SUNRCompareTol(Adata[i], val, tol) != 0)
+      {
+        printf("  Adata[%ld] = %" GSYM " != %" GSYM " (err = %" GSYM ")\n",
+               (long int)i, Adata[i], val, SUNRabs(Adata[i] - val));
+      }
+    }
+  }
+
+  if (failure > ZERO) { return (1); }
+  else { return (0); }
+}
+
+int check_vector(N_Vector x, N_Vector y, sunrealtype tol)
+{
+  int failure = 0;
+  sunrealtype *xdata, *ydata;
+  sunindextype xldata, yldata;
+  sunindextype i;
+
+  /* get vector data */
+  xdata = N_VGetArrayPointer(x);
+  ydata = N_VGetArrayPointer(y);
+
+  /* check data lengths */
+  xldata = N_VGetLength(x);
+  yldata = N_VGetLength(y);
+
+  if (xldata != yldata)
+  {
+    printf(">>> ERROR: check_vector: Different data array lengths \n");
+    return (1);
+  }
+
+  /* check vector data */
+  for (i = 0; i < xldata; i++)
+  {
+    failure += SUNRCompareTol(xdata[i], ydata[i], tol);
+  }
+
+  if (failure > ZERO)
+  {
+    printf("Check_vector failures:\n");
+    for (i = 0; i < xldata; i++)
+    {
+      if (SUNRCompareTol(xdata[i], ydata[i], tol) != 0)
+      {
+        printf("  xdata[%ld] = %" GSYM " != %" GSYM " (err = %" GSYM ")\n",
+               (long int)i, xdata[i], ydata[i], SUNRabs(xdata[i] - ydata[i]));
+      }
+    }
+  }
+
+  if (failure > ZERO) { return (1); }
+  else { return (0); }
+}
+
+sunbooleantype has_data(SUNMatrix A)
+{
+  sunrealtype* Adata = SUNBSRMatrix_Data(A);
+  if (Adata == NULL) { return SUNFALSE; }
+  else { return SUNTRUE; }
+}
+
+sunbooleantype is_square(SUNMatrix A)
+{
+  if (SUNBSRMatrix_Rows(A) == SUNBSRMatrix_Columns(A)) { return SUNTRUE; }
+  else { return SUNFALSE; }
+}
+
+void sync_device(SUNMatrix A)
+{
+  /* not running on GPU, just return */
+  return;
+}
@@ -32,8 +32,13 @@
 int Test_SUNMatScaleAdd2(SUNMatrix A, SUNMatrix B, N_Vector x, N_Vector y,
                          N_Vector z);
 int Test_SUNMatScaleAddI2(SUNMatrix A, N_Vector x, N_Vector y);
+int Test_SUNMatScaleAddRepeat(SUNMatrix A, SUNMatrix B, N_Vector x, N_Vector y,
+                              N_Vector z, int square);
 int Test_SUNSparseMatrixToCSC(SUNMatrix A);
 int Test_SUNSparseMatrixToCSR(SUNMatrix A);
+int Test_SUNSparseMatrixSELL(SUNMatrix A, N_Vector x, N_Vector y);
+int Test_SUNSparseMatrixColumnColoring(SUNMatrix A);
+int Test_SUNSparseMatrixTriplets(SUNMatrix A, N_Vector x, N_Vector y);
 
 /* ----------------------------------------------------------------------
  * Main SUNMatrix Testing Routine
@@ -50,7 +55,7 @@ int main(int argc, char* argv[])
   sunindextype i, j, k, kstart, kend, N, uband, lband;
   sunindextype *colptrs, *rowindices;
   sunindextype *rowptrs, *colindices;
-  int print_timing, square;
+  int print_timing, square, nthreads, sell;
   SUNContext sunctx;
 
   if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
@@ -92,9 +97,16 @@ int main(int argc, char* argv[])
   print_timing = atoi(argv[4]);
   SetTiming(print_timing);
 
+  nthreads = 1;
+  if (argc >= 6) { nthreads = atoi(argv[5]); }
+
+  sell = 0;
+  if (argc >= 7) { sell = atoi(argv[6]); }
+
   square = (matrows == matcols) ? 1 : 0;
-  printf("\nSparse matrix test: size %ld by %ld, type = %i\n\n",
-         (long int)matrows, (long int)matcols, mattype);
+  printf("\nSparse matrix test: size %ld by %ld, type = %i, threads = %i, "
+         "SELL matvec = %i\n\n",
+         (long int)matrows, (long int)matcols, mattype, nthreads, sell);
 
   /* Initialize vectors and matrices to NULL */
   x  = NULL;
@@ -421,6 +433,17 @@ int main(int argc, char* argv[])
   AT = SUNSparseFromDenseMatrix(CT, ZERO, mattype);
   B  = SUNSparseFromDenseMatrix(D, ZERO, mattype);
 
+  fails += SUNSparseMatrix_SetNumThreads(A, nthreads);
+  fails += SUNSparseMatrix_SetNumThreads(AT, nthreads);
+  fails += SUNSparseMatrix_SetNumThreads(B, nthreads);
+  if (square) { fails += SUNSparseMatrix_SetNumThreads(I, nthreads); }
+
+  if (sell)
+  {
+    fails += SUNSparseMatrix_SetMatvecSELL(A, SUNTRUE, 0);
+    fails += SUNSparseMatrix_SetMatvecSELL(B, SUNTRUE, 0);
+  }
+
   /* Create vectors and fill */
   x       = N_VNew_Serial(matcols, sunctx);
   y       = N_VNew_Serial(matrows, sunctx);
@@ -469,7 +492,11 @@ int main(int argc, char* argv[])
     fails += Test_SUNMatScaleAddI(A, I, 0);
     fails += Test_SUNMatScaleAddI2(A, x, y);
   }
+  fails += Test_SUNMatScaleAddRepeat(A, B, x, y, z, square);
   fails += Test_SUNMatMatvec(A, x, y, 0);
+  fails += Test_SUNSparseMatrixSELL(A, x, y);
+  fails += Test_SUNSparseMatrixColumnColoring(A);
+  fails += Test_SUNSparseMatrixTriplets(A, x, y);
   fails += Test_SUNMatHermitianTransposeVec(A, AT, x, y, 0);
   fails += Test_SUNMatSpace(A, 0);
   if (mattype == CSR_MAT) { fails += Test_SUNSparseMatrixToCSC(A); }
@@ -910,6 +937,87 @@ int Test_SUNMatScaleAddI2(SUNMatrix A, N_Vector x, N_Vector y)
   return (0);
 }
 
+/* ----------------------------------------------------------------------
+ * Repeated ScaleAdd and ScaleAddI tests for sparse matrices, where the
+ * calls after the first reuse the cached merge of the sparsity patterns:
+ *    y should already equal A*x
+ *    z should already equal B*x
+ * --------------------------------------------------------------------*/
+int Test_SUNMatScaleAddRepeat(SUNMatrix A, SUNMatrix B, N_Vector x, N_Vector y,
+                              N_Vector z, int square)
+{
+  int failure, k;
+  long int lenrw, leniw;
+  SUNMatrix C;
+  N_Vector u, v;
+  sunrealtype tol = 200 * SUN_UNIT_ROUNDOFF;
+
+  /* create clones for test */
+  C = SUNMatClone(A);
+  u = N_VClone(y);
+  v = N_VClone(y);
+
+  for (k = 1; k <= 3; k++)
+  {
+    /* C = k A + B */
+    failure = SUNMatCopy(A, C);
+    if (!failure) { failure = SUNMatScaleAdd((sunrealtype)k, C, B); }
+    if (!failure) { failure = SUNMatMatvec(C, x, u); }
+    if (!failure)
+    {
+      N_VLinearSum((sunrealtype)k, y, ONE, z, v); /* v = k y + z */
+      failure = check_vector(u, v, tol);
+    }
+    if (failure)
+    {
+      printf(">>> FAILED test -- SUNMatScaleAddRepeat ScaleAdd call %d \n", k);
+      SUNMatDestroy(C);
+      N_VDestroy(u);
+      N_VDestroy(v);
+      return (1);
+    }
+
+    if (!square) { continue; }
+
+    /* C = I - k A */
+    failure = SUNMatCopy(A, C);
+    if (!failure) { failure = SUNMatScaleAddI(-(sunrealtype)k, C); }
+    if (!failure) { failure = SUNMatMatvec(C, x, u); }
+    if (!failure)
+    {
+      N_VLinearSum(ONE, x, -(sunrealtype)k, y, v); /* v = x - k y */
+      failure = check_vector(u, v, tol);
+    }
+    if (failure)
+    {
+      printf(">>> FAILED test -- SUNMatScaleAddRepeat ScaleAddI call %d \n", k);
+      SUNMatDestroy(C);
+      N_VDestroy(u);
+      N_VDestroy(v);
+      return (1);
+    }
+  }
+
+  /* the cached merges are counted in the integer workspace */
+  failure = SUNMatSpace(C, &lenrw, &leniw);
+  if (failure || leniw <= 10 + SM_NP_S(C) + SM_NNZ_S(C))
+  {
+    printf(">>> FAILED test -- SUNMatScaleAddRepeat, leniw = %ld \n", leniw);
+    SUNMatDestroy(C);
+    N_VDestroy(u);
+    N_VDestroy(v);
+    return (1);
+  }
+
+  printf("    PASSED test -- SUNMatScaleAddRepeat \n");
+
+  SUNMatDestroy(C);
+  N_VDestroy(u);
+  N_VDestroy(v);
+
+  return (0);
+}
+
 int Test_SUNSparseMatrixToCSR(SUNMatrix A)
 {
   int failure;
@@ -990,6 +1098,264 @@ int Test_SUNSparseMatrixToCSC(SUNMatrix A)
   return (0);
 }
 
+/* ----------------------------------------------------------------------
+ * SELL-C-sigma matvec test:
+ *    y should already equal A*x
+ *    the product is checked for several sorting windows, after changing
+ *      the entries directly followed by SUNMatMatvecSetup, and after
+ *      disabling the SELL-C-sigma copy
+ * --------------------------------------------------------------------*/
+int Test_SUNSparseMatrixSELL(SUNMatrix A, N_Vector x, N_Vector y)
+{
+  int failure, k;
+  SUNMatrix C;
+  N_Vector u, v;
+  sunindextype i;
+  sunrealtype* Cdata;
+  sunrealtype tol = 100 * SUN_UNIT_ROUNDOFF;
+  sunindextype sigmas[4];
+
+  sigmas[0] = 1;
+  sigmas[1] = 3;
+  sigmas[2] = 0;
+  sigmas[3] = SUNSparseMatrix_Rows(A) + 1;
+
+  /* create clones for test */
+  C = SUNMatClone(A);
+  u = N_VClone(y);
+  v = N_VClone(y);
+
+  failure = SUNMatCopy(A, C);
+
+  /* test 1: products with several sorting windows */
+  for (k = 0; k < 4 && !failure; k++)
+  {
+    failure = SUNSparseMatrix_SetMatvecSELL(C, SUNTRUE, sigmas[k]);
+    if (!failure) { failure = SUNMatMatvec(C, x, u); }
+    if (!failure) { failure = check_vector(u, y, tol); }
+    if (failure)
+    {
+      printf(">>> FAILED test -- SUNSparseMatrixSELL sigma %ld \n",
+             (long int)sigmas[k]);
+    }
+  }
+
+  /* test 2: change the entries directly and refresh the copy */
+  if (!failure)
+  {
+    Cdata = SUNSparseMatrix_Data(C);
+    for (i = 0; i < SUNSparseMatrix_NNZ(C); i++) { Cdata[i] *= TWO; }
+    failure = SUNMatMatvecSetup(C);
+    if (!failure) { failure = SUNMatMatvec(C, x, u); }
+    if (!failure)
+    {
+      N_VScale(TWO, y, v);
+      failure = check_vector(u, v, tol);
+    }
+    if (failure)
+    {
+      printf(">>> FAILED test -- SUNSparseMatrixSELL after SUNMatMatvecSetup "
+             "\n");
+    }
+  }
+
+  /* test 3: disable the copy */
+  if (!failure)
+  {
+    failure = SUNSparseMatrix_SetMatvecSELL(C, SUNFALSE, 0);
+    if (!failure) { failure = SUNMatMatvec(C, x, u); }
+    if (!failure) { failure = check_vector(u, v, tol); }
+    if (failure)
+    {
+      printf(">>> FAILED test -- SUNSparseMatrixSELL disabled \n");
+    }
+  }
+
+  SUNMatDestroy(C);
+  N_VDestroy(u);
+  N_VDestroy(v);
+
+  if (failure) { return (1); }
+
+  printf("    PASSED test -- SUNSparseMatrixSELL \n");
+
+  return (0);
+}
+
+/* ----------------------------------------------------------------------
+ * Column coloring test:
+ *    every column gets a color in [0, ncolors) and the columns with
+ *    nonzeros in the same row all have different colors
+ * --------------------------------------------------------------------*/
+int Test_SUNSparseMatrixColumnColoring(SUNMatrix A)
+{
+  int failure;
+  SUNMatrix csr = NULL;
+  sunindextype i, j, p, N, ncolors;
+  sunindextype *colors, *seen, *rowptrs, *colvals;
+
+  N      = SUNSparseMatrix_Columns(A);
+  colors = (sunindextype*)malloc(N * sizeof(sunindextype));
+  seen   = (sunindextype*)malloc(N * sizeof(sunindextype));
+
+  failure = SUNSparseMatrix_ColumnColoring(A, colors, &ncolors);
+  if (failure)
+  {
+    printf(">>> FAILED test -- SUNSparseMatrix_ColumnColoring returned "
+           "nonzero\n");
+  }
+
+  /* check the color range */
+  for (j = 0; j < N && !failure; j++)
+  {
+    if (colors[j] < 0 || colors[j] >= ncolors)
+    {
+      printf(">>> FAILED test -- SUNSparseMatrixColumnColoring column %ld has "
+             "color %ld\n",
+             (long int)j, (long int)colors[j]);
+      failure = 1;
+    }
+  }
+
+  /* check that no two columns of a row share a color */
+  if (!failure) { failure = SUNSparseMatrix_ToCSR(A, &csr); }
+  if (!failure)
+  {
+    rowptrs = SUNSparseMatrix_IndexPointers(csr);
+    colvals = SUNSparseMatrix_IndexValues(csr);
+    for (j = 0; j < N; j++) { seen[j] = -1; }
+    for (i = 0; i < SUNSparseMatrix_Rows(csr) && !failure; i++)
+    {
+      for (p = rowptrs[i]; p < rowptrs[i + 1]; p++)
+      {
+        if (seen[colors[colvals[p]]] == i)
+        {
+          printf(">>> FAILED test -- SUNSparseMatrixColumnColoring row %ld "
+                 "has two columns with color %ld\n",
+                 (long int)i, (long int)colors[colvals[p]]);
+          failure = 1;
+          break;
+        }
+        seen[colors[colvals[p]]] = i;
+      }
+    }
+  }
+
+  SUNMatDestroy(csr);
+  free(colors);
+  free(seen);
+
+  if (failure) { return (1); }
+
+  printf("    PASSED test -- SUNSparseMatrixColumnColoring (%ld colors)\n",
+         (long int)ncolors);
+
+  return (0);
+}
+
+/* ----------------------------------------------------------------------
+ * Triplet assembly test:
+ *    each entry of A is split into two triplets, listed in reverse
+ *    order, and the assembled matrix must equal A; the matrix is then
+ *    zeroed and assembled again with doubled values using the cached
+ *    map, and the product is checked
+ * --------------------------------------------------------------------*/
+int Test_SUNSparseMatrixTriplets(SUNMatrix A, N_Vector x, N_Vector y)
+{
+  int failure;
+  SUNMatrix C;
+  N_Vector u, v;
+  sunindextype i, p, k, nnz, ntrip;
+  sunindextype *Ap, *Ai, *rows, *cols;
+  sunrealtype *Ax, *vals;
+  sunrealtype tol = 100 * SUN_UNIT_ROUNDOFF;
+
+  Ap    = SUNSparseMatrix_IndexPointers(A);
+  Ai    = SUNSparseMatrix_IndexValues(A);
+  Ax    = SUNSparseMatrix_Data(A);
+  nnz   = Ap[SUNSparseMatrix_NP(A)];
+  ntrip = 2 * nnz;
+
+  rows = (sunindextype*)malloc(ntrip * sizeof(sunindextype));
+  cols = (sunindextype*)malloc(ntrip * sizeof(sunindextype));
+  vals = (sunrealtype*)malloc(ntrip * sizeof(sunrealtype));
+
+  /* split each entry in two, the second halves after all first halves */
+  k = 0;
+  for (i = SUNSparseMatrix_NP(A) - 1; i >= 0; i--)
+  {
+    for (p = Ap[i + 1] - 1; p >= Ap[i]; p--)
+    {
+      if (SUNSparseMatrix_SparseType(A) == CSC_MAT)
+      {
+        rows[k] = Ai[p];
+        cols[k] = i;
+      }
+      else
+      {
+        rows[k] = i;
+        cols[k] = Ai[p];
+      }
+      rows[k + nnz] = rows[k];
+      cols[k + nnz] = cols[k];
+      vals[k]       = SUN_RCONST(0.25) * Ax[p];
+      vals[k + nnz] = SUN_RCONST(0.75) * Ax[p];
+      k++;
+    }
+  }
+
+  /* start with too little storage so the pattern has to grow */
+  C = SUNSparseMatrix(SUNSparseMatrix_Rows(A), SUNSparseMatrix_Columns(A), 1,
+                      SUNSparseMatrix_SparseType(A), A->sunctx);
+  u = N_VClone(y);
+  v = N_VClone(y);
+
+  failure = SUNSparseMatrix_SetNumThreads(C, SM_NTHREADS_S(A));
+
+  /* test 1: the assembled matrix equals A */
+  if (!failure)
+  {
+    failure = SUNSparseMatrix_SetTripletPattern(C, ntrip, rows, cols);
+  }
+  if (!failure) { failure = SUNSparseMatrix_AssembleTriplets(C, vals); }
+  if (!failure) { failure = check_matrix(C, A, tol); }
+  if (failure)
+  {
+    printf(">>> FAILED test -- SUNSparseMatrixTriplets assembly \n");
+  }
+
+  /* test 2: reuse the map after zeroing the matrix */
+  if (!failure)
+  {
+    for (k = 0; k < ntrip; k++) { vals[k] *= TWO; }
+    failure = SUNMatZero(C);
+    if (!failure) { failure = SUNSparseMatrix_AssembleTriplets(C, vals); }
+    if (!failure) { failure = SUNMatMatvec(C, x, u); }
+    if (!failure)
+    {
+      N_VScale(TWO, y, v);
+      failure = check_vector(u, v, tol);
+    }
+    if (failure)
+    {
+      printf(">>> FAILED test -- SUNSparseMatrixTriplets reassembly \n");
+    }
+  }
+
+  SUNMatDestroy(C);
+  N_VDestroy(u);
+  N_VDestroy(v);
+  free(rows);
+  free(cols);
+  free(vals);
+
+  if (failure) { return (1); }
+
+  printf("    PASSED test -- SUNSparseMatrixTriplets \n");
+
+  return (0);
+}
+
 /* ----------------------------------------------------------------------
  * Check matrix
  * --------------------------------------------------------------------*/
@@ -0,0 +1,340 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Shared fixture for the unit tests of the sparse difference quotient Jacobian
+ * set up with the SetJacSparsity functions of CVODE, ARKODE, IDA, and KINSOL.
+ * The problems are linear in y with the Jacobian J tridiagonal plus the two
+ * corner entries,
+ *
+ *   (J y)_i = y_{i-1} - 4 y_i + 2 y_{i+1},
+ *   (J y)_0 += y_{N-1} / 2,  (J y)_{N-1} += 2 y_0,
+ *
+ * so the difference quotients reproduce J up to roundoff. The pattern of J is
+ * symmetric but its entries are not, so entries stored in the wrong position
+ * are detected. Each package test provides a solve function that sets up the
+ * package with the given system matrix, pattern, and linear solver, solves its
+ * problem, and checks the saved Jacobian and the number of function
+ * evaluations with check_sparsedq. The solve function is run with CSC and CSR
+ * system matrices and patterns. The sparse system is solved by copying it into
+ * a dense matrix.
+ * ---------------------------------------------------------------------------*/
+
+#ifndef _TEST_SPARSEDQ_H
+#define _TEST_SPARSEDQ_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+#include "sunmatrix/sunmatrix_sparse.h"
+
+#define NEQ 50
+#define NNZ (3 * NEQ)
+
+#define ZERO SUN_RCONST(0.0)
+#define HALF SUN_RCONST(0.5)
+#define ONE  SUN_RCONST(1.0)
+#define TWO  SUN_RCONST(2.0)
+#define FOUR SUN_RCONST(4.0)
+
+/* Sets up and solves the package problem, returns the number of failures */
+typedef int (*SparseDQSolveFn)(SUNMatrix A, SUNMatrix S, SUNLinearSolver LS,
+                               sunindextype ncolors, SUNContext sunctx);
+
+/* Entry (i, j) of the Jacobian */
+static sunrealtype jac_entry(sunindextype i, sunindextype j)
+{
+  if (i == j) { return -FOUR; }
+  if (i - j == 1) { return ONE; }
+  if (j - i == 1) { return TWO; }
+  if (i == 0 && j == NEQ - 1) { return HALF; }
+  if (i == NEQ - 1 && j == 0) { return TWO; }
+  return ZERO;
+}
+
+/* Product r = J y */
+static void jac_times(N_Vector y, N_Vector r_vec)
+{
+  sunindextype i;
+  sunrealtype* u = N_VGetArrayPointer(y);
+  sunrealtype* r = N_VGetArrayPointer(r_vec);
+
+  for (i = 0; i < NEQ; i++)
+  {
+    r[i] = -FOUR * u[i];
+    if (i > 0) { r[i] += u[i - 1]; }
+    if (i < NEQ - 1) { r[i] += TWO * u[i + 1]; }
+  }
+  r[0] += HALF * u[NEQ - 1];
+  r[NEQ - 1] += TWO * u[0];
+}
+
+/* Fill S with the pattern of the Jacobian */
+static void fill_pattern(SUNMatrix S)
+{
+  sunindextype k, l, nnz;
+  sunindextype* ptrs = SUNSparseMatrix_IndexPointers(S);
+  sunindextype* idx  = SUNSparseMatrix_IndexValues(S);
+  sunrealtype* data  = SUNSparseMatrix_Data(S);
+
+  /* the pattern is symmetric, so a row and a column have the same indices */
+  nnz = 0;
+  for (k = 0; k < NEQ; k++)
+  {
+    ptrs[k] = nnz;
+    for (l = 0; l < NEQ; l++)
+    {
+      if (jac_entry(k, l) != ZERO)
+      {
+        idx[nnz]  = l;
+        data[nnz] = ONE;
+        nnz++;
+      }
+    }
+  }
+  ptrs[NEQ] = nnz;
+}
+
+/* Check that Jac holds alpha I + beta J and that each of the nje Jacobian
+   evaluations called the function once per color */
+static int check_sparsedq(SUNMatrix Jac, sunrealtype alpha, sunrealtype beta,
+                          long int nje, long int nfe, sunindextype ncolors)
+{
+  sunindextype k, p, row, col;
+  sunindextype* ptrs = SUNSparseMatrix_IndexPointers(Jac);
+  sunindextype* idx  = SUNSparseMatrix_IndexValues(Jac);
+  sunrealtype* data  = SUNSparseMatrix_Data(Jac);
+  sunrealtype tol    = SUN_RCONST(1.0e-6) * (ONE + SUNRabs(alpha));
+  sunrealtype expected;
+
+  if (nje < 1 || nfe != nje * ncolors)
+  {
+    fprintf(stderr,
+            "%ld function evaluations for %ld Jacobians, expected %ld\n", nfe,
+            nje, nje * (long int)ncolors);
+    return 1;
+  }
+
+  if (ptrs[NEQ] != NNZ)
+  {
+    fprintf(stderr, "Jacobian has %ld entries, expected %d\n",
+            (long int)ptrs[NEQ], NNZ);
+    return 1;
+  }
+
+  for (k = 0; k < NEQ; k++)
+  {
+    for (p = ptrs[k]; p < ptrs[k + 1]; p++)
+    {
+      row      = (SUNSparseMatrix_SparseType(Jac) == CSC_MAT) ? idx[p] : k;
+      col      = (SUNSparseMatrix_SparseType(Jac) == CSC_MAT) ? k : idx[p];
+      expected = beta * jac_entry(row, col);
+      if (row == col) { expected += alpha; }
+      if (jac_entry(row, col) == ZERO || SUNRabs(data[p] - expected) > tol)
+      {
+        fprintf(stderr, "Jacobian entry (%ld, %ld) is %g, expected %g\n",
+                (long int)row, (long int)col, (double)data[p],
+                (double)expected);
+        return 1;
+      }
+    }
+  }
+
+  return 0;
+}
+
+/* -----------------------------------------------------------------------------
+ * Direct linear solver that copies the sparse matrix into a dense matrix and
+ * uses the dense linear solver
+ * ---------------------------------------------------------------------------*/
+
+typedef struct
+{
+  SUNMatrix D;
+  SUNLinearSolver LS;
+} DenseCopyContent;
+
+static SUNLinearSolver_Type DenseCopyGetType(SUNLinearSolver S)
+{
+  return SUNLINEARSOLVER_DIRECT;
+}
+
+static int DenseCopySetup(SUNLinearSolver S, SUNMatrix A)
+{
+  sunindextype k, p;
+  DenseCopyContent* content = (DenseCopyContent*)S->content;
+  sunindextype* ptrs        = SUNSparseMatrix_IndexPointers(A);
+  sunindextype* idx         = SUNSparseMatrix_IndexValues(A);
+  sunrealtype* data         = SUNSparseMatrix_Data(A);
+
+  SUNMatZero(content->D);
+  for (k = 0; k < NEQ; k++)
+  {
+    for (p = ptrs[k]; p < ptrs[k + 1]; p++)
+    {
+      if (SUNSparseMatrix_SparseType(A) == CSC_MAT)
+      {
+        SM_ELEMENT_D(content->D, idx[p], k) = data[p];
+      }
+      else { SM_ELEMENT_D(content->D, k, idx[p]) = data[p]; }
+    }
+  }
+
+  return SUNLinSolSetup(content->LS, content->D);
+}
+
+static int DenseCopySolve(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                          N_Vector b, sunrealtype tol)
+{
+  DenseCopyContent* content = (DenseCopyContent*)S->content;
+  return SUNLinSolSolve(content->LS, content->D, x, b, tol);
+}
+
+static SUNErrCode DenseCopyFree(SUNLinearSolver S)
+{
+  DenseCopyContent* content = (DenseCopyContent*)S->content;
+  SUNLinSolFree(content->LS);
+  SUNMatDestroy(content->D);
+  free(content);
+  S->content = NULL;
+  SUNLinSolFreeEmpty(S);
+  return SUN_SUCCESS;
+}
+
+static SUNLinearSolver DenseCopy(N_Vector y, SUNContext sunctx)
+{
+  SUNLinearSolver S;
+  DenseCopyContent* content;
+
+  S = SUNLinSolNewEmpty(sunctx);
+  if (!S) { return NULL; }
+
+  S->ops->gettype = DenseCopyGetType;
+  S->ops->setup   = DenseCopySetup;
+  S->ops->solve   = DenseCopySolve;
+  S->ops->free    = DenseCopyFree;
+
+  content = (DenseCopyContent*)malloc(sizeof(DenseCopyContent));
+  if (!content)
+  {
+    SUNLinSolFreeEmpty(S);
+    return NULL;
+  }
+  S->content = content;
+
+  content->D  = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  content->LS = content->D ? SUNLinSol_Dense(y, content->D, sunctx) : NULL;
+  if (!content->LS)
+  {
+    DenseCopyFree(S);
+    return NULL;
+  }
+
+  return S;
+}
+
+/* -----------------------------------------------------------------------------
+ * Create the system matrix, pattern, and linear solver, color the pattern, and
+ * call solve
+ * ---------------------------------------------------------------------------*/
+static int run_sparsedq_test(SparseDQSolveFn solve, int matrixtype,
+                             int patterntype, SUNContext sunctx)
+{
+  int retval          = 0;
+  int fails           = 0;
+  N_Vector y          = NULL;
+  SUNMatrix A         = NULL;
+  SUNMatrix S         = NULL;
+  SUNLinearSolver LS  = NULL;
+  sunindextype* color = NULL;
+  sunindextype ncolors;
+
+  y     = N_VNew_Serial(NEQ, sunctx);
+  A     = SUNSparseMatrix(NEQ, NEQ, NNZ, matrixtype, sunctx);
+  S     = SUNSparseMatrix(NEQ, NEQ, NNZ, patterntype, sunctx);
+  LS    = (y) ? DenseCopy(y, sunctx) : NULL;
+  color = (sunindextype*)malloc(NEQ * sizeof(sunindextype));
+  if (!y || !A || !S || !LS || !color)
+  {
+    fprintf(stderr, "Creating the vectors, matrices, or solver failed\n");
+    fails++;
+  }
+
+  if (!fails)
+  {
+    fill_pattern(S);
+    retval = SUNSparseMatrix_ColumnColoring(S, color, &ncolors);
+    if (retval)
+    {
+      fprintf(stderr, "SUNSparseMatrix_ColumnColoring returned %i\n", retval);
+      fails++;
+    }
+  }
+
+  if (!fails) { fails += solve(A, S, LS, ncolors, sunctx); }
+
+  if (fails)
+  {
+    fprintf(stderr, "FAILED: matrix type %d, pattern type %d\n", matrixtype,
+            patterntype);
+  }
+  else
+  {
+    printf("PASSED: matrix type %d, pattern type %d, %ld colors\n",
+           matrixtype, patterntype, (long int)ncolors);
+  }
+
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  SUNMatDestroy(S);
+  N_VDestroy(y);
+  free(color);
+
+  return fails;
+}
+
+/* Run solve with CSC and CSR system matrices and patterns */
+static int run_sparsedq_tests(SparseDQSolveFn solve)
+{
+  int retval        = 0;
+  int fails         = 0;
+  SUNContext sunctx = NULL;
+  int matrixtype, patterntype;
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  for (matrixtype = CSC_MAT; matrixtype <= CSR_MAT; matrixtype++)
+  {
+    for (patterntype = CSC_MAT; patterntype <= CSR_MAT; patterntype++)
+    {
+      fails += run_sparsedq_test(solve, matrixtype, patterntype, sunctx);
+    }
+  }
+
+  SUNContext_Free(&sunctx);
+
+  if (fails) { return 1; }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+#endif